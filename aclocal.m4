@@ -1195,6 +1195,7 @@ m4_include([m4/ax_arg_enable_efence.m4])
 m4_include([m4/ax_arg_enable_warnings.m4])
 m4_include([m4/ax_arg_ioloop_mechanism.m4])
 m4_include([m4/ax_arg_with_tls.m4])
+m4_include([m4/ax_arg_with_zlib.m4])
 m4_include([m4/ax_check_compile_flag.m4])
 m4_include([m4/ax_define_dir.m4])
 m4_include([m4/ax_gcc_stack_protect.m4])
@@ -0,0 +1,188 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file address_ntop_test.c
+ * \brief Checks address_ntop() against getnameinfo() and times both.
+ * \version $Id$
+ *
+ * Usage: address_ntop_test [IPv6 address count]
+ *
+ * Formats every 251st IPv4 address, a list of IPv6 edge cases and the
+ * given number of random IPv6 addresses (default 4000000) both ways and
+ * reports any difference. The random addresses are heavy on zero words,
+ * so that zero runs of every length and position come up, and on the
+ * forms inet_ntop() prints with an embedded IPv4 address.
+ */
+
+#include "stdinc.h"
+#include "irc_string.h"
+
+
+static unsigned long checked, mismatches;
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+reference(int family, const void *addr, char *buf, size_t size)
+{
+  struct sockaddr_storage ss = { .ss_family = family };
+  socklen_t len;
+
+  if (family == AF_INET)
+  {
+    memcpy(&((struct sockaddr_in *)&ss)->sin_addr, addr, 4);
+    len = sizeof(struct sockaddr_in);
+  }
+  else
+  {
+    memcpy(&((struct sockaddr_in6 *)&ss)->sin6_addr, addr, 16);
+    len = sizeof(struct sockaddr_in6);
+  }
+
+  if (getnameinfo((struct sockaddr *)&ss, len, buf, size, NULL, 0, NI_NUMERICHOST))
+    strlcpy(buf, "(getnameinfo failed)", size);
+}
+
+static void
+check(int family, const void *addr)
+{
+  char ours[INET6_ADDRSTRLEN], theirs[NI_MAXHOST];
+  const size_t len = address_ntop(family, addr, ours);
+
+  reference(family, addr, theirs, sizeof(theirs));
+  ++checked;
+
+  if (strcmp(ours, theirs) || len != strlen(ours))
+    if (++mismatches <= 10)
+      printf("mismatch: address_ntop() \"%s\" (%zu), getnameinfo() \"%s\"\n", ours, len, theirs);
+}
+
+static void
+check6(const char *text)
+{
+  unsigned char addr[16];
+
+  if (inet_pton(AF_INET6, text, addr) != 1)
+  {
+    printf("bad test address %s\n", text);
+    exit(EXIT_FAILURE);
+  }
+
+  check(AF_INET6, addr);
+}
+
+int
+main(int argc, char *argv[])
+{
+  static const char *const edge[] =
+  {
+    "::", "::1", "1::", "::ffff:0.0.0.0", "::ffff:1.2.3.4", "::1.2.3.4", "::0.0.1.0",
+    "::ffff:0:1.2.3.4", "::fffe:1.2.3.4", "0:0:0:0:0:1:1.2.3.4", "1:0:0:0:0:0:0:1",
+    "1:0::1:0:0:1", "1:0:0:1:0:0:0:1", "0:1:0:1:0:1:0:1", "1:0:1:0:1:0:1:0",
+    "2001:db8::", "2001:db8:0:0:1::", "fe80::1", "ff02::1:ff00:1",
+    "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "64:ff9b::1.2.3.4", "::ffff:255.255.255.255"
+  };
+  const unsigned long count6 = argc > 1 ? strtoul(argv[1], NULL, 10) : 4000000;
+  char buf[NI_MAXHOST];
+
+  for (uint64_t i = 0; i < UINT64_C(1) << 32; i += 251)
+  {
+    const uint32_t addr = htonl((uint32_t)i);
+    check(AF_INET, &addr);
+  }
+
+  for (unsigned int i = 0; i < sizeof(edge) / sizeof(edge[0]); ++i)
+    check6(edge[i]);
+
+  srand(1);
+
+  for (unsigned long n = 0; n < count6; ++n)
+  {
+    unsigned char addr[16];
+
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      unsigned int word;
+
+      switch (rand() & 3)
+      {
+        case 0: word = rand() & 0xffff; break;
+        case 1: word = 0; break;
+        case 2: word = rand() & 0xf; break;
+        default: word = 0xffff; break;
+      }
+
+      addr[i * 2] = word >> 8;
+      addr[i * 2 + 1] = word & 0xff;
+    }
+
+    /* Every fifth one is a mapped, compatible or nearly so address */
+    if (n % 5 == 0)
+    {
+      memset(addr, 0, 10);
+      if (rand() & 1)
+        addr[10] = addr[11] = 0xff;
+      else if (rand() & 1)
+        addr[10] = addr[11] = 0;
+    }
+
+    check(AF_INET6, addr);
+  }
+
+  printf("%lu addresses checked, %lu mismatches\n", checked, mismatches);
+
+  enum { ROUNDS = 2000000 };
+  static const char *const timed[] = { "192.168.100.200", "2001:db8:1234::5678:9abc" };
+
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    const int family = i ? AF_INET6 : AF_INET;
+    unsigned char addr[16];
+    volatile size_t sink = 0;
+
+    inet_pton(family, timed[i], addr);
+
+    double t = now();
+    for (unsigned int n = 0; n < ROUNDS; ++n)
+    {
+      reference(family, addr, buf, sizeof(buf));
+      sink += buf[0];
+    }
+    const double ref = now() - t;
+
+    t = now();
+    for (unsigned int n = 0; n < ROUNDS; ++n)
+      sink += address_ntop(family, addr, buf);
+    const double ours = now() - t;
+
+    printf("%s: getnameinfo() %.0f ns, address_ntop() %.0f ns\n", timed[i],
+           ref * 1e9 / ROUNDS, ours * 1e9 / ROUNDS);
+  }
+
+  return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,287 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file command_lookup_bench.c
+ * \brief Compares find_command() with the command trie it replaced.
+ * \version $Id$
+ *
+ * Usage: command_lookup_bench [lookups]
+ *
+ * Registers 96 command names with both mod_add_cmd() from parse.c and a
+ * copy of the trie parse.c used to keep commands in, and checks that both
+ * find the same command for every name and for a PRIVMSG-heavy mix that
+ * includes server tokens, lower-case and unknown commands. That is
+ * checked again after deleting every other command.
+ *
+ * Timings are taken for the mix with hot caches, and with caches evicted
+ * before every lookup, as happens between messages on a busy server.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "conf.h"
+#include "hash.h"
+#include "ircd.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "packet.h"
+#include "parse.h"
+#include "restart.h"
+#include "send.h"
+
+
+/* Whatever else parse.c refers to; none of it is reached by find_command() */
+struct Client me;
+struct config_serverhide_entry ConfigServerHide;
+struct ServerStatistics ServerStats;
+struct SetOptions GlobalSetOptions;
+uintmax_t send_sendq_bytes;
+
+void flood_endgrace(struct Client *client) { abort(); }
+struct Client *find_person(const struct Client *source, const char *name) { abort(); }
+const char *client_get_name(const struct Client *client, enum addr_mask_type type) { abort(); }
+struct Client *hash_find_id(const char *name) { abort(); }
+struct Client *hash_find_client(const char *name) { abort(); }
+struct Channel *hash_find_channel(const char *name) { abort(); }
+void sendto_one(struct Client *to, const char *pattern, ...) { abort(); }
+void sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numerics numeric, ...) { abort(); }
+void sendto_channel_butone(struct Client *one, const struct Client *from, struct Channel *channel,
+                           unsigned int type, const char *pattern, ...) { abort(); }
+void sendto_realops_flags(unsigned int flags, int level, int type, const char *pattern, ...) { abort(); }
+void server_die(const char *message, bool restart) { abort(); }
+
+
+/*
+ * The trie find_command() used to walk, as it was in parse.c: one node
+ * per character, indexed by the low five bits of the character
+ */
+enum { MAXPTRLEN = 32 };
+
+static struct MessageTree
+{
+  int links;  /* Count of all pointers (including msg) at this node */
+  struct Message *msg;
+  struct MessageTree *pointers[MAXPTRLEN];
+} msg_tree;
+
+static void
+trie_add_element(struct MessageTree *mtree_p, struct Message *msg_p, const char *cmd)
+{
+  if (*cmd == '\0')
+  {
+    mtree_p->msg = msg_p;
+    mtree_p->links++;
+    return;
+  }
+
+  struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
+  if (ntree_p == NULL)
+  {
+    ntree_p = xcalloc(sizeof(*ntree_p));
+    mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = ntree_p;
+    mtree_p->links++;
+  }
+
+  trie_add_element(ntree_p, msg_p, cmd + 1);
+}
+
+static void
+trie_del_element(struct MessageTree *mtree_p, const char *cmd)
+{
+  if (*cmd == '\0' && mtree_p->msg)
+  {
+    mtree_p->msg = NULL;
+    mtree_p->links--;
+    return;
+  }
+
+  struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
+  if (ntree_p)
+  {
+    trie_del_element(ntree_p, cmd + 1);
+
+    if (ntree_p->links == 0)
+    {
+      mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = NULL;
+      mtree_p->links--;
+      xfree(ntree_p);
+    }
+  }
+}
+
+static struct Message *
+trie_find(const char *cmd)
+{
+  struct MessageTree *mtree = &msg_tree;
+
+  while (IsAlpha(*cmd) && (mtree = mtree->pointers[*cmd & (MAXPTRLEN - 1)]))
+    if (*++cmd == '\0')
+      return mtree->msg;
+
+  return NULL;
+}
+
+static void
+trie_add(struct Message *msg)
+{
+  if (trie_find(msg->cmd) == NULL)
+    trie_add_element(&msg_tree, msg, msg->cmd);
+}
+
+static void
+trie_del(struct Message *msg)
+{
+  if (trie_find(msg->cmd))
+    trie_del_element(&msg_tree, msg->cmd);
+}
+
+
+static const char *const names[] =
+{
+  "ACCEPT", "ADMIN", "AWAY", "BMASK", "CAP", "CAPAB", "CERTFP", "CLOSE", "CONNECT", "DIE",
+  "DLINE", "ENCAP", "EOB", "ERROR", "ETRACE", "GET", "GLOBOPS", "HASH", "HELP", "INFO",
+  "INVITE", "ISON", "JOIN", "KICK", "KILL", "KLINE", "KNOCK", "LINKS", "LIST", "LOAD",
+  "LOCOPS", "LUSERS", "MAP", "METADATA", "MODE", "MODULE", "MONITOR", "MOTD", "NAMES", "NICK",
+  "NOTICE", "OPER", "OPME", "PART", "PASS", "PING", "PONG", "POST", "PRIVMSG", "PUT",
+  "QUIT", "REHASH", "RELOAD", "RESTART", "RESV", "SERVER", "SET", "SID", "SJOIN", "SQUIT",
+  "STATS", "SVINFO", "SVSACCOUNT", "SVSHOST", "SVSJOIN", "SVSKILL", "SVSMODE", "SVSNICK", "SVSPART", "SVSTAG",
+  "TBURST", "TIME", "TMODE", "TOPIC", "TRACE", "UID", "UNDLINE", "UNKLINE", "UNLOAD", "UNRESV",
+  "UNXLINE", "USER", "USERHOST", "VERSION", "WALLOPS", "WEBIRC", "WHO", "WHOIS", "WHOWAS", "XLINE",
+  "HEAD", "CHALLENGE", "RESPONSE", "USERIP", "WATCH", "SVSLOGIN"
+};
+
+static const char *const mix[] =
+{
+  "PRIVMSG", "PRIVMSG", "PRIVMSG", "PRIVMSG", "privmsg", "NOTICE", "PING", "PONG", "UID",
+  "SJOIN", "EOB", "TMODE", "JOIN", "PART", "QUIT", "MODE", "NICK", "WHO", "AWAY", "TOPIC",
+  "ENCAP", "ISON", "FOOBAR", "PRIVMSGX", "Privmsg", "SID"
+};
+
+enum
+{
+  NAMES = sizeof(names) / sizeof(names[0]),
+  MIX = sizeof(mix) / sizeof(mix[0]),
+  EVICT_SIZE = 16 << 20,
+  COLD_LOOKUPS = 200000
+};
+
+static struct Message msgs[NAMES];
+
+static bool
+consistent(void)
+{
+  bool ok = true;
+
+  for (unsigned int i = 0; i < NAMES; ++i)
+    if (find_command(names[i]) != trie_find(names[i]))
+    {
+      printf("mismatch for %s\n", names[i]);
+      ok = false;
+    }
+
+  for (unsigned int i = 0; i < MIX; ++i)
+    if (find_command(mix[i]) != trie_find(mix[i]))
+    {
+      printf("mismatch for %s\n", mix[i]);
+      ok = false;
+    }
+
+  return ok;
+}
+
+static double
+nsec(const struct timespec *a, const struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1e9 + (b->tv_nsec - a->tv_nsec);
+}
+
+int
+main(int argc, char *argv[])
+{
+  const unsigned long lookups = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000000;
+  volatile uintptr_t sink = 0;
+  struct timespec t0, t1;
+
+  for (unsigned int i = 0; i < NAMES; ++i)
+  {
+    msgs[i].cmd = names[i];
+    mod_add_cmd(&msgs[i]);
+    trie_add(&msgs[i]);
+  }
+
+  if (consistent() == false)
+    return EXIT_FAILURE;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (unsigned long i = 0; i < lookups; ++i)
+    sink += (uintptr_t)trie_find(mix[i % MIX]);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  const double trie = nsec(&t0, &t1) / lookups;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for (unsigned long i = 0; i < lookups; ++i)
+    sink += (uintptr_t)find_command(mix[i % MIX]);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  const double hash = nsec(&t0, &t1) / lookups;
+
+  printf("%lu lookups, hot caches: trie %.1f ns, hash table %.1f ns\n", lookups, trie, hash);
+
+  /*
+   * Pass 0 only evicts, to measure the clock and loop overhead that is
+   * then taken off the other two
+   */
+  char *const evict = xcalloc(EVICT_SIZE);
+  double total[3] = { 0, 0, 0 };
+
+  for (unsigned int pass = 0; pass < 3; ++pass)
+    for (unsigned int i = 0; i < COLD_LOOKUPS; ++i)
+    {
+      const char *const cmd = mix[(i * 2654435761U) % MIX];
+
+      for (unsigned int j = 0; j < EVICT_SIZE; j += 64 * 97)
+        sink += evict[(j + i * 64) % EVICT_SIZE];
+
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      if (pass == 1)
+        sink += (uintptr_t)trie_find(cmd);
+      else if (pass == 2)
+        sink += (uintptr_t)find_command(cmd);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+
+      total[pass] += nsec(&t0, &t1);
+    }
+
+  printf("%d lookups, caches evicted: trie %.1f ns, hash table %.1f ns\n", COLD_LOOKUPS,
+         (total[1] - total[0]) / COLD_LOOKUPS, (total[2] - total[0]) / COLD_LOOKUPS);
+
+  for (unsigned int i = 0; i < NAMES; i += 2)
+  {
+    mod_del_cmd(&msgs[i]);
+    trie_del(&msgs[i]);
+  }
+
+  if (consistent() == false)
+    return EXIT_FAILURE;
+
+  printf("results agree, also after deleting every other command\n");
+  return EXIT_SUCCESS;
+}
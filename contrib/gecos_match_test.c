@@ -0,0 +1,192 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file gecos_match_test.c
+ * \brief Checks gecos_match() against match() on every X-line, and times both.
+ * \version $Id$
+ *
+ * Usage: gecos_match_test [rounds]
+ *
+ * Each round (default 200000) adds or deletes a random X-line out of a
+ * pool of 400, then looks up a random realname. gecos_match() must find
+ * an X-line exactly when one of the live masks matches the realname, and
+ * the one it finds must match. Masks and realnames are drawn from a small
+ * alphabet with *, ? and \ escapes so that matches are frequent.
+ *
+ * Then 10000 realistic masks are matched against 5000 realnames, one in
+ * ten of which is caught by some mask, through the automaton and by
+ * calling match() on each mask in turn. Both must catch the same number of
+ * realnames, and deleting every mask must free every automaton node.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "irc_string.h"
+#include "conf_gecos.h"
+#include "hash.h"
+#include "restart.h"
+#include "send.h"
+
+
+enum { POOL = 400, MASKS = 10000, REALNAMES = 5000 };
+
+/* conf_gecos.c only uses these for expiry notices and rehashing */
+void
+sendto_realops_flags(unsigned int flags, int level, int type, const char *pattern, ...)
+{
+}
+
+void
+server_die(const char *message, bool restart)
+{
+  abort();
+}
+
+unsigned int
+strhash(const char *name)
+{
+  unsigned int hval = 2166136261U;
+
+  for (const unsigned char *p = (const unsigned char *)name; *p; ++p)
+    hval = (hval * 16777619U) ^ ToLower(*p);
+  return hval;
+}
+
+static void
+random_string(char *buf, unsigned int len, const char *alphabet)
+{
+  const size_t size = strlen(alphabet);
+
+  for (unsigned int i = 0; i < len; ++i)
+    buf[i] = alphabet[rand() % size];
+  buf[len] = '\0';
+}
+
+int
+main(int argc, char *argv[])
+{
+  static struct GecosItem *pool[POOL];
+  const unsigned long rounds = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+  unsigned long mismatches = 0;
+
+  srand(1);
+
+  for (unsigned long round = 0; round < rounds; ++round)
+  {
+    const unsigned int i = rand() % POOL;
+    char mask[8], info[16];
+
+    if (pool[i])
+    {
+      gecos_delete(pool[i], false);
+      pool[i] = NULL;
+    }
+    else
+    {
+      random_string(mask, 1 + rand() % 6, "abAB*?\\c ");
+
+      /* A trailing backslash escapes nothing */
+      if (mask[strlen(mask) - 1] == '\\')
+        mask[strlen(mask) - 1] = 'x';
+      pool[i] = gecos_make(mask);
+    }
+
+    random_string(info, rand() % 12, "abABc x");
+
+    const struct GecosItem *gecos = gecos_match(info);
+    bool expected = false;
+
+    for (unsigned int j = 0; j < POOL && expected == false; ++j)
+      if (pool[j] && match(pool[j]->mask, info) == 0)
+        expected = true;
+
+    if ((gecos != NULL) != expected || (gecos && match(gecos->mask, info)))
+      if (++mismatches <= 10)
+        printf("mismatch: realname \"%s\", gecos_match() found %s\n", info,
+               gecos ? gecos->mask : "nothing");
+  }
+
+  printf("%lu rounds, %lu mismatches\n", rounds, mismatches);
+
+  for (unsigned int i = 0; i < POOL; ++i)
+    if (pool[i])
+      gecos_delete(pool[i], false);
+
+  static char words[MASKS][12];
+  static char masks[MASKS][48];
+  static struct GecosItem *items[MASKS];
+  static char infos[REALNAMES][64];
+
+  for (unsigned int i = 0; i < MASKS; ++i)
+  {
+    random_string(words[i], 6 + rand() % 5, "abcdefghijklmnopqrstuvwxyz0123456789");
+    snprintf(masks[i], sizeof(masks[i]), (i % 3) ? "*%s*" : "*%s bot*", words[i]);
+    items[i] = gecos_make(masks[i]);
+  }
+
+  for (unsigned int i = 0; i < REALNAMES; ++i)
+  {
+    /* One realname in ten contains the literal part of some mask */
+    if (i % 10 == 0)
+    {
+      const unsigned int j = rand() % MASKS;
+      char prefix[5];
+
+      random_string(prefix, 4, "abcdefghijklmnopqrstuvwxyz ABCDEFG");
+      snprintf(infos[i], sizeof(infos[i]), "%s%s%s", prefix, words[j], (j % 3) ? "" : " bot");
+    }
+    else
+      random_string(infos[i], 10 + rand() % 30, "abcdefghijklmnopqrstuvwxyz ABCDEFG");
+  }
+
+  unsigned long hits = 0, hits_linear = 0;
+  clock_t t = clock();
+
+  for (unsigned int i = 0; i < REALNAMES; ++i)
+    hits += gecos_match(infos[i]) != NULL;
+
+  const double automaton = (double)(clock() - t) / CLOCKS_PER_SEC;
+  t = clock();
+
+  for (unsigned int i = 0; i < REALNAMES; ++i)
+    for (unsigned int j = 0; j < MASKS; ++j)
+      if (match(masks[j], infos[i]) == 0)
+      {
+        ++hits_linear;
+        break;
+      }
+
+  const double linear = (double)(clock() - t) / CLOCKS_PER_SEC;
+  unsigned int nodes;
+  size_t memory;
+
+  gecos_count_memory(&nodes, &memory);
+  printf("%d masks, %d realnames: automaton %.4f s (%lu hits), match() loop %.4f s (%lu hits), "
+         "%u nodes, %zu bytes\n", MASKS, REALNAMES, automaton, hits, linear, hits_linear, nodes, memory);
+
+  for (unsigned int i = 0; i < MASKS; ++i)
+    gecos_delete(items[i], false);
+
+  gecos_count_memory(&nodes, &memory);
+  printf("%u nodes left after deleting every mask\n", nodes);
+
+  return (mismatches || hits != hits_linear || nodes) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+#!/usr/bin/env bash
+#
+#  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+#
+#  Copyright (c) 2020 ircd-hybrid development team
+#
+#  This program is free software; you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation; either version 2 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; if not, write to the Free Software
+#  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+#  USA
+#
+
+# linktest.sh - links two local servers with compressed connect {} blocks
+# and checks that traffic crosses the link intact in both directions.
+#
+# Usage: linktest.sh <path to installed ircd binary> [base port]
+#
+# Uses four ports starting at the base port (default 16600), all on
+# 127.0.0.1. Must not be run as root, as ircd refuses to.
+#
+# Server a bursts CLIENTS clients (default 300) in one channel to b. Then
+# each direction carries LINES channel messages (default 2000) of varying
+# length, sent as fast as the server takes them, so that many lines share
+# a deflate batch and some batches are cut at the 16 KiB limit. Every message carries its sequence number and length and
+# is checked on the other side. STATS ? must report compression for the
+# link on both servers.
+
+IRCD=${1:?usage: $0 <path to ircd binary> [base port]}
+PORT=${2:-16600}
+LINES=${LINES:-2000}
+CLIENTS=${CLIENTS:-300}
+
+DIR=$(mktemp -d /tmp/linktest.XXXXXX) || exit 1
+FAILED=0
+
+cleanup()
+{
+  for s in a b; do
+    [ -f "$DIR/$s/ircd.pid" ] && kill "$(cat "$DIR/$s/ircd.pid")" 2>/dev/null
+  done
+  sleep 1
+  if [ $FAILED -eq 0 ]; then rm -rf "$DIR"; else echo "Logs kept in $DIR"; fi
+}
+trap cleanup EXIT
+
+fail()
+{
+  echo "FAIL: $*"
+  FAILED=1
+  exit 1
+}
+
+# write_conf <name> <sid> <client port> <server port> <peer name> <peer server port>
+write_conf()
+{
+  mkdir -p "$DIR/$1"
+  cat > "$DIR/$1/ircd.conf" <<EOF
+serverinfo { name = "$1.linktest"; sid = "$2"; description = "linktest"; network_name = "linktest"; network_description = "linktest"; hub = yes; default_max_clients = 1000; };
+admin { name = "linktest"; description = "linktest"; email = "linktest"; };
+class { name = "users"; ping_time = 90 seconds; number_per_ip_local = 1000; number_per_ip_global = 1000; max_number = 1000; sendq = 4 megabytes; recvq = 2560 bytes; number_per_cidr = 1000; };
+class { name = "server"; ping_time = 90 seconds; connectfreq = 2 seconds; max_number = 1; sendq = 4 megabytes; };
+listen { host = "127.0.0.1"; flags = client; port = $3; flags = server; port = $4; };
+auth { user = "*@*"; class = "users"; flags = exceed_limit, no_tilde, can_flood; };
+operator { name = "linktest"; user = "*@*"; password = "linktest"; encrypted = no; class = "users"; };
+connect { name = "$5.linktest"; host = "127.0.0.1"; port = $6; send_password = "linktest"; accept_password = "linktest"; encrypted = no; hub_mask = "*"; class = "server"; flags = autoconn, compressed; };
+general { throttle_count = 1000; throttle_time = 1 second; disable_auth = yes; ping_cookie = no; default_floodcount = 100000; anti_spam_exit_message_time = 0 seconds; };
+EOF
+}
+
+# start_server <name>
+start_server()
+{
+  local d="$DIR/$1"
+  (cd "$d" && "$IRCD" -configfile "$d/ircd.conf" -logfile "$d/ircd.log" -pidfile "$d/ircd.pid" \
+                      -klinefile "$d/k.db" -dlinefile "$d/d.db" -xlinefile "$d/x.db" \
+                      -resvfile "$d/r.db") > "$d/stdout" 2>&1 || fail "could not start $1, see $d/stdout"
+}
+
+# irc_open <var> <port> <nick>: opens a registered client connection, fd in var,
+# which must not be named fd
+irc_open()
+{
+  local fd line
+  exec {fd}<>"/dev/tcp/127.0.0.1/$2" || fail "cannot connect to port $2"
+  printf 'NICK %s\r\nUSER lt 0 * :linktest\r\n' "$3" >&$fd
+  # Generous, as every client waits for its DNS lookup to fail or time out
+  while read -r -t 60 -u $fd line; do
+    case "$line" in
+      *" 376 "*|*" 422 "*) printf -v "$1" '%s' "$fd"; return 0 ;;
+      PING*) printf 'PONG %s\r\n' "${line#PING }" >&$fd ;;
+    esac
+  done
+  fail "$3 could not register on port $2"
+}
+
+# irc_wait <fd> <pattern> [seconds]: reads until a line matches pattern
+irc_wait()
+{
+  local line
+  while read -r -t "${3:-10}" -u "$1" line; do
+    line=${line%$'\r'}
+    case "$line" in
+      $2) REPLY=$line; return 0 ;;
+    esac
+  done
+  return 1
+}
+
+# payload <n>: message n, between 1 and about 400 characters long
+payload()
+{
+  local len=$(( ($1 * 7919) % 400 + 1 )) body
+  printf -v body '%*s' "$len" ''
+  body=${body// /x$1}
+  printf '%s %s %s' "$1" "$len" "${body:0:$len}"
+}
+
+# flood <from port> <to port> <tag>
+flood()
+{
+  local src dst n i line
+  irc_open dst "$2" "rcv$3"
+  printf 'JOIN #linktest%s\r\n' "$3" >&$dst
+  irc_wait $dst "* 366 *" || fail "rcv$3 could not join"
+
+  irc_open src "$1" "snd$3"
+  printf 'JOIN #linktest%s\r\n' "$3" >&$src
+  irc_wait $src "* 366 *" || fail "snd$3 could not join"
+  irc_wait $dst ":snd$3!* JOIN *" || fail "JOIN of snd$3 did not cross the link"
+
+  for ((i = 1; i <= LINES; ++i)); do
+    printf 'PRIVMSG #linktest%s :%s\r\n' "$3" "$(payload $i)"
+  done >&$src
+
+  n=0
+  while ((n < LINES)) && read -r -t 20 -u $dst line; do
+    line=${line%$'\r'}
+    case "$line" in
+      *" PRIVMSG #linktest$3 :"*) ;;
+      PING*) printf 'PONG %s\r\n' "${line#PING }" >&$dst; continue ;;
+      *) continue ;;
+    esac
+
+    ((++n))
+    [ "${line#* PRIVMSG #linktest$3 :}" = "$(payload $n)" ] || fail "$3: message $n garbled: $line"
+  done
+
+  ((n == LINES)) || fail "$3: only $n of $LINES messages arrived"
+  echo "ok: $LINES messages $3"
+  exec {src}>&- {dst}>&-
+}
+
+# stats_zip <port> <peer>: checks that STATS ? reports compression for peer
+stats_zip()
+{
+  local zfd
+  irc_open zfd "$1" "st$1"
+  printf 'OPER linktest linktest\r\nSTATS ?\r\n' >&$zfd
+  irc_wait $zfd "* 249 * :Compression for $2.linktest:*" ||
+    fail "STATS ? on port $1 shows no compression for $2.linktest"
+  echo "ok: ${REPLY#* :}"
+  exec {zfd}>&-
+}
+
+# clients <port> <prefix>: keeps CLIENTS clients connected in the background
+clients()
+{
+  local fds=() fd i
+
+  for ((i = 0; i < CLIENTS; ++i)); do
+    exec {fd}<>"/dev/tcp/127.0.0.1/$1" || break
+    printf 'NICK %s%d\r\nUSER lt 0 * :linktest client %d\r\nJOIN #burst%s\r\n' "$2" $i $i "$2" >&$fd
+    fds+=($fd)
+  done
+}
+
+write_conf a 1LT $PORT $((PORT + 1)) b $((PORT + 3))
+write_conf b 2LT $((PORT + 2)) $((PORT + 3)) a $((PORT + 1))
+
+# Let a build up some state first, so that the burst goes over the compressed link
+start_server a
+sleep 1
+clients $PORT ca
+irc_open watch $PORT watch
+for ((i = 0; i < 60; ++i)); do
+  printf 'LUSERS\r\n' >&$watch
+  irc_wait $watch "* 255 * :I have $((CLIENTS + 1)) clients *" 2 && break
+  sleep 1
+done
+((i < 60)) || fail "only some of the $CLIENTS clients registered"
+
+start_server b
+for ((i = 0; i < 30; ++i)); do
+  printf 'LINKS\r\n' >&$watch
+  irc_wait $watch "* 364 * b.linktest *" 2 && break
+done
+((i < 30)) || fail "servers did not link"
+echo "ok: linked"
+
+# Clients are invisible, so NAMES only lists them all to members
+irc_open check $((PORT + 2)) check
+printf 'JOIN #burstca\r\n' >&$check
+for ((i = 0; i < 30; ++i)); do
+  printf 'NAMES #burstca\r\n' >&$check
+  n=0
+  while irc_wait $check "* 3[56][36] *"; do
+    case "$REPLY" in
+      *" 366 "*) break ;;
+    esac
+    set -- ${REPLY#* :}
+    n=$((n + $#))
+  done
+  ((n == CLIENTS + 1)) && break
+  sleep 1
+done
+((n == CLIENTS + 1)) || fail "b has $((n - 1)) of $CLIENTS members of #burstca after the burst"
+echo "ok: burst of $CLIENTS clients"
+
+flood $PORT $((PORT + 2)) ab
+flood $((PORT + 2)) $PORT ba
+
+stats_zip $PORT b
+stats_zip $((PORT + 2)) a
+
+echo "PASS"
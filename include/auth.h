@@ -29,6 +29,17 @@
 
 enum { RFC1413_BUFSIZ = 512 };  /**< rfc1413 says we MUST accept 512 bytes */
 enum { RFC1413_PORT   = 113 };  /**< As defined per rfc1413, IDENT server listens on TCP port 113 */
+enum { AUTH_HISTOGRAM_BUCKETS = 16 };  /**< Bucket n counts times below 2^n ms, the last one all others */
+
+/** Registration phases whose duration is recorded, all timed from auth_start() */
+enum
+{
+  AUTH_PHASE_DNS,       /**< Until the DNS lookup has finished */
+  AUTH_PHASE_IDENT,     /**< Until the ident lookup has finished */
+  AUTH_PHASE_AUTH,      /**< Until the client has been released by auth */
+  AUTH_PHASE_REGISTER,  /**< Until the client has been registered */
+  AUTH_PHASE_LAST
+};
 
 struct Client;
 
@@ -39,9 +50,13 @@ struct AuthRequest
   bool ident_pending;     /**< 'true' as long as identd request hasn't finished */
   struct Client *client;  /**< Pointer to Client structure for request. */
   fde_t *fd;              /**< File descriptor for identd queries. */
+  uintmax_t ident_deadline;  /**< When the ident lookup has to be done by; monotonic time */
 };
 
 extern void auth_init(void);
 extern void auth_start(struct Client *);
 extern void auth_delete(struct AuthRequest *);
+extern void auth_registered(struct Client *);
+extern const unsigned int *auth_get_histogram(unsigned int);
+extern void auth_get_budget(unsigned int *, unsigned int *);
 #endif
@@ -29,6 +29,8 @@
 
 #include "ircd_defs.h"        /* KEYLEN, CHANNELLEN */
 #include "extban.h"
+#include "channel_index.h"
+#include "token_bucket.h"
 
 #define AddMemberFlag(x, y) ((x)->flags |=  (y))
 #define DelMemberFlag(x, y) ((x)->flags &= ~(y))
@@ -55,6 +57,7 @@ enum
 #define ClearJoinFloodNoticed(x) ((x)->flags &= ~JOIN_FLOOD_NOTICED)
 
 struct Client;
+struct ChannelModeBatch;
 
 /*! \brief Mode structure for channels */
 struct Mode
@@ -77,12 +80,11 @@ struct Channel
 
   uintmax_t creation_time;  /**< Real time */
   uintmax_t topic_time;  /**< Real time */
-  uintmax_t last_knock_time;  /**< Don't allow knock to flood; monotonic time */
-  uintmax_t last_invite_time;  /**< Monotonic time */
-  uintmax_t last_join_time;  /**< Monotonic time */
-  uintmax_t first_received_message_time;  /*!< Channel flood control; monotonic time */
+  struct TokenBucket knock_bucket;  /**< See channel::knock_delay_channel */
+  struct TokenBucket invite_bucket;  /**< See channel::invite_delay_channel */
+  struct TokenBucket join_bucket;  /**< See SET JFLOODCOUNT */
+  struct TokenBucket message_bucket;  /**< See SET FLOODCOUNT */
   unsigned int flags;
-  unsigned int received_number_of_privmsgs;
 
   dlink_list members_local;  /*!< local members are here too */
   dlink_list members;
@@ -91,10 +93,14 @@ struct Channel
   dlink_list exceptlist;
   dlink_list invexlist;
 
-  float number_joined;
-
   char name[CHANNELLEN + 1];
   size_t name_len;
+
+  struct ChannelIndexNode *index[CHANNEL_INDEX_LAST];  /**< Our nodes in the ordered channel indexes */
+
+  const struct ResvItem *resv;  /**< RESV matching the channel name, if any */
+  uintmax_t resv_generation;  /**< Value of resv_generation resv was looked up at */
+  struct ChannelModeBatch *mode_batch;  /**< Mode changes not sent out yet, if any */
 };
 
 /*! \brief ChannelMember structure */
@@ -131,7 +137,8 @@ extern const dlink_list *channel_get_list(void);
 extern bool channel_check_name(const char *, bool);
 extern int can_send(struct Channel *, struct Client *, struct ChannelMember *, const char *, bool);
 extern bool is_banned(struct Channel *, struct Client *);
-extern bool find_bmask(struct Client *, struct Channel*, const dlink_list *, struct Extban *);
+extern unsigned int find_bmask(struct Client *, struct Channel *, const dlink_list *, unsigned int);
+extern unsigned int ban_verdict(struct Client *, struct Channel *, unsigned int, bool *);
 extern bool member_has_flags(const struct ChannelMember *, const unsigned int);
 
 extern void channel_do_join(struct Client *, char *, char *);
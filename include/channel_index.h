@@ -0,0 +1,53 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file channel_index.h
+ * \brief A header for the ordered channel indexes used by LIST.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_channel_index_h
+#define INCLUDED_channel_index_h
+
+struct Channel;
+
+enum
+{
+  CHANNEL_INDEX_USERS,  /**< Ordered by member count, largest first, then by name */
+  CHANNEL_INDEX_NAME,  /**< Ordered by case-folded name */
+  CHANNEL_INDEX_LAST
+};
+
+/*! \brief ChannelIndexNode structure */
+struct ChannelIndexNode
+{
+  struct Channel *channel;
+  unsigned int users;  /**< Member count this node is currently sorted under */
+  unsigned int level;  /**< Number of entries in next[] */
+  struct ChannelIndexNode *next[];
+};
+
+extern void channel_index_add(struct Channel *);
+extern void channel_index_del(struct Channel *);
+extern void channel_index_update(struct Channel *);
+extern struct ChannelIndexNode *channel_index_seek(unsigned int, unsigned int, const char *, bool);
+extern void channel_index_count_memory(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_channel_index_h */
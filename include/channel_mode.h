@@ -36,6 +36,9 @@ enum { MODEBUFLEN = 200 };
 /* Maximum mode changes allowed per client, per server is different */
 enum { MAXMODEPARAMS = 6 };
 
+/* Maximum mode changes queued for a channel before they're sent out anyway */
+enum { CHANNEL_MODE_BATCH_CHANGES = MAXMODEPARAMS * 16 };
+
 enum
 {
   MODE_QUERY,
@@ -130,4 +133,9 @@ extern const char *add_id(struct Client *, struct Channel *, const char *, dlink
 extern void channel_mode_set(struct Client *, struct Channel *,
                              struct ChannelMember *, int, char **);
 extern void clear_ban_cache_list(dlink_list *);
+extern void channel_mode_queue(struct Channel *, const char *, const struct Client *,
+                               const char *, const struct ChModeChange *, unsigned int);
+extern void channel_mode_flush_channel(struct Channel *);
+extern void channel_mode_flush_status(struct Channel *);
+extern void channel_mode_flush(void);
 #endif /* INCLUDED_channel_mode_h */
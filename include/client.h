@@ -33,6 +33,11 @@
 #include "ircd_defs.h"
 #include "dbuf.h"
 #include "auth.h"
+#include "token_bucket.h"
+
+struct BurstTask;
+struct ZipState;
+struct MonitorBatch;
 
 
 /*
@@ -272,6 +277,11 @@ struct ListTask
   dlink_list hide_mask;  /**< Channels to hide */
 
   unsigned int hash_index;  /**< The hash bucket we are currently in */
+  unsigned int index;  /**< CHANNEL_INDEX_* to walk, or CHANNEL_INDEX_LAST to scan the hash table */
+  unsigned int index_users;  /**< Member count of the next channel to look at in the index */
+  char index_name[CHANNELLEN + 1];  /**< Name of the next channel to look at in the index */
+  char prefix[CHANNELLEN + 1];  /**< Prefix all channels to be shown have in common */
+  unsigned int top_max;  /**< Channels left to show in top N mode */
   unsigned int users_min;
   unsigned int users_max;
   unsigned int created_min;  /**< Real time */
@@ -303,20 +313,22 @@ struct Connection
                              which can be modified by check_pings_list; monotonic time */
   uintmax_t created_real;  /**< Time client was created; real time */
   uintmax_t created_monotonic;  /**< Time client was created; monotonic time */
+  uintmax_t auth_started;  /**< Time auth_start() was called; monotonic microseconds */
   uintmax_t last_caller_id_time;  /**< Monotonic time */
-  uintmax_t first_received_message_time;  /**< Monotonic time */
   uintmax_t last_privmsg;  /**< Last time we got a PRIVMSG; monotonic time */
   uintmax_t last_join_time;  /**< When this client last joined a channel; monotonic time */
   uintmax_t last_leave_time;  /**< When this client last left a channel; monotonic time */
 
   unsigned int join_leave_count;  /**< Count of JOIN/LEAVE in less than MIN_JOIN_LEAVE_TIME seconds */
   unsigned int oper_warn_count_down;  /**< Warn opers of this possible spambot every time this gets to 0 */
-  unsigned int received_number_of_privmsgs;
 
   struct ListTask  *list_task;
+  struct BurstTask *burst_task;  /**< Set while we are bursting to this server */
+  struct ZipState  *zip;  /**< Set if the link to this server is compressed */
 
   struct dbuf_queue buf_sendq;
   struct dbuf_queue buf_recvq;
+  size_t tls_write_size;  /**< Length of a TLS write that has to be retried; 0 if none */
 
   struct
   {
@@ -326,26 +338,25 @@ struct Connection
 
   struct
   {
-    unsigned int count;  /**< How many AWAY/INVITE/KNOCK/NICK requests client has sent */
-    uintmax_t last_attempt;  /**< Last time the AWAY/INVITE/KNOCK/NICK request was issued; monotonic time */
-  } away, invite, knock, nick;
+    unsigned int count;  /**< How many AWAY/NICK requests client has sent */
+    uintmax_t last_attempt;  /**< Last time the AWAY/NICK request was issued; monotonic time */
+  } away, nick;
+
+  struct TokenBucket flood_bucket;  /**< Lines parsed; see class::flood_burst */
+  struct TokenBucket message_bucket;  /**< PRIVMSG/NOTICE received; see SET FLOODCOUNT */
+  struct TokenBucket invite_bucket;  /**< INVITEs sent; see channel::invite_client_count */
+  struct TokenBucket knock_bucket;  /**< KNOCKs sent; see channel::knock_client_count */
 
   struct AuthRequest *auth;
   struct Listener *listener;  /**< Listener accepted from */
   dlink_list acceptlist;  /**< Clients I'll allow to talk to me */
-  dlink_list monitors;  /**< Chain of Monitor pointer blocks */
+  dlink_list monitors;  /**< Chain of MonitorSubscription items */
+  struct MonitorBatch *monitor_batch;  /**< RPL_MONONLINE targets not yet sent */
   dlink_list confs;  /**< Configuration record associated */
   dlink_list invited;  /**< Chain of invite pointer blocks */
 
   fde_t *fd;  /**< Pointer to fdlist.c:fd_table[] */
 
-  /* Anti-flood stuff. We track how many messages were parsed and how
-   * many we were allowed in the current second, and apply a simple
-   * decay to avoid flooding.
-   *   -- adrian
-   */
-  int sent_parsed;  /**< How many messages we've parsed in this second */
-
   char *password;  /**< Password supplied by the client/server */
 };
 
@@ -363,6 +374,7 @@ struct Client
   struct Client *from;  /**< == self, if Local Client, *NEVER* NULL! */
 
   uintmax_t tsinfo;  /**< Timestamp on this nick; real time */
+  uintmax_t global_serial;  /**< Order of insertion into global_client_list */
 
   unsigned int flags;  /**< Client flags */
   unsigned int umodes;  /**< User modes this client has set */
@@ -376,12 +388,21 @@ struct Client
 
   struct irc_ssaddr ip;  /**< Real IP address */
 
+  dlink_node index_host_node;  /**< Link to the client list of a host index node */
+  dlink_node index_ip_node;  /**< Link to the client list of an IP index node */
+  dlink_node index_account_node;  /**< Link to an account index bucket */
+  void *index_host;  /**< Pointer to 'struct HostIndexNode' item */
+  void *index_ip;  /**< Pointer to 'patricia_node_t' item */
+  dlink_list *index_account;  /**< Account index bucket we are in */
+
   char *tls_certfp;  /**< TLS certificate fingerprint */
   char *tls_cipher;  /**< Exact copy of tls_get_cipher() */
 
   char away[AWAYLEN + 1];  /**< Client's AWAY message. Can be set/unset via AWAY command */
   char name[HOSTLEN + 1];  /**< Unique name for a client nick or host */
+  size_t name_len;  /**< Length of name; kept up to date once registered */
   char id[IDLEN + 1];  /**< Client ID, unique ID per client */
+  uint64_t idnum;  /**< Client ID as decoded by id_decode() */
   char account[ACCOUNTLEN + 1];  /**< Services account */
 
   /*
@@ -392,6 +413,7 @@ struct Client
    * this field should be considered read-only.
    */
   char username[USERLEN + 1];  /**< client's username */
+  size_t username_len;  /**< Length of username; set on registration */
 
   /*
    * client->host contains the resolved name or ip address as a string
@@ -399,6 +421,7 @@ struct Client
    * once it's changed the *real* address goes away.
    */
   char host[HOSTLEN + 1];  /**< Client's hostname. Can be faked/spoofed */
+  size_t host_len;  /**< Length of host; kept up to date once registered */
 
   /*
    * client->realhost contains the resolved name or ip address as a string
@@ -441,7 +464,7 @@ extern void del_accept(struct split_nuh_item *, struct Client *);
 extern void del_all_accepts(struct Client *);
 extern void exit_client(struct Client *, const char *);
 extern void conf_try_ban(struct Client *, int, const char *);
-extern void check_conf_klines(void);
+extern void check_conf_klines(unsigned int);
 extern void client_init(void);
 extern void dead_link_on_write(struct Client *, int);
 extern void dead_link_on_read(struct Client *, int);
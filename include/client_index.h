@@ -0,0 +1,47 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file client_index.h
+ * \brief A header for the client attribute indexes used by WHO.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_client_index_h
+#define INCLUDED_client_index_h
+
+struct Client;
+struct irc_ssaddr;
+
+/*! \brief Called for every client found in an index; returns false to stop the walk */
+typedef bool (*client_index_visit)(struct Client *, void *);
+
+extern void client_index_init(void);
+extern void client_index_add(struct Client *);
+extern void client_index_del(struct Client *);
+extern void client_index_host_add(struct Client *);
+extern void client_index_host_del(struct Client *);
+extern void client_index_account_add(struct Client *);
+extern void client_index_account_del(struct Client *);
+extern bool client_index_walk_host(const char *, bool, client_index_visit, void *);
+extern bool client_index_walk_ip(const struct irc_ssaddr *, int, client_index_visit, void *);
+extern bool client_index_walk_account(const char *, client_index_visit, void *);
+extern void client_index_count_memory(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_client_index_h */
@@ -38,7 +38,7 @@ enum
   TK_MINUTES
 };
 
-enum { CLEANUP_TKLINES_TIME = 60 };
+enum { CLEANUP_TKLINES_TIME = 1 };  /**< Cheap when nothing is due; see conf_expire.c */
 
 enum maskitem_type
 {
@@ -67,7 +67,8 @@ enum
   CONF_FLAGS_EXEMPTRESV      = 1 << 11,
   CONF_FLAGS_TLS             = 1 << 12,
   CONF_FLAGS_WEBIRC          = 1 << 13,
-  CONF_FLAGS_EXEMPTXLINE     = 1 << 14
+  CONF_FLAGS_EXEMPTXLINE     = 1 << 14,
+  CONF_FLAGS_COMPRESSED      = 1 << 15
 };
 
 enum
@@ -97,6 +98,7 @@ enum
 #define ClearConfAllowAutoConn(x) ((x)->flags &= ~CONF_FLAGS_ALLOW_AUTO_CONN)
 #define IsConfRedir(x)            ((x)->flags & CONF_FLAGS_REDIR)
 #define IsConfTLS(x)              ((x)->flags & CONF_FLAGS_TLS)
+#define IsConfCompressed(x)       ((x)->flags & CONF_FLAGS_COMPRESSED)
 #define IsConfDatabase(x)         ((x)->flags & CONF_FLAGS_IN_DATABASE)
 #define SetConfDatabase(x)        ((x)->flags |= CONF_FLAGS_IN_DATABASE)
 
@@ -149,6 +151,7 @@ struct MaskItem
   char              *certfp;
   char              *whois;
   char              *cipher_list;
+  tls_session_t      tls_session;  /* Session to resume on the next connect */
 };
 
 struct conf_parser_context
@@ -213,6 +216,10 @@ struct config_general_entry
   unsigned int throttle_time;
   unsigned int ping_cookie;
   unsigned int disable_auth;
+  unsigned int auth_timeout;
+  unsigned int ident_timeout;
+  unsigned int ident_cache_time;
+  unsigned int ident_max_pending;
   unsigned int cycle_on_host_change;
 };
 
@@ -262,9 +269,13 @@ struct config_serverinfo_entry
   char *tls_cipher_list;
   char *tls_cipher_suites;
   char *tls_message_digest_algorithm;
+  char *tls_ticket_key_file;
   tls_context_t tls_ctx;
   tls_md_t message_digest_algorithm;
   unsigned int hub;
+  unsigned int tls_handshake_threads;
+  unsigned int tls_kernel_offload;
+  unsigned int tls_session_cache_size;
   unsigned int default_max_clients;
   unsigned int max_nick_length;
   unsigned int max_topic_length;
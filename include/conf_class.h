@@ -45,6 +45,8 @@ struct ClassItem
   unsigned int ref_count;
   unsigned int max_sendq;
   unsigned int max_recvq;
+  unsigned int flood_burst;  /**< Lines a client may send in one go */
+  unsigned int flood_rate;  /**< Lines per second a client may send after using up flood_burst */
   unsigned int con_freq;
   unsigned int ping_freq;
   unsigned int max_total;
@@ -0,0 +1,44 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+
+/*! \file conf_expire.h
+ * \brief A header for the expiry queue of temporary bans.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_conf_expire_h
+#define INCLUDED_conf_expire_h
+
+/*! \brief ConfExpire structure; embedded in every item that can expire */
+struct ConfExpire
+{
+  uintmax_t when;  /**< Real time the item is due; 0 while not queued */
+  unsigned int index;  /**< Position in the heap */
+  void (*handler)(void *);  /**< Called once the item is due, after it has left the queue */
+  void *data;  /**< Passed on to handler */
+};
+
+extern void conf_expire_add(struct ConfExpire *, uintmax_t, void (*)(void *), void *);
+extern void conf_expire_del(struct ConfExpire *);
+extern void conf_expire_run(uintmax_t);
+extern void conf_expire_count_memory(unsigned int *const, size_t *const);
+#endif  /* INCLUDED_conf_expire_h */
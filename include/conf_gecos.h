@@ -27,6 +27,8 @@
 #ifndef INCLUDED_conf_gecos_h
 #define INCLUDED_conf_gecos_h
 
+#include "conf_expire.h"
+
 struct GecosItem
 {
   dlink_node node;
@@ -35,12 +37,21 @@ struct GecosItem
   uintmax_t expire;
   uintmax_t setat;
   bool in_database;
+  bool stale;  /**< Left from the previous configuration, see gecos_mark_stale() */
+  dlink_node stale_node;  /**< Link to the stale X-lines hash while stale */
+  struct ConfExpire expire_queue;  /**< Queued for expiry if expire is set */
+  struct GecosNode *anchor;  /**< Matcher node the anchor of mask ends in; NULL if it has none */
+  dlink_node anchor_node;  /**< Link to the output of anchor, or to the unanchored X-lines */
+  uintmax_t match_serial;  /**< Last gecos_match() call that checked this X-line */
 };
 
 extern const dlink_list *gecos_get_list(void);
 extern void gecos_delete(struct GecosItem *, bool);
-extern struct GecosItem *gecos_make(void);
+extern struct GecosItem *gecos_make(const char *);
 extern struct GecosItem *gecos_find(const char *, int (*)(const char *, const char *));
-extern void gecos_clear(void);
-extern void gecos_expire(void);
+extern struct GecosItem *gecos_match(const char *);
+extern void gecos_set_expire(struct GecosItem *, uintmax_t);
+extern void gecos_mark_stale(void);
+extern bool gecos_sweep_stale(void);
+extern void gecos_count_memory(unsigned int *const, size_t *const);
 #endif  /* INCLUDED_conf_gecos_h */
@@ -27,16 +27,22 @@
 #ifndef INCLUDED_conf_resv_h
 #define INCLUDED_conf_resv_h
 
+#include "conf_expire.h"
+
 struct ResvItem
 {
   dlink_node node;
   dlink_list *list;
+  struct ResvItem *hnext;  /**< For resv_hash lookups; masks without wildcards only */
+  dlink_node wild_node;  /**< Link to resv_chan_wild or resv_nick_wild; masks with wildcards only */
+  bool wild;
   dlink_list exempt_list;
   char *mask;
   char *reason;
   uintmax_t expire;
   uintmax_t setat;
   bool in_database;
+  struct ConfExpire expire_queue;  /**< Queued for expiry if expire is set */
 };
 
 struct ResvExemptItem
@@ -50,12 +56,15 @@ struct ResvExemptItem
   int type;
 };
 
+extern uintmax_t resv_generation;
+
 extern const dlink_list *resv_chan_get_list(void);
 extern const dlink_list *resv_nick_get_list(void);
 extern void resv_delete(struct ResvItem *, bool);
 extern struct ResvItem *resv_make(const char *, const char *, const dlink_list *);
 extern bool resv_exempt_find(const struct Client *, const struct ResvItem *);
 extern struct ResvItem *resv_find(const char *, int (*)(const char *, const char *));
+extern struct ResvItem *resv_match(const char *);
+extern void resv_set_expire(struct ResvItem *, uintmax_t);
 extern void resv_clear(void);
-extern void resv_expire(void);
 #endif  /* INCLUDED_conf_resv_h */
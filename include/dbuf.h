@@ -46,6 +46,8 @@ struct dbuf_queue
   size_t pos;
 };
 
+extern unsigned int dbuf_block_count;
+
 extern struct dbuf_block *dbuf_alloc(void);
 extern void dbuf_ref_free(struct dbuf_block *);
 extern void dbuf_add(struct dbuf_queue *, struct dbuf_block *);
@@ -53,4 +55,5 @@ extern void dbuf_delete(struct dbuf_queue *, size_t);
 extern void dbuf_put_fmt(struct dbuf_block *, const char *, ...);
 extern void dbuf_put_args(struct dbuf_block *, const char *, va_list);
 extern void dbuf_put(struct dbuf_queue *, const char *, size_t);
+extern size_t dbuf_copy(const struct dbuf_queue *, char *, size_t);
 #endif  /* INCLUDED_dbuf_h */
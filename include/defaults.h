@@ -94,6 +94,8 @@
 #define PORTNUM 6667                    /* default outgoing portnum */
 #define DEFAULT_PINGFREQUENCY    120    /* Default ping frequency */
 #define DEFAULT_CONNECTFREQUENCY 600    /* Default connect frequency */
+#define DEFAULT_FLOOD_BURST      5      /* Default lines parsed at once */
+#define DEFAULT_FLOOD_RATE       2      /* Default lines parsed per second after that */
 #define CLIENT_FLOOD_MAX     8000
 #define CLIENT_FLOOD_MIN     512
 
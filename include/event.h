@@ -34,6 +34,7 @@ struct event_base
   struct
   {
     uintmax_t sec_real, sec_monotonic;
+    uintmax_t msec_monotonic;  /**< Same clock as sec_monotonic, in milliseconds */
   } time;
 };
 
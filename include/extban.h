@@ -36,9 +36,12 @@ struct ChannelMember;
 enum
 {
   /* All possible mask values */
-  EXTBAN_MASK = 0xFFFFFFFF
+  EXTBAN_MASK = 0x7FFFFFFF
 };
 
+/* Stands for bans without an acting extban in find_bmask() and ban_verdict() */
+#define EXTBAN_PLAIN 0x80000000U
+
 enum extban_type
 {
   EXTBAN_NONE,
@@ -77,8 +80,6 @@ extern const char *extban_get_isupport(void);
 
 
 /* TBD: move to modules: */
-extern int extban_mute_can_send(struct Channel *, struct Client *, struct ChannelMember *);
-extern int extban_join_can_join(struct Channel *, struct Client *, struct ChannelMember *);
 extern int extban_nick_can_change(struct Channel *, struct Client *, struct ChannelMember *);
 extern struct Extban extban_account;
 extern struct Extban extban_channel;
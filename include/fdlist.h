@@ -33,6 +33,8 @@
 
 enum { FD_DESC_SIZE = 80 };  /* HOSTLEN + comment */
 
+struct TlsPoolJob;
+
 typedef struct _fde
 {
   /* New-school stuff, again pretty much ripped from squid */
@@ -63,6 +65,7 @@ typedef struct _fde
   {
     bool open;
     bool is_socket;
+    bool tls_kernel_send;  /* Set if the kernel encrypts what we write (kTLS) */
   } flags;
 
   struct
@@ -76,6 +79,7 @@ typedef struct _fde
   } connect;
 
   tls_data_t tls;
+  struct TlsPoolJob *tls_job;  /* Set while a worker thread owns the TLS session */
 } fde_t;
 
 extern int number_fd;
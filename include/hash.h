@@ -48,6 +48,8 @@ extern void hash_add_channel(struct Channel *);
 extern void hash_del_channel(struct Channel *);
 extern void hash_add_id(struct Client *);
 extern void hash_del_id(struct Client *);
+extern bool hash_id_available(uint64_t);
+extern void hash_id_local_stats(unsigned int *, unsigned int *);
 
 extern struct Client *hash_find_id(const char *);
 extern struct Client *hash_find_client(const char *);
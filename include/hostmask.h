@@ -27,6 +27,8 @@
 #ifndef INCLUDED_hostmask_h
 #define INCLUDED_hostmask_h
 
+#include "conf_expire.h"
+
 enum { ATABLE_SIZE = 0x1000 };
 
 enum hostmask_type
@@ -64,18 +66,22 @@ struct AddressRec
   struct MaskItem *conf;
 
   dlink_node node;
+  dlink_list *list;  /**< atable[] bucket node is linked into */
+  struct ConfExpire expire;  /**< Queued for expiry if conf is a temporary K- or D-line */
+  bool stale;  /**< Left from the previous configuration, see address_conf_mark_stale() */
 };
 
 extern dlink_list atable[ATABLE_SIZE];
 extern int parse_netmask(const char *, struct irc_ssaddr *, int *);
 extern bool address_compare(const void *, const void *, bool, bool, int);
+extern void address_format(const struct irc_ssaddr *, char *, size_t);
 extern bool match_ipv6(const struct irc_ssaddr *, const struct irc_ssaddr *, int);
 extern bool match_ipv4(const struct irc_ssaddr *, const struct irc_ssaddr *, int);
 
 extern struct AddressRec *add_conf_by_address(const unsigned int, struct MaskItem *);
 extern void delete_one_address_conf(const char *, struct MaskItem *);
-extern void clear_out_address_conf(void);
-extern void hostmask_expire_temporary(void);
+extern void address_conf_mark_stale(void);
+extern unsigned int address_conf_sweep_stale(void);
 
 extern struct MaskItem *find_address_conf(const char *, const char *, const struct irc_ssaddr *, const char *);
 extern struct MaskItem *find_dline_conf(const struct irc_ssaddr *);
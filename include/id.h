@@ -34,6 +34,11 @@ enum
   TOTALSIDUID = IRC_MAXSID + IRC_MAXUID
 };
 
+/** Lower half of a SID as returned by id_decode(); UIDs stay below it */
+#define ID_SERVER UINT32_MAX
+
+extern uint64_t id_decode(const char *);
+
 extern bool valid_sid(const char *);
 extern bool valid_uid(const char *);
 extern void init_uid(void);
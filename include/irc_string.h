@@ -68,6 +68,8 @@ extern const char *libio_basename(const char *);
 
 extern const char *stripws(char *);
 
+extern size_t address_ntop(int, const void *, char *);
+
 #define EmptyString(x) (!(x) || (*(x) == '\0'))
 
 /*
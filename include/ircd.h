@@ -36,6 +36,7 @@
 struct SetOptions
 {
   bool autoconn;      /* autoconn enabled for all servers? */
+  bool profiling;     /* time command handlers? */
   unsigned int maxclients;
   unsigned int floodcount;  /* Number of messages in 'floodtime' seconds */
   unsigned int floodtime;
@@ -71,6 +72,12 @@ struct ServerStatistics
   unsigned int    is_kill; /* number of kills generated on collisions */
   unsigned int    is_asuc; /* successful auth requests */
   unsigned int    is_abad; /* bad auth requests */
+  unsigned int    is_atmo; /* auth requests that timed out */
+  unsigned int    is_aref; /* auth requests refused by the client's host */
+  unsigned int    is_acch; /* auth requests skipped, host in negative cache */
+  unsigned int    is_alim; /* auth requests skipped, too many pending on listener */
+  unsigned int    is_tls;  /* completed TLS handshakes */
+  unsigned int    is_tlsr; /* TLS handshakes that resumed a session */
 };
 
 struct Counter
@@ -36,19 +36,34 @@ enum
   LISTENER_HIDDEN = 1 << 1,
   LISTENER_SERVER = 1 << 2,
   LISTENER_CLIENT = 1 << 3,
-  LISTENER_DEFER  = 1 << 4
+  LISTENER_DEFER  = 1 << 4,
+  LISTENER_REUSEPORT = 1 << 5,
+  LISTENER_METRICS = 1 << 6  /**< UNIX domain socket serving metrics.c snapshots */
+};
+
+enum
+{
+  LISTENER_QUEUES_MAX = 4,  /**< Sockets opened for a port with LISTENER_REUSEPORT */
+  LISTENER_ACCEPT_BUDGET = 32  /**< Connections accepted per socket per event loop iteration */
 };
 
 struct Listener
 {
   dlink_node node;           /**< Doubly linked list node */
   bool active;               /**< Current state of listener */
-  fde_t *fd;                 /**< File descriptor */
-  int port;                  /**< Listener IP port */
+  fde_t *fd[LISTENER_QUEUES_MAX];  /**< File descriptors; more than one with LISTENER_REUSEPORT */
+  unsigned int fd_count;     /**< Number of open entries in fd[]; 0 if closed */
+  int port;                  /**< Listener IP port; unused with LISTENER_METRICS */
   int ref_count;             /**< Number of connection references */
-  struct irc_ssaddr addr;    /**< Holds an IPv6 or IPv4 address */
-  char name[HOSTIPLEN + 1];  /**< Holds an IPv6 or IPv4 address in string representation*/
-  unsigned int flags;        /**< Listener flags (tls, hidden, server, client, defer) */
+  struct irc_ssaddr addr;    /**< Holds an IPv6 or IPv4 address, or a UNIX socket path */
+  char name[HOSTIPLEN + 1];  /**< Holds an IPv6 or IPv4 address in string representation, or the (possibly truncated) socket path */
+  unsigned int flags;        /**< Listener flags (tls, hidden, server, client, defer, reuseport, metrics) */
+  uintmax_t accepted;        /**< Connections handed on to add_connection() */
+  uintmax_t dropped;         /**< Connections closed right after accept() */
+  uintmax_t rate_time;       /**< Monotonic second rate_count belongs to */
+  unsigned int rate_count;   /**< Connections accepted during rate_time */
+  unsigned int rate_last;    /**< Connections accepted during the second before rate_time */
+  unsigned int ident_pending;  /**< Ident lookups in progress for clients of this listener */
 };
 
 extern const dlink_list *listener_get_list(void);
@@ -58,4 +73,5 @@ extern void listener_close_marked(void);
 extern const char *listener_get_name(const struct Listener *);
 extern bool listener_has_flag(const struct Listener *, unsigned int);
 extern void listener_count_memory(unsigned int *, size_t *);
+extern unsigned int listener_accept_rate(const struct Listener *);
 #endif
@@ -40,6 +40,7 @@ enum log_type
   LOG_TYPE_OPER,
   LOG_TYPE_USER,
   LOG_TYPE_DEBUG,
+  LOG_TYPE_METRICS,
   LOG_TYPE_LAST
 };
 
@@ -0,0 +1,51 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file loop_stats.h
+ * \brief A header for the event loop health metrics.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_loop_stats_h
+#define INCLUDED_loop_stats_h
+
+/** Parts of an io_loop() iteration whose time is accounted for separately */
+enum
+{
+  LOOP_STAGE_EVENTS,  /**< Timed events, LIST and burst continuation, flushes */
+  LOOP_STAGE_WAIT,    /**< Blocked in epoll_wait() or its equivalent */
+  LOOP_STAGE_IO,      /**< Read and write callbacks */
+  LOOP_STAGE_EXIT,    /**< exit_aborted_clients() and free_exited_clients() */
+  LOOP_STAGE_LAST
+};
+
+struct Client;
+
+extern uintmax_t loop_syscalls;
+
+extern void loop_stats_stage(unsigned int);
+extern void loop_stats_ready(int);
+extern void loop_stats_iteration(void);
+extern void loop_stats_fanout(unsigned int);
+extern void loop_stats_report(struct Client *);
+extern uintmax_t loop_stats_get(uintmax_t *);
+extern void loop_stats_init(void);
+#endif  /* INCLUDED_loop_stats_h */
@@ -0,0 +1,38 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+
+/*! \file metrics.h
+ * \brief A header for the metrics exporter.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_metrics_h
+#define INCLUDED_metrics_h
+
+enum
+{
+  METRICS_REQUEST_MAX = 1024,  /**< Longest HTTP request header we read */
+  METRICS_TIMEOUT = 5  /**< Seconds a scrape may take, request and response together */
+};
+
+extern void metrics_accept(int);
+#endif  /* INCLUDED_metrics_h */
@@ -29,19 +29,39 @@
 #define INCLUDED_monitor_h
 
 
-/*! \brief Monitor structure */
+/*! \brief Monitor structure
+ *
+ * One per monitored name, no matter how many clients monitor it.
+ */
 struct Monitor
 {
-  dlink_node node;  /**< List node; linked into monitor_hash */
-  dlink_list monitored_by;  /**< List of clients that have this entry on their monitor list */
-  unsigned int hash_value; /**< Cached hash value derived from Monitor::name */
-  char *name;  /**< Name of the client to monitor */
+  struct Monitor *hnext;  /**< For monitor_hash lookups */
+  struct MonitorSubscription **subscribers;  /**< Clients that have this entry on their monitor list */
+  unsigned int subscribers_count;
+  unsigned int subscribers_size;  /**< Allocated length of Monitor::subscribers */
+  uint32_t hash_value;  /**< Cached hash value derived from Monitor::name */
+  char name[NICKLEN + 1];  /**< Name of the client to monitor */
+};
+
+/*! \brief MonitorSubscription structure
+ *
+ * Links a client to a name it monitors. Knowing its position in both
+ * lists, it can be removed from either in constant time.
+ */
+struct MonitorSubscription
+{
+  dlink_node node;  /**< Link to Connection::monitors */
+  struct Monitor *monitor;
+  struct Client *client;
+  unsigned int index;  /**< Position in Monitor::subscribers */
 };
 
 extern void monitor_signon(const struct Client *);
 extern void monitor_signoff(const struct Client *);
+extern void monitor_flush(void);
 extern bool monitor_add_to_hash_table(const char *, struct Client *);
 extern void monitor_del_from_hash_table(const char *, struct Client *);
 extern void monitor_clear_list(struct Client *);
 extern void monitor_count_memory(unsigned int *const, size_t *const);
+extern void monitor_batch_count_memory(unsigned int *const, size_t *const);
 #endif  /* INCLUDED_monitor_h */
@@ -136,6 +136,7 @@ enum irc_numerics
   RPL_VERSION              = 351,
   RPL_WHOREPLY             = 352,
   RPL_NAMREPLY             = 353,
+  RPL_WHOSPCRPL            = 354,
   RPL_CLOSING              = 362,
   RPL_CLOSEEND             = 363,
   RPL_LINKS                = 364,
@@ -174,6 +175,7 @@ enum irc_numerics
   ERR_NOTEXTTOSEND         = 412,
   ERR_NOTOPLEVEL           = 413,
   ERR_WILDTOPLEVEL         = 414,
+  ERR_QUERYTOOLONG         = 416,
   ERR_UNKNOWNCOMMAND       = 421,
   ERR_NOMOTD               = 422,
   ERR_TOOMANYAWAY          = 429,
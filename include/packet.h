@@ -38,20 +38,19 @@
  * the network.
  *   -- adrian
  */
-/* MAX_FLOOD is the amount of lines in a 'burst' we allow from a client,
- * anything beyond MAX_FLOOD is limited to about one line per second.
+/* MAX_FLOOD is the amount of lines we parse from an unregistered client
+ * per read; the rest waits for the next one, or about a second.
  *
- * MAX_FLOOD_BURST is the amount of lines we allow from a client who has
- * just connected.  this allows clients to rejoin multiple channels
- * without being so heavily penalised they excess flood.
+ * FLOOD_GRACE_FACTOR multiplies class::flood_burst and class::flood_rate
+ * for a client who has just connected.  this allows clients to rejoin
+ * multiple channels without being so heavily penalised they excess flood.
  */
 enum
 {
   MAX_FLOOD = 5,
-  MAX_FLOOD_BURST = MAX_FLOOD * 8
+  FLOOD_GRACE_FACTOR = 8
 };
 
 extern void read_packet(fde_t *, void *);
-extern void flood_recalc(fde_t *, void *);
 extern void flood_endgrace(struct Client *);
 #endif  /* INCLUDED_packet_h */
@@ -68,6 +68,18 @@ typedef enum HandlerType
   LAST_HANDLER_TYPE
 } HandlerType;
 
+enum { MESSAGE_HISTOGRAM_BUCKETS = 20 };  /**< Bucket n counts times below 2^n us, the last one all others */
+
+/*! \brief MessageProfile structure; updated while SET PROFILING is on */
+struct MessageProfile
+{
+  uintmax_t calls;  /**< Number of handler calls timed */
+  uintmax_t time;  /**< Total time spent in the handler; nanoseconds */
+  uintmax_t time_max;  /**< Longest handler call; nanoseconds */
+  uintmax_t sendq_bytes;  /**< Bytes the handler queued for sending */
+  unsigned int histogram[MESSAGE_HISTOGRAM_BUCKETS];
+};
+
 struct MessageHandler
 {
   bool end_grace_period;  /**< Handler ends the flood grace period */
@@ -90,6 +102,7 @@ struct Message
   unsigned int rcount;  /**< Number of times command used by server */
   unsigned int ecount;  /**< Number of times command has been issued via ENCAP */
   uintmax_t bytes;  /**< Bytes received for this message */
+  struct MessageProfile profile;
 
   /* handlers:
    * UNREGISTERED, CLIENT, SERVER, ENCAP, OPER, LAST
@@ -102,6 +115,8 @@ extern void mod_add_cmd(struct Message *);
 extern void mod_del_cmd(struct Message *);
 extern struct Message *find_command(const char *);
 extern void report_messages(struct Client *);
+extern void report_messages_profile(struct Client *);
+extern void parse_profile_reset(void);
 
 /* generic handlers */
 extern void m_ignore(struct Client *, int, char *[]);
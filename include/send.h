@@ -56,12 +56,16 @@ enum
  */
 struct Channel;
 struct Client;
+struct dbuf_block;
+
+extern uintmax_t send_sendq_bytes;
 
 /* send.c prototypes */
 extern void sendq_unblocked(fde_t *, void *);
 extern void send_queued_write(struct Client *);
 extern void sendto_one(struct Client *, const char *, ...) AFP(2,3);
 extern void sendto_one_numeric(struct Client *, const struct Client *, enum irc_numerics, ...);
+extern void sendto_one_buffer(struct Client *, struct dbuf_block *);
 extern void sendto_one_notice(struct Client *, const struct Client *, const char *, ...) AFP(3,4);
 extern void sendto_channel_butone(struct Client *, const struct Client *,
                                   struct Channel *, unsigned int,
@@ -0,0 +1,58 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file server_burst.h
+ * \brief A header for the resumable server burst.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_server_burst_h
+#define INCLUDED_server_burst_h
+
+#include "list.h"
+
+struct Client;
+struct dbuf_block;
+
+/*! \brief BurstTask structure */
+struct BurstTask
+{
+  dlink_node node;  /**< Embedded list node used to link into bursting_server_list */
+  dlink_node *client_next;  /**< Next global_client_list node to be introduced */
+  uintmax_t client_serial;  /**< Client::global_serial of client_next; 0 once all clients are sent */
+  unsigned int hash_index;  /**< The channel hash bucket we are currently in */
+  unsigned int clients_sent;
+  unsigned int clients_total;  /**< Length of global_client_list when the burst started */
+  unsigned int channels_sent;
+  uintmax_t bytes;  /**< Bytes produced so far */
+  dlink_list held;  /**< Messages from clients not introduced yet, see server_burst_hold() */
+  size_t held_bytes;
+  uintmax_t started;  /**< Monotonic time */
+};
+
+extern dlink_list bursting_server_list;
+
+extern void server_burst_start(struct Client *);
+extern void server_burst_continue(struct Client *);
+extern void server_burst_free(struct Client *);
+extern void server_burst_client_exit(const struct Client *);
+extern bool server_burst_hold(struct Client *, struct dbuf_block *);
+#endif  /* INCLUDED_server_burst_h */
@@ -39,7 +39,8 @@ enum
   CAPAB_TBURST  = 1 <<  6,  /**< Supports TBURST */
   CAPAB_DLN     = 1 <<  7,  /**< Can do DLINE message */
   CAPAB_UNDLN   = 1 <<  8,  /**< Can do UNDLINE message */
-  CAPAB_RHOST   = 1 <<  9  /**< Can do extended realhost UID messages */
+  CAPAB_RHOST   = 1 <<  9,  /**< Can do extended realhost UID messages */
+  CAPAB_ZIP     = 1 << 10   /**< Can do compressed server links */
 };
 
 /*
@@ -62,4 +63,5 @@ extern void capab_add(const char *, unsigned int);
 extern void capab_del(const char *);
 extern unsigned int capab_find(const char *);
 extern const char *capab_get(const void *);
+extern const char *capab_get_link(const void *);
 #endif  /* INCLUDED_server_capab_h */
@@ -0,0 +1,51 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file server_zip.h
+ * \brief A header for compressed server links.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_server_zip_h
+#define INCLUDED_server_zip_h
+
+struct Client;
+struct dbuf_queue;
+
+/*! \brief ZipStats structure */
+struct ZipStats
+{
+  uintmax_t out_raw;  /**< Bytes taken from the sendq */
+  uintmax_t out_zip;  /**< Compressed bytes produced from them */
+  uintmax_t in_zip;  /**< Compressed bytes read from the socket */
+  uintmax_t in_raw;  /**< Bytes obtained by decompressing them */
+  uintmax_t usec;  /**< Time spent in deflate() and inflate() */
+};
+
+extern bool server_zip_start(struct Client *);
+extern bool server_zip_recv_start(struct Client *);
+extern void server_zip_free(struct Client *);
+extern void server_zip_defer(struct Client *);
+extern void server_zip_flush(void);
+extern struct dbuf_queue *server_zip_queue(struct Client *);
+extern bool server_zip_inflate(struct Client *, const char *, size_t);
+extern const struct ZipStats *server_zip_stats(const struct Client *);
+#endif  /* INCLUDED_server_zip_h */
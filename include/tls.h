@@ -63,6 +63,7 @@ extern const char *tls_get_cipher(const tls_data_t *);
 extern const char *tls_get_version(void);
 
 extern bool tls_isusing(tls_data_t *);
+extern bool tls_kernel_send(tls_data_t *);
 extern bool tls_new(tls_data_t *, int, tls_role_t);
 extern void tls_free(tls_data_t *);
 
@@ -74,6 +75,12 @@ extern void tls_shutdown(tls_data_t *);
 
 extern bool tls_set_ciphers(tls_data_t *, const char *);
 
+extern void tls_session_resume(tls_data_t *, tls_session_t *);
+extern void tls_session_detach(tls_data_t *);
+extern bool tls_session_reused(tls_data_t *);
+extern void tls_session_free(tls_session_t *);
+extern void tls_session_cache_stats(unsigned int *, unsigned int *);
+
 extern bool tls_verify_certificate(tls_data_t *, tls_md_t, char **);
 
 #endif  /* INCLUDED_tls_h */
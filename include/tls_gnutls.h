@@ -41,6 +41,7 @@
 enum { TLS_GNUTLS_MAX_HASH_SIZE = 64 };
 
 typedef gnutls_digest_algorithm_t tls_md_t;
+typedef void * tls_session_t;  /* Session resumption isn't implemented for GnuTLS */
 typedef struct gnutls_context * tls_context_t;
 
 struct gnutls_context
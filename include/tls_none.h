@@ -30,6 +30,7 @@
 
 typedef void * tls_data_t;
 typedef void * tls_md_t;
+typedef void * tls_session_t;
 typedef void * tls_context_t;
 
 #endif /* INCLUDED_tls_none_h */
@@ -40,6 +40,7 @@
 
 typedef SSL * tls_data_t;
 typedef const EVP_MD * tls_md_t;
+typedef SSL_SESSION * tls_session_t;
 
 typedef struct
 {
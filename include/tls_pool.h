@@ -0,0 +1,39 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file tls_pool.h
+ * \brief A header for the TLS handshake worker threads.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_tls_pool_h
+#define INCLUDED_tls_pool_h
+
+#include "fdlist.h"
+
+/*! \brief Called on the event loop with the result of a handshake step */
+typedef void (*tls_pool_callback)(fde_t *, tls_handshake_status_t, const char *, void *);
+
+extern void tls_pool_handshake(fde_t *, tls_role_t, tls_pool_callback, void *);
+extern void tls_pool_orphan(fde_t *);
+extern void tls_pool_drain(void);
+extern void tls_pool_stats(unsigned int *, unsigned int *);
+#endif  /* INCLUDED_tls_pool_h */
@@ -40,6 +40,7 @@
 
 typedef WOLFSSL * tls_data_t;
 typedef const WOLFSSL_EVP_MD * tls_md_t;
+typedef void * tls_session_t;  /* Session resumption isn't implemented for wolfSSL */
 
 typedef struct
 {
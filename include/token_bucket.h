@@ -0,0 +1,47 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file token_bucket.h
+ * \brief A header for the token buckets used for flood control.
+ * \version $Id$
+ */
+
+#ifndef INCLUDED_token_bucket_h
+#define INCLUDED_token_bucket_h
+
+/*! \brief TokenBucket structure
+ *
+ * A bucket holds up to size tokens and gains one every interval
+ * milliseconds; every action it limits takes one. Nothing ever ticks a
+ * bucket. All it stores is the time it will be full again, from which
+ * the number of tokens it holds is worked out whenever it's used. A
+ * zeroed bucket is full.
+ */
+struct TokenBucket
+{
+  uintmax_t full;  /**< When the bucket will be full again; monotonic milliseconds */
+};
+
+extern bool token_bucket_take(struct TokenBucket *, unsigned int, uintmax_t);
+extern bool token_bucket_is_full(const struct TokenBucket *);
+extern uintmax_t token_bucket_wait(const struct TokenBucket *, unsigned int, uintmax_t);
+extern void token_bucket_fill(struct TokenBucket *);
+#endif  /* INCLUDED_token_bucket_h */
@@ -0,0 +1,13 @@
+AC_DEFUN([AX_ARG_WITH_ZLIB], [
+
+AC_ARG_WITH(zlib, [AS_HELP_STRING([--without-zlib], [Disables compression of server links])], [with_zlib=$withval], [with_zlib=auto])
+
+if test "$with_zlib" != "no"; then
+  AC_CHECK_HEADER(zlib.h, [AC_CHECK_LIB(z, deflateInit2_, [], [], [])])
+
+  AC_MSG_CHECKING([for zlib])
+  AS_IF([test "$ac_cv_lib_z_deflateInit2_" = "yes"],
+        [AC_MSG_RESULT(found)], [AC_MSG_RESULT(no - server link compression disabled)])
+fi
+
+])
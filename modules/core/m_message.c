@@ -107,17 +107,11 @@ flood_attack_client(bool notice, struct Client *source_p, struct Client *target_
   if (HasFlag(source_p, FLAGS_SERVICE | FLAGS_CANFLOOD))
     return false;
 
-  if (target_p->connection->first_received_message_time + GlobalSetOptions.floodtime < event_base->time.sec_monotonic)
-  {
-    if (target_p->connection->received_number_of_privmsgs)
-      target_p->connection->received_number_of_privmsgs = 0;
-    else
-      DelFlag(target_p, FLAGS_FLOOD_NOTICED);
-
-    target_p->connection->first_received_message_time = event_base->time.sec_monotonic;
-  }
+  if (token_bucket_is_full(&target_p->connection->message_bucket))
+    DelFlag(target_p, FLAGS_FLOOD_NOTICED);
 
-  if (target_p->connection->received_number_of_privmsgs >= GlobalSetOptions.floodcount)
+  if (token_bucket_take(&target_p->connection->message_bucket, GlobalSetOptions.floodcount,
+                        GlobalSetOptions.floodtime * 1000 / GlobalSetOptions.floodcount) == false)
   {
     if (!HasFlag(target_p, FLAGS_FLOOD_NOTICED))
     {
@@ -133,7 +127,6 @@ flood_attack_client(bool notice, struct Client *source_p, struct Client *target_
     return true;
   }
 
-  ++target_p->connection->received_number_of_privmsgs;
   return false;
 }
 
@@ -158,17 +151,11 @@ flood_attack_channel(bool notice, struct Client *source_p, struct Channel *chann
   if (HasFlag(source_p, FLAGS_SERVICE | FLAGS_CANFLOOD))
     return false;
 
-  if (channel->first_received_message_time + GlobalSetOptions.floodtime < event_base->time.sec_monotonic)
-  {
-    if (channel->received_number_of_privmsgs)
-      channel->received_number_of_privmsgs = 0;
-    else
-      ClearFloodNoticed(channel);
-
-    channel->first_received_message_time = event_base->time.sec_monotonic;
-  }
+  if (token_bucket_is_full(&channel->message_bucket))
+    ClearFloodNoticed(channel);
 
-  if (channel->received_number_of_privmsgs >= GlobalSetOptions.floodcount)
+  if (token_bucket_take(&channel->message_bucket, GlobalSetOptions.floodcount,
+                        GlobalSetOptions.floodtime * 1000 / GlobalSetOptions.floodcount) == false)
   {
     if (!IsSetFloodNoticed(channel))
     {
@@ -187,7 +174,6 @@ flood_attack_channel(bool notice, struct Client *source_p, struct Channel *chann
     }
   }
 
-  ++channel->received_number_of_privmsgs;
   return false;
 }
 
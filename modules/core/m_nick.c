@@ -254,6 +254,7 @@ change_local_nick(struct Client *source_p, const char *nick)
 
   hash_del_client(source_p);
   strlcpy(source_p->name, nick, sizeof(source_p->name));
+  source_p->name_len = strlen(source_p->name);
   hash_add_client(source_p);
 
   if (samenick == false)
@@ -307,6 +308,7 @@ change_remote_nick(struct Client *source_p, char *parv[])
   /* Set the new nick name */
   hash_del_client(source_p);
   strlcpy(source_p->name, parv[1], sizeof(source_p->name));
+  source_p->name_len = strlen(source_p->name);
   hash_add_client(source_p);
 
   if (samenick == false)
@@ -620,7 +622,7 @@ mr_nick(struct Client *source_p, int parc, char *parv[])
   }
 
   /* Check if the nick is resv'd */
-  const struct ResvItem *resv = resv_find(nick, match);
+  const struct ResvItem *resv = resv_match(nick);
   if (resv)
   {
     sendto_one_numeric(source_p, &me, ERR_ERRONEUSNICKNAME, nick, resv->reason);
@@ -674,7 +676,7 @@ m_nick(struct Client *source_p, int parc, char *parv[])
 
   if (!HasFlag(source_p, FLAGS_EXEMPTRESV) &&
       !(HasUMode(source_p, UMODE_OPER) && HasOFlag(source_p, OPER_FLAG_NICK_RESV)) &&
-      (resv = resv_find(nick, match)))
+      (resv = resv_match(nick)))
   {
     sendto_one_numeric(source_p, &me, ERR_ERRONEUSNICKNAME, nick, resv->reason);
     sendto_realops_flags(UMODE_REJ, L_ALL, SEND_NOTICE,
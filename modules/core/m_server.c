@@ -27,7 +27,6 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
-#include "client_svstag.h"
 #include "event.h"
 #include "hash.h"
 #include "id.h"
@@ -40,7 +39,9 @@
 #include "log.h"
 #include "misc.h"
 #include "server.h"
+#include "server_burst.h"
 #include "server_capab.h"
+#include "server_zip.h"
 #include "user.h"
 #include "send.h"
 #include "parse.h"
@@ -75,138 +76,6 @@ server_set_flags(struct Client *client_p, const char *flags)
   }
 }
 
-/*
- * send_tb
- *
- * inputs       - pointer to Client
- *              - pointer to channel
- * output       - NONE
- * side effects - Called on a server burst when
- *                server is CAPAB_TBURST capable
- */
-static void
-server_send_tburst(struct Client *client_p, const struct Channel *channel)
-{
-  /*
-   * We may also send an empty topic here, but only if topic_time isn't 0,
-   * i.e. if we had a topic that got unset.  This is required for syncing
-   * topics properly.
-   *
-   * Imagine the following scenario: Our downlink introduces a channel
-   * to us with a TS that is equal to ours, but the channel topic on
-   * their side got unset while the servers were in splitmode, which means
-   * their 'topic' is newer.  They simply wanted to unset it, so we have to
-   * deal with it in a more sophisticated fashion instead of just resetting
-   * it to their old topic they had before.  Read m_tburst.c:ms_tburst
-   * for further information   -Michael
-   */
-  if (channel->topic_time)
-    sendto_one(client_p, ":%s TBURST %ju %s %ju %s :%s", me.id,
-               channel->creation_time, channel->name,
-               channel->topic_time,
-               channel->topic_info,
-               channel->topic);
-}
-
-/* sendnick_TS()
- *
- * inputs       - client (server) to send nick towards
- *          - client to send nick for
- * output       - NONE
- * side effects - NICK message is sent towards given client_p
- */
-static void
-server_send_client(struct Client *client_p, struct Client *target_p)
-{
-  dlink_node *node;
-  char buf[UMODE_MAX_STR] = "";
-
-  assert(IsClient(target_p));
-
-  send_umode(target_p, false, 0, buf);
-
-  if (buf[0] == '\0')
-  {
-    buf[0] = '+';
-    buf[1] = '\0';
-  }
-
-  /* TBR: compatibility mode */
-  if (IsCapable(client_p, CAPAB_RHOST))
-    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s %s :%s",
-               target_p->servptr->id,
-               target_p->name, target_p->hopcount + 1,
-               target_p->tsinfo,
-               buf, target_p->username, target_p->host, target_p->realhost,
-               target_p->sockhost, target_p->id,
-               target_p->account, target_p->info);
-  else
-    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
-               target_p->servptr->id,
-               target_p->name, target_p->hopcount + 1,
-               target_p->tsinfo,
-               buf, target_p->username, target_p->host,
-               target_p->sockhost, target_p->id,
-               target_p->account, target_p->info);
-
-  if (!EmptyString(target_p->tls_certfp))
-    sendto_one(client_p, ":%s CERTFP %s", target_p->id, target_p->tls_certfp);
-
-  if (target_p->away[0])
-    sendto_one(client_p, ":%s AWAY :%s", target_p->id, target_p->away);
-
-
-  DLINK_FOREACH(node, target_p->svstags.head)
-  {
-    const struct ServicesTag *svstag = node->data;
-    char *m = buf;
-
-    for (const struct user_modes *tab = umode_tab; tab->c; ++tab)
-      if (svstag->umodes & tab->flag)
-        *m++ = tab->c;
-    *m = '\0';
-
-    sendto_one(client_p, ":%s SVSTAG %s %ju %u +%s :%s", me.id, target_p->id,
-               target_p->tsinfo, svstag->numeric, buf, svstag->tag);
-  }
-}
-
-/* burst_all()
- *
- * inputs       - pointer to server to send burst to
- * output       - NONE
- * side effects - complete burst of channels/nicks is sent to client_p
- */
-static void
-server_burst(struct Client *client_p)
-{
-  dlink_node *node;
-
-  DLINK_FOREACH(node, global_client_list.head)
-  {
-    struct Client *target_p = node->data;
-
-    if (target_p->from != client_p)
-      server_send_client(client_p, target_p);
-  }
-
-  DLINK_FOREACH(node, channel_get_list()->head)
-  {
-    const struct Channel *channel = node->data;
-
-    if (dlink_list_length(&channel->members))
-    {
-      channel_send_modes(client_p, channel);
-
-      if (IsCapable(client_p, CAPAB_TBURST))
-        server_send_tburst(client_p, channel);
-    }
-  }
-
-  /* Always send a PING after connect burst is done */
-  sendto_one(client_p, "PING :%s", me.id);
-}
-
 /* server_estab()
  *
  * inputs       - pointer to a struct Client
@@ -226,13 +95,13 @@ server_estab(struct Client *client_p)
     return;
   }
 
+  const struct MaskItem *const conf = client_p->connection->confs.head->data;
+
   if (IsUnknown(client_p))
   {
-    const struct MaskItem *const conf = client_p->connection->confs.head->data;
-
     sendto_one(client_p, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-    sendto_one(client_p, "CAPAB :%s", capab_get(NULL));
+    sendto_one(client_p, "CAPAB :%s", capab_get_link(conf));
 
     sendto_one(client_p, "SERVER %s 1 :%s%s",
                me.name, ConfigServerHide.hidden ? "(H) " : "", me.info);
@@ -241,6 +110,19 @@ server_estab(struct Client *client_p)
   sendto_one(client_p, ":%s SVINFO %u %u 0 :%ju", me.id, TS_CURRENT, TS_MINIMUM,
              event_base->time.sec_real);
 
+  /*
+   * Both ends offered ZIP only if their connect{} blocks ask for it.
+   * Everything following the SVINFO lines is compressed.
+   */
+  if (IsCapable(client_p, CAPAB_ZIP) && IsConfCompressed(conf))
+  {
+    if (server_zip_start(client_p) == false)
+    {
+      exit_client(client_p, "Unable to set up link compression");
+      return;
+    }
+  }
+
   if (IsDead(client_p))
     return;
 
@@ -342,21 +224,11 @@ server_estab(struct Client *client_p)
                target_p->info);
   }
 
-  server_burst(client_p);
-
-  if (IsCapable(client_p, CAPAB_EOB))
-  {
-    DLINK_FOREACH_PREV(node, global_server_list.tail)
-    {
-      struct Client *target_p = node->data;
-
-      if (target_p->from == client_p)
-        continue;
-
-      if (IsMe(target_p) || HasFlag(target_p, FLAGS_EOB))
-        sendto_one(client_p, ":%s EOB", target_p->id);
-    }
-  }
+  /*
+   * Clients and channels are sent as the sendq drains; PING and
+   * EOBs follow once the burst is complete. See server_burst.c
+   */
+  server_burst_start(client_p);
 }
 
 /* set_server_gecos()
@@ -96,11 +96,12 @@ mo_opme(struct Client *source_p, int parc, char *parv[])
   sendto_server(NULL, 0, 0, ":%s GLOBOPS :%s used OPME on channel %s",
                 me.id, get_oper_name(source_p), channel->name);
 
+  channel_mode_flush_status(channel);
   AddMemberFlag(member, CHFL_CHANOP);
-  sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s +o %s",
-                       me.name, channel->name, source_p->name);
-  sendto_server(NULL, 0, 0, ":%s TMODE %ju %s +o %s", me.id, channel->creation_time,
-                channel->name, source_p->id);
+
+  const struct ChModeChange change = { .letter = 'o', .arg = source_p->name,
+                                       .id = source_p->id, .dir = MODE_ADD };
+  channel_mode_queue(channel, me.name, NULL, me.id, &change, 1);
 }
 
 static struct Message opme_msgtab =
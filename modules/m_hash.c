@@ -118,6 +118,10 @@ mo_hash(struct Client *source_p, int parc, char *parv[])
 
   sendto_one_notice(source_p, &me, ":Id: entries: %u buckets: %u "
                     "max chain: %u", count, buckets, max_chain);
+
+  hash_id_local_stats(&count, &buckets);
+  sendto_one_notice(source_p, &me, ":Local id: entries: %u slots: %u",
+                    count, buckets);
 }
 
 static struct Message hash_msgtab =
@@ -337,6 +337,30 @@ static const struct InfoStruct info_table[] =
     &ConfigGeneral.disable_auth,
     "Completely disable ident lookups"
   },
+  {
+    "auth_timeout",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.auth_timeout,
+    "Maximum time to wait for DNS and ident lookups"
+  },
+  {
+    "ident_timeout",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.ident_timeout,
+    "Maximum time to wait for an ident lookup"
+  },
+  {
+    "ident_cache_time",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.ident_cache_time,
+    "Time to skip ident lookups for hosts whose identd didn't answer"
+  },
+  {
+    "ident_max_pending",
+    OUTPUT_DECIMAL,
+    &ConfigGeneral.ident_max_pending,
+    "Maximum number of ident lookups in progress per listener"
+  },
   {
     "disable_remote_commands",
     OUTPUT_BOOLEAN_YN,
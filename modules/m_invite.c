@@ -39,6 +39,7 @@
 #include "parse.h"
 #include "modules.h"
 #include "packet.h"
+#include "misc.h"
 
 
 /*! \brief INVITE command handler
@@ -109,30 +110,30 @@ m_invite(struct Client *source_p, int parc, char *parv[])
     return;
   }
 
-  if ((source_p->connection->invite.last_attempt + ConfigChannel.invite_client_time) < event_base->time.sec_monotonic)
-    source_p->connection->invite.count = 0;
+  /* A client may invite invite_client_count times per invite_client_time */
+  const unsigned int count = IRCD_MAX(ConfigChannel.invite_client_count, 1);
+  const uintmax_t interval = ConfigChannel.invite_client_time * 1000 / count;
 
-  if (source_p->connection->invite.count > ConfigChannel.invite_client_count)
+  if (token_bucket_wait(&source_p->connection->invite_bucket, count, interval))
   {
     sendto_one_numeric(source_p, &me, ERR_TOOMANYINVITE, channel->name, "user");
     return;
   }
 
-  if ((channel->last_invite_time + ConfigChannel.invite_delay_channel) > event_base->time.sec_monotonic)
+  if (token_bucket_wait(&channel->invite_bucket, 1, ConfigChannel.invite_delay_channel * 1000))
   {
     sendto_one_numeric(source_p, &me, ERR_TOOMANYINVITE, channel->name, "channel");
     return;
   }
 
-  source_p->connection->invite.last_attempt = event_base->time.sec_monotonic;
-  source_p->connection->invite.count++;
+  token_bucket_take(&source_p->connection->invite_bucket, count, interval);
 
   sendto_one_numeric(source_p, &me, RPL_INVITING, target_p->name, channel->name);
 
   if (target_p->away[0])
     sendto_one_numeric(source_p, &me, RPL_AWAY, target_p->name, target_p->away);
 
-  channel->last_invite_time = event_base->time.sec_monotonic;
+  token_bucket_take(&channel->invite_bucket, 1, ConfigChannel.invite_delay_channel * 1000);
 
   if (MyConnect(target_p))
   {
@@ -190,7 +191,7 @@ ms_invite(struct Client *source_p, int parc, char *parv[])
   if (strtoumax(parv[3], NULL, 10) > channel->creation_time)
     return;
 
-  channel->last_invite_time = event_base->time.sec_monotonic;
+  token_bucket_take(&channel->invite_bucket, 1, ConfigChannel.invite_delay_channel * 1000);
 
   if (MyConnect(target_p))
   {
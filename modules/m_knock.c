@@ -40,6 +40,7 @@
 #include "server_capab.h"
 #include "user.h"
 #include "isupport.h"
+#include "misc.h"
 
 
 /*! \brief KNOCK command handler
@@ -97,28 +98,29 @@ m_knock(struct Client *source_p, int parc, char *parv[])
       return;
     }
 
-    if ((source_p->connection->knock.last_attempt + ConfigChannel.knock_client_time) < event_base->time.sec_monotonic)
-      source_p->connection->knock.count = 0;
+    /* A client may knock knock_client_count times per knock_client_time */
+    const unsigned int count = IRCD_MAX(ConfigChannel.knock_client_count, 1);
+    const uintmax_t interval = ConfigChannel.knock_client_time * 1000 / count;
 
-    if (source_p->connection->knock.count > ConfigChannel.knock_client_count)
+    if (token_bucket_wait(&source_p->connection->knock_bucket, count, interval))
     {
       sendto_one_numeric(source_p, &me, ERR_TOOMANYKNOCK, channel->name, "user");
       return;
     }
 
-    if ((channel->last_knock_time + ConfigChannel.knock_delay_channel) > event_base->time.sec_monotonic)
+    if (token_bucket_wait(&channel->knock_bucket, 1, ConfigChannel.knock_delay_channel * 1000))
     {
       sendto_one_numeric(source_p, &me, ERR_TOOMANYKNOCK, channel->name, "channel");
       return;
     }
 
-    source_p->connection->knock.last_attempt = event_base->time.sec_monotonic;
-    source_p->connection->knock.count++;
+    token_bucket_take(&source_p->connection->knock_bucket, count, interval);
 
     sendto_one_numeric(source_p, &me, RPL_KNOCKDLVR, channel->name);
   }
 
-  channel->last_knock_time = event_base->time.sec_monotonic;
+  /* Remote knocks count towards the channel limit, but aren't held back by it */
+  token_bucket_take(&channel->knock_bucket, 1, ConfigChannel.knock_delay_channel * 1000);
   sendto_channel_local(NULL, channel, CHFL_CHANOP | CHFL_HALFOP, 0, 0,
                        ":%s NOTICE %%%s :KNOCK: %s (%s [%s@%s] has asked for an invite)",
                        me.name, channel->name, channel->name,
@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "channel_index.h"
 #include "hash.h"
 #include "irc_string.h"
 #include "ircd.h"
@@ -39,6 +40,41 @@
 #include "isupport.h"
 
 
+/* list_choose_index()
+ *
+ * inputs       - pointer to a list task
+ * output       - NONE
+ * side effects - picks the channel index that lets the list task skip
+ *                the most channels which can't match, and where to
+ *                start walking it
+ */
+static void
+list_choose_index(struct ListTask *lt)
+{
+  if (dlink_list_length(&lt->show_mask) == 1)
+  {
+    const char *const mask = lt->show_mask.head->data;
+    const size_t len = strcspn(mask, "*?\\");
+
+    if (len < sizeof(lt->prefix))
+      strlcpy(lt->prefix, mask, len + 1);
+  }
+
+  /* In top N mode channels have to come in member count order anyway */
+  if (lt->top_max == UINT_MAX && lt->prefix[1])
+  {
+    lt->index = CHANNEL_INDEX_NAME;
+    strlcpy(lt->index_name, lt->prefix, sizeof(lt->index_name));
+  }
+  else if (lt->top_max != UINT_MAX || lt->users_min || lt->users_max != UINT_MAX)
+  {
+    lt->index = CHANNEL_INDEX_USERS;
+    lt->index_users = lt->users_max;
+  }
+  else
+    lt->index = CHANNEL_INDEX_LAST;
+}
+
 static void
 do_list(struct Client *source_p, char *arg)
 {
@@ -55,6 +91,7 @@ do_list(struct Client *source_p, char *arg)
   lt->users_max = UINT_MAX;
   lt->created_max = UINT_MAX;
   lt->topicts_max = UINT_MAX;
+  lt->top_max = UINT_MAX;
   source_p->connection->list_task = lt;
   dlinkAdd(source_p, &lt->node, &listing_client_list);
 
@@ -82,6 +119,12 @@ do_list(struct Client *source_p, char *arg)
           else
             error = true;
           break;
+        case '^':
+          if ((i = atoi(opt + 1)) > 0)
+            lt->top_max = (unsigned int)i;
+          else
+            error = true;
+          break;
         case 'C':
         case 'c':
           switch (*++opt)
@@ -160,6 +203,8 @@ do_list(struct Client *source_p, char *arg)
     }
   }
 
+  list_choose_index(lt);
+
   sendto_one_numeric(source_p, &me, RPL_LISTSTART);
   safe_list_channels(source_p, no_masked_channels && lt->show_mask.head != NULL);
 }
@@ -148,7 +148,7 @@ monitor_list(struct Client *source_p)
 
   DLINK_FOREACH(node, source_p->connection->monitors.head)
   {
-    const struct Monitor *monitor = node->data;
+    const struct Monitor *monitor = ((const struct MonitorSubscription *)node->data)->monitor;
 
     if ((bufptr - buf) + strlen(monitor->name) + 1 /* +1 for comma */ + len > sizeof(buf))
     {
@@ -182,7 +182,7 @@ monitor_status(struct Client *source_p)
 
   DLINK_FOREACH(node, source_p->connection->monitors.head)
   {
-    const struct Monitor *monitor = node->data;
+    const struct Monitor *monitor = ((const struct MonitorSubscription *)node->data)->monitor;
 
     const struct Client *target_p = find_person(source_p, monitor->name);
     if (target_p == NULL)
@@ -92,6 +92,31 @@ quote_autoconnall(struct Client *source_p, const char *arg, int newval)
                       status[GlobalSetOptions.autoconn == true]);
 }
 
+/* SET PROFILING */
+static void
+quote_profiling(struct Client *source_p, const char *arg, int newval)
+{
+  static const char *const status[] =
+  {
+    "OFF", "ON"
+  };
+
+  if (newval >= 0)
+  {
+    /* Start over, so that STATS M covers just the time since */
+    if (newval && GlobalSetOptions.profiling == false)
+      parse_profile_reset();
+
+    GlobalSetOptions.profiling = newval != 0;
+    sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
+                         "%s has changed PROFILING to %s",
+                         get_oper_name(source_p), status[GlobalSetOptions.profiling == true]);
+  }
+  else
+    sendto_one_notice(source_p, &me, ":PROFILING is currently %s",
+                      status[GlobalSetOptions.profiling == true]);
+}
+
 /* SET FLOODCOUNT */
 static void
 quote_floodcount(struct Client *source_p, const char *arg, int newval)
@@ -246,6 +271,7 @@ static const struct SetStruct set_cmd_table[] =
   { "FLOODCOUNT",       quote_floodcount,   false,  true  },
   { "FLOODTIME",        quote_floodtime,    false,  true  },
   { "MAX",              quote_max,          false,  true  },
+  { "PROFILING",        quote_profiling,    false,  true  },
   { "SPAMNUM",          quote_spamnum,      false,  true  },
   { "SPAMTIME",         quote_spamtime,     false,  true  },
   { "JFLOODTIME",       quote_jfloodtime,   false,  true  },
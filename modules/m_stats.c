@@ -27,6 +27,8 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "client_index.h"
+#include "hash.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "listener.h"
@@ -34,6 +36,7 @@
 #include "conf.h"
 #include "conf_class.h"
 #include "conf_cluster.h"
+#include "conf_expire.h"
 #include "conf_gecos.h"
 #include "conf_pseudo.h"
 #include "conf_resv.h"
@@ -45,6 +48,8 @@
 #include "fdlist.h"
 #include "misc.h"
 #include "server.h"
+#include "server_burst.h"
+#include "server_zip.h"
 #include "server_capab.h"
 #include "event.h"
 #include "modules.h"
@@ -54,7 +59,11 @@
 #include "motd.h"
 #include "ipcache.h"
 #include "channel.h"
+#include "channel_index.h"
 #include "channel_invite.h"
+#include "tls_pool.h"
+#include "auth.h"
+#include "loop_stats.h"
 
 
 static const char *
@@ -270,6 +279,8 @@ stats_connect(struct Client *source_p, int parc, char *parv[])
       *p++ = 'A';
     if (IsConfTLS(conf))
       *p++ = 'S';
+    if (IsConfCompressed(conf))
+      *p++ = 'Z';
     if (p == buf)
       *p++ = '*';
 
@@ -340,6 +351,17 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   unsigned int safelist_count = 0;
   size_t safelist_memory = 0;
 
+  unsigned int channel_index_nodes = 0;
+  size_t channel_index_memory = 0;
+
+  unsigned int host_index_nodes = 0;
+  size_t host_index_memory = 0;
+
+  unsigned int expire_queue_entries = 0;
+  size_t expire_queue_memory = 0;
+  unsigned int gecos_nodes = 0;
+  size_t gecos_memory = 0;
+
   size_t wwm = 0;               /* whowas array memory used       */
   size_t mem_ips_stored = 0;        /* memory used by ip address hash */
 
@@ -352,6 +374,8 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
   unsigned int monitor_list_headers = 0;   /* monitorlist headers     */
   unsigned int monitor_list_entries = 0;   /* monitorlist entries     */
   size_t monitor_list_memory = 0; /* monitorlist memory used */
+  unsigned int monitor_batches = 0;  /* pending RPL_MONONLINE batches */
+  size_t monitor_batch_memory = 0;
 
   unsigned int listener_count = 0;
   size_t listener_memory = 0;
@@ -416,13 +440,33 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      monitor_list_headers,
                      monitor_list_memory,
                      monitor_list_entries,
-                     monitor_list_entries * sizeof(dlink_node) * 2);
+                     monitor_list_entries * sizeof(struct MonitorSubscription));
+
+  monitor_batch_count_memory(&monitor_batches, &monitor_batch_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :MONITOR batches %u(%zu)",
+                     monitor_batches, monitor_batch_memory);
 
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Clients %u(%zu)",
                      dlink_list_length(&global_client_list),
                      dlink_list_length(&global_client_list) * sizeof(struct Client));
 
+  client_index_count_memory(&host_index_nodes, &host_index_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Host index nodes %u(%zu)",
+                     host_index_nodes, host_index_memory);
+
+  conf_expire_count_memory(&expire_queue_entries, &expire_queue_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Expiry queue entries %u(%zu)",
+                     expire_queue_entries, expire_queue_memory);
+
+  gecos_count_memory(&gecos_nodes, &gecos_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :X-line matcher nodes %u(%zu)",
+                     gecos_nodes, gecos_memory);
+
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Servers %u(%zu, %zu)",
                      dlink_list_length(&global_server_list),
@@ -456,6 +500,11 @@ stats_memory(struct Client *source_p, int parc, char *parv[])
                      dlink_list_length(channel_get_list()),
                      dlink_list_length(channel_get_list()) * sizeof(struct Channel));
 
+  channel_index_count_memory(&channel_index_nodes, &channel_index_memory);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "z :Channel index nodes %u(%zu)",
+                     channel_index_nodes, channel_index_memory);
+
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "z :Bans %u(%zu)",
                      channel_bans, channel_ban_memory);
@@ -508,8 +557,7 @@ stats_dns_servers(struct Client *source_p, int parc, char *parv[])
 
   for (unsigned int i = 0; i < irc_nscount; ++i)
   {
-    getnameinfo((const struct sockaddr *)&irc_nsaddr_list[i], irc_nsaddr_list[i].ss_len,
-                ipaddr, sizeof(ipaddr), NULL, 0, NI_NUMERICHOST);
+    address_format(&irc_nsaddr_list[i], ipaddr, sizeof(ipaddr));
     sendto_one_numeric(source_p, &me, RPL_STATSALINE, ipaddr);
   }
 }
@@ -818,6 +866,18 @@ stats_messages(struct Client *source_p, int parc, char *parv[])
     report_messages(source_p);
 }
 
+static void
+stats_messages_profile(struct Client *source_p, int parc, char *parv[])
+{
+  report_messages_profile(source_p);
+}
+
+static void
+stats_loop(struct Client *source_p, int parc, char *parv[])
+{
+  loop_stats_report(source_p);
+}
+
 static void
 stats_pseudo(struct Client *source_p, int parc, char *parv[])
 {
@@ -913,6 +973,10 @@ stats_ports(struct Client *source_p, int parc, char *parv[])
       *p++ = 'T';
     if (listener_has_flag(listener, LISTENER_DEFER))
       *p++ = 'D';
+    if (listener_has_flag(listener, LISTENER_REUSEPORT))
+      *p++ = 'R';
+    if (listener_has_flag(listener, LISTENER_METRICS))
+      *p++ = 'M';
     *p = '\0';
 
     if (HasUMode(source_p, UMODE_ADMIN) && ConfigServerHide.hide_server_ips == 0)
@@ -924,6 +988,12 @@ stats_ports(struct Client *source_p, int parc, char *parv[])
       sendto_one_numeric(source_p, &me, RPL_STATSPLINE, 'P', listener->port,
                          me.name, listener->ref_count, buf,
                          listener->active == true ? "active" : "disabled");
+
+    if (HasUMode(source_p, UMODE_OPER))
+      sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                         "P :%d accepted %ju (%u/s) dropped %ju queues %u",
+                         listener->port, listener->accepted, listener_accept_rate(listener),
+                         listener->dropped, listener->fd_count);
   }
 }
 
@@ -971,6 +1041,56 @@ stats_tstats(struct Client *source_p, int parc, char *parv[])
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :auth successes %u fails %u",
                      sp.is_asuc, sp.is_abad);
+
+  const unsigned int queries = IRCD_MAX(sp.is_asuc + sp.is_abad, 1);
+  unsigned int dns_budget, ident_budget;
+  auth_get_budget(&dns_budget, &ident_budget);
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :auth success %u%% timeout %u%% refused %u%% skipped cached %u limited %u",
+                     sp.is_asuc * 100 / queries, sp.is_atmo * 100 / queries,
+                     sp.is_aref * 100 / queries, sp.is_acch, sp.is_alim);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :auth time limit dns %us ident %us",
+                     dns_budget, ident_budget);
+
+  for (unsigned int phase = 0; phase < AUTH_PHASE_LAST; ++phase)
+  {
+    static const char *const phase_names[AUTH_PHASE_LAST] =
+    {
+      [AUTH_PHASE_DNS] = "dns",
+      [AUTH_PHASE_IDENT] = "ident",
+      [AUTH_PHASE_AUTH] = "auth",
+      [AUTH_PHASE_REGISTER] = "register"
+    };
+    const unsigned int *histogram = auth_get_histogram(phase);
+    char buf[IRCD_BUFSIZE];
+    size_t len = 0;
+
+    /* Bucket n counts times below 2^n ms */
+    for (unsigned int i = 0; i < AUTH_HISTOGRAM_BUCKETS && len < sizeof(buf); ++i)
+      if (histogram[i])
+        len += snprintf(buf + len, sizeof(buf) - len, " %s%u:%u",
+                        i == AUTH_HISTOGRAM_BUCKETS - 1 ? ">=" : "<",
+                        1U << (i == AUTH_HISTOGRAM_BUCKETS - 1 ? i - 1 : i), histogram[i]);
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "t :auth %s ms%s", phase_names[phase], len ? buf : " none");
+  }
+
+  unsigned int tls_entries, tls_size;
+  tls_session_cache_stats(&tls_entries, &tls_size);
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :TLS handshakes %u resumed %u session cache %u/%u",
+                     sp.is_tls, sp.is_tlsr, tls_entries, tls_size);
+
+  unsigned int tls_threads, tls_queued;
+  tls_pool_stats(&tls_threads, &tls_queued);
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "t :TLS handshake threads %u queued %u",
+                     tls_threads, tls_queued);
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
                      "t :Client Server");
   sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
@@ -1083,6 +1203,40 @@ stats_servlinks(struct Client *source_p, int parc, char *parv[])
                capab_get(target_p));
   }
 
+  DLINK_FOREACH(node, local_server_list.head)
+  {
+    const struct Client *target_p = node->data;
+    const struct ZipStats *zs = server_zip_stats(target_p);
+
+    if (zs == NULL)
+      continue;
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "? :Compression for %s: out %ju KiB -> %ju KiB (%4.1f%%), "
+                       "in %ju KiB -> %ju KiB (%4.1f%%), %ju ms CPU",
+                       target_p->name,
+                       zs->out_raw >> 10, zs->out_zip >> 10,
+                       (float)(zs->out_zip * 100) / (float)(zs->out_raw ? zs->out_raw : 1),
+                       zs->in_zip >> 10, zs->in_raw >> 10,
+                       (float)(zs->in_zip * 100) / (float)(zs->in_raw ? zs->in_raw : 1),
+                       zs->usec / 1000);
+  }
+
+  DLINK_FOREACH(node, bursting_server_list.head)
+  {
+    const struct Client *target_p = node->data;
+    const struct BurstTask *bt = target_p->connection->burst_task;
+    const uintmax_t elapsed = event_base->time.sec_monotonic - bt->started;
+
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "? :Burst to %s: clients %u/%u, channel buckets %u/%u, "
+                       "channels %u, %ju KiB in %ju seconds (%4.1f KiB/s)",
+                       target_p->name, bt->clients_sent, bt->clients_total,
+                       bt->hash_index, HASHSIZE, bt->channels_sent,
+                       bt->bytes >> 10, elapsed,
+                       (float)((float)(bt->bytes >> 10) / (float)(elapsed ? elapsed : 1)));
+  }
+
   sendB >>= 10;
   recvB >>= 10;
 
@@ -1242,13 +1396,14 @@ static const struct StatsStruct  stats_tab[] =
   { .letter = 'l', .handler = stats_ltrace, .required_modes = UMODE_OPER },
   { .letter = 'L', .handler = stats_ltrace, .required_modes = UMODE_OPER },
   { .letter = 'm', .handler = stats_messages },
-  { .letter = 'M', .handler = stats_messages },
+  { .letter = 'M', .handler = stats_messages_profile, .required_modes = UMODE_OPER },
   { .letter = 'o', .handler = stats_operator },
   { .letter = 'O', .handler = stats_operator },
   { .letter = 'p', .handler = stats_operedup },
   { .letter = 'P', .handler = stats_ports },
   { .letter = 'q', .handler = stats_resv, .required_modes = UMODE_OPER },
   { .letter = 'Q', .handler = stats_resv, .required_modes = UMODE_OPER },
+  { .letter = 'r', .handler = stats_loop, .required_modes = UMODE_OPER },
   { .letter = 's', .handler = stats_pseudo, .required_modes = UMODE_OPER },
   { .letter = 'S', .handler = stats_service, .required_modes = UMODE_OPER },
   { .letter = 't', .handler = stats_tstats, .required_modes = UMODE_OPER },
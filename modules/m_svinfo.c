@@ -33,6 +33,7 @@
 #include "log.h"
 #include "parse.h"
 #include "modules.h"
+#include "server_zip.h"
 
 
 /*! \brief SVINFO command handler
@@ -55,6 +56,13 @@ ms_svinfo(struct Client *source_p, int parc, char *parv[])
   if (!IsServer(source_p) || !MyConnect(source_p))
     return;
 
+  /* On a compressed link, whatever follows SVINFO is compressed */
+  if (server_zip_recv_start(source_p) == false)
+  {
+    exit_client(source_p, "Corrupt compressed data");
+    return;
+  }
+
   if (TS_CURRENT < atoi(parv[2]) || atoi(parv[1]) < TS_MINIMUM)
   {
     /*
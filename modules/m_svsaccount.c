@@ -26,6 +26,7 @@
 
 #include "stdinc.h"
 #include "client.h"
+#include "client_index.h"
 #include "ircd.h"
 #include "send.h"
 #include "parse.h"
@@ -60,7 +61,9 @@ ms_svsaccount(struct Client *source_p, int parc, char *parv[])
   if (ts && (ts != target_p->tsinfo))
     return;
 
+  client_index_account_del(target_p);
   strlcpy(target_p->account, parv[3], sizeof(target_p->account));
+  client_index_account_add(target_p);
   sendto_common_channels_local(target_p, true, CAP_ACCOUNT_NOTIFY, 0, ":%s!%s@%s ACCOUNT %s",
                                target_p->name, target_p->username,
                                target_p->host, target_p->account);
@@ -28,6 +28,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "client_index.h"
 #include "client_svstag.h"
 #include "ircd.h"
 #include "send.h"
@@ -90,7 +91,9 @@ ms_svsmode(struct Client *source_p, int parc, char *parv[])
       case 'd':
         if (!EmptyString(extarg))
         {
+          client_index_account_del(target_p);
           strlcpy(target_p->account, extarg, sizeof(target_p->account));
+          client_index_account_add(target_p);
           sendto_common_channels_local(target_p, true, CAP_ACCOUNT_NOTIFY, 0, ":%s!%s@%s ACCOUNT %s",
                                        target_p->name, target_p->username,
                                        target_p->host, target_p->account);
@@ -134,6 +134,7 @@ ms_svsnick(struct Client *source_p, int parc, char *parv[])
 
   hash_del_client(target_p);
   strlcpy(target_p->name, new_nick, sizeof(target_p->name));
+  target_p->name_len = strlen(target_p->name);
   hash_add_client(target_p);
 
   monitor_signon(target_p);
@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "client_index.h"
 #include "channel.h"
 #include "channel_mode.h"
 #include "hash.h"
@@ -36,17 +37,223 @@
 #include "send.h"
 #include "irc_string.h"
 #include "conf.h"
+#include "conf_class.h"
+#include "dbuf.h"
 #include "parse.h"
 #include "modules.h"
 #include "hostmask.h"
+#include "isupport.h"
 
 
 enum { WHO_MAX_REPLIES = 500 };
 
+/* Attributes a mask is matched against; WHO <mask> <nuhisra> */
+enum
+{
+  WHO_MATCH_NICK     = 1 << 0,
+  WHO_MATCH_USER     = 1 << 1,
+  WHO_MATCH_HOST     = 1 << 2,
+  WHO_MATCH_IP       = 1 << 3,  /**< Opers only */
+  WHO_MATCH_SERVER   = 1 << 4,
+  WHO_MATCH_REALNAME = 1 << 5,
+  WHO_MATCH_ACCOUNT  = 1 << 6,
+  WHO_MATCH_REALHOST = 1 << 7,  /**< Opers only; can't be selected explicitly */
+  WHO_MATCH_DEFAULT  = WHO_MATCH_NICK | WHO_MATCH_USER | WHO_MATCH_HOST | WHO_MATCH_IP |
+                       WHO_MATCH_SERVER | WHO_MATCH_REALNAME | WHO_MATCH_REALHOST
+};
+
+/* Fields of a WHOX reply; WHO <mask> %<tcuihsnfdlaor> */
+enum
+{
+  WHO_FIELD_QUERYTYPE = 1 << 0,
+  WHO_FIELD_CHANNEL   = 1 << 1,
+  WHO_FIELD_USER      = 1 << 2,
+  WHO_FIELD_IP        = 1 << 3,
+  WHO_FIELD_HOST      = 1 << 4,
+  WHO_FIELD_SERVER    = 1 << 5,
+  WHO_FIELD_NICK      = 1 << 6,
+  WHO_FIELD_FLAGS     = 1 << 7,
+  WHO_FIELD_HOPS      = 1 << 8,
+  WHO_FIELD_IDLE      = 1 << 9,
+  WHO_FIELD_ACCOUNT   = 1 << 10,
+  WHO_FIELD_OPLEVEL   = 1 << 11,
+  WHO_FIELD_REALNAME  = 1 << 12
+};
+
+/*! \brief WhoQuery structure */
+struct WhoQuery
+{
+  struct Client *source_p;  /**< Client that has sent the WHO */
+  const char *mask;  /**< NULL to match everyone */
+  unsigned int match;  /**< WHO_MATCH_* attributes to match mask against */
+  unsigned int fields;  /**< WHO_FIELD_* fields to send; 0 for a plain RPL_WHOREPLY */
+  unsigned int replies_left;
+  bool opers_only;
+  bool limit_exceeded;
+  char querytype[4];  /**< Up to three digits echoed in the 't' field */
+  int cidr_type;  /**< parse_netmask() result for mask */
+  int cidr_bits;
+  struct irc_ssaddr cidr_addr;
+};
+
+static const struct
+{
+  char letter;
+  unsigned int field;
+} who_field_tab[] =
+{
+  { 't', WHO_FIELD_QUERYTYPE },
+  { 'c', WHO_FIELD_CHANNEL   },
+  { 'u', WHO_FIELD_USER      },
+  { 'i', WHO_FIELD_IP        },
+  { 'h', WHO_FIELD_HOST      },
+  { 's', WHO_FIELD_SERVER    },
+  { 'n', WHO_FIELD_NICK      },
+  { 'f', WHO_FIELD_FLAGS     },
+  { 'd', WHO_FIELD_HOPS      },
+  { 'l', WHO_FIELD_IDLE      },
+  { 'a', WHO_FIELD_ACCOUNT   },
+  { 'o', WHO_FIELD_OPLEVEL   },
+  { 'r', WHO_FIELD_REALNAME  },
+  { '\0', 0 }
+};
+
+
+/* who_parse_options()
+ *
+ * inputs       - pointer to query to fill in
+ *              - the second WHO argument, may be NULL
+ * output       - NONE
+ * side effects - parses "[o][nuhisra][%fields[,querytype]]"
+ */
+static void
+who_parse_options(struct WhoQuery *who, const char *options)
+{
+  who->match = 0;
+
+  for (; options && *options && *options != '%'; ++options)
+  {
+    switch (*options)
+    {
+      case 'o': who->opers_only = true; break;
+      case 'n': who->match |= WHO_MATCH_NICK; break;
+      case 'u': who->match |= WHO_MATCH_USER; break;
+      case 'h': who->match |= WHO_MATCH_HOST; break;
+      case 'i': who->match |= WHO_MATCH_IP; break;
+      case 's': who->match |= WHO_MATCH_SERVER; break;
+      case 'r': who->match |= WHO_MATCH_REALNAME; break;
+      case 'a': who->match |= WHO_MATCH_ACCOUNT; break;
+      default: break;
+    }
+  }
+
+  if (who->match == 0)
+    who->match = WHO_MATCH_DEFAULT;
+
+  if (options == NULL || *options != '%')
+    return;
+
+  for (++options; *options && *options != ','; ++options)
+    for (unsigned int i = 0; who_field_tab[i].letter; ++i)
+      if (who_field_tab[i].letter == *options)
+        who->fields |= who_field_tab[i].field;
+
+  if (*options == ',')
+  {
+    const char *token = options + 1;
+    size_t len = strspn(token, "0123456789");
+
+    if (len > 0 && len < sizeof(who->querytype) && token[len] == '\0')
+      strlcpy(who->querytype, token, sizeof(who->querytype));
+  }
+}
+
+/* who_send_whox()
+ *
+ * inputs       - pointer to query
+ *              - pointer to client to do who on
+ *              - The reported name
+ *              - status flags as shown in a plain RPL_WHOREPLY
+ * output       - NONE
+ * side effects - sends a RPL_WHOSPCRPL with the requested fields,
+ *                in the fixed order of who_field_tab
+ */
+static void
+who_send_whox(const struct WhoQuery *who, const struct Client *target_p,
+              const char *name, const char *status)
+{
+  struct Client *const source_p = who->source_p;
+  const bool hide_server = !HasUMode(source_p, UMODE_OPER) &&
+                           (ConfigServerHide.hide_servers || IsHidden(target_p->servptr));
+  char buf[IRCD_BUFSIZE] = "";
+  char num[16];
+  size_t len = 0;
+
+  for (unsigned int i = 0; who_field_tab[i].letter && len < sizeof(buf); ++i)
+  {
+    const char *value = NULL;
+
+    switch (who->fields & who_field_tab[i].field)
+    {
+      case WHO_FIELD_QUERYTYPE:
+        value = who->querytype[0] ? who->querytype : "0";
+        break;
+      case WHO_FIELD_CHANNEL:
+        value = name ? name : "*";
+        break;
+      case WHO_FIELD_USER:
+        value = target_p->username;
+        break;
+      case WHO_FIELD_IP:
+        value = HasUMode(source_p, UMODE_OPER) ? target_p->sockhost : "255.255.255.255";
+        break;
+      case WHO_FIELD_HOST:
+        value = target_p->host;
+        break;
+      case WHO_FIELD_SERVER:
+        value = hide_server ? "*" : target_p->servptr->name;
+        break;
+      case WHO_FIELD_NICK:
+        value = target_p->name;
+        break;
+      case WHO_FIELD_FLAGS:
+        value = status;
+        break;
+      case WHO_FIELD_HOPS:
+        snprintf(num, sizeof(num), "%u", hide_server ? 0 : target_p->hopcount);
+        value = num;
+        break;
+      case WHO_FIELD_IDLE:
+        if (MyConnect(target_p) && (!HasUMode(target_p, UMODE_HIDEIDLE) ||
+                                    HasUMode(source_p, UMODE_OPER) || source_p == target_p))
+          snprintf(num, sizeof(num), "%u", client_get_idle_time(source_p, target_p));
+        else
+          strlcpy(num, "0", sizeof(num));
+        value = num;
+        break;
+      case WHO_FIELD_ACCOUNT:
+        value = strcmp(target_p->account, "*") ? target_p->account : "0";
+        break;
+      case WHO_FIELD_OPLEVEL:
+        value = "n/a";
+        break;
+      case WHO_FIELD_REALNAME:
+        len += snprintf(buf + len, sizeof(buf) - len, "%s:%s", len ? " " : "", target_p->info);
+        break;
+      default:
+        break;
+    }
+
+    if (value)
+      len += snprintf(buf + len, sizeof(buf) - len, "%s%s", len ? " " : "", value);
+  }
+
+  sendto_one_numeric(source_p, &me, RPL_WHOSPCRPL, buf);
+}
 
 /* do_who()
  *
- * inputs       - pointer to client requesting who
+ * inputs       - pointer to query
  *              - pointer to client to do who on
  *              - The reported name
  *              - channel flags
@@ -54,9 +261,10 @@ enum { WHO_MAX_REPLIES = 500 };
  * side effects - do a who on given person
  */
 static void
-do_who(struct Client *source_p, const struct Client *target_p,
+do_who(const struct WhoQuery *who, const struct Client *target_p,
        const char *name, const char *op_flags)
 {
+  struct Client *const source_p = who->source_p;
   char status[8];  /* sizeof("GBr*@%+") + 1 */
 
   if (HasUMode(source_p, UMODE_OPER))
@@ -71,7 +279,9 @@ do_who(struct Client *source_p, const struct Client *target_p,
              HasUMode(target_p, UMODE_OPER) &&
              !HasUMode(target_p, UMODE_HIDDEN) ? "*" : "", op_flags);
 
-  if (ConfigServerHide.hide_servers || IsHidden(target_p->servptr))
+  if (who->fields)
+    who_send_whox(who, target_p, name, status);
+  else if (ConfigServerHide.hide_servers || IsHidden(target_p->servptr))
     sendto_one_numeric(source_p, &me, RPL_WHOREPLY,
                (name) ? (name) : "*",
                target_p->username, target_p->host,
@@ -86,70 +296,114 @@ do_who(struct Client *source_p, const struct Client *target_p,
 }
 
 /*!
- * \param source_p Pointer to client requesting who
+ * \param who      Pointer to query
  * \param target_p Pointer to client to do who on
- * \param mask Mask to match
  * \return true if mask matches, false otherwise
  */
 static bool
-who_matches(struct Client *source_p, struct Client *target_p, const char *mask)
+who_matches(const struct WhoQuery *who, const struct Client *target_p)
 {
+  const struct Client *const source_p = who->source_p;
+  const char *const mask = who->mask;
+
   if (mask == NULL)
     return true;
 
-  if (match(mask, target_p->name) == 0)
+  if ((who->match & WHO_MATCH_NICK) && match(mask, target_p->name) == 0)
+    return true;
+
+  if ((who->match & WHO_MATCH_USER) && match(mask, target_p->username) == 0)
     return true;
 
-  if (match(mask, target_p->username) == 0)
+  if ((who->match & WHO_MATCH_HOST) && match(mask, target_p->host) == 0)
     return true;
 
-  if (match(mask, target_p->host) == 0)
+  if ((who->match & WHO_MATCH_REALNAME) && match(mask, target_p->info) == 0)
     return true;
 
-  if (match(mask, target_p->info) == 0)
+  if ((who->match & WHO_MATCH_ACCOUNT) && strcmp(target_p->account, "*") &&
+      match(mask, target_p->account) == 0)
     return true;
 
   if (HasUMode(source_p, UMODE_OPER))
   {
-    int bits = 0;
-    struct irc_ssaddr addr;
-
-    switch (parse_netmask(mask, &addr, &bits))
+    if (who->match & WHO_MATCH_IP)
     {
-      case HM_IPV6:
-      case HM_IPV4:
-        if (address_compare(&target_p->ip, &addr, false, false, bits) == true)
-          return true;
+      switch (who->cidr_type)
+      {
+        case HM_IPV6:
+        case HM_IPV4:
+          if (address_compare(&target_p->ip, &who->cidr_addr, false, false, who->cidr_bits) == true)
+            return true;
+      }
+
+      if (match(mask, target_p->sockhost) == 0)
+        return true;
     }
 
-    if (match(mask, target_p->sockhost) == 0)
-      return true;
-    if (match(mask, target_p->realhost) == 0)
+    if ((who->match & WHO_MATCH_REALHOST) && match(mask, target_p->realhost) == 0)
       return true;
   }
 
-  if (HasUMode(source_p, UMODE_OPER) ||
-      (ConfigServerHide.hide_servers == 0 && !IsHidden(target_p->servptr)))
-    if (match(mask, target_p->servptr->name) == 0)
-      return true;
+  if (who->match & WHO_MATCH_SERVER)
+    if (HasUMode(source_p, UMODE_OPER) ||
+        (ConfigServerHide.hide_servers == 0 && !IsHidden(target_p->servptr)))
+      if (match(mask, target_p->servptr->name) == 0)
+        return true;
+
+  return false;
+}
+
+/* who_send_counted()
+ *
+ * inputs       - pointer to query
+ *              - pointer to client to do who on
+ * output       - false once the reply budget of the query is spent
+ * side effects - sends a reply as part of a global WHO
+ *
+ * Opers may get as many replies as fit into half their sendq; everyone
+ * else is limited to WHO_MAX_REPLIES in addition. Running out of sendq
+ * is reported with its own numeric, as it doesn't depend on a fixed
+ * number of replies.
+ */
+static bool
+who_send_counted(struct WhoQuery *who, const struct Client *target_p)
+{
+  struct Client *const source_p = who->source_p;
+
+  do_who(who, target_p, NULL, "");
 
+  if (--who->replies_left == 0)
+    sendto_one_numeric(source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
+  else if (dbuf_length(&source_p->connection->buf_sendq) > get_sendq(&source_p->connection->confs) / 2)
+    sendto_one_numeric(source_p, &me, ERR_QUERYTOOLONG, "WHO");
+  else
+    return true;
+
+  who->limit_exceeded = true;
   return false;
 }
 
+static bool
+who_opers_only_skip(const struct WhoQuery *who, const struct Client *target_p)
+{
+  if (who->opers_only == false)
+    return false;
+
+  return !HasUMode(target_p, UMODE_OPER) ||
+         (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(who->source_p, UMODE_OPER));
+}
+
 /* who_common_channel
- * inputs	- pointer to client requesting who
+ * inputs	- pointer to query
  * 		- pointer to channel member chain.
- *		- char * mask to match
- *		- int if oper on a server or not
- *		- pointer to int maxmatches
- * output	- NONE
+ * output	- false once the reply budget of the query is spent
  * side effects - lists matching clients on specified channel,
  * 		  marks matched clients.
  *
  */
-static void
-who_common_channel(struct Client *source_p, struct Channel *channel, const char *mask,
-                   bool server_oper, unsigned int *maxmatches)
+static bool
+who_common_channel(struct WhoQuery *who, struct Channel *channel)
 {
   dlink_node *node;
 
@@ -160,43 +414,144 @@ who_common_channel(struct Client *source_p, struct Channel *channel, const char
     if (!HasUMode(target_p, UMODE_INVISIBLE) || HasFlag(target_p, FLAGS_MARK))
       continue;
 
-    if (server_oper == true)
-      if (!HasUMode(target_p, UMODE_OPER) ||
-          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-        continue;
+    if (who_opers_only_skip(who, target_p) == true)
+      continue;
 
     AddFlag(target_p, FLAGS_MARK);
 
-    if (who_matches(source_p, target_p, mask) == true)
-    {
-      do_who(source_p, target_p, NULL, "");
+    if (who_matches(who, target_p) == true)
+      if (who_send_counted(who, target_p) == false)
+        return false;
+  }
+
+  return true;
+}
+
+/* who_global_one()
+ *
+ * inputs       - pointer to client to do who on
+ *              - pointer to query
+ * output       - false once the reply budget of the query is spent
+ * side effects - lists target_p if it is visible and matches; invisible
+ *                clients have been dealt with by who_common_channel()
+ */
+static bool
+who_global_one(struct Client *target_p, void *ptr)
+{
+  struct WhoQuery *const who = ptr;
+
+  assert(IsClient(target_p));
+
+  if (HasUMode(target_p, UMODE_INVISIBLE))
+    return true;
+
+  if (who_opers_only_skip(who, target_p) == true)
+    return true;
+
+  if (who_matches(who, target_p) == false)
+    return true;
+
+  return who_send_counted(who, target_p);
+}
+
+/* who_global_host()
+ *
+ * inputs       - pointer to query
+ * output       - false if the host index can't answer the query
+ * side effects - walks the clients whose host is mask, or within the
+ *                domain of a "*.domain" mask
+ */
+static bool
+who_global_host(struct WhoQuery *who)
+{
+  const char *mask = who->mask;
+  bool subdomains = false;
+
+  if (mask[0] == '*' && mask[1] == '.')
+  {
+    mask += 2;
+    subdomains = true;
+  }
+
+  if (strpbrk(mask, "*?\\"))
+    return false;
+
+  client_index_walk_host(mask, subdomains, who_global_one, who);
+  return true;
+}
 
-      if (*maxmatches)
+/* who_global_indexed()
+ *
+ * inputs       - pointer to query
+ * output       - false if no index can answer the query
+ * side effects - walks the clients that can possibly match a mask which
+ *                is matched against a single indexed attribute only
+ */
+static bool
+who_global_indexed(struct WhoQuery *who)
+{
+  const char *const mask = who->mask;
+  const bool literal = strpbrk(mask, "*?\\") == NULL;
+  dlink_node *node, *node2, *node2_next;
+
+  switch (who->match)
+  {
+    case WHO_MATCH_HOST:
+      return who_global_host(who);
+
+    case WHO_MATCH_IP:
+      if (!HasUMode(who->source_p, UMODE_OPER))
+        return true;  /* Nothing can match */
+      if (who->cidr_type != HM_IPV4 && who->cidr_type != HM_IPV6)
+        return false;
+      client_index_walk_ip(&who->cidr_addr, who->cidr_bits, who_global_one, who);
+      return true;
+
+    case WHO_MATCH_ACCOUNT:
+      if (literal == false)
+        return false;
+      client_index_walk_account(mask, who_global_one, who);
+      return true;
+
+    case WHO_MATCH_SERVER:
+      if (!HasUMode(who->source_p, UMODE_OPER) && ConfigServerHide.hide_servers)
+        return true;  /* Nothing can match */
+
+      DLINK_FOREACH(node, global_server_list.head)
       {
-        if (--(*maxmatches) == 0)
-        {
-          sendto_one_numeric(source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
-          return;
-        }
+        const struct Client *server_p = node->data;
+
+        if (match(mask, server_p->name))
+          continue;
+
+        DLINK_FOREACH_SAFE(node2, node2_next, server_p->serv->client_list.head)
+          if (who_global_one(node2->data, who) == false)
+            return true;
       }
-    }
+
+      return true;
+
+    default:
+      return false;
   }
 }
 
 /* who_global()
  *
- * inputs	- pointer to client requesting who
- *		- char * mask to match
- *		- int if oper on a server or not
+ * inputs	- pointer to query
  * output	- NONE
  * side effects - do a global scan of all clients looking for match
  *		  this is slightly expensive on EFnet ...
+ *
+ * Queries matching a single attribute that has an index, and addresses
+ * and host names given without match flags, only look at the clients
+ * that index returns instead.
  */
 static void
-who_global(struct Client *source_p, const char *mask, bool server_oper)
+who_global(struct WhoQuery *who)
 {
-  dlink_node *node;
-  unsigned int maxmatches = WHO_MAX_REPLIES;
+  struct Client *const source_p = who->source_p;
+  dlink_node *node, *node2;
   static uintmax_t last_used = 0;
 
   if (!HasUMode(source_p, UMODE_OPER))
@@ -210,61 +565,47 @@ who_global(struct Client *source_p, const char *mask, bool server_oper)
     last_used = event_base->time.sec_monotonic;
   }
 
+  who->replies_left = HasUMode(source_p, UMODE_OPER) ? UINT_MAX : WHO_MAX_REPLIES;
+
   /* First, list all matching invisible clients on common channels */
   DLINK_FOREACH(node, source_p->channel.head)
   {
     struct Channel *channel = ((struct ChannelMember *)node->data)->channel;
-    who_common_channel(source_p, channel, mask, server_oper, &maxmatches);
+
+    if (who_common_channel(who, channel) == false)
+      break;
   }
 
   /* Second, list all matching visible clients */
-  DLINK_FOREACH(node, global_client_list.head)
+  if (who->limit_exceeded == false)
   {
-    struct Client *target_p = node->data;
-
-    assert(IsClient(target_p));
-
-    if (HasUMode(target_p, UMODE_INVISIBLE))
+    if (who->mask == NULL || who_global_indexed(who) == false)
     {
-      DelFlag(target_p, FLAGS_MARK);
-      continue;
+      DLINK_FOREACH(node, global_client_list.head)
+        if (who_global_one(node->data, who) == false)
+          break;
     }
+  }
 
-    if (server_oper == true)
-      if (!HasUMode(target_p, UMODE_OPER) ||
-          (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-        continue;
-
-    if (who_matches(source_p, target_p, mask) == true)
-    {
-      do_who(source_p, target_p, NULL, "");
+  DLINK_FOREACH(node, source_p->channel.head)
+  {
+    const struct Channel *channel = ((struct ChannelMember *)node->data)->channel;
 
-      if (maxmatches)
-      {
-        if (--maxmatches == 0)
-        {
-          sendto_one_numeric(source_p, &me, ERR_WHOLIMEXCEED, WHO_MAX_REPLIES, "WHO");
-          return;
-        }
-      }
-    }
+    DLINK_FOREACH(node2, channel->members.head)
+      DelFlag(((struct ChannelMember *)node2->data)->client, FLAGS_MARK);
   }
 }
 
 /* do_who_on_channel()
  *
- * inputs	- pointer to client requesting who
+ * inputs	- pointer to query
  *		- pointer to channel to do who on
- *		- The "real name" of this channel
- *		- int if source_p is a server oper or not
  *		- int if client is member or not
- *		- int server_op flag
  * output	- NONE
  * side effects - do a who on given channel
  */
 static void
-do_who_on_channel(struct Client *source_p, struct Channel *channel,
-                  bool is_member, bool server_oper)
+do_who_on_channel(const struct WhoQuery *who, struct Channel *channel, bool is_member)
 {
   dlink_node *node;
 
@@ -275,11 +616,9 @@ do_who_on_channel(struct Client *source_p, struct Channel *channel,
 
     if (is_member == true || !HasUMode(target_p, UMODE_INVISIBLE))
     {
-      if (server_oper == true)
-        if (!HasUMode(target_p, UMODE_OPER) ||
-            (HasUMode(target_p, UMODE_HIDDEN) && !HasUMode(source_p, UMODE_OPER)))
-          continue;
-      do_who(source_p, target_p, channel->name, member_get_prefix(member, !!HasCap(source_p, CAP_MULTI_PREFIX)));
+      if (who_opers_only_skip(who, target_p) == true)
+        continue;
+      do_who(who, target_p, channel->name, member_get_prefix(member, !!HasCap(who->source_p, CAP_MULTI_PREFIX)));
     }
   }
 }
@@ -294,7 +633,8 @@ do_who_on_channel(struct Client *source_p, struct Channel *channel,
  * \note Valid arguments for this command are:
  *      - parv[0] = command
  *      - parv[1] = nickname/channelname
- *      - parv[2] = additional selection flag, only 'o' for now
+ *      - parv[2] = additional selection flags and WHOX fields,
+ *                  [o][nuhisra][%tcuihsnfdlaor[,querytype]]
  */
 static void
 m_who(struct Client *source_p, int parc, char *parv[])
@@ -303,12 +643,14 @@ m_who(struct Client *source_p, int parc, char *parv[])
   struct Client *target_p = NULL;
   struct Channel *channel = NULL;
   char *const mask = parv[1];
-  const bool server_oper = parv[2] && *parv[2] == 'o';  /* Show OPERS only */
+  struct WhoQuery who = { .source_p = source_p };
+
+  who_parse_options(&who, parv[2]);
 
   /* See if mask is there, collapse it or return if not there */
   if (EmptyString(mask))
   {
-    who_global(source_p, NULL, server_oper);
+    who_global(&who);
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
     return;
   }
@@ -323,9 +665,9 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((channel = hash_find_channel(mask)))
     {
       if (HasUMode(source_p, UMODE_ADMIN) || member_find_link(source_p, channel))
-        do_who_on_channel(source_p, channel, true, server_oper);
+        do_who_on_channel(&who, channel, true);
       else if (!SecretChannel(channel))
-        do_who_on_channel(source_p, channel, false, server_oper);
+        do_who_on_channel(&who, channel, false);
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
@@ -334,7 +676,7 @@ m_who(struct Client *source_p, int parc, char *parv[])
 
   /* '/who nick' */
   if ((target_p = find_person(source_p, mask)) &&
-      (server_oper == false || HasUMode(target_p, UMODE_OPER)))
+      (who.opers_only == false || HasUMode(target_p, UMODE_OPER)))
   {
     DLINK_FOREACH(node, target_p->channel.head)
     {
@@ -344,10 +686,10 @@ m_who(struct Client *source_p, int parc, char *parv[])
     }
 
     if (node)
-      do_who(source_p, target_p, channel->name,
+      do_who(&who, target_p, channel->name,
              member_get_prefix(node->data, !!HasCap(source_p, CAP_MULTI_PREFIX)));
     else
-      do_who(source_p, target_p, NULL, "");
+      do_who(&who, target_p, NULL, "");
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
     return;
@@ -359,7 +701,7 @@ m_who(struct Client *source_p, int parc, char *parv[])
     if ((node = source_p->channel.head))
     {
       channel = ((struct ChannelMember *)node->data)->channel;
-      do_who_on_channel(source_p, channel, true, server_oper);
+      do_who_on_channel(&who, channel, true);
     }
 
     sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, "*");
@@ -367,10 +709,13 @@ m_who(struct Client *source_p, int parc, char *parv[])
   }
 
   /* '/who 0' */
-  if (strcmp(mask, "0") == 0)
-    who_global(source_p, NULL, server_oper);
-  else
-    who_global(source_p, mask, server_oper);
+  if (strcmp(mask, "0"))
+  {
+    who.mask = mask;
+    who.cidr_type = parse_netmask(mask, &who.cidr_addr, &who.cidr_bits);
+  }
+
+  who_global(&who);
 
   /* Wasn't a nick, wasn't a channel, wasn't a '*' so ... */
   sendto_one_numeric(source_p, &me, RPL_ENDOFWHO, mask);
@@ -390,12 +735,14 @@ static void
 module_init(void)
 {
   mod_add_cmd(&who_msgtab);
+  isupport_add("WHOX", NULL, -1);
 }
 
 static void
 module_exit(void)
 {
   mod_del_cmd(&who_msgtab);
+  isupport_delete("WHOX");
 }
 
 struct module module_entry =
@@ -97,15 +97,14 @@ xline_handle(struct Client *source_p, const struct aline_ctx *aline)
   else
     snprintf(buf, sizeof(buf), "%.*s (%s)", REASONLEN, aline->reason, date_iso8601(0));
 
-  gecos = gecos_make();
-  gecos->mask = xstrdup(aline->mask);
+  gecos = gecos_make(aline->mask);
   gecos->reason = xstrdup(buf);
   gecos->setat = event_base->time.sec_real;
   gecos->in_database = true;
 
   if (aline->duration)
   {
-    gecos->expire = event_base->time.sec_real + aline->duration;
+    gecos_set_expire(gecos, event_base->time.sec_real + aline->duration);
 
     if (IsClient(source_p))
       sendto_one_notice(source_p, &me, ":Added temporary %ju min. X-Line [%s]",
@@ -53,6 +53,8 @@
 #include "memory.h"
 #include "misc.h"
 #include "hostmask.h"
+#include "ipcache.h"
+#include "listener.h"
 
 
 enum
@@ -83,6 +85,93 @@ static const char *const HeaderMessages[] =
 
 #define auth_sendheader(c, i) sendto_one_notice((c), &me, "%s", HeaderMessages[(i)])
 
+/** Outcome of an ident lookup */
+enum IdentResult
+{
+  IDENT_SUCCESS,
+  IDENT_FAILED,   /**< No usable reply */
+  IDENT_TIMEOUT,  /**< No reply in time */
+  IDENT_REFUSED   /**< Connect failed, usually because nothing listens on port 113 */
+};
+
+/** Smoothed latency of successful lookups, estimated like TCP's retransmission timer */
+struct AuthLatency
+{
+  uintmax_t srtt;    /**< Smoothed latency in microseconds; 0 until the first sample */
+  uintmax_t rttvar;  /**< Smoothed mean deviation in microseconds */
+};
+
+static struct AuthLatency latency_dns;
+static struct AuthLatency latency_ident;
+static unsigned int auth_histogram[AUTH_PHASE_LAST][AUTH_HISTOGRAM_BUCKETS];
+
+
+static uintmax_t
+auth_clock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* auth_timing_record()
+ *
+ * inputs       - AUTH_PHASE_*
+ *              - time the phase started; monotonic microseconds
+ * output       - duration of the phase in microseconds
+ * side effects - the duration is counted in the phase's histogram
+ */
+static uintmax_t
+auth_timing_record(unsigned int phase, uintmax_t started)
+{
+  const uintmax_t usec = auth_clock() - started;
+  const uintmax_t msec = usec / 1000;
+  unsigned int bucket = 0;
+
+  while (bucket < AUTH_HISTOGRAM_BUCKETS - 1 && msec >= (1U << bucket))
+    ++bucket;
+
+  ++auth_histogram[phase][bucket];
+  return usec;
+}
+
+static void
+auth_latency_update(struct AuthLatency *latency, uintmax_t sample)
+{
+  if (latency->srtt == 0)
+  {
+    latency->srtt = IRCD_MAX(sample, 1);
+    latency->rttvar = sample / 2;
+    return;
+  }
+
+  const uintmax_t error = sample > latency->srtt ? sample - latency->srtt : latency->srtt - sample;
+
+  latency->rttvar = (3 * latency->rttvar + error) / 4;
+  latency->srtt = IRCD_MAX((7 * latency->srtt + sample) / 8, 1);
+}
+
+/* auth_latency_budget()
+ *
+ * inputs       - latency estimate
+ *              - lower and upper bound in seconds
+ * output       - number of seconds a lookup may take: four mean deviations
+ *                above the smoothed latency, rounded up and within bounds,
+ *                or the upper bound if there is no estimate yet
+ * side effects - NONE
+ */
+static uintmax_t
+auth_latency_budget(const struct AuthLatency *latency, uintmax_t min, uintmax_t max)
+{
+  max = IRCD_MAX(max, 1);
+
+  if (latency->srtt == 0)
+    return max;
+
+  const uintmax_t budget = (latency->srtt + 4 * latency->rttvar + 999999) / 1000000;
+  return IRCD_MIN(IRCD_MAX(budget, min), max);
+}
 
 
 /*! \brief Allocate a new auth request.
@@ -128,13 +217,14 @@ auth_release_client(struct AuthRequest *auth)
   auth_free(auth);
   client->connection->auth = NULL;
 
+  auth_timing_record(AUTH_PHASE_AUTH, client->connection->auth_started);
+  comm_settimeout(client->connection->fd, 0, NULL, NULL);
+
   /*
    * When a client has auth'ed, we want to start reading what it sends
    * us. This is what read_packet() does.
    *     -- adrian
    */
-  comm_setflush(client->connection->fd, 1, flood_recalc, client);
-
   client->connection->last_ping = event_base->time.sec_monotonic;
   client->connection->last_data = event_base->time.sec_monotonic;
   client->connection->created_real = event_base->time.sec_real;
@@ -183,6 +273,11 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
 
   auth->dns_pending = false;
 
+  const uintmax_t usec = auth_timing_record(AUTH_PHASE_DNS, auth->client->connection->auth_started);
+
+  if (namelength)
+    auth_latency_update(&latency_dns, usec);
+
   if (namelength == 0)
     auth_sendheader(auth->client, REPORT_FAIL_DNS);
   else if (address_compare(addr, &auth->client->ip, true, false, 0) == false)
@@ -200,25 +295,87 @@ auth_dns_callback(void *vptr, const struct irc_ssaddr *addr, const char *name, s
   auth_release_client(auth);
 }
 
-/*
- * auth_error - handle auth send errors
+/* auth_ident_close()
+ *
+ * inputs       - pointer to auth request with an ident lookup in progress
+ * output       - NONE
+ * side effects - closes the ident socket
  */
 static void
-auth_error(struct AuthRequest *auth)
+auth_ident_close(struct AuthRequest *auth)
 {
-  assert(auth);
-  assert(auth->fd);
-  assert(auth->client);
-  assert(auth->client->connection);
-
-  ++ServerStats.is_abad;
+  struct Listener *listener = auth->client->connection->listener;
 
   fd_close(auth->fd);
   auth->fd = NULL;
   auth->ident_pending = false;
 
-  auth_sendheader(auth->client, REPORT_FAIL_ID);
+  if (listener)
+  {
+    assert(listener->ident_pending > 0);
+    --listener->ident_pending;
+  }
+}
+
+/* auth_ident_finish()
+ *
+ * inputs       - pointer to auth request with an ident lookup in progress
+ *              - IDENT_*
+ *              - username if result is IDENT_SUCCESS
+ * output       - NONE
+ * side effects - ends the ident lookup and tells the client about the
+ *                outcome. Hosts whose ident server didn't answer at all
+ *                are skipped for general::ident_cache_time.
+ */
+static void
+auth_ident_finish(struct AuthRequest *auth, enum IdentResult result, const char *username)
+{
+  struct Client *const client = auth->client;
+
+  assert(auth->fd);
+  assert(client);
+  assert(client->connection);
+
+  auth_ident_close(auth);
+
+  const uintmax_t usec = auth_timing_record(AUTH_PHASE_IDENT, client->connection->auth_started);
+
+  if (result == IDENT_SUCCESS)
+  {
+    strlcpy(client->username, username, sizeof(client->username));
+    auth_sendheader(client, REPORT_FIN_ID);
+    ++ServerStats.is_asuc;
+    AddFlag(client, FLAGS_GOTID);
+
+    auth_latency_update(&latency_ident, usec);
+    return;
+  }
+
+  auth_sendheader(client, REPORT_FAIL_ID);
+  ++ServerStats.is_abad;
+
+  if (result == IDENT_FAILED)
+    return;
+
+  if (result == IDENT_TIMEOUT)
+    ++ServerStats.is_atmo;
+  else
+    ++ServerStats.is_aref;
+
+  if (ConfigGeneral.ident_cache_time)
+  {
+    struct ip_entry *ipcache = ipcache_record_find_or_add(&client->ip);
+    ipcache->ident_fail_until = event_base->time.sec_monotonic + ConfigGeneral.ident_cache_time;
+  }
+}
 
+/*
+ * auth_error - handle auth send errors
+ */
+static void
+auth_error(struct AuthRequest *auth, enum IdentResult result)
+{
+  auth_ident_finish(auth, result, NULL);
   auth_release_client(auth);
 }
 
@@ -330,28 +487,23 @@ auth_read_reply(fde_t *F, void *data)
   assert(auth->client);
   assert(auth->client->connection);
 
-  if (F->read_handler == NULL && (len = recv(auth->fd->fd, buf, sizeof(buf) - 1, 0)) > 0)
+  /* Called as timeout handler with the read handler still set */
+  if (F->read_handler)
+  {
+    auth_error(auth, IDENT_TIMEOUT);
+    return;
+  }
+
+  if ((len = recv(auth->fd->fd, buf, sizeof(buf) - 1, 0)) > 0)
   {
     buf[len] = '\0';
     username = auth_check_ident_reply(buf);
   }
 
-  fd_close(auth->fd);
-  auth->fd = NULL;
-  auth->ident_pending = false;
-
   if (EmptyString(username))
-  {
-    auth_sendheader(auth->client, REPORT_FAIL_ID);
-    ++ServerStats.is_abad;
-  }
+    auth_ident_finish(auth, IDENT_FAILED, NULL);
   else
-  {
-    strlcpy(auth->client->username, username, sizeof(auth->client->username));
-    auth_sendheader(auth->client, REPORT_FIN_ID);
-    ++ServerStats.is_asuc;
-    AddFlag(auth->client, FLAGS_GOTID);
-  }
+    auth_ident_finish(auth, IDENT_SUCCESS, username);
 
   auth_release_client(auth);
 }
@@ -386,7 +538,12 @@ auth_connect_callback(fde_t *F, int error, void *data)
 
   if (error != COMM_OK)
   {
-    auth_error(auth);
+    if (error == COMM_ERR_TIMEOUT)
+      auth_error(auth, IDENT_TIMEOUT);
+    else if (error == COMM_ERR_CONNECT)
+      auth_error(auth, IDENT_REFUSED);
+    else
+      auth_error(auth, IDENT_FAILED);
     return;
   }
 
@@ -395,7 +552,7 @@ auth_connect_callback(fde_t *F, int error, void *data)
   {
     report_error(L_ALL, "auth get{sock,peer}name error %s:%s",
                  client_get_name(auth->client, SHOW_IP), errno);
-    auth_error(auth);
+    auth_error(auth, IDENT_FAILED);
     return;
   }
 
@@ -408,11 +565,16 @@ auth_connect_callback(fde_t *F, int error, void *data)
 
   if (send(F->fd, authbuf, len, 0) != len)
   {
-    auth_error(auth);
+    auth_error(auth, IDENT_FAILED);
     return;
   }
 
-  comm_setselect(F, COMM_SELECT_READ, auth_read_reply, auth, 4);
+  /* Whatever is left of the time allowed for the lookup, connect included */
+  uintmax_t timeout = 1;
+  if (auth->ident_deadline > event_base->time.sec_monotonic)
+    timeout = auth->ident_deadline - event_base->time.sec_monotonic;
+
+  comm_setselect(F, COMM_SELECT_READ, auth_read_reply, auth, timeout);
 }
 
 /*! \brief Flag the client to show an attempt to contact the ident server on
@@ -427,10 +589,27 @@ auth_start_query(struct AuthRequest *auth)
   struct irc_ssaddr localaddr;
   socklen_t locallen = sizeof(struct irc_ssaddr);
   struct sockaddr_in6 *v6;
+  struct Listener *listener = auth->client->connection->listener;
 
   assert(auth->client);
   assert(auth->client->connection);
 
+  const struct ip_entry *ipcache = ipcache_record_find_or_add(&auth->client->ip);
+  if (ipcache->ident_fail_until > event_base->time.sec_monotonic)
+  {
+    auth_sendheader(auth->client, REPORT_FAIL_ID);
+    ++ServerStats.is_acch;
+    return;
+  }
+
+  if (listener && ConfigGeneral.ident_max_pending &&
+      listener->ident_pending >= ConfigGeneral.ident_max_pending)
+  {
+    auth_sendheader(auth->client, REPORT_FAIL_ID);
+    ++ServerStats.is_alim;
+    return;
+  }
+
   /* Open a socket of the same type as the client socket */
   int fd = comm_socket(auth->client->ip.ss.ss_family, SOCK_STREAM, 0);
   if (fd == -1)
@@ -444,6 +623,9 @@ auth_start_query(struct AuthRequest *auth)
   auth->fd = fd_open(fd, true, "ident");
   auth->ident_pending = true;
 
+  if (listener)
+    ++listener->ident_pending;
+
   auth_sendheader(auth->client, REPORT_DO_ID);
 
   /*
@@ -457,8 +639,42 @@ auth_start_query(struct AuthRequest *auth)
   v6 = (struct sockaddr_in6 *)&localaddr;
   v6->sin6_port = htons(0);
 
+  const uintmax_t timeout = auth_latency_budget(&latency_ident, 1, ConfigGeneral.ident_timeout);
+  auth->ident_deadline = event_base->time.sec_monotonic + timeout;
+
   comm_connect_tcp(auth->fd, &auth->client->ip, RFC1413_PORT, &localaddr,
-                   auth_connect_callback, auth, 4);
+                   auth_connect_callback, auth, timeout);
+}
+
+/* auth_timeout()
+ *
+ * inputs       - client socket
+ *              - pointer to auth request
+ * output       - NONE
+ * side effects - gives up on whatever lookups are still in progress once
+ *                the time allowed for auth is up, and releases the client
+ */
+static void
+auth_timeout(fde_t *F, void *data)
+{
+  struct AuthRequest *const auth = data;
+
+  assert(auth->client);
+  assert(auth->client->connection->fd == F);
+
+  if (auth->ident_pending == true)
+    auth_ident_finish(auth, IDENT_TIMEOUT, NULL);
+
+  if (auth->dns_pending == true)
+  {
+    delete_resolver_queries(auth);
+    auth->dns_pending = false;
+
+    auth_timing_record(AUTH_PHASE_DNS, auth->client->connection->auth_started);
+    auth_sendheader(auth->client, REPORT_FAIL_DNS);
+  }
+
+  auth_release_client(auth);
 }
 
 /*
@@ -476,10 +692,20 @@ auth_start(struct Client *client)
   assert(client);
   assert(client->connection);
 
+  client->connection->auth_started = auth_clock();
+
   auth_sendheader(client, REPORT_DO_DNS);
 
   auth->dns_pending = true;
 
+  /*
+   * DNS gets at least as long as ident, so that a client
+   * with a working resolver keeps its hostname.
+   */
+  comm_settimeout(client->connection->fd,
+                  auth_latency_budget(&latency_dns, ConfigGeneral.ident_timeout,
+                                      ConfigGeneral.auth_timeout), auth_timeout, auth);
+
   if (ConfigGeneral.disable_auth == 0)
     auth_start_query(auth);
 
@@ -496,15 +722,44 @@ auth_delete(struct AuthRequest *auth)
   assert(auth->client->connection);
 
   if (auth->fd)
-  {
-    fd_close(auth->fd);
-    auth->fd = NULL;
-  }
+    auth_ident_close(auth);
 
   auth->ident_pending = false;
 
   delete_resolver_queries(auth);
   auth->dns_pending = false;
 
+  if (auth->client->connection->fd)
+    comm_settimeout(auth->client->connection->fd, 0, NULL, NULL);
+
   auth_free(auth);
 }
+
+/*! \brief Records how long a client took to register
+ * \param client Pointer to client that has just been registered
+ */
+void
+auth_registered(struct Client *client)
+{
+  auth_timing_record(AUTH_PHASE_REGISTER, client->connection->auth_started);
+}
+
+/*! \brief Returns the histogram of durations recorded for a phase
+ * \param phase AUTH_PHASE_*
+ * \return Array of AUTH_HISTOGRAM_BUCKETS counters
+ */
+const unsigned int *
+auth_get_histogram(unsigned int phase)
+{
+  assert(phase < AUTH_PHASE_LAST);
+  return auth_histogram[phase];
+}
+
+/*! \brief Reports the time in seconds new DNS and ident lookups are given
+ */
+void
+auth_get_budget(unsigned int *dns, unsigned int *ident)
+{
+  *dns = auth_latency_budget(&latency_dns, ConfigGeneral.ident_timeout, ConfigGeneral.auth_timeout);
+  *ident = auth_latency_budget(&latency_ident, 1, ConfigGeneral.ident_timeout);
+}
@@ -27,12 +27,14 @@
 #include "stdinc.h"
 #include "list.h"
 #include "channel.h"
+#include "channel_index.h"
 #include "channel_invite.h"
 #include "channel_mode.h"
 #include "client.h"
 #include "hash.h"
 #include "conf.h"
 #include "conf_resv.h"
+#include "dbuf.h"
 #include "hostmask.h"
 #include "irc_string.h"
 #include "ircd.h"
@@ -71,24 +73,20 @@ add_user_to_channel(struct Channel *channel, struct Client *client,
 {
   assert(IsClient(client));
 
-  if (GlobalSetOptions.joinfloodtime)
+  if (GlobalSetOptions.joinfloodtime && GlobalSetOptions.joinfloodcount)
   {
-    if (flood_ctrl == true)
-      ++channel->number_joined;
-
-    channel->number_joined -= (event_base->time.sec_monotonic - channel->last_join_time) *
-      (((float)GlobalSetOptions.joinfloodcount) /
-       (float)GlobalSetOptions.joinfloodtime);
-
-    if (channel->number_joined <= 0)
-    {
-      channel->number_joined = 0;
+    if (token_bucket_is_full(&channel->join_bucket))
       ClearJoinFloodNoticed(channel);
-    }
-    else if (channel->number_joined >= GlobalSetOptions.joinfloodcount)
-    {
-      channel->number_joined = GlobalSetOptions.joinfloodcount;
 
+    /*
+     * The bucket refills at joinfloodcount joins per joinfloodtime seconds.
+     * It holds one join less, so the joinfloodcount-th join in a row gets
+     * noticed, as it did when joins were counted.
+     */
+    if (flood_ctrl == true &&
+        token_bucket_take(&channel->join_bucket, GlobalSetOptions.joinfloodcount - 1,
+                          GlobalSetOptions.joinfloodtime * 1000 / GlobalSetOptions.joinfloodcount) == false)
+    {
       if (!IsSetJoinFloodNoticed(channel))
       {
         SetJoinFloodNoticed(channel);
@@ -98,10 +96,11 @@ add_user_to_channel(struct Channel *channel, struct Client *client,
                              client->servptr->name, channel->name);
       }
     }
-
-    channel->last_join_time = event_base->time.sec_monotonic;
   }
 
+  /* Mode changes made before the join are not for the new member to see */
+  channel_mode_flush_channel(channel);
+
   struct ChannelMember *member = xcalloc(sizeof(*member));
   member->client = client;
   member->channel = channel;
@@ -113,6 +112,8 @@ add_user_to_channel(struct Channel *channel, struct Client *client,
     dlinkAdd(member, &member->locchannode, &channel->members_local);
 
   dlinkAdd(member, &member->usernode, &client->channel);
+
+  channel_index_update(channel);
 }
 
 /*! \brief Deletes an user from a channel by removing a link in the
@@ -125,6 +126,9 @@ remove_user_from_channel(struct ChannelMember *member)
   struct Client *const client = member->client;
   struct Channel *const channel = member->channel;
 
+  /* Whoever leaves still gets to see the mode changes made before */
+  channel_mode_flush_channel(channel);
+
   dlinkDelete(&member->channode, &channel->members);
 
   if (MyConnect(client))
@@ -136,6 +140,8 @@ remove_user_from_channel(struct ChannelMember *member)
 
   if (channel->members.head == NULL)
     channel_free(channel);
+  else
+    channel_index_update(channel);
 }
 
 /* remove_a_mode()
@@ -148,13 +154,9 @@ void
 channel_demote_members(struct Channel *channel, const struct Client *client, unsigned int mask, const char flag)
 {
   dlink_node *node;
-  char modebuf[MODEBUFLEN];
-  char parabuf[MODEBUFLEN];
-  char *mbuf = modebuf;
-  char *pbuf = parabuf;
-  const char *names[MAXMODEPARAMS];
-  static const unsigned int names_size = sizeof(names) / sizeof(names[0]);
-  unsigned int count = 0;
+
+  if (mask & (CHFL_CHANOP | CHFL_HALFOP))
+    channel_mode_flush_status(channel);
 
   DLINK_FOREACH(node, channel->members.head)
   {
@@ -165,35 +167,9 @@ channel_demote_members(struct Channel *channel, const struct Client *client, uns
 
     member->flags &= ~mask;
 
-    names[count++] = member->client->name;
-
-    *mbuf++ = flag;
-
-    if (count >= names_size)
-    {
-      *mbuf = '\0';
-
-      for (unsigned int i = 0; i < names_size; ++i)
-        pbuf += snprintf(pbuf, sizeof(parabuf) - (pbuf - parabuf), " %s", names[i]);
-
-      sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s -%s%s",
-                           client->name, channel->name, modebuf, parabuf);
-      mbuf = modebuf;
-      pbuf = parabuf;
-      count = 0;
-    }
-  }
-
-  if (count)
-  {
-    assert(count < names_size);
-    *mbuf = '\0';
-
-    for (unsigned int i = 0; i < count; ++i)
-      pbuf += snprintf(pbuf, sizeof(parabuf) - (pbuf - parabuf), " %s", names[i]);
-
-    sendto_channel_local(NULL, channel, 0, 0, 0, ":%s MODE %s -%s%s",
-                         client->name, channel->name, modebuf, parabuf);
+    /* Shares lines with the other modes being taken away */
+    const struct ChModeChange change = { .letter = flag, .arg = member->client->name, .dir = MODE_DEL };
+    channel_mode_queue(channel, client->name, NULL, NULL, &change, 1);
   }
 }
 
@@ -379,7 +355,6 @@ channel_make(const char *name)
   channel->hnextch = channel;
   /* Doesn't hurt to set it here */
   channel->creation_time = event_base->time.sec_real;
-  channel->last_join_time = event_base->time.sec_monotonic;
 
   /* Cache channel name length to avoid repetitive strlen() calls. */
   channel->name_len = strlcpy(channel->name, name, sizeof(channel->name));
@@ -388,6 +363,7 @@ channel_make(const char *name)
 
   dlinkAdd(channel, &channel->node, &channel_list);
   hash_add_channel(channel);
+  channel_index_add(channel);
 
   return channel;
 }
@@ -398,6 +374,7 @@ channel_make(const char *name)
 void
 channel_free(struct Channel *channel)
 {
+  channel_mode_flush_channel(channel);
   invite_clear_list(&channel->invites);
 
   /* Free ban/exception/invex lists */
@@ -407,6 +384,7 @@ channel_free(struct Channel *channel)
 
   dlinkDelete(&channel->node, &channel_list);
   hash_del_channel(channel);
+  channel_index_del(channel);
 
   assert(channel->hnextch == channel);
 
@@ -457,65 +435,91 @@ channel_pub_or_secret(const struct Channel *channel)
 /*! \brief lists all names on given channel
  * \param client   Pointer to client struct requesting names
  * \param channel  Pointer to channel block
+ *
+ * Members are copied straight into the dbuf block that is going to be
+ * sent, using the lengths cached in struct Client. Once a line is full,
+ * its trailing space becomes the CR-LF and the numeric's prefix is copied
+ * over to a fresh block for the next line.
  */
 void
 channel_send_namereply(struct Client *client, struct Channel *channel)
 {
   dlink_node *node;
-  char buf[IRCD_BUFSIZE + 1];
-  char *bufptr = buf;
-  size_t masklen = 0;
+  struct dbuf_block *buffer = NULL;
+  size_t headlen = 0;
   bool is_member = member_find_link(client, channel) != NULL;
   bool multi_prefix = HasCap(client, CAP_MULTI_PREFIX) != 0;
   bool uhnames = HasCap(client, CAP_UHNAMES) != 0;
 
   assert(IsClient(client));
+  assert(MyConnect(client));
 
   if (PubChannel(channel) || is_member == true)
   {
-    /* :me.name 353 client->name @ channel->name :+nick1 @nick2 %nick3 ...\r\n */
-    /* 1       23456            789             01                        2 3  */
-    size_t len = strlen(me.name) + strlen(client->name) + channel->name_len + 13;
-
     DLINK_FOREACH(node, channel->members.head)
     {
       const struct ChannelMember *member = node->data;
+      const struct Client *target = member->client;
 
-      if (HasUMode(member->client, UMODE_INVISIBLE) && is_member == false)
+      if (HasUMode(target, UMODE_INVISIBLE) && is_member == false)
         continue;
 
+      const size_t prefixlen = member_get_prefix_len(member, multi_prefix);
+      size_t masklen = prefixlen + target->name_len + 1;  /* +1 for space */
       if (uhnames == true)
-        masklen = strlen(member->client->name) + strlen(member->client->username) +
-                  strlen(member->client->host) + 3;  /* +3 for ! + @ + space */
-      else
-        masklen = strlen(member->client->name) + 1;  /* +1 for space */
+        masklen += target->username_len + target->host_len + 2;  /* +2 for ! and @ */
 
-      masklen += member_get_prefix_len(member, multi_prefix);
+      /* The trailing space turns into CR, so only LF needs room on top */
+      if (buffer && buffer->size + masklen + 1 > IRCD_BUFSIZE)
+      {
+        buffer->data[buffer->size - 1] = '\r';
+        buffer->data[buffer->size++] = '\n';
+        sendto_one_buffer(client, buffer);
 
-      if ((bufptr - buf) + masklen + len > sizeof(buf))
+        struct dbuf_block *next = dbuf_alloc();
+        memcpy(next->data, buffer->data, headlen);
+        next->size = headlen;
+
+        dbuf_ref_free(buffer);
+        buffer = next;
+      }
+
+      if (buffer == NULL)
       {
-        *(bufptr - 1) = '\0';
-        sendto_one_numeric(client, &me, RPL_NAMREPLY,
-                           channel_pub_or_secret(channel), channel->name, buf);
-        bufptr = buf;
+        /* :me.name 353 client->name @ channel->name : */
+        buffer = dbuf_alloc();
+        dbuf_put_fmt(buffer, ":%s %03d %s ", me.name, RPL_NAMREPLY, client->name);
+        dbuf_put_fmt(buffer, numeric_form(RPL_NAMREPLY), channel_pub_or_secret(channel),
+                     channel->name, "");
+        headlen = buffer->size;
       }
 
+      char *p = buffer->data + buffer->size;
+      memcpy(p, member_get_prefix(member, multi_prefix), prefixlen);
+      p += prefixlen;
+      memcpy(p, target->name, target->name_len);
+      p += target->name_len;
+
       if (uhnames == true)
-        bufptr += snprintf(bufptr, sizeof(buf) - (bufptr - buf), "%s%s!%s@%s ",
-                           member_get_prefix(member, multi_prefix),
-                           member->client->name, member->client->username,
-                           member->client->host);
-      else
-        bufptr += snprintf(bufptr, sizeof(buf) - (bufptr - buf), "%s%s ",
-                           member_get_prefix(member, multi_prefix),
-                           member->client->name);
+      {
+        *p++ = '!';
+        memcpy(p, target->username, target->username_len);
+        p += target->username_len;
+        *p++ = '@';
+        memcpy(p, target->host, target->host_len);
+        p += target->host_len;
+      }
+
+      *p++ = ' ';
+      buffer->size = p - buffer->data;
     }
 
-    if (bufptr != buf)
+    if (buffer)
     {
-      *(bufptr - 1) = '\0';
-      sendto_one_numeric(client, &me, RPL_NAMREPLY,
-                         channel_pub_or_secret(channel), channel->name, buf);
+      buffer->data[buffer->size - 1] = '\r';
+      buffer->data[buffer->size++] = '\n';
+      sendto_one_buffer(client, buffer);
+      dbuf_ref_free(buffer);
     }
   }
 
@@ -632,39 +636,76 @@ ban_matches(struct Client *client, struct Channel *channel, struct Ban *ban)
   return false;
 }
 
-bool
-find_bmask(struct Client *client, struct Channel *channel, const dlink_list *list, struct Extban *extban)
+/*! \brief Finds out which kinds of bans in a list match a client
+ * \param client  Pointer to client to check
+ * \param channel Pointer to channel the list belongs to
+ * \param list    Pointer to ban list to search
+ * \param kinds   Flags of the acting extbans to look for, and EXTBAN_PLAIN
+ *                for bans without an acting extban
+ * \return The subset of kinds that a ban in list matching client has been
+ *         found for
+ *
+ * The list is walked only once no matter how many kinds are asked for.
+ * Bans of a kind that has already been found aren't matched against.
+ */
+unsigned int
+find_bmask(struct Client *client, struct Channel *channel, const dlink_list *list, unsigned int kinds)
 {
+  const unsigned int acting_mask = extban_acting_mask();
+  unsigned int found = 0;
   dlink_node *node;
 
   DLINK_FOREACH(node, list->head)
   {
     struct Ban *ban = node->data;
 
-    /* Looking for a specific type of extban? */
-    if (extban)
-    {
-      if (!(ban->extban & extban->flag))
-        continue;
-    }
-    else
-    {
-      /*
-       * Acting extbans have their own time they act and are not general purpose bans,
-       * so skip them unless we are hunting them.
-       */
-      if (ban->extban & extban_acting_mask())
-        continue;
-    }
+    /*
+     * Acting extbans have their own time they act and are not general purpose bans,
+     * so they are a kind of their own. A ban has one acting extban at most.
+     */
+    unsigned int kind = ban->extban & acting_mask;
+    if (kind == 0)
+      kind = EXTBAN_PLAIN;
 
-    bool matches = ban_matches(client, channel, ban);
-    if (matches == false)
+    if ((kinds & ~found & kind) == 0)
       continue;
 
-    return true;
+    if (ban_matches(client, channel, ban) == true)
+    {
+      found |= kind;
+
+      if ((kinds & ~found) == 0)
+        break;
+    }
   }
 
-  return false;
+  return found & kinds;
+}
+
+/*! \brief Finds out which kinds of bans apply to a client, i.e. have a
+ *         matching ban that isn't overridden by a matching exception, and
+ *         optionally whether an invite exception matches the client
+ * \param client  Pointer to client to check
+ * \param channel Pointer to channel
+ * \param kinds   See find_bmask()
+ * \param invexed Pointer to whether the client is already known to be let
+ *                past +i; set if an invite exception matches it. NULL if
+ *                invite exceptions don't matter.
+ * \return The subset of kinds that apply to client
+ */
+unsigned int
+ban_verdict(struct Client *client, struct Channel *channel, unsigned int kinds, bool *invexed)
+{
+  unsigned int banned = find_bmask(client, channel, &channel->banlist, kinds);
+
+  /* Clients who match +e x: override +b x: */
+  if (banned)
+    banned &= ~find_bmask(client, channel, &channel->exceptlist, banned);
+
+  /* Clients who match +I get past +i */
+  if (invexed && *invexed == false)
+    *invexed = find_bmask(client, channel, &channel->invexlist, EXTBAN_PLAIN) != 0;
+  return banned;
 }
 
 /*!
@@ -675,9 +716,7 @@ find_bmask(struct Client *client, struct Channel *channel, const dlink_list *lis
 bool
 is_banned(struct Channel *channel, struct Client *client)
 {
-  if (find_bmask(client, channel, &channel->banlist, NULL) == true)
-    return find_bmask(client, channel, &channel->exceptlist, NULL) == false;
-  return false;
+  return ban_verdict(client, channel, EXTBAN_PLAIN, NULL) != 0;
 }
 
 /*! Tests if a client can join a certain channel
@@ -699,10 +738,18 @@ can_join(struct Client *client, struct Channel *channel, const char *key)
   if (HasCMode(channel, MODE_OPERONLY) && !HasUMode(client, UMODE_OPER))
     return ERR_OPERONLYCHAN;
 
+  /*
+   * Plain bans, join bans ($j:) and, on +i channels, invite exceptions are
+   * evaluated in one go. The numerics are still returned in the usual order.
+   */
+  bool invited = true;
   if (HasCMode(channel, MODE_INVITEONLY))
-    if (invite_find(channel, client) == NULL)
-      if (find_bmask(client, channel, &channel->invexlist, NULL) == false)
-        return ERR_INVITEONLYCHAN;
+    invited = invite_find(channel, client) != NULL;
+
+  const unsigned int banned = ban_verdict(client, channel, EXTBAN_PLAIN | extban_join.flag, &invited);
+
+  if (invited == false)
+    return ERR_INVITEONLYCHAN;
 
   if (channel->mode.key[0] && (key == NULL || strcmp(channel->mode.key, key)))
     return ERR_BADCHANNELKEY;
@@ -711,10 +758,10 @@ can_join(struct Client *client, struct Channel *channel, const char *key)
       channel->mode.limit)
     return ERR_CHANNELISFULL;
 
-  if (is_banned(channel, client) == true)
+  if (banned)
     return ERR_BANNEDFROMCHAN;
 
-  return extban_join_can_join(channel, client, NULL);
+  return 0;
 }
 
 bool
@@ -781,6 +828,24 @@ msg_has_ctrls(const char *message)
   return false;  /* No control code found */
 }
 
+/* channel_get_resv()
+ *
+ * inputs       - pointer to channel
+ * output       - pointer to the RESV matching the channel name, or NULL
+ * side effects - the lookup is cached in the channel until RESVs change
+ */
+static const struct ResvItem *
+channel_get_resv(struct Channel *channel)
+{
+  if (channel->resv_generation != resv_generation)
+  {
+    channel->resv = resv_match(channel->name);
+    channel->resv_generation = resv_generation;
+  }
+
+  return channel->resv;
+}
+
 /*! Tests if a client can send to a channel
  * \param channel Pointer to Channel struct
  * \param client  Pointer to Client struct
@@ -801,7 +866,7 @@ can_send(struct Channel *channel, struct Client *client,
 
   if (MyConnect(client) && !HasFlag(client, FLAGS_EXEMPTRESV))
     if (!(HasUMode(client, UMODE_OPER) && HasOFlag(client, OPER_FLAG_JOIN_RESV)))
-      if ((resv = resv_find(channel->name, match)) && resv_exempt_find(client, resv) == false)
+      if ((resv = channel_get_resv(channel)) && resv_exempt_find(client, resv) == false)
         return ERR_CANNOTSENDTOCHAN;
 
   if (HasCMode(channel, MODE_NOCTRL) && msg_has_ctrls(message) == true)
@@ -827,7 +892,7 @@ can_send(struct Channel *channel, struct Client *client,
   if (HasCMode(channel, MODE_NONOTICE) && notice == true)
     return ERR_CANNOTSENDTOCHAN;
 
-  /* Cache can send if banned */
+  /* Cache can send if banned; plain bans and mute bans ($m:) are checked in one go */
   if (MyConnect(client))
   {
     if (member)
@@ -835,22 +900,28 @@ can_send(struct Channel *channel, struct Client *client,
       if (member->flags & CHFL_BAN_SILENCED)
         return ERR_CANNOTSENDTOCHAN;
 
+      unsigned int kinds = 0;
       if (!(member->flags & CHFL_BAN_CHECKED))
+        kinds |= EXTBAN_PLAIN;
+      if (!(member->flags & CHFL_MUTE_CHECKED))
+        kinds |= extban_mute.flag;
+
+      if (kinds)
       {
-        if (is_banned(channel, client) == true)
+        member->flags |= (CHFL_BAN_CHECKED | CHFL_MUTE_CHECKED);
+
+        if (ban_verdict(client, channel, kinds, NULL))
         {
-          member->flags |= (CHFL_BAN_CHECKED | CHFL_BAN_SILENCED);
+          member->flags |= CHFL_BAN_SILENCED;
           return ERR_CANNOTSENDTOCHAN;
         }
-
-        member->flags |= CHFL_BAN_CHECKED;
       }
     }
-    else if (is_banned(channel, client) == true)
+    else if (ban_verdict(client, channel, EXTBAN_PLAIN | extban_mute.flag, NULL))
       return ERR_CANNOTSENDTOCHAN;
   }
 
-  return extban_mute_can_send(channel, client, member);
+  return CAN_SEND_NONOP;
 }
 
 /*! \brief Updates the client's oper_warn_count_down, warns the
@@ -960,7 +1031,7 @@ channel_do_join(struct Client *client, char *chan_list, char *key_list)
 
     if (!HasFlag(client, FLAGS_EXEMPTRESV) &&
         !(HasUMode(client, UMODE_OPER) && HasOFlag(client, OPER_FLAG_JOIN_RESV)) &&
-        ((resv = resv_find(name, match)) && resv_exempt_find(client, resv) == false))
+        ((resv = resv_match(name)) && resv_exempt_find(client, resv) == false))
     {
       sendto_one_numeric(client, &me, ERR_CHANBANREASON, name, resv->reason);
       sendto_realops_flags(UMODE_REJ, L_ALL, SEND_NOTICE,
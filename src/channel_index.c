@@ -0,0 +1,236 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file channel_index.c
+ * \brief Ordered channel indexes used by LIST.
+ * \version $Id$
+ *
+ * Every channel is kept in two skip lists: one sorted by member count
+ * (largest first) and one sorted by case-folded name. LIST walks the
+ * former for user count limits and the top N mode, and the latter for
+ * masks with a fixed prefix, so neither has to look at channels that
+ * can't possibly match. Channel names are unique, which makes every
+ * key unique as well; a walk that has to stop for a full sendq can
+ * therefore remember the key of the last channel it looked at and seek
+ * past it later on, without holding a pointer to a channel that may be
+ * gone by then.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "channel.h"
+#include "channel_index.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "rng_mt.h"
+
+enum { CHANNEL_INDEX_MAXLEVEL = 12 };  /**< Plenty for 4^12 channels */
+
+/*! \brief ChannelIndex structure */
+struct ChannelIndex
+{
+  struct ChannelIndexNode *head[CHANNEL_INDEX_MAXLEVEL];
+};
+
+static struct ChannelIndex channel_index[CHANNEL_INDEX_LAST];
+
+
+/* index_name_compare()
+ *
+ * inputs       - two channel names
+ * output       - less than, equal to, or greater than zero, in the
+ *                order ToUpper() establishes
+ * side effects - NONE
+ *
+ * Unlike irccmp(), this yields an order. Names that share a prefix
+ * (case-insensitively) sort next to each other.
+ */
+static int
+index_name_compare(const char *s1, const char *s2)
+{
+  const unsigned char *str1 = (const unsigned char *)s1;
+  const unsigned char *str2 = (const unsigned char *)s2;
+
+  for (; ToUpper(*str1) == ToUpper(*str2); ++str1, ++str2)
+    if (*str1 == '\0')
+      return 0;
+
+  return ToUpper(*str1) - ToUpper(*str2);
+}
+
+static int
+index_compare(unsigned int type, const struct ChannelIndexNode *node,
+              unsigned int users, const char *name)
+{
+  if (type == CHANNEL_INDEX_USERS && node->users != users)
+    return node->users > users ? -1 : 1;
+
+  return index_name_compare(node->channel->name, name);
+}
+
+/* index_find()
+ *
+ * inputs       - index to search
+ *              - key to search for
+ *              - whether to stop after the key rather than at it
+ *              - array to store the link pointing to the position found,
+ *                for every level
+ * output       - NONE
+ * side effects - NONE
+ */
+static void
+index_find(unsigned int type, unsigned int users, const char *name, bool after,
+           struct ChannelIndexNode **update[])
+{
+  struct ChannelIndexNode **next = channel_index[type].head;
+  const int limit = after == true ? 1 : 0;
+
+  for (int i = CHANNEL_INDEX_MAXLEVEL - 1; i >= 0; --i)
+  {
+    while (next[i] && index_compare(type, next[i], users, name) < limit)
+      next = next[i]->next;
+
+    update[i] = &next[i];
+  }
+}
+
+static void
+index_insert(unsigned int type, struct ChannelIndexNode *node)
+{
+  struct ChannelIndexNode **update[CHANNEL_INDEX_MAXLEVEL];
+
+  index_find(type, node->users, node->channel->name, false, update);
+
+  for (unsigned int i = 0; i < node->level; ++i)
+  {
+    node->next[i] = *update[i];
+    *update[i] = node;
+  }
+}
+
+static void
+index_remove(unsigned int type, struct ChannelIndexNode *node)
+{
+  struct ChannelIndexNode **update[CHANNEL_INDEX_MAXLEVEL];
+
+  index_find(type, node->users, node->channel->name, false, update);
+
+  for (unsigned int i = 0; i < node->level; ++i)
+  {
+    assert(*update[i] == node);
+    *update[i] = node->next[i];
+  }
+}
+
+static struct ChannelIndexNode *
+index_node_make(struct Channel *channel)
+{
+  unsigned int level = 1;
+
+  for (uint32_t bits = genrand_int32(); level < CHANNEL_INDEX_MAXLEVEL && (bits & 3) == 0; bits >>= 2)
+    ++level;
+
+  struct ChannelIndexNode *node = xcalloc(sizeof(*node) + level * sizeof(node->next[0]));
+  node->channel = channel;
+  node->users = dlink_list_length(&channel->members);
+  node->level = level;
+
+  return node;
+}
+
+/*! \brief Adds a newly created channel to all indexes
+ * \param channel Pointer to channel
+ */
+void
+channel_index_add(struct Channel *channel)
+{
+  for (unsigned int type = 0; type < CHANNEL_INDEX_LAST; ++type)
+  {
+    channel->index[type] = index_node_make(channel);
+    index_insert(type, channel->index[type]);
+  }
+}
+
+/*! \brief Removes a channel that is about to be destroyed from all indexes
+ * \param channel Pointer to channel
+ */
+void
+channel_index_del(struct Channel *channel)
+{
+  for (unsigned int type = 0; type < CHANNEL_INDEX_LAST; ++type)
+  {
+    index_remove(type, channel->index[type]);
+    xfree(channel->index[type]);
+    channel->index[type] = NULL;
+  }
+}
+
+/*! \brief Moves a channel to its new place in the member count index
+ *         after someone joined or left
+ * \param channel Pointer to channel
+ */
+void
+channel_index_update(struct Channel *channel)
+{
+  struct ChannelIndexNode *node = channel->index[CHANNEL_INDEX_USERS];
+  const unsigned int users = dlink_list_length(&channel->members);
+
+  if (node->users == users)
+    return;
+
+  index_remove(CHANNEL_INDEX_USERS, node);
+  node->users = users;
+  index_insert(CHANNEL_INDEX_USERS, node);
+}
+
+/*! \brief Finds where to start or resume walking an index
+ * \param type  CHANNEL_INDEX_USERS or CHANNEL_INDEX_NAME
+ * \param users Member count part of the key; ignored for CHANNEL_INDEX_NAME
+ * \param name  Name part of the key
+ * \param after Whether to return the first node following the key
+ *              instead of the first node at or following it
+ * \return Pointer to index node, or NULL if there is none
+ */
+struct ChannelIndexNode *
+channel_index_seek(unsigned int type, unsigned int users, const char *name, bool after)
+{
+  struct ChannelIndexNode **update[CHANNEL_INDEX_MAXLEVEL];
+
+  assert(type < CHANNEL_INDEX_LAST);
+
+  index_find(type, users, name, after, update);
+  return *update[0];
+}
+
+/*! \brief Counts up memory used by the channel indexes
+ */
+void
+channel_index_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  for (unsigned int type = 0; type < CHANNEL_INDEX_LAST; ++type)
+  {
+    for (const struct ChannelIndexNode *node = channel_index[type].head[0]; node; node = node->next[0])
+    {
+      (*count)++;
+      (*bytes) += sizeof(*node) + node->level * sizeof(node->next[0]);
+    }
+  }
+}
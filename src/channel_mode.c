@@ -22,6 +22,15 @@
 /*! \file channel_mode.c
  * \brief Controls modes on channels.
  * \version $Id$
+ *
+ * Mode changes aren't sent out right away. channel_mode_queue() collects
+ * them per channel until the end of the event loop iteration, so that a
+ * stream of changes from the same source, such as services syncing a
+ * channel, goes out in as few MODE and TMODE lines as the parameter
+ * limit allows. A change that undoes one still pending, like -o after
+ * +o on the same member, takes both out. Anything else sent to any
+ * client or server first flushes all pending changes, so nobody ever
+ * gets to see them out of order.
  */
 
 #include "stdinc.h"
@@ -30,6 +39,7 @@
 #include "channel_mode.h"
 #include "client.h"
 #include "conf.h"
+#include "hash.h"
 #include "hostmask.h"
 #include "irc_string.h"
 #include "ircd.h"
@@ -45,6 +55,26 @@ static struct ChModeChange mode_changes[IRCD_BUFSIZE];
 static unsigned int mode_count;
 static unsigned int mode_limit;  /* number of modes set other than simple */
 static unsigned int simple_modes_mask;  /* bit mask of simple modes already set */
+static dlink_list mode_batch_list;  /* ChannelModeBatch structs waiting to be sent */
+static dlink_list mode_batch_free_list;  /* Spare ChannelModeBatch structs */
+
+enum { MODE_BATCH_SPARE = 16 };  /**< Number of spare batches kept around */
+
+/*! \brief ChannelModeBatch structure */
+struct ChannelModeBatch
+{
+  dlink_node node;  /**< Link to mode_batch_list */
+  struct Channel *channel;
+  char one[IDLEN + 1];  /**< ID of the link the changes came from; empty if none */
+  uintmax_t creation_time;  /**< Channel TS the changes were made with */
+  char prefix[NICKLEN + USERLEN + HOSTLEN + 3];  /**< Source as shown to local clients */
+  char id[IDLEN + 1];  /**< Source as shown to servers; empty if not propagated */
+  unsigned int count;
+  unsigned int restricted;  /**< Number of changes only chanops and halfops get to see */
+  struct ChModeChange changes[CHANNEL_MODE_BATCH_CHANGES];
+  size_t buflen;
+  char buf[IRCD_BUFSIZE * 8];  /**< Copies of the changes' arguments */
+};
 
 
 /* check_string()
@@ -547,6 +577,30 @@ chm_mask(struct Client *client, struct Channel *channel, int parc, int *parn, ch
   mode_changes[mode_count++].dir = dir;
 }
 
+/* mode_changes_queue()
+ *
+ * inputs       - pointer to client the changes come from
+ *              - pointer to channel
+ * output       - NONE
+ * side effects - queues the changes collected in mode_changes so far
+ */
+static void
+mode_changes_queue(struct Client *client, struct Channel *channel)
+{
+  if (mode_count == 0)
+    return;
+
+  char prefix[NICKLEN + USERLEN + HOSTLEN + 3];
+  if (IsClient(client))
+    snprintf(prefix, sizeof(prefix), "%s!%s@%s", client->name, client->username, client->host);
+  else
+    strlcpy(prefix, (IsHidden(client) || ConfigServerHide.hide_servers) ?
+            me.name : client->name, sizeof(prefix));
+
+  channel_mode_queue(channel, prefix, client->from, client->id, mode_changes, mode_count);
+  mode_count = 0;
+}
+
 static void
 chm_flag(struct Client *client, struct Channel *channel, int parc, int *parn, char **parv,
          int *errors, int alev, int dir, const char c, const struct chan_mode *mode)
@@ -582,20 +636,23 @@ chm_flag(struct Client *client, struct Channel *channel, int parc, int *parn, ch
   if (MyClient(client) && (++mode_limit > MAXMODEPARAMS))
     return;
 
-  if (dir == MODE_ADD)  /* setting + */
-  {
-    if (member_has_flags(member, mode->flag) == true)
-      return;  /* No redundant mode changes */
+  if (member_has_flags(member, mode->flag) == (dir == MODE_ADD))
+    return;  /* No redundant mode changes */
 
-    AddMemberFlag(member, mode->flag);
-  }
-  else if (dir == MODE_DEL)  /* setting - */
+  /*
+   * Changes for chanops and halfops only that were made before must reach
+   * those who held the status at the time
+   */
+  if (mode->flag & (CHFL_CHANOP | CHFL_HALFOP))
   {
-    if (member_has_flags(member, mode->flag) == false)
-      return;  /* No redundant mode changes */
+    mode_changes_queue(client, channel);
+    channel_mode_flush_status(channel);
+  }
 
+  if (dir == MODE_ADD)  /* setting + */
+    AddMemberFlag(member, mode->flag);
+  else  /* setting - */
     DelMemberFlag(member, mode->flag);
-  }
 
   mode_changes[mode_count].letter = mode->letter;
   mode_changes[mode_count].arg = client_target->name;
@@ -746,36 +803,59 @@ get_channel_access(const struct Client *client,
   return CHACCESS_PEON;
 }
 
+/* mode_batch_one()
+ *
+ * inputs       - pointer to batch
+ * output       - pointer to the link the changes came from, or NULL if
+ *                there is none or it has gone away since
+ */
+static const struct Client *
+mode_batch_one(const struct ChannelModeBatch *batch)
+{
+  if (batch->one[0] == '\0')
+    return NULL;
+
+  const struct Client *one = hash_find_id(batch->one);
+  if (one && MyConnect(one))
+    return one;
+  return NULL;
+}
+
 /* send_mode_changes_server()
- * Input: the source client(client),
- *        the channel to send mode changes for(channel)
+ * Input: the batch of mode changes to send
  * Output: None.
  * Side-effects: Sends the appropriate mode changes to servers.
  *
  */
 static void
-send_mode_changes_server(struct Client *client, struct Channel *channel)
+send_mode_changes_server(const struct ChannelModeBatch *batch)
 {
   char modebuf[IRCD_BUFSIZE];
   char parabuf[IRCD_BUFSIZE];
   char *parptr = parabuf;
   unsigned int mbl = 0, pbl = 0, arglen = 0, modecount = 0, paracount = 0;
   unsigned int dir = MODE_QUERY;
+  const struct Client *one = mode_batch_one(batch);
+
+  /* Changes without arguments don't write to it */
+  parabuf[0] = '\0';
 
   mbl = snprintf(modebuf, sizeof(modebuf), ":%s TMODE %ju %s ",
-                 client->id, channel->creation_time, channel->name);
+                 batch->id, batch->creation_time, batch->channel->name);
 
   /* Loop the list of modes we have */
-  for (unsigned int i = 0; i < mode_count; ++i)
+  for (unsigned int i = 0; i < batch->count; ++i)
   {
-    if (mode_changes[i].letter == 0)
+    const struct ChModeChange *change = &batch->changes[i];
+
+    if (change->letter == 0)
       continue;
 
     const char *arg;
-    if (mode_changes[i].id)
-      arg = mode_changes[i].id;
+    if (change->id)
+      arg = change->id;
     else
-      arg = mode_changes[i].arg;
+      arg = change->arg;
 
     if (arg)
       arglen = strlen(arg);
@@ -790,13 +870,13 @@ send_mode_changes_server(struct Client *client, struct Channel *channel)
         ((arglen + mbl + pbl + 2 /* +2 for /r/n */ ) > IRCD_BUFSIZE))
     {
       if (modecount)
-        sendto_server(client, 0, 0, "%s %s", modebuf, parabuf);
+        sendto_server(one, 0, 0, "%s %s", modebuf, parabuf);
 
       modecount = 0;
       paracount = 0;
 
       mbl = snprintf(modebuf, sizeof(modebuf), ":%s TMODE %ju %s ",
-                     client->id, channel->creation_time, channel->name);
+                     batch->id, batch->creation_time, batch->channel->name);
 
       pbl = 0;
       parabuf[0] = '\0';
@@ -804,13 +884,13 @@ send_mode_changes_server(struct Client *client, struct Channel *channel)
       dir = MODE_QUERY;
     }
 
-    if (dir != mode_changes[i].dir)
+    if (dir != change->dir)
     {
-      modebuf[mbl++] = (mode_changes[i].dir == MODE_ADD) ? '+' : '-';
-      dir = mode_changes[i].dir;
+      modebuf[mbl++] = (change->dir == MODE_ADD) ? '+' : '-';
+      dir = change->dir;
     }
 
-    modebuf[mbl++] = mode_changes[i].letter;
+    modebuf[mbl++] = change->letter;
     modebuf[mbl] = '\0';
     ++modecount;
 
@@ -824,22 +904,19 @@ send_mode_changes_server(struct Client *client, struct Channel *channel)
   }
 
   if (modecount)
-    sendto_server(client, 0, 0, "%s %s", modebuf, parabuf);
+    sendto_server(one, 0, 0, "%s %s", modebuf, parabuf);
 }
 
-/* void send_mode_changes(struct Client *client,
- *                        struct Client *client,
- *                        struct Channel *channel)
- * Input: The client sending(client), the source client(client),
- *        the channel to send mode changes for(channel),
- *        mode change globals.
+/* send_mode_changes_client()
+ * Input: the batch of mode changes to send
  * Output: None.
- * Side-effects: Sends the appropriate mode changes to other clients
- *               and propagates to servers.
+ * Side-effects: Sends the appropriate mode changes to local channel
+ *               members.
  */
 static void
-send_mode_changes_client(struct Client *client, struct Channel *channel)
+send_mode_changes_client(const struct ChannelModeBatch *batch)
 {
+  struct Channel *channel = batch->channel;
   unsigned int flags = 0;
 
   for (unsigned int pass = 2; pass--; flags = CHFL_CHANOP | CHFL_HALFOP)
@@ -850,20 +927,18 @@ send_mode_changes_client(struct Client *client, struct Channel *channel)
     unsigned int mbl = 0, pbl = 0, arglen = 0, modecount = 0, paracount = 0;
     unsigned int dir = MODE_QUERY;
 
-    if (IsClient(client))
-      mbl = snprintf(modebuf, sizeof(modebuf), ":%s!%s@%s MODE %s ", client->name,
-                     client->username, client->host, channel->name);
-    else
-      mbl = snprintf(modebuf, sizeof(modebuf), ":%s MODE %s ", (IsHidden(client) ||
-                     ConfigServerHide.hide_servers) ?
-                     me.name : client->name, channel->name);
+    parabuf[0] = '\0';
 
-    for (unsigned int i = 0; i < mode_count; ++i)
+    mbl = snprintf(modebuf, sizeof(modebuf), ":%s MODE %s ", batch->prefix, channel->name);
+
+    for (unsigned int i = 0; i < batch->count; ++i)
     {
-      if (mode_changes[i].letter == 0 || mode_changes[i].flags != flags)
+      const struct ChModeChange *change = &batch->changes[i];
+
+      if (change->letter == 0 || change->flags != flags)
         continue;
 
-      const char *arg = mode_changes[i].arg;
+      const char *arg = change->arg;
       if (arg)
         arglen = strlen(arg);
       else
@@ -878,13 +953,7 @@ send_mode_changes_client(struct Client *client, struct Channel *channel)
         modecount = 0;
         paracount = 0;
 
-        if (IsClient(client))
-          mbl = snprintf(modebuf, sizeof(modebuf), ":%s!%s@%s MODE %s ", client->name,
-                         client->username, client->host, channel->name);
-        else
-          mbl = snprintf(modebuf, sizeof(modebuf), ":%s MODE %s ", (IsHidden(client) ||
-                         ConfigServerHide.hide_servers) ?
-                         me.name : client->name, channel->name);
+        mbl = snprintf(modebuf, sizeof(modebuf), ":%s MODE %s ", batch->prefix, channel->name);
 
         pbl = 0;
         parabuf[0] = '\0';
@@ -892,13 +961,13 @@ send_mode_changes_client(struct Client *client, struct Channel *channel)
         dir = MODE_QUERY;
       }
 
-      if (dir != mode_changes[i].dir)
+      if (dir != change->dir)
       {
-        modebuf[mbl++] = (mode_changes[i].dir == MODE_ADD) ? '+' : '-';
-        dir = mode_changes[i].dir;
+        modebuf[mbl++] = (change->dir == MODE_ADD) ? '+' : '-';
+        dir = change->dir;
       }
 
-      modebuf[mbl++] = mode_changes[i].letter;
+      modebuf[mbl++] = change->letter;
       modebuf[mbl] = '\0';
       ++modecount;
 
@@ -916,6 +985,222 @@ send_mode_changes_client(struct Client *client, struct Channel *channel)
   }
 }
 
+/*! \brief Sends out and frees the mode changes a channel has pending, if any
+ * \param channel Pointer to channel
+ */
+void
+channel_mode_flush_channel(struct Channel *channel)
+{
+  struct ChannelModeBatch *batch = channel->mode_batch;
+
+  if (batch == NULL)
+    return;
+
+  /* Unlink first, so that sending doesn't find it still pending */
+  dlinkDelete(&batch->node, &mode_batch_list);
+  channel->mode_batch = NULL;
+
+  send_mode_changes_client(batch);
+  if (batch->id[0])
+    send_mode_changes_server(batch);
+
+  /* MODE floods shouldn't turn into a stream of large allocations */
+  if (dlink_list_length(&mode_batch_free_list) < MODE_BATCH_SPARE)
+    dlinkAdd(batch, &batch->node, &mode_batch_free_list);
+  else
+    xfree(batch);
+}
+
+/*! \brief Sends out the mode changes a channel has pending if some of them
+ *         are for chanops and halfops only. Called before a member's chanop
+ *         or halfop status changes.
+ * \param channel Pointer to channel
+ */
+void
+channel_mode_flush_status(struct Channel *channel)
+{
+  if (channel->mode_batch && channel->mode_batch->restricted)
+    channel_mode_flush_channel(channel);
+}
+
+/*! \brief Sends out all mode changes queued since the last flush. Called
+ *         once per event loop iteration, and by send_message() before
+ *         anything else goes out, so that mode changes are never seen
+ *         out of order with other messages.
+ */
+void
+channel_mode_flush(void)
+{
+  static bool flushing;
+
+  /* Sending one batch is going to call us again; the loop here takes care of the rest */
+  if (flushing == true)
+    return;
+
+  flushing = true;
+
+  while (mode_batch_list.head)
+    channel_mode_flush_channel(((struct ChannelModeBatch *)mode_batch_list.head->data)->channel);
+
+  flushing = false;
+}
+
+/* mode_batch_get()
+ *
+ * inputs       - pointer to channel
+ *              - source as shown to local clients
+ *              - server link the changes came from, or NULL
+ *              - source as shown to servers, or NULL if the changes
+ *                are not to be propagated
+ * output       - pointer to the batch to add changes to
+ * side effects - changes pending from a different source are sent out
+ */
+static struct ChannelModeBatch *
+mode_batch_get(struct Channel *channel, const char *prefix,
+               const struct Client *one, const char *id)
+{
+  struct ChannelModeBatch *batch = channel->mode_batch;
+
+  if (id == NULL)
+    id = "";
+
+  const char *const one_id = one ? one->id : "";
+
+  if (batch)
+  {
+    if (strcmp(batch->one, one_id) == 0 && batch->creation_time == channel->creation_time &&
+        strcmp(batch->id, id) == 0 && strcmp(batch->prefix, prefix) == 0)
+      return batch;
+
+    channel_mode_flush_channel(channel);
+  }
+
+  if (mode_batch_free_list.head)
+  {
+    batch = mode_batch_free_list.head->data;
+    dlinkDelete(&batch->node, &mode_batch_free_list);
+
+    batch->count = 0;
+    batch->restricted = 0;
+    batch->buflen = 0;
+  }
+  else
+    batch = xcalloc(sizeof(*batch));
+
+  batch->channel = channel;
+  strlcpy(batch->one, one_id, sizeof(batch->one));
+  batch->creation_time = channel->creation_time;
+  strlcpy(batch->prefix, prefix, sizeof(batch->prefix));
+  strlcpy(batch->id, id, sizeof(batch->id));
+
+  dlinkAddTail(batch, &batch->node, &mode_batch_list);
+  channel->mode_batch = batch;
+  return batch;
+}
+
+/* mode_batch_merge()
+ *
+ * inputs       - pointer to batch
+ *              - mode change to add
+ * output       - true if the change cancels out one already pending
+ * side effects - pending changes the new one supersedes are dropped
+ */
+static bool
+mode_batch_merge(struct ChannelModeBatch *batch, const struct ChModeChange *change)
+{
+  const struct chan_mode *mode = cmode_map[(unsigned char)change->letter];
+
+  for (unsigned int i = 0; i < batch->count; ++i)
+  {
+    struct ChModeChange *pending = &batch->changes[i];
+
+    if (pending->letter != change->letter)
+      continue;
+
+    if (mode->flag == 0)
+    {
+      /* +k, +l and simple modes: only the last change matters */
+      pending->letter = 0;
+      continue;
+    }
+
+    /*
+     * Members' status and b/e/I masks only ever change for real, so an
+     * opposite change of the same argument gets us back to where we were
+     */
+    if (pending->dir != change->dir && pending->flags == change->flags &&
+        irccmp(pending->id ? pending->id : pending->arg,
+               change->id ? change->id : change->arg) == 0)
+    {
+      pending->letter = 0;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static const char *
+mode_batch_strdup(struct ChannelModeBatch *batch, const char *str)
+{
+  if (str == NULL)
+    return NULL;
+
+  char *const copy = batch->buf + batch->buflen;
+  batch->buflen += strlcpy(copy, str, sizeof(batch->buf) - batch->buflen) + 1;
+  return copy;
+}
+
+/*! \brief Queues mode changes for a channel. Changes queued from the same
+ *         source until the next flush share as few MODE and TMODE lines
+ *         as possible, and opposite changes cancel out.
+ * \param channel Pointer to channel
+ * \param prefix  Source as shown to local clients
+ * \param one     Server link the changes came from, or NULL
+ * \param id      Source as shown to servers, or NULL if the changes are
+ *                not to be propagated
+ * \param changes Array of mode changes; entries with no letter are skipped
+ * \param count   Number of entries in changes
+ */
+void
+channel_mode_queue(struct Channel *channel, const char *prefix, const struct Client *one,
+                   const char *id, const struct ChModeChange *changes, unsigned int count)
+{
+  struct ChannelModeBatch *batch = mode_batch_get(channel, prefix, one, id);
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    const struct ChModeChange *change = &changes[i];
+
+    if (change->letter == 0)
+      continue;
+
+    if (mode_batch_merge(batch, change) == true)
+      continue;
+
+    size_t len = 0;
+    if (change->arg)
+      len += strlen(change->arg) + 1;
+    if (change->id)
+      len += strlen(change->id) + 1;
+
+    if (batch->count == CHANNEL_MODE_BATCH_CHANGES || batch->buflen + len > sizeof(batch->buf))
+    {
+      channel_mode_flush_channel(channel);
+      batch = mode_batch_get(channel, prefix, one, id);
+    }
+
+    struct ChModeChange *pending = &batch->changes[batch->count++];
+    pending->letter = change->letter;
+    pending->dir = change->dir;
+    pending->flags = change->flags;
+    if (pending->flags)
+      ++batch->restricted;
+    pending->arg = mode_batch_strdup(batch, change->arg);
+    pending->id = mode_batch_strdup(batch, change->id);
+  }
+}
+
 const struct chan_mode *cmode_map[256];
 const struct chan_mode  cmode_tab[] =
 {
@@ -961,7 +1246,7 @@ channel_mode_init(void)
  *        the parameters, the channel name.
  * Output: None.
  * Side-effects: Changes the channel membership and modes appropriately,
- *               sends the appropriate MODE messages to the appropriate
+ *               queues the appropriate MODE messages for the appropriate
  *               clients.
  */
 void
@@ -1004,10 +1289,5 @@ channel_mode_set(struct Client *client, struct Channel *channel,
     }
   }
 
-  /* Bail out if we have nothing to do... */
-  if (mode_count == 0)
-    return;
-
-  send_mode_changes_client(client, channel);
-  send_mode_changes_server(client, channel);
+  mode_changes_queue(client, channel);
 }
@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "client_index.h"
 #include "client_svstag.h"
 #include "event.h"
 #include "hash.h"
@@ -40,6 +41,8 @@
 #include "log.h"
 #include "misc.h"
 #include "server.h"
+#include "server_burst.h"
+#include "server_zip.h"
 #include "send.h"
 #include "whowas.h"
 #include "user.h"
@@ -155,6 +158,7 @@ client_free(struct Client *client)
     assert(client->connection->lclient_node.next == NULL);
 
     assert(client->connection->list_task == NULL);
+    assert(client->connection->burst_task == NULL);
     assert(client->connection->auth == NULL);
 
     assert(dlink_list_length(&client->connection->acceptlist) == 0);
@@ -338,13 +342,13 @@ check_pings(void *unused)
 
 /* check_conf_klines()
  *
- * inputs       - NONE
+ * inputs       - (1 << CLIENT_BAN_*) bits of the kinds of bans to check
  * output       - NONE
  * side effects - Check all connections for a pending kline against the
  * 		  client, exit the client if a kline matches.
  */
 void
-check_conf_klines(void)
+check_conf_klines(unsigned int types)
 {
   dlink_node *node, *node_next;
   const void *ptr;
@@ -357,14 +361,16 @@ check_conf_klines(void)
     if (IsDead(client))
       continue;
 
-    if ((ptr = find_conf_by_address(NULL, &client->ip, CONF_DLINE, NULL, NULL, 1)))
+    if ((types & (1U << CLIENT_BAN_DLINE)) &&
+        (ptr = find_conf_by_address(NULL, &client->ip, CONF_DLINE, NULL, NULL, 1)))
     {
       const struct MaskItem *conf = ptr;
       conf_try_ban(client, CLIENT_BAN_DLINE, conf->reason);
       continue;  /* and go examine next Client */
     }
 
-    if ((ptr = find_conf_by_address(client->host, &client->ip, CONF_KLINE,
+    if ((types & (1U << CLIENT_BAN_KLINE)) &&
+        (ptr = find_conf_by_address(client->host, &client->ip, CONF_KLINE,
                                     client->username, NULL, 1)))
     {
       const struct MaskItem *conf = ptr;
@@ -372,7 +378,7 @@ check_conf_klines(void)
       continue;  /* and go examine next Client */
     }
 
-    if ((ptr = gecos_find(client->info, match)))
+    if ((types & (1U << CLIENT_BAN_XLINE)) && (ptr = gecos_match(client->info)))
     {
       const struct GecosItem *conf = ptr;
       conf_try_ban(client, CLIENT_BAN_XLINE, conf->reason);
@@ -380,6 +386,9 @@ check_conf_klines(void)
     }
   }
 
+  if ((types & (1U << CLIENT_BAN_DLINE)) == 0)
+    return;
+
   /* Also check the unknowns list for new dlines */
   DLINK_FOREACH_SAFE(node, node_next, unknown_list.head)
   {
@@ -617,7 +626,7 @@ client_close_connection(struct Client *client)
   else
     ++ServerStats.is_ni;
 
-  if (tls_isusing(&client->connection->fd->tls))
+  if (tls_isusing(&client->connection->fd->tls) && client->connection->fd->tls_job == NULL)
     tls_shutdown(&client->connection->fd->tls);
 
   if (client->connection->fd)
@@ -628,6 +637,7 @@ client_close_connection(struct Client *client)
 
   dbuf_clear(&client->connection->buf_sendq);
   dbuf_clear(&client->connection->buf_recvq);
+  server_zip_free(client);
 
   xfree(client->connection->password);
   client->connection->password = NULL;
@@ -657,7 +667,11 @@ exit_one_client(struct Client *client, const char *comment)
       --Count.invisi;
 
     dlinkDelete(&client->lnode, &client->servptr->serv->client_list);
+
+    if (bursting_server_list.head)
+      server_burst_client_exit(client);
     dlinkDelete(&client->node, &global_client_list);
+    client_index_del(client);
 
     /*
      * If a person is on a channel, send a QUIT notice
@@ -808,6 +822,9 @@ exit_client(struct Client *client, const char *comment)
       assert(dlinkFind(&local_server_list, client));
       dlinkDelete(&client->connection->lclient_node, &local_server_list);
 
+      if (client->connection->burst_task)
+        server_burst_free(client);
+
       if (!HasFlag(client, FLAGS_SQUIT))
         /* For them, we are exiting the network */
         sendto_one(client, ":%s SQUIT %s :%s", me.id, me.id, comment);
@@ -874,6 +891,7 @@ exit_client(struct Client *client, const char *comment)
   assert(dlinkFind(&local_server_list, client) == NULL);
   assert(dlinkFind(&oper_list, client) == NULL);
   assert(dlinkFind(&listing_client_list, client) == NULL);
+  assert(dlinkFind(&bursting_server_list, client) == NULL);
   assert(dlinkFind(&abort_list, client) == NULL);
 
   exit_one_client(client, comment);
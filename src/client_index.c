@@ -0,0 +1,396 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file client_index.c
+ * \brief Client attribute indexes used by WHO.
+ * \version $Id$
+ *
+ * Registered clients are indexed by visible host, IP address and services
+ * account, so that WHO can answer queries on one of these attributes by
+ * looking at the clients that can match only, instead of running
+ * match() against everyone in global_client_list. Clients by server are
+ * already available from Server::client_list.
+ *
+ * The host index is a trie over the dot separated labels of a host,
+ * read from right to left: "irc.example.com" hangs below "example.com",
+ * which in turn hangs below "com". Each node carries its full suffix as
+ * name and is found through a hash table rather than by searching its
+ * parent's children, so both an exact host and all hosts below a domain
+ * are found in constant time, plus the time it takes to walk the result.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "client_index.h"
+#include "conf.h"
+#include "hash.h"
+#include "hostmask.h"
+#include "irc_string.h"
+#include "memory.h"
+#include "patricia.h"
+
+
+/*! \brief HostIndexNode structure */
+struct HostIndexNode
+{
+  struct HostIndexNode *hnext;  /**< For host_index_hash lookups */
+  struct HostIndexNode *parent;  /**< Node of the next shorter suffix; NULL for top level labels */
+  dlink_node node;  /**< Link to the parent's children */
+  dlink_list children;
+  dlink_list clients;  /**< Clients with exactly this host */
+  char name[];  /**< Suffix this node stands for */
+};
+
+static struct HostIndexNode *host_index_hash[HASHSIZE];
+static dlink_list account_index_hash[HASHSIZE];
+static patricia_tree_t *ip_index_v6;
+static patricia_tree_t *ip_index_v4;
+
+
+static patricia_tree_t *
+ip_index_get_trie(const struct irc_ssaddr *addr)
+{
+  if (addr->ss.ss_family == AF_INET6)
+    return ip_index_v6;
+  else
+    return ip_index_v4;
+}
+
+static struct HostIndexNode *
+host_index_find(const char *name)
+{
+  for (struct HostIndexNode *node = host_index_hash[strhash(name)]; node; node = node->hnext)
+    if (irccmp(node->name, name) == 0)
+      return node;
+
+  return NULL;
+}
+
+/* host_index_get()
+ *
+ * inputs       - host or domain name
+ * output       - pointer to the node for name
+ * side effects - the node and any missing nodes above it are created
+ */
+static struct HostIndexNode *
+host_index_get(const char *name)
+{
+  struct HostIndexNode *node = host_index_find(name);
+
+  if (node)
+    return node;
+
+  const size_t len = strlen(name);
+  const unsigned int hashv = strhash(name);
+
+  node = xcalloc(sizeof(*node) + len + 1);
+  memcpy(node->name, name, len + 1);
+  node->hnext = host_index_hash[hashv];
+  host_index_hash[hashv] = node;
+
+  const char *const dot = strchr(name, '.');
+  if (dot && *(dot + 1))
+  {
+    node->parent = host_index_get(dot + 1);
+    dlinkAdd(node, &node->node, &node->parent->children);
+  }
+
+  return node;
+}
+
+/* host_index_put()
+ *
+ * inputs       - pointer to a host index node
+ * output       - NONE
+ * side effects - frees the node and any nodes above it that have
+ *                become unused
+ */
+static void
+host_index_put(struct HostIndexNode *node)
+{
+  while (node && node->clients.head == NULL && node->children.head == NULL)
+  {
+    struct HostIndexNode *const parent = node->parent;
+    struct HostIndexNode **prev = &host_index_hash[strhash(node->name)];
+
+    while (*prev != node)
+      prev = &(*prev)->hnext;
+    *prev = node->hnext;
+
+    if (parent)
+      dlinkDelete(&node->node, &parent->children);
+
+    xfree(node);
+    node = parent;
+  }
+}
+
+static bool
+host_index_walk(const struct HostIndexNode *node, bool subdomains,
+                client_index_visit visit, void *ptr)
+{
+  dlink_node *dnode, *dnode_next;
+
+  if (subdomains == true)
+  {
+    DLINK_FOREACH_SAFE(dnode, dnode_next, node->children.head)
+    {
+      const struct HostIndexNode *child = dnode->data;
+
+      if (host_index_walk(child, false, visit, ptr) == false ||
+          host_index_walk(child, true, visit, ptr) == false)
+        return false;
+    }
+
+    return true;
+  }
+
+  DLINK_FOREACH_SAFE(dnode, dnode_next, node->clients.head)
+    if (visit(dnode->data, ptr) == false)
+      return false;
+
+  return true;
+}
+
+/*! \brief Adds a client to the host index
+ * \param client Pointer to client
+ */
+void
+client_index_host_add(struct Client *client)
+{
+  struct HostIndexNode *node = host_index_get(client->host);
+
+  assert(client->index_host == NULL);
+
+  dlinkAdd(client, &client->index_host_node, &node->clients);
+  client->index_host = node;
+}
+
+/*! \brief Removes a client from the host index, if it is in there
+ * \param client Pointer to client
+ */
+void
+client_index_host_del(struct Client *client)
+{
+  struct HostIndexNode *node = client->index_host;
+
+  if (node == NULL)
+    return;
+
+  dlinkDelete(&client->index_host_node, &node->clients);
+  client->index_host = NULL;
+
+  host_index_put(node);
+}
+
+/*! \brief Adds a client to the account index, if it is logged in
+ * \param client Pointer to client
+ */
+void
+client_index_account_add(struct Client *client)
+{
+  assert(client->index_account == NULL);
+
+  if (strcmp(client->account, "*") == 0)
+    return;
+
+  client->index_account = &account_index_hash[strhash(client->account)];
+  dlinkAdd(client, &client->index_account_node, client->index_account);
+}
+
+/*! \brief Removes a client from the account index, if it is in there
+ * \param client Pointer to client
+ */
+void
+client_index_account_del(struct Client *client)
+{
+  if (client->index_account == NULL)
+    return;
+
+  dlinkDelete(&client->index_account_node, client->index_account);
+  client->index_account = NULL;
+}
+
+/*! \brief Adds a newly registered client to all indexes
+ * \param client Pointer to client
+ */
+void
+client_index_add(struct Client *client)
+{
+  client_index_host_add(client);
+  client_index_account_add(client);
+
+  /* Clients introduced with a spoofed IP address of 0 have none */
+  if (client->ip.ss.ss_family != AF_INET && client->ip.ss.ss_family != AF_INET6)
+    return;
+
+  patricia_node_t *pnode = patricia_make_and_lookup_addr(ip_index_get_trie(&client->ip),
+                                                         (struct sockaddr *)&client->ip, 0);
+  if (pnode->data == NULL)
+    PATRICIA_DATA_SET(pnode, xcalloc(sizeof(dlink_list)));
+
+  dlinkAdd(client, &client->index_ip_node, PATRICIA_DATA_GET(pnode, dlink_list));
+  client->index_ip = pnode;
+}
+
+/*! \brief Removes an exiting client from all indexes
+ * \param client Pointer to client
+ */
+void
+client_index_del(struct Client *client)
+{
+  client_index_host_del(client);
+  client_index_account_del(client);
+
+  patricia_node_t *pnode = client->index_ip;
+  if (pnode == NULL)
+    return;
+
+  dlink_list *list = PATRICIA_DATA_GET(pnode, dlink_list);
+  dlinkDelete(&client->index_ip_node, list);
+  client->index_ip = NULL;
+
+  if (list->head == NULL)
+  {
+    patricia_remove(ip_index_get_trie(&client->ip), pnode);
+    xfree(list);
+  }
+}
+
+/*! \brief Walks the clients having a given host
+ * \param name       Host name, or domain name if subdomains is true
+ * \param subdomains Whether to walk all clients whose host ends in ".name"
+ *                   instead of those whose host is name
+ * \param visit      Function to call for every client found
+ * \param ptr        Passed on to visit
+ * \return false if the walk has been stopped by visit, otherwise true
+ */
+bool
+client_index_walk_host(const char *name, bool subdomains, client_index_visit visit, void *ptr)
+{
+  const struct HostIndexNode *node = host_index_find(name);
+
+  if (node == NULL)
+    return true;
+
+  return host_index_walk(node, subdomains, visit, ptr);
+}
+
+/*! \brief Walks the clients whose IP address is within a given network
+ * \param addr  Network address
+ * \param bits  Network prefix length
+ * \param visit Function to call for every client found
+ * \param ptr   Passed on to visit
+ * \return false if the walk has been stopped by visit, otherwise true
+ */
+bool
+client_index_walk_ip(const struct irc_ssaddr *addr, int bits, client_index_visit visit, void *ptr)
+{
+  const patricia_tree_t *tree = ip_index_get_trie(addr);
+  const unsigned char *key;
+  patricia_node_t *pnode = tree->head, *xnode;
+
+  if (addr->ss.ss_family == AF_INET6)
+    key = (const unsigned char *)&((const struct sockaddr_in6 *)addr)->sin6_addr;
+  else
+    key = (const unsigned char *)&((const struct sockaddr_in *)addr)->sin_addr;
+
+  /*
+   * Every address within the network sits below the first node that
+   * tests a bit past the prefix. Path compression means that node's
+   * subtree may hold other addresses as well, so check each of them.
+   */
+  while (pnode && pnode->bit < (unsigned int)bits)
+  {
+    if (BIT_TEST(key[pnode->bit >> 3], 0x80 >> (pnode->bit & 0x07)))
+      pnode = pnode->r;
+    else
+      pnode = pnode->l;
+  }
+
+  if (pnode == NULL)
+    return true;
+
+  PATRICIA_WALK(pnode, xnode)
+  {
+    const dlink_list *list = PATRICIA_DATA_GET(xnode, dlink_list);
+    dlink_node *node, *node_next;
+
+    DLINK_FOREACH_SAFE(node, node_next, list->head)
+    {
+      struct Client *client = node->data;
+
+      if (address_compare(&client->ip, addr, false, false, bits) == false)
+        break;  /* All of them share the same address */
+
+      if (visit(client, ptr) == false)
+        return false;
+    }
+  } PATRICIA_WALK_END;
+
+  return true;
+}
+
+/*! \brief Walks the clients logged in to a given services account
+ * \param name  Account name
+ * \param visit Function to call for every client found
+ * \param ptr   Passed on to visit
+ * \return false if the walk has been stopped by visit, otherwise true
+ */
+bool
+client_index_walk_account(const char *name, client_index_visit visit, void *ptr)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, account_index_hash[strhash(name)].head)
+  {
+    struct Client *client = node->data;
+
+    if (irccmp(client->account, name) == 0)
+      if (visit(client, ptr) == false)
+        return false;
+  }
+
+  return true;
+}
+
+/*! \brief Counts up memory used by the host index
+ */
+void
+client_index_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  for (unsigned int i = 0; i < HASHSIZE; ++i)
+  {
+    for (const struct HostIndexNode *node = host_index_hash[i]; node; node = node->hnext)
+    {
+      (*count)++;
+      (*bytes) += sizeof(*node) + strlen(node->name) + 1;
+    }
+  }
+}
+
+void
+client_index_init(void)
+{
+  ip_index_v6 = patricia_new(128);
+  ip_index_v4 = patricia_new( 32);
+}
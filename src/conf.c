@@ -30,6 +30,7 @@
 #include "parse.h"
 #include "conf.h"
 #include "conf_cluster.h"
+#include "conf_expire.h"
 #include "conf_gecos.h"
 #include "conf_pseudo.h"
 #include "conf_resv.h"
@@ -47,6 +48,7 @@
 #include "modules.h"
 #include "numeric.h"
 #include "fdlist.h"
+#include "tls_pool.h"
 #include "log.h"
 #include "send.h"
 #include "memory.h"
@@ -74,6 +76,8 @@ struct conf_parser_context conf_parser_ctx;
 dlink_list connect_items;
 dlink_list operator_items;
 
+static unsigned int conf_bans_changed;  /**< (1 << CLIENT_BAN_*) bits of the last conf_read() */
+
 extern unsigned int lineno;
 extern char linebuf[];
 extern char conffilebuf[IRCD_BUFSIZE];
@@ -218,6 +222,7 @@ conf_free(struct MaskItem *conf)
   xfree(conf->addr);
   xfree(conf->bind);
   xfree(conf->cipher_list);
+  tls_session_free(&conf->tls_session);
 
   DLINK_FOREACH_SAFE(node, node_next, conf->hub_list.head)
   {
@@ -580,6 +585,9 @@ conf_set_defaults(void)
   ConfigServerInfo.max_nick_length = 9;
   ConfigServerInfo.max_topic_length = 80;
   ConfigServerInfo.hub = 0;
+  ConfigServerInfo.tls_handshake_threads = 0;
+  ConfigServerInfo.tls_kernel_offload = 0;
+  ConfigServerInfo.tls_session_cache_size = 16384;
 
   log_iterate(log_free);
 
@@ -621,6 +629,10 @@ conf_set_defaults(void)
   ConfigGeneral.kline_min_cidr6 = 48;
   ConfigGeneral.invisible_on_connect = 1;
   ConfigGeneral.disable_auth = 0;
+  ConfigGeneral.auth_timeout = 10;
+  ConfigGeneral.ident_timeout = 4;
+  ConfigGeneral.ident_cache_time = 300;
+  ConfigGeneral.ident_max_pending = 256;
   ConfigGeneral.kill_chase_time_limit = 90;
   ConfigGeneral.default_floodcount = 8;
   ConfigGeneral.default_floodtime = 1;
@@ -690,6 +702,19 @@ conf_read(FILE *file)
   yyparse();  /* Load the values from the conf */
   conf_validate();  /* Check to make sure some values are still okay. */
                     /* Some global values are also loaded here. */
+
+  /*
+   * Drop what's left of the previous configuration, and note the
+   * kinds of bans that may now apply to clients they didn't apply to.
+   */
+  const unsigned int changed = address_conf_sweep_stale();
+  if (changed & (1U << CONF_DLINE))
+    conf_bans_changed |= 1U << CLIENT_BAN_DLINE;
+  if (changed & (1U << CONF_KLINE))
+    conf_bans_changed |= 1U << CLIENT_BAN_KLINE;
+  if (gecos_sweep_stale() == true)
+    conf_bans_changed |= 1U << CLIENT_BAN_XLINE;
+
   whowas_trim();  /* Attempt to trim whowas list if necessary */
   class_delete_marked();  /* Delete unused classes that are marked for deletion */
 }
@@ -714,10 +739,13 @@ conf_rehash(bool sig)
 
   /* don't close listeners until we know we can go ahead with the rehash */
 
+  conf_bans_changed = 0;
   conf_read_files(false);
 
   load_conf_modules();
-  check_conf_klines();
+
+  if (conf_bans_changed)
+    check_conf_klines(conf_bans_changed);
 }
 
 /* conf_connect_allowed()
@@ -759,15 +787,13 @@ conf_connect_allowed(struct irc_ssaddr *addr)
  *
  * inputs       - NONE
  * output       - NONE
- * side effects - call function to expire temporary k/d lines
+ * side effects - removes temporary k/d/x lines and resvs that are due
  *                This is an event started off in ircd.c
  */
 void
 cleanup_tklines(void *unused)
 {
-  hostmask_expire_temporary();
-  gecos_expire();
-  resv_expire();
+  conf_expire_run(event_base->time.sec_real);
 }
 
 /*
@@ -852,7 +878,7 @@ conf_clear(void)
    */
   class_mark_for_deletion();
 
-  clear_out_address_conf();
+  address_conf_mark_stale();  /* Mark address records; see conf_read() */
 
   modules_conf_clear();  /* Clear modules {} items */
 
@@ -860,7 +886,7 @@ conf_clear(void)
 
   cluster_clear();  /* Clear cluster {} items */
 
-  gecos_clear();  /* Clear gecos {} items */
+  gecos_mark_stale();  /* Mark gecos {} items */
 
   resv_clear();  /* Clear resv {} items */
 
@@ -891,6 +917,8 @@ conf_clear(void)
   ConfigServerInfo.tls_cipher_suites = NULL;
   xfree(ConfigServerInfo.tls_message_digest_algorithm);
   ConfigServerInfo.tls_message_digest_algorithm = NULL;
+  xfree(ConfigServerInfo.tls_ticket_key_file);
+  ConfigServerInfo.tls_ticket_key_file = NULL;
 
   /* Clean out ConfigAdminInfo */
   xfree(ConfigAdminInfo.name);
@@ -913,6 +941,9 @@ conf_clear(void)
 static void
 conf_handle_tls(bool cold)
 {
+  /* Handshake threads must not be using the TLS contexts while they change */
+  tls_pool_drain();
+
   if (tls_new_credentials() == false)
   {
     if (cold == true)
@@ -55,6 +55,8 @@ class_make(void)
   class->ping_freq = DEFAULT_PINGFREQUENCY;
   class->max_sendq = DEFAULT_SENDQ;
   class->max_recvq = DEFAULT_RECVQ;
+  class->flood_burst = DEFAULT_FLOOD_BURST;
+  class->flood_rate = DEFAULT_FLOOD_RATE;
   class->ip_tree_v6 = patricia_new(128);
   class->ip_tree_v4 = patricia_new( 32);
 
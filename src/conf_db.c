@@ -750,7 +750,7 @@ load_resv_database(const char *filename)
 
     resv = resv_make(name, reason, NULL);
     resv->setat = tmp64_setat;
-    resv->expire = tmp64_hold;
+    resv_set_expire(resv, tmp64_hold);
     resv->in_database = true;
 
     xfree(name);
@@ -826,12 +826,12 @@ load_xline_database(const char *filename)
     SAFE_READ(read_uint64(&tmp64_setat, f));
     SAFE_READ(read_uint64(&tmp64_hold, f));
 
-    gecos = gecos_make();
+    gecos = gecos_make(name);
     gecos->in_database = true;
-    gecos->mask = name;
     gecos->reason = reason;
     gecos->setat = tmp64_setat;
-    gecos->expire = tmp64_hold;
+    gecos_set_expire(gecos, tmp64_hold);
+    xfree(name);
   }
 
   close_db(f);
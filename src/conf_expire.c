@@ -0,0 +1,165 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+
+/*! \file conf_expire.c
+ * \brief Expiry queue of temporary K/D/X-lines and RESVs.
+ * \version $Id$
+ *
+ * Every temporary ban is queued in a binary min-heap ordered by the time
+ * it expires, so finding out whether anything is due means looking at
+ * the root only, and each expiry costs O(log n) regardless of how many
+ * other bans there are. Items embed a struct ConfExpire, which remembers
+ * its position in the heap so that bans removed before they expire can
+ * be taken out in O(log n) as well.
+ */
+
+#include "stdinc.h"
+#include "conf_expire.h"
+#include "memory.h"
+
+
+static struct ConfExpire **expire_heap;
+static unsigned int expire_heap_length;
+static unsigned int expire_heap_size;
+
+
+static void
+expire_heap_set(unsigned int index, struct ConfExpire *entry)
+{
+  expire_heap[index] = entry;
+  entry->index = index;
+}
+
+static void
+expire_heap_up(unsigned int index)
+{
+  struct ConfExpire *const entry = expire_heap[index];
+
+  while (index)
+  {
+    const unsigned int parent = (index - 1) / 2;
+
+    if (expire_heap[parent]->when <= entry->when)
+      break;
+
+    expire_heap_set(index, expire_heap[parent]);
+    index = parent;
+  }
+
+  expire_heap_set(index, entry);
+}
+
+static void
+expire_heap_down(unsigned int index)
+{
+  struct ConfExpire *const entry = expire_heap[index];
+
+  while (true)
+  {
+    unsigned int child = index * 2 + 1;
+
+    if (child >= expire_heap_length)
+      break;
+
+    if (child + 1 < expire_heap_length && expire_heap[child + 1]->when < expire_heap[child]->when)
+      ++child;
+
+    if (entry->when <= expire_heap[child]->when)
+      break;
+
+    expire_heap_set(index, expire_heap[child]);
+    index = child;
+  }
+
+  expire_heap_set(index, entry);
+}
+
+/*! \brief Queues an item for expiry
+ * \param entry   ConfExpire embedded in the item; must not be queued yet
+ * \param when    Real time the item expires; must not be 0
+ * \param handler Function that removes the item once it is due
+ * \param data    Passed on to handler
+ */
+void
+conf_expire_add(struct ConfExpire *entry, uintmax_t when, void (*handler)(void *), void *data)
+{
+  assert(entry->when == 0);
+  assert(when);
+
+  if (expire_heap_length == expire_heap_size)
+  {
+    expire_heap_size = expire_heap_size ? expire_heap_size * 2 : 64;
+    expire_heap = xrealloc(expire_heap, expire_heap_size * sizeof(*expire_heap));
+  }
+
+  entry->when = when;
+  entry->handler = handler;
+  entry->data = data;
+
+  expire_heap_set(expire_heap_length++, entry);
+  expire_heap_up(entry->index);
+}
+
+/*! \brief Takes an item off the expiry queue, if it is on it
+ * \param entry ConfExpire embedded in the item
+ */
+void
+conf_expire_del(struct ConfExpire *entry)
+{
+  if (entry->when == 0)
+    return;
+
+  const unsigned int index = entry->index;
+
+  assert(expire_heap[index] == entry);
+
+  entry->when = 0;
+
+  if (index == --expire_heap_length)
+    return;
+
+  expire_heap_set(index, expire_heap[expire_heap_length]);
+  expire_heap_up(index);
+  expire_heap_down(expire_heap[index]->index);
+}
+
+/*! \brief Removes everything that is due
+ * \param now Current real time
+ */
+void
+conf_expire_run(uintmax_t now)
+{
+  while (expire_heap_length && expire_heap[0]->when <= now)
+  {
+    struct ConfExpire *const entry = expire_heap[0];
+
+    conf_expire_del(entry);
+    entry->handler(entry->data);
+  }
+}
+
+void
+conf_expire_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  *count = expire_heap_length;
+  *bytes = expire_heap_size * sizeof(*expire_heap);
+}
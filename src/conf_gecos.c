@@ -22,6 +22,26 @@
 /*! \file conf_gecos.c
  * \brief Implements gecos {} block configuration management.
  * \version $Id$
+ *
+ * gecos_match() doesn't run match() against every X-line, as there may
+ * be thousands of them. Instead, the longest run of literal characters
+ * of each mask, its anchor, is entered into an Aho-Corasick automaton
+ * that finds all anchors occurring in a realname in a single pass over
+ * it. Only X-lines whose anchor has been found can match, so only those
+ * are checked with match(). Masks without any literal characters, such
+ * as "*", are checked for every realname.
+ *
+ * Adding an anchor adds nodes to the trie, and removing one frees the
+ * nodes that have become unused. Either may invalidate failure links,
+ * which are then recomputed in one breadth-first pass before the next
+ * lookup, so a burst of XLINEs or a rehash costs a single pass.
+ *
+ * On a rehash, the X-lines from ircd.conf are marked stale rather than
+ * deleted; gecos_make() takes over a stale X-line with the same mask,
+ * and whatever is still stale after parsing is deleted. Anchors of
+ * unchanged X-lines thus stay in the automaton. Stale X-lines are
+ * hashed by mask for the duration, so that a rehash remains linear in
+ * the number of X-lines.
  */
 
 #include "stdinc.h"
@@ -29,13 +49,279 @@
 #include "send.h"
 #include "client.h"
 #include "ircd.h"
+#include "irc_string.h"
+#include "hash.h"
 #include "memory.h"
 #include "conf.h"
 #include "conf_gecos.h"
 
 
+/*! \brief GecosNode structure; a trie node of the X-line matcher */
+struct GecosNode
+{
+  struct GecosNode *parent;
+  struct GecosNode *fail;  /**< Node of the longest proper suffix that is in the trie */
+  struct GecosNode *output_next;  /**< Next node on the fail chain with X-lines in output */
+  struct GecosNode **child;  /**< Sorted by key */
+  unsigned int child_count;
+  unsigned int child_size;
+  unsigned char key;  /**< Case folded character leading here from parent */
+  dlink_list output;  /**< X-lines whose anchor ends here */
+};
+
 static dlink_list gecos_list;
+static dlink_list gecos_unanchored;  /**< X-lines without an anchor */
+static struct GecosNode gecos_root;
+static struct GecosNode *gecos_root_next[256];  /**< Children of gecos_root, by key */
+static unsigned int gecos_node_count;
+static bool gecos_links_dirty;  /**< Failure links need to be recomputed */
+static uintmax_t gecos_match_serial;
+static unsigned int gecos_stale_count;  /**< X-lines marked by gecos_mark_stale() */
+static bool gecos_added;  /**< An X-line has been added since gecos_mark_stale() */
+static dlink_list *gecos_stale_hash;  /**< Stale X-lines by mask, until gecos_sweep_stale() */
+static unsigned int gecos_stale_hash_size;  /**< Power of two */
+
+
+static struct GecosNode *
+gecos_node_child(const struct GecosNode *node, unsigned char key)
+{
+  if (node == &gecos_root)
+    return gecos_root_next[key];
+
+  unsigned int low = 0, high = node->child_count;
+
+  while (low < high)
+  {
+    const unsigned int mid = (low + high) / 2;
+
+    if (node->child[mid]->key == key)
+      return node->child[mid];
+    if (node->child[mid]->key < key)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+
+  return NULL;
+}
+
+/* gecos_node_add_child()
+ *
+ * inputs       - parent node
+ *              - case folded character
+ * output       - pointer to the new child node
+ * side effects - NONE
+ */
+static struct GecosNode *
+gecos_node_add_child(struct GecosNode *node, unsigned char key)
+{
+  struct GecosNode *child = xcalloc(sizeof(*child));
+  unsigned int pos = 0;
+
+  child->parent = node;
+  child->key = key;
+
+  if (node->child_count == node->child_size)
+  {
+    node->child_size = node->child_size ? node->child_size * 2 : 2;
+    node->child = xrealloc(node->child, node->child_size * sizeof(*node->child));
+  }
+
+  while (pos < node->child_count && node->child[pos]->key < key)
+    ++pos;
+
+  memmove(&node->child[pos + 1], &node->child[pos], (node->child_count - pos) * sizeof(*node->child));
+  node->child[pos] = child;
+  ++node->child_count;
+
+  if (node == &gecos_root)
+    gecos_root_next[key] = child;
+
+  ++gecos_node_count;
+  return child;
+}
+
+/* gecos_node_prune()
+ *
+ * inputs       - pointer to a node
+ * output       - NONE
+ * side effects - frees the node and any nodes above it that have become
+ *                unused
+ */
+static void
+gecos_node_prune(struct GecosNode *node)
+{
+  while (node != &gecos_root && node->output.head == NULL && node->child_count == 0)
+  {
+    struct GecosNode *const parent = node->parent;
+    unsigned int pos = 0;
+
+    while (parent->child[pos] != node)
+      ++pos;
+
+    memmove(&parent->child[pos], &parent->child[pos + 1],
+            (parent->child_count - pos - 1) * sizeof(*parent->child));
+    --parent->child_count;
+
+    if (parent == &gecos_root)
+      gecos_root_next[node->key] = NULL;
+
+    xfree(node->child);
+    xfree(node);
+    --gecos_node_count;
+
+    gecos_links_dirty = true;
+    node = parent;
+  }
+}
+
+/* gecos_links_update()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - recomputes failure and output links, if needed, by
+ *                visiting the trie in breadth-first order
+ */
+static void
+gecos_links_update(void)
+{
+  if (gecos_links_dirty == false)
+    return;
+
+  struct GecosNode **queue = xcalloc((gecos_node_count + 1) * sizeof(*queue));
+  unsigned int head = 0, tail = 0;
+
+  gecos_root.fail = NULL;
+  gecos_root.output_next = NULL;
+  queue[tail++] = &gecos_root;
+
+  while (head < tail)
+  {
+    struct GecosNode *const node = queue[head++];
+
+    for (unsigned int i = 0; i < node->child_count; ++i)
+    {
+      struct GecosNode *const child = node->child[i];
+      struct GecosNode *fail = node->fail;
+
+      while (fail && gecos_node_child(fail, child->key) == NULL)
+        fail = fail->fail;
+
+      child->fail = fail ? gecos_node_child(fail, child->key) : &gecos_root;
+      child->output_next = child->fail->output.head ? child->fail : child->fail->output_next;
+      queue[tail++] = child;
+    }
+  }
+
+  xfree(queue);
+  gecos_links_dirty = false;
+}
+
+/* gecos_anchor()
+ *
+ * inputs       - X-line mask
+ *              - buffer for the anchor, at least as large as mask
+ * output       - length of the anchor, which is 0 if there is none
+ * side effects - the longest run of literal characters in mask is
+ *                written to buf, case folded
+ */
+static size_t
+gecos_anchor(const char *mask, unsigned char *buf)
+{
+  const char *run = NULL, *best = NULL;
+  size_t len = 0, best_len = 0;
+
+  for (const char *p = mask; ; ++p)
+  {
+    if (*p == '\0' || *p == '*' || *p == '?')
+    {
+      if (len > best_len)
+      {
+        best = run;
+        best_len = len;
+      }
+
+      if (*p == '\0')
+        break;
+
+      run = NULL;
+      len = 0;
+      continue;
+    }
+
+    if (run == NULL)
+      run = p;
+
+    /* An escaped character is compared exactly by match(); folding it here is still safe */
+    if (*p == '\\' && *(p + 1))
+      ++p;
+    ++len;
+  }
+
+  for (size_t i = 0; i < best_len; ++i, ++best)
+  {
+    if (*best == '\\' && *(best + 1))
+      ++best;
+    buf[i] = ToLower(*best);
+  }
+
+  return best_len;
+}
+
+static void
+gecos_index_add(struct GecosItem *gecos)
+{
+  unsigned char *anchor = xcalloc(strlen(gecos->mask) + 1);
+  const size_t len = gecos_anchor(gecos->mask, anchor);
+
+  if (len == 0)
+  {
+    gecos->anchor = NULL;
+    dlinkAdd(gecos, &gecos->anchor_node, &gecos_unanchored);
+    xfree(anchor);
+    return;
+  }
+
+  struct GecosNode *node = &gecos_root;
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    struct GecosNode *next = gecos_node_child(node, anchor[i]);
+
+    if (next == NULL)
+    {
+      next = gecos_node_add_child(node, anchor[i]);
+      gecos_links_dirty = true;
+    }
+
+    node = next;
+  }
 
+  /* Nodes whose fail chain leads here need their output links updated */
+  if (node->output.head == NULL)
+    gecos_links_dirty = true;
+
+  dlinkAdd(gecos, &gecos->anchor_node, &node->output);
+  gecos->anchor = node;
+  xfree(anchor);
+}
+
+static void
+gecos_index_del(struct GecosItem *gecos)
+{
+  struct GecosNode *const node = gecos->anchor;
+
+  if (node == NULL)
+  {
+    dlinkDelete(&gecos->anchor_node, &gecos_unanchored);
+    return;
+  }
+
+  /* Output links may now point at a node without X-lines; gecos_match() copes with that */
+  dlinkDelete(&gecos->anchor_node, &node->output);
+  gecos->anchor = NULL;
+  gecos_node_prune(node);
+}
 
 const dlink_list *
 gecos_get_list(void)
@@ -43,8 +329,68 @@ gecos_get_list(void)
   return &gecos_list;
 }
 
+/* gecos_mark_stale()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - marks the X-lines from ircd.conf as stale, to be taken
+ *                over by gecos_make() or deleted by gecos_sweep_stale()
+ */
 void
-gecos_clear(void)
+gecos_mark_stale(void)
+{
+  dlink_node *node;
+
+  gecos_stale_count = 0;
+  gecos_added = false;
+
+  gecos_stale_hash_size = 1;
+  while (gecos_stale_hash_size < dlink_list_length(&gecos_list))
+    gecos_stale_hash_size *= 2;
+
+  xfree(gecos_stale_hash);
+  gecos_stale_hash = xcalloc(gecos_stale_hash_size * sizeof(*gecos_stale_hash));
+
+  DLINK_FOREACH(node, gecos_list.head)
+  {
+    struct GecosItem *gecos = node->data;
+
+    if (gecos->in_database == false)
+    {
+      gecos->stale = true;
+      ++gecos_stale_count;
+
+      dlinkAdd(gecos, &gecos->stale_node,
+               &gecos_stale_hash[strhash(gecos->mask) & (gecos_stale_hash_size - 1)]);
+    }
+  }
+}
+
+/* gecos_unstale()
+ *
+ * inputs       - pointer to stale X-line
+ * output       - NONE
+ * side effects - the X-line is no longer going to be deleted by
+ *                gecos_sweep_stale()
+ */
+static void
+gecos_unstale(struct GecosItem *gecos)
+{
+  assert(gecos->stale == true);
+
+  dlinkDelete(&gecos->stale_node, &gecos_stale_hash[strhash(gecos->mask) & (gecos_stale_hash_size - 1)]);
+  gecos->stale = false;
+  --gecos_stale_count;
+}
+
+/* gecos_sweep_stale()
+ *
+ * inputs       - NONE
+ * output       - true if an X-line has been added since gecos_mark_stale()
+ * side effects - deletes the X-lines that are still stale
+ */
+bool
+gecos_sweep_stale(void)
 {
   dlink_node *node, *node_next;
 
@@ -52,9 +398,17 @@ gecos_clear(void)
   {
     struct GecosItem *gecos = node->data;
 
-    if (gecos->in_database == false)
+    if (gecos_stale_count == 0)
+      break;
+
+    if (gecos->stale == true)
       gecos_delete(gecos, false);
   }
+
+  xfree(gecos_stale_hash);
+  gecos_stale_hash = NULL;
+
+  return gecos_added;
 }
 
 void
@@ -64,6 +418,11 @@ gecos_delete(struct GecosItem *gecos, bool expired)
     sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE, "Temporary X-line for [%s] expired",
                          gecos->mask);
 
+  if (gecos->stale == true)
+    gecos_unstale(gecos);
+
+  conf_expire_del(&gecos->expire_queue);
+  gecos_index_del(gecos);
   dlinkDelete(&gecos->node, &gecos_list);
   xfree(gecos->mask);
   xfree(gecos->reason);
@@ -71,10 +430,36 @@ gecos_delete(struct GecosItem *gecos, bool expired)
 }
 
 struct GecosItem *
-gecos_make(void)
+gecos_make(const char *mask)
 {
+  if (gecos_stale_count)
+  {
+    dlink_node *node;
+
+    DLINK_FOREACH(node, gecos_stale_hash[strhash(mask) & (gecos_stale_hash_size - 1)].head)
+    {
+      struct GecosItem *gecos = node->data;
+
+      if (strcmp(gecos->mask, mask))
+        continue;
+
+      gecos_unstale(gecos);
+
+      /* Start over like a new one would; the caller sets the reason anew */
+      gecos_set_expire(gecos, 0);
+      gecos->setat = 0;
+      xfree(gecos->reason);
+      gecos->reason = NULL;
+      return gecos;
+    }
+  }
+
+  gecos_added = true;
+
   struct GecosItem *gecos = xcalloc(sizeof(*gecos));
+  gecos->mask = xstrdup(mask);
   dlinkAdd(gecos, &gecos->node, &gecos_list);
+  gecos_index_add(gecos);
 
   return gecos;
 }
@@ -82,33 +467,103 @@ gecos_make(void)
 struct GecosItem *
 gecos_find(const char *name, int (*compare)(const char *, const char *))
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
 
-  DLINK_FOREACH_SAFE(node, node_next, gecos_list.head)
+  DLINK_FOREACH(node, gecos_list.head)
   {
     struct GecosItem *gecos = node->data;
 
-    if (gecos->expire &&
-        (gecos->expire <= event_base->time.sec_real))
-      gecos_delete(gecos, true);
-    else if (compare(gecos->mask, name) == 0)
+    if (compare(gecos->mask, name) == 0)
       return gecos;
   }
 
   return NULL;
 }
 
-void
-gecos_expire(void)
+/*! \brief Finds an X-line matching a realname
+ * \param info Realname
+ * \return Pointer to the X-line, or NULL if there is none
+ */
+struct GecosItem *
+gecos_match(const char *info)
 {
-  dlink_node *node, *node_next;
+  const struct GecosNode *state = &gecos_root;
+  dlink_node *node;
 
-  DLINK_FOREACH_SAFE(node, node_next, gecos_list.head)
+  DLINK_FOREACH(node, gecos_unanchored.head)
   {
     struct GecosItem *gecos = node->data;
 
-    if (gecos->expire &&
-        (gecos->expire <= event_base->time.sec_real))
-      gecos_delete(gecos, true);
+    if (match(gecos->mask, info) == 0)
+      return gecos;
   }
+
+  if (gecos_root.child_count == 0)
+    return NULL;
+
+  gecos_links_update();
+  ++gecos_match_serial;
+
+  for (const unsigned char *p = (const unsigned char *)info; *p; ++p)
+  {
+    const unsigned char key = ToLower(*p);
+    const struct GecosNode *next;
+
+    while ((next = gecos_node_child(state, key)) == NULL && state != &gecos_root)
+      state = state->fail;
+
+    if (next == NULL)
+      continue;  /* Back at the root */
+
+    state = next;
+
+    for (const struct GecosNode *out = state->output.head ? state : state->output_next; out;
+         out = out->output_next)
+    {
+      DLINK_FOREACH(node, out->output.head)
+      {
+        struct GecosItem *gecos = node->data;
+
+        /* An anchor may occur more than once in info */
+        if (gecos->match_serial == gecos_match_serial)
+          continue;
+
+        gecos->match_serial = gecos_match_serial;
+
+        if (match(gecos->mask, info) == 0)
+          return gecos;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/*! \brief Counts up memory used by the X-line matcher
+ */
+void
+gecos_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  *count = gecos_node_count;
+  *bytes = gecos_node_count * sizeof(struct GecosNode);
+}
+
+static void
+gecos_expire(void *data)
+{
+  gecos_delete(data, true);
+}
+
+/*! \brief Makes an X-line temporary
+ * \param gecos  Pointer to X-line
+ * \param expire Real time the X-line expires
+ */
+void
+gecos_set_expire(struct GecosItem *gecos, uintmax_t expire)
+{
+  conf_expire_del(&gecos->expire_queue);
+  gecos->expire = expire;
+
+  if (expire)
+    conf_expire_add(&gecos->expire_queue, expire, gecos_expire, gecos);
 }
@@ -355,8 +355,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 255
-#define YY_END_OF_BUFFER 256
+#define YY_NUM_RULES 268
+#define YY_END_OF_BUFFER 269
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -364,187 +364,201 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1623] =
+static const flex_int16_t yy_accept[1756] =
     {   0,
-        4,    4,  256,  254,    4,    3,  254,    5,  254,  254,
-        6,  254,  254,  254,  254,  254,  254,  254,  254,  254,
-      254,  254,  254,  254,  254,  254,  254,  254,  254,  254,
-      254,  254,  254,  254,    4,    3,    0,    7,    5,  253,
+        4,    4,  269,  267,    4,    3,  267,    5,  267,  267,
+        6,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+      267,  267,  267,  267,    4,    3,    0,    7,    5,  266,
         0,    2,    5,    6,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   92,
-        0,  247,    0,    0,    0,    0,    0,    0,    0,  252,
-        0,    0,    0,    0,    0,    0,    0,  226,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       99,    0,  260,    0,    0,    0,    0,    0,    0,    0,
+      265,    0,    0,    0,    0,    0,    0,    0,  239,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   12,    0,    0,    0,    0,
-       20,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  234,    0,    0,    0,    0,    0,
-       46,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   12,    0,    0,    0,
+        0,   21,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  247,    0,    0,    0,    0,
+        0,   48,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   84,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  106,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   88,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  113,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  161,    0,    0,    0,    0,
-        0,    0,  175,    0,    0,  178,    0,    0,    0,    0,
-      183,    0,  185,    0,    0,    0,    0,  197,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  225,    0,    0,    0,    0,    0,
-       15,    0,    0,   19,  242,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  233,   36,    0,
-        0,    0,   44,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   63,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   83,  236,    0,    0,
-       93,   94,   95,    0,   96,    0,    0,    0,    0,    0,
-        0,  107,    0,    0,    0,    0,    0,    0,    0,  126,
-      127,    0,    0,    0,  133,    0,    0,    0,    0,  140,
-      145,    0,    0,  149,    0,  152,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  165,    0,    0,    0,    0,
-        0,    0,  179,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  208,    0,    0,    0,    0,    0,
-        0,  216,    0,    0,    0,    0,  232,    0,    0,    0,
-
-      228,    0,    0,    9,    0,    0,    0,    0,  241,    0,
-        0,   24,    0,    0,   28,    0,   30,    0,    0,    0,
-        0,   37,    0,   43,    0,    0,   50,    0,   54,    0,
-        0,    0,    0,    0,    0,    0,    0,   64,    0,   68,
-       69,    0,    0,    0,    0,    0,    0,    0,  235,    0,
-        0,    0,  246,    0,    0,   98,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  251,    0,    0,
-        0,    0,    0,  230,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  169,    0,
+        0,    0,    0,    0,    0,    0,  184,    0,    0,  187,
+        0,    0,    0,    0,  192,    0,  194,    0,    0,    0,
+        0,  206,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  238,    0,
+        0,    0,    0,    0,   15,    0,    0,   20,  255,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  157,    0,    0,    0,    0,    0,    0,    0,  169,
+        0,    0,  246,   38,    0,    0,    0,   46,    0,    0,
 
-        0,    0,    0,    0,    0,    0,  180,    0,  182,  184,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   65,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   87,  249,    0,    0,    0,  100,  101,  102,    0,
+      103,    0,    0,    0,    0,    0,    0,  114,    0,    0,
+        0,    0,    0,    0,    0,    0,  134,  135,    0,    0,
+        0,  141,    0,    0,    0,    0,  148,  153,    0,    0,
+      157,    0,  160,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  173,    0,    0,    0,    0,    0,    0,    0,
+      188,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  221,    0,    0,    0,    0,    0,    0,  229,
+
+        0,    0,    0,    0,  245,    0,    0,    0,  241,    0,
+        0,    9,    0,    0,    0,    0,    0,  254,    0,    0,
+       25,    0,    0,   29,    0,   31,    0,    0,    0,    0,
+        0,   39,    0,   45,    0,    0,   52,    0,   56,    0,
+        0,    0,    0,    0,    0,    0,    0,   66,    0,   70,
+       73,    0,    0,    0,    0,    0,    0,    0,  248,    0,
+        0,    0,    0,  259,    0,    0,  105,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  264,    0,
+        0,    0,    0,    0,    0,  243,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      231,  221,    0,  223,  227,    0,    0,    0,   11,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   29,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   58,    0,    0,    0,    0,    0,    0,    0,    0,
-       75,    0,    0,    0,    0,    0,    0,    0,  245,    0,
-        0,    0,    0,    0,  104,  105,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  250,    0,  238,    0,
 
-        0,  124,  229,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      154,    0,  156,    0,    0,  160,  162,    0,    0,    0,
-      240,    0,  170,    0,    0,  176,    0,    0,    0,  193,
+        0,    0,    0,  165,    0,    0,    0,    0,    0,    0,
+        0,    0,  178,    0,    0,    0,    0,    0,    0,  189,
+        0,  191,  193,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      209,    0,    0,    0,  213,    0,    0,  217,    0,  220,
+        0,    0,    0,    0,    0,    0,  244,  234,    0,  236,
+      240,    0,    0,    0,   11,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   30,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   60,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   79,
+        0,    0,    0,    0,    0,    0,    0,    0,  258,    0,
+
+        0,    0,    0,    0,  111,  112,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  263,    0,    0,  251,
+        0,    0,  132,  242,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   25,    0,   31,   32,   33,    0,    0,
+        0,  162,    0,  164,    0,    0,  168,  170,    0,    0,
+        0,    0,  253,    0,  179,    0,    0,  185,    0,    0,
+        0,  202,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  222,    0,    0,    0,
+      226,    0,    0,  230,    0,  233,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   70,   73,    0,    0,    0,    0,    0,    0,
 
+       26,    0,   32,   33,    0,   35,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   74,   77,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  237,    0,    0,  125,  128,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  153,    0,    0,    0,    0,  164,    0,    0,  239,
-        0,    0,    0,  173,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  196,    0,    0,    0,    0,
-        0,    0,    0,    0,  210,  211,    0,  214,    0,  218,
-        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
-        0,   22,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   60,    0,    0,    0,
-        0,    0,    0,   78,    0,    0,   85,    0,    0,    0,
-        0,    0,  244,    0,    0,    0,    0,    0,    0,  109,
-        0,  112,    0,    0,    0,    0,    0,    0,  249,  121,
-        0,    0,    0,    0,  136,    0,  135,    0,  143,    0,
-        0,    0,    0,  148,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  128,  250,    0,    0,  133,  136,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  161,    0,    0,    0,    0,
+      172,    0,    0,    0,  252,    0,    0,    0,  182,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   18,    0,   23,
+
+      205,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  223,  224,    0,  227,    0,  231,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   17,    0,
+        0,   23,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   62,    0,    0,
+        0,    0,    0,    0,    0,    0,   82,    0,    0,   89,
+        0,    0,    0,    0,    0,    0,    0,    0,  257,    0,
+        0,    0,    0,    0,    0,  116,    0,  119,    0,    0,
+        0,    0,    0,    0,  262,  129,    0,    0,    0,    0,
+      144,    0,  143,    0,  151,    0,    0,    0,    0,  156,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   56,    0,    0,    0,    0,    0,    0,
-        0,   77,    0,    0,   86,    0,    0,    0,    0,  243,
-        0,    0,    0,    0,  103,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  248,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  146,    0,  151,    0,  158,
-      159,  163,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  212,    0,    0,    0,
-        0,    0,    1,    0,    1,    0,    0,    0,    0,   17,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   59,    0,   62,    0,   74,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  108,    0,    0,    0,    0,    0,    0,
-        0,  118,    0,    0,    0,  129,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
+        0,   24,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   58,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   81,    0,    0,    0,
+        0,    0,   93,    0,    0,    0,    0,  256,    0,    0,
+        0,    0,  110,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,  261,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  154,    0,  159,    0,  166,  167,  171,
+        0,  175,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      171,  172,  174,  177,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  225,
+        0,    0,    0,    0,    0,    1,    0,    1,    0,    0,
+        0,    0,    0,   18,    0,    0,   34,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       61,    0,   64,    0,    0,   72,   78,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   34,    0,    0,    0,    0,   45,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   76,    0,    0,
+        0,    0,    0,  115,    0,    0,    0,    0,    0,    0,
+        0,  125,    0,    0,    0,  137,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      180,  181,  183,  186,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  113,  114,    0,    0,    0,  119,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  142,    0,  150,
-      155,  166,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   36,    0,    0,
+        0,    0,   47,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   71,   80,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  215,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   47,    0,    0,    0,
-        0,    0,   57,    0,    0,    0,   81,    0,    0,    0,
-        0,    0,    0,    0,   99,    0,    0,    0,    0,  111,
 
-        0,    0,    0,    0,    0,    0,    0,  132,    0,    0,
-        0,    0,    0,    0,    0,    0,  181,    0,    0,    0,
+        0,  120,  121,    0,    0,    0,  126,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  150,    0,  158,  163,
+      174,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  206,    0,    0,    0,  224,    0,   10,
+        0,    0,    0,    0,    0,  228,    0,    0,    0,    0,
+        0,    0,    0,   16,    0,    0,    0,    0,    0,    0,
+       49,    0,    0,    0,    0,    0,   59,    0,    0,    0,
+       85,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  106,    0,    0,    0,    0,  118,    0,    0,    0,
+        0,    0,    0,    0,  140,    0,    0,    0,    0,    0,
+
+        0,    0,    0,  190,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   53,    0,    0,   65,    0,    0,   82,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  117,
-        0,    0,  130,    0,  134,    0,    0,    0,    0,    0,
-        0,  168,    0,    0,    0,    0,    0,    0,    0,    0,
-      195,    0,    0,    0,    0,    0,    0,    0,  207,    0,
-
-        0,    0,    0,    0,   21,    0,    0,    0,    0,    0,
-        0,    0,    0,   51,   55,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   71,    0,    0,    0,  110,    0,
+        0,    0,    0,    0,  219,    0,    0,    0,  237,    0,
+       10,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   55,    0,    0,   67,    0,    0,   86,    0,
+        0,   92,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  124,    0,    0,  138,    0,  142,    0,
+        0,    0,    0,    0,    0,  177,    0,    0,    0,    0,
+        0,    0,    0,    0,  204,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  220,    0,    0,    0,
+
+        0,    0,   22,    0,    0,    0,    0,    0,    0,    0,
+        0,   53,   57,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   75,    0,    0,    0,  117,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  194,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    8,   13,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   52,    0,
-        0,    0,    0,   80,    0,    0,    0,    0,    0,    0,
-       72,    0,    0,    0,    0,  116,    0,  122,    0,  137,
+        0,    0,    0,    0,    0,    0,    0,  203,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    8,   13,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   54,    0,    0,    0,    0,   84,    0,    0,
+        0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
+        0,  123,    0,  130,    0,  145,    0,    0,    0,    0,
 
-        0,    0,    0,    0,  200,    0,    0,    0,    0,    0,
-        0,    0,    0,   26,   27,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  115,  120,    0,    0,    0,
-        0,    0,  141,  147,    0,  186,    0,    0,    0,    0,
+      209,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   27,   28,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   90,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  122,  127,    0,
+        0,    0,    0,    0,  149,  155,    0,  195,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   39,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  101,
-        0,    0,    0,    0,    0,    0,    0,  187,  188,  189,
-      190,  191,  192,    0,  201,    0,  203,    0,    0,    0,
-
-        0,    0,    0,   38,    0,    0,    0,    0,   61,    0,
-       67,    0,    0,    0,   89,    0,   91,    0,  100,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
+        0,    0,    0,    0,    0,    0,    0,    0,   91,    0,
+        0,    0,    0,    0,    0,    0,  108,    0,    0,    0,
+
+        0,    0,    0,    0,  196,  197,  198,  199,  200,  201,
+        0,  210,    0,  212,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   40,    0,    0,    0,    0,   63,
+        0,   69,    0,    0,    0,   96,    0,   98,    0,  107,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   42,    0,    0,   66,    0,
-        0,   88,    0,    0,  102,    0,  131,    0,  139,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   35,
-        0,    0,    0,    0,   79,   87,   90,    0,    0,  138,
-        0,  167,  198,    0,    0,    0,  205,    0,    0,    0,
-        0,    0,   48,    0,   97,    0,  144,    0,    0,    0,
-      219,  222,    0,    0,    0,    0,  123,    0,    0,    0,
-
-        0,    0,   41,   49,    0,  202,    0,    0,   40,    0,
-        0,    0,    0,    0,    0,    0,    0,   14,  199,    0,
-      204,    0
+      214,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       44,    0,    0,   68,    0,    0,   95,    0,    0,  109,
+        0,  139,    0,  147,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  218,    0,    0,    0,   37,    0,    0,
+        0,    0,   83,   94,   97,    0,    0,  146,    0,  176,
+
+      207,    0,    0,    0,    0,    0,  217,    0,    0,    0,
+        0,    0,   50,    0,  104,    0,  152,    0,    0,  213,
+        0,    0,  232,  235,    0,    0,    0,    0,  131,    0,
+        0,    0,  216,    0,    0,   43,   51,    0,  211,    0,
+        0,   42,    0,    0,    0,    0,    0,    0,    0,    0,
+       14,  208,    0,  215,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -558,11 +572,11 @@ static const YY_CHAR yy_ec[256] =
         1,   13,    1,    1,   14,   15,   16,   17,   18,   19,
        20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
        30,   31,   32,   33,   34,   35,   36,   37,   38,   39,
-        1,    1,    1,    1,   40,    1,   41,   42,   43,   44,
+        1,    1,    1,    1,   40,    1,   14,   15,   16,   17,
 
-       45,   46,   47,   48,   49,   50,   51,   52,   53,   54,
-       55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
-       65,   66,    1,    1,    1,    1,    1,    1,    1,    1,
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+       38,   39,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -579,1089 +593,1326 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[41] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1628] =
+static const flex_int16_t yy_base[1756] =
     {   0,
-        0,    0, 3121, 3122, 3118,    0,   64,    0,   62,   64,
-       64,   96,   49,  146,  198,   52,   68,   58,  115,   68,
-       52,  136,  147,  240,  282,   52,  330,  159,  372,  419,
-      154,  196,   66,   74, 3117,    0,   82, 3122,    0, 3122,
-       72, 3122,    0,   91,  109,  101,   95,  120,  133,  146,
-      168,  170,  170,  172,  194,  187,  208,  208,  242,  207,
-      220,  200,  471,  227,  218,  218,  243,  274,  276,  244,
-      249,  285,  291,  251,  252,  291,  288,  296,  277,  289,
-      306,  291,  305,  311,  313,  328,  314,  334,  316,  321,
-      344,  338,  370,  346,  361,  365,  368,  368,  381,  400,
-
-      403,  385,  384,  398,  419,  411,  517,  433,  439,  447,
-      452,  427,  431,  445,  418,  429,  466,  456,  458,  466,
-      462, 3078,  466,  473,  560,  487,  484,  505,  480,  502,
-      512,  511,  511,  515,  501, 3122,  519,  524,  508,  531,
-     3122,  537,  534, 3077,  535,  536,  538,  542,  560,  548,
-      549,  557,  560,  563,  560,  574,  560,  581,  560,  584,
-     3122,  588,  576,  574,  587,  598,  585,  599,  597,  606,
-      613,  607,  618,  617,  618,  609,  611,  623,  627,  627,
-      629,  615,  618, 3076,  630,  123,  626,  621,  632,  629,
-      647,  648,  637,  643, 3122,  653, 3075,  649,  671,  652,
-
-      654,  656,  674,  675,  681,  679,  663,  676,  673,  674,
-      688,  674,  688,  690,  678,  690,  694,  684,  690,  687,
-      707,  693,  696,  714,  725, 3122,  712,  710, 3074,  714,
-      730,  714, 3122,  719,  722, 3122,  736,  730,  723,  729,
-     3122,  737, 3122,  727,  741,  734,  746, 3073,  739,  750,
-      754,  748,  753,  757,  767,  765,  763,  768,  769,  775,
-      775,  779,  777,  776, 3122,  783,  780,  783,  782, 3072,
-     3122,  797, 3071, 3122,  782,  798,  799,  792,  795, 3070,
-      793,  800,  811,  797,  818,  815,  821, 3122, 3122,  824,
-      813,  817, 3122,  819,  836,  835, 3069,  830,  833,  823,
-
-      844,  834,  833,  834,  849,  840, 3122,  837,  837,  855,
-      841,  845,  851, 3068,  863,  871, 3122,  851,  860,  869,
-     3122, 3122, 3122,  880, 3067,  889,  887,  883, 3066,  891,
-      883, 3122,  926,  898,  902,  885,  897,  897,  902, 3122,
-     3122,  900, 3065,  902, 3122,  906,  906,  915,  920,  941,
-     3122, 3064,  911, 3122, 3063, 3122,  938,  941,  933,  935,
-      936,  939,  939,  939,  962, 3062,  948,  951,  954,  969,
-      971,  959, 3122,  970,  985,  983,  973,  975,  990,  976,
-      982, 1014,  998, 1001, 3122,  999,  998,  999,  998,  993,
-     1004, 3122, 1002, 1004, 3061, 1007, 1009, 1011, 1031, 1031,
-
-     1018, 1021, 1023, 1038, 1043, 1037, 1034, 1047, 3122, 1035,
-     1046, 3122, 1056, 1060, 3122, 1045, 3122, 1061, 1054, 1068,
-     3060, 3122, 1060, 3122, 1064, 1067, 3059, 1072, 3122, 1077,
-     1068, 1082, 1067, 1089, 1077, 1092, 1083, 3122, 1096, 3122,
-     3122, 1101, 1087, 1095, 1091, 1099, 1106, 1103, 3122, 1114,
-     1107, 1114, 1101, 1118, 1100, 3058, 3057, 1113, 1113, 1114,
-     1132, 1135, 1130, 1136, 1126, 1135, 1144, 1132, 1130, 1152,
-     1154, 1146, 1159, 1147, 1162, 1164, 1152, 1156, 1170, 1164,
-     1161, 1161, 3056, 1174, 1164, 1175, 1189, 1180, 1183, 1186,
-     1190, 3122, 1194, 1197, 1206, 1194, 1210, 1200, 1216, 3122,
-
-     1207, 1206, 1224, 1213, 1225, 3055, 3122, 1229, 3122, 3122,
-     3054, 1213, 1214, 1214, 1243, 1233, 1238, 1223, 1222, 1231,
-     1234, 1245, 1249, 1255, 1243, 1252, 1252, 1253, 1258, 1271,
-     3122, 3122, 1258, 3053, 3122, 1274, 3052, 1262, 3122, 1273,
-     1267, 1270, 1272, 1279, 1280, 1280, 1285, 1289, 3122, 1282,
-     1298, 1283, 1291, 1292, 1297, 1312, 1305, 1305, 3051, 1300,
-     3050, 3122, 1301, 1322, 3049, 1312, 1314, 1319, 1313, 1330,
-     3048, 1334, 1324, 1333, 1333, 1322, 1340, 3047, 3122, 1335,
-     1329, 1347, 1353, 1350, 3122, 3122, 1351, 1352, 1366, 1359,
-     1350, 1359, 1371, 1362, 1359, 1364, 3122, 1362, 1366, 1374,
-
-     1374, 1370, 3122, 1385, 1387, 1391, 1384, 1391, 1379, 1399,
-     3046, 1390, 1404, 1394, 1397, 1410, 1396, 1405, 1412, 1421,
-     3122, 3045, 3122, 1411, 1422, 3122, 1426, 1409, 1407, 1425,
-     1417, 1438, 1434, 1435, 1424, 3122, 1432, 1434, 1469, 3122,
-     1437, 1430, 1441, 1444, 1448, 3044, 1445, 1449, 3043, 1454,
-     3122, 1470, 1474, 1461, 3122, 1478, 1481, 1474, 1479, 3122,
-     3042, 1491, 1492, 1482, 1479, 1497, 1502, 1490, 1492, 1501,
-     1512, 1509, 1504, 3122, 1502, 3122, 3122, 1522, 1515, 3041,
-     1512, 3040, 1524, 3039, 1529, 1530, 1524, 1528, 1526, 1524,
-     1537, 3038, 3122, 3122, 1539, 1533, 1534, 1545, 1539, 1534,
-
-     1542, 1542, 1579, 1557, 1562, 1544, 1561, 1560, 1568, 1557,
-     1581, 1568, 1574, 1584, 1581, 1582, 1581, 1591, 1589, 1589,
-     1596, 3122, 1597, 1581, 3122, 3122, 1600, 1587, 3037, 1600,
-     3036, 1603, 1596, 1603, 1597, 1612, 1611, 1618, 1626, 1621,
-     1624, 3122, 1629, 1622, 1623, 1641, 3122, 1638, 1622, 3122,
-     1626, 1637, 1633, 3122, 1641, 1637, 1643, 3035, 3034, 3033,
-     3032, 3031, 3030, 3029, 1651, 3122, 1638, 1651, 1646, 1645,
-     1643, 1650, 1671, 3028, 3122, 3122, 1671, 3122, 1671, 3122,
-     3027, 1672, 1657,  134, 1683, 1672, 1680, 1679, 3122, 1680,
-     1690, 3122, 1692, 1693, 1686, 1681, 3026, 1700, 1691, 1714,
-
-     1687, 1695, 1685, 1708, 1705, 1701, 3122, 1713, 1727, 1722,
-     1721, 1737, 1725, 3122, 1740, 1724, 3122, 1743, 1737, 1745,
-     1727, 1733, 1734, 1749, 1741, 1749, 1748, 1752, 1748, 3025,
-     1752, 3122, 1747, 1748, 3024, 1764, 1765, 1771, 1764, 3122,
-     1775, 1772, 1769, 1785, 3122, 1786, 3122, 1793, 3122, 1784,
-     1777, 1799, 1784, 3122, 1794, 1801, 1803, 1788, 1787, 1798,
-     1801, 1816, 1799, 1816, 1815, 1819, 1803, 1819, 1824, 1822,
-     1823, 1825, 1827, 1828, 1831, 3023, 1843, 1848, 1849, 1855,
-     1856, 1843, 1854, 1856, 1857, 1853, 1860, 1857, 1863, 1883,
-     3058, 3048, 1852, 1874, 3020, 3019, 1856, 3122, 3018, 3122,
-
-     1872, 1873, 1883, 1880, 1879, 1895, 1882, 1878, 1899, 1896,
-     3017, 1902, 1887, 3122, 1895, 1895, 1905, 1891, 1903, 1893,
-     1901, 3122, 3016, 1911, 3015, 1906, 1905, 1906, 1920, 3122,
-     1916, 3014, 1925, 1930, 3122, 1912, 1933, 1941, 1943, 1935,
-     1948, 1935, 1934, 3008, 3122, 1943, 1941, 1939, 1958, 1963,
-     1953, 1948, 1966, 3007, 1964, 3006, 1961, 3122, 1959, 3122,
-     3122, 3122, 1958, 1956, 1956, 1978, 1969, 1980, 1982, 1981,
-     1991, 1986, 1988, 1989, 1991, 1992, 1993, 2013, 2008, 1997,
-     2014, 2000, 2012, 2002, 2009, 2017, 3122, 2009, 2009, 2006,
-     2015, 3040, 3039, 3028, 3026, 2011, 2017, 2032, 2034, 3122,
-
-     2017, 2039, 2037, 2041, 2043, 2050, 2037, 2048, 2043, 2057,
-     2056, 2067, 2066, 2070, 2064, 3122, 2056, 3122, 2061, 3122,
-     2071, 2071, 2060, 2076, 2067, 2079, 2086, 2082, 2998, 2076,
-     2090, 2080, 2082, 3122, 2107, 2098, 2093, 2095, 2107, 2111,
-     2108, 3122, 2103, 2111, 2120, 3122, 2110, 2107, 2114, 2113,
-     2994, 2110, 2109, 2112, 2113, 2128, 2131, 2118, 2136, 2130,
-     3122, 3122, 3122, 3122, 2137, 2128, 2143, 2156, 2157, 2159,
-     2161, 2162, 2154, 2161, 2162, 2985, 2156, 2176, 2173, 2159,
-     2160, 2169, 2175, 2169, 2164, 2169, 2163, 2172, 2178, 2168,
-     2194, 1530, 3122, 2180, 2185, 2187, 1430, 3122, 2194, 2210,
-
-     2201, 2209, 2206, 2220, 2203, 1424, 2213, 3122, 2207, 2211,
-     2226, 2218, 2219, 2209, 2217, 2216, 2217, 2230, 2220,  973,
-     2223, 2225, 3122, 3122, 2245, 2235, 2240, 3122, 2249, 2252,
-     2238, 2262, 2264, 2255, 2269, 2255, 2262, 3122, 2268, 3122,
-     3122, 3122,  886, 2261, 2280, 2284, 2268, 2269, 2270, 2271,
-     2272, 2273, 2272, 2281, 2292, 2288, 2289, 2290,  881, 2303,
-     2308, 2290, 3122, 2305, 2308, 2304, 2311, 2310, 2314, 2322,
-     2323, 2324, 2318, 2335,  875, 2337, 3122,  844, 2321, 2338,
-     2323, 2330, 3122, 2331, 2328, 2333, 3122, 2340, 2333,  517,
-     2334,  471, 2352, 2352, 3122, 2358,  466, 2360, 2357, 3122,
-
-     2359, 2370, 2373, 2366, 2381, 2379, 2367, 3122, 2382, 2378,
-     2376,  464, 2378, 2381, 2384, 2392, 3122, 2395,  419,  418,
-      416,  408,  373,  366, 2384, 2394, 2400, 2393, 2382, 2391,
-      338, 2404, 2407, 3122, 2414, 2411, 2399, 3122, 2400, 3122,
-     2412, 2411, 2412, 2418,  336, 2433, 2431, 2427, 2437, 2436,
-     2428, 3122, 2428, 2433,  334, 2436, 2434, 3122, 2448,  330,
-     2449,  327, 2442, 2438, 2466, 2449, 2455, 2455, 2445, 3122,
-     2463, 2453, 3122, 2463, 3122, 2477,  326, 2482, 2484, 2474,
-     2486, 3122, 2481, 2479, 2480, 2485, 2486, 2487, 2488, 2484,
-     3122, 2485, 2487, 2498, 2495, 2504, 2502,  323, 3122, 2511,
-
-     2491, 2515, 2519,  240, 3122, 2502, 2522, 2511, 2526, 2527,
-     2531, 2534,  237,  262, 3122, 2524, 2541,  231, 2529, 2534,
-     2553, 2546, 2535, 2552,  258, 2543, 2550, 2559, 3122, 2556,
-     2555, 2544, 2561, 2552, 2552, 2582, 2576, 2573, 2567, 2555,
-     2588, 2582, 2584, 2585, 2587, 2588, 2589, 3122, 2603, 2589,
-     2590,  195, 2602, 2605, 2606, 2594,  191, 3122, 3122, 2602,
-      217, 2609, 2597, 2606, 2607, 2619, 2626, 2628, 3122, 2623,
-     2628, 2625, 2628, 3122, 2633, 2633, 2641, 2651, 2644,  189,
-     3122, 2634, 2643, 2643, 2643, 3122, 2655,  159, 2644, 3122,
-     2653, 2651, 2655, 2649, 2664,  143, 2667, 2660, 2661, 2664,
-
-     2666, 2669, 2673,  113, 3122, 2681, 2669, 2676, 2692, 2683,
-      107, 2690, 2699, 3122, 3122, 2705, 2693, 2704, 2695, 2697,
-     2702, 2702, 2715, 2707, 2708, 2705, 2708, 2702, 2712, 2712,
-     2714, 2718, 2718, 2730, 2725, 3122, 3122, 2721, 2732, 2727,
-     2748, 2743, 3122, 3122, 2750, 3122, 2733, 2735, 2736, 2738,
-     2739, 2740, 2764, 2752, 2767, 2768, 2755, 2760, 2774, 2772,
-     2760, 2766, 2761, 3122, 2780, 2766, 2775, 2780, 2789, 2794,
-     2791, 2800, 2804, 2796, 2807, 2800, 2810, 2808, 2798, 3122,
-     2814, 2815, 2810, 2824, 2826, 2823, 2820, 3122, 3122, 3122,
-     3122, 3122, 3122, 2821, 3122, 2814, 3122, 2813, 2813, 2823,
-
-     2824, 2821, 2836, 3122,  104, 2828, 2843, 2836, 3122, 2825,
-     3122, 2841, 2860, 2844, 3122, 2861, 3122, 2855, 3122, 2857,
-     2858, 2858, 2872, 2866, 2861, 2868, 2869, 2861,  101, 2868,
-     2870, 2880, 2887, 2884, 2898, 3122, 2880, 2893, 3122, 2878,
-     2882, 3122, 2891, 2895, 3122, 2897, 3122, 2905, 3122, 2911,
-     2917, 2918, 2918, 2917, 2926, 2913, 2930, 2914, 2928, 3122,
-     2921, 2928, 2919, 2925, 3122, 3122, 3122, 2921, 2930, 3122,
-     2939, 3122, 3122, 2941, 2930, 2939, 3122, 2944, 2948, 2952,
-     2937, 2954, 3122, 2967, 3122, 2967, 3122, 2956, 2971, 2970,
-     3122, 3122,   95, 2965, 2975, 2962, 3122, 2970, 2983, 2973,
-
-     2969, 2970, 3122, 3122, 2973, 3122, 2974, 2984, 3122, 2986,
-     2987, 2984, 2986, 2982, 3000, 2989, 3002, 3122, 3122, 2998,
-     3122, 3122,  130, 3051,   95,   93,   87
+        0,   41,  208,  249,  658,  205,   82,  246,  852,  701,
+      657,  679,  817,  700,  753,  823,  669,  897,  799,  802,
+      737,  810,  761,  770,  740,  682,  772,  824,  656,  755,
+      841,  843, 1099, 1108,  662,  287,  123,  290,  328,  331,
+     1100,  372,  369,  661,  718,  866, 1101, 1106, 1114, 1120,
+      995, 1122, 1130, 1132,  920, 1133,  996, 1135,  812,  905,
+     1138, 1136,  782,  923, 1137, 1139, 1046,  659,  730,  742,
+     1141,  924,  926, 1140, 1142, 1143,  925, 1155, 1144, 1145,
+     1146, 1151, 1148, 1150, 1156, 1157, 1169, 1158,  863,  928,
+     1164,  934, 1167,  848, 1171,  927,  933, 1176,  935, 1179,
+
+      943,  854, 1182, 1184, 1188, 1189, 1187,  676, 1196,  820,
+      936,  939, 1191, 1193,  944, 1195, 1198, 1203, 1199, 1200,
+     1201, 1204, 1208, 1211, 1216,  791, 1219,  946,  958, 1218,
+     1220,  949, 1222, 1221, 1225, 1224,  413, 1228,  790, 1226,
+     1232,  454, 1233, 1234, 1235, 1241, 1243, 1245, 1252, 1253,
+     1254, 1255,  968, 1256, 1257, 1258, 1260, 1261,  970, 1263,
+     1265,  495, 1266, 1267, 1272, 1269, 1273, 1274, 1278, 1277,
+     1285, 1292, 1289, 1293, 1297,  979, 1298, 1299, 1300, 1302,
+     1306,  974, 1308, 1311, 1312, 1313, 1316,  795, 1319, 1320,
+      980, 1321, 1323, 1325, 1322, 1328,  536, 1330, 1329, 1331,
+
+     1333, 1332,  726, 1334, 1337, 1343, 1349, 1336, 1345, 1335,
+     1351, 1357,  983, 1358, 1359, 1361, 1365, 1366, 1372, 1374,
+     1376, 1377, 1378, 1380, 1381, 1382, 1386, 1387,  577, 1388,
+      985, 1389, 1384, 1391, 1403, 1392,  618, 1395, 1399,  663,
+     1396, 1400, 1402, 1404,  712, 1407,  807, 1405, 1411, 1415,
+     1410, 1418,  987, 1422, 1433, 1423, 1434, 1439, 1436, 1437,
+      986, 1441, 1442, 1445, 1444,  993, 1446, 1447,  830, 1449,
+     1451, 1452, 1453, 1455, 1456, 1460, 1457,  877, 1470, 1463,
+     1464, 1465, 1471, 1472, 1475, 1477, 1485, 1484, 1486, 1487,
+     1488, 1490,  882,  937, 1489, 1491, 1493,  940, 1499, 1501,
+
+     1505, 1494, 1510, 1511, 1513, 1514, 1515, 1519, 1521, 1520,
+     1526, 1001, 1527, 1522, 1528, 1529, 1531, 1537, 1533, 1539,
+      665, 1004, 1540, 1541, 1542,  989, 1048, 1049, 1053, 1546,
+     1543, 1548, 1553, 1556, 1547, 1558, 1549, 1094,  717, 1566,
+     1570, 1560, 1568, 1003, 1569, 1574, 2110, 2342, 1577, 1579,
+     1581, 2343, 1586, 1588, 1589, 1590,  844, 2345, 1591, 1592,
+     2346, 1593, 3648, 1596, 1598, 1597, 1599, 1600, 1603, 1605,
+     1602, 1606, 1607, 1618, 1610, 1616,  998,  871, 1622, 1612,
+     3896, 1621, 1626, 1629, 1623, 1632, 1641, 1624, 1638,  703,
+     1644, 1649, 3897, 1650, 1651, 1652, 1653, 1654, 1655, 3901,
+
+     1660, 1661, 1662, 1665, 1667, 1669, 1670, 1672, 1671, 1675,
+     1678, 1676, 1682, 1000, 1680, 1687, 1019, 3902, 1681, 1683,
+     3903, 1688, 1692, 3904, 1691, 3907, 1704, 1693, 1705, 1694,
+     1695, 3917, 1714, 3918, 1697, 1716, 1717, 1718, 3919, 1725,
+     1721, 1727, 1726, 1728, 1729, 1730, 1731, 3921, 1733, 1732,
+     3923, 1734, 1736, 1738, 1737, 1745, 1746, 1002, 3924, 1753,
+     1749, 1752, 1755, 1754, 1761, 1762, 1768, 1769, 1770, 1771,
+     1775, 1776, 1779, 1778, 1014, 1782, 1033, 1036, 1780, 1781,
+     1785, 1784, 1787, 1783, 1788, 1790, 1794, 1037, 1795, 1797,
+     1803, 1791, 1805, 1813, 1815, 1040, 1817, 1820, 1042, 1818,
+
+     1823, 1824, 1825, 3925, 1044, 1833, 1829, 1827, 1831, 1830,
+     1832, 1839, 3927, 1835, 1834, 1841, 1838, 1843, 1837, 3928,
+     1861, 3929, 3930, 1840, 1862, 1867, 1842,  872, 1868, 1869,
+     1870, 1872, 1043, 1871, 1844, 1873, 1874, 1878, 1882, 1879,
+     1884, 1885, 1886, 1887, 1891, 1892, 3931, 3932, 1894, 1896,
+     3933, 1898, 1897, 1899, 3934, 1902, 1903, 1907, 1911, 1913,
+     1917, 1047, 1920, 1910, 1921, 3935, 1922, 1923, 1925, 1927,
+     1928, 1930, 1933, 1934, 1942, 1944, 1945, 1946, 1947, 3936,
+     1949, 1950, 1951, 1954, 1959, 1039, 1955, 1958, 1961, 1965,
+     1969, 1967, 1972, 1966, 1970,  862, 1973, 1974, 3937, 1975,
+
+     1976, 1045,  990, 1993, 3938, 3939, 1994, 1977, 1997, 1995,
+     1998, 1999, 2000, 2001, 2003, 2006, 3940, 2008, 2012, 2013,
+     2015, 2019, 2017, 3941, 2018, 2021, 2023, 2024, 2025, 2022,
+     2030, 2028, 2029, 2039, 2031, 2050, 2042, 2032, 2051, 2052,
+     2055, 3942, 2059, 3943, 2060, 2062, 3944, 2066, 2061, 2064,
+     2065, 2067, 2070, 2069, 1057, 2073, 2071, 3945, 2077, 2075,
+      723, 3946, 2082, 2078, 2084, 2085, 2086, 2087, 2090, 2092,
+     2096, 2097, 2095, 2105, 2098, 2106, 3947, 2108, 2112, 2109,
+     3948, 2116, 2119, 2118, 2120, 3949, 2122, 2125, 2131, 2132,
+     2135, 2136, 2137, 2140, 2144, 2141, 2146, 2147, 2145, 2153,
+
+     3950, 2154, 3951, 3952, 2156, 2155, 2157, 2158, 2159, 2160,
+     2163, 2165, 2173, 2176, 2170, 2177, 2178, 2169, 2183, 2179,
+     2180, 2182, 3953, 3954, 2186, 2189, 2190, 2193, 2202, 2206,
+     2207, 2208, 2209, 2210, 2213,  885, 2212, 2215, 2218, 2220,
+     2221, 2225, 2224, 2229, 2228, 2230, 2234, 2236, 2239, 2235,
+     2248, 2244, 2240, 2249, 3955, 3956, 2250, 2241, 3957, 3958,
+     2251, 2253, 2254, 2245, 2266, 2270, 2271, 2272, 2273, 2274,
+     2276, 2275, 2278, 2279, 2282, 3959, 2280, 2281, 2283, 2284,
+     3960, 2287, 2286, 2289, 3961, 2290, 2291, 2292, 3962, 2293,
+     2301, 2296, 2309, 2310, 2316, 2318, 2320, 2323, 2325, 2326,
+
+     3963, 2328, 2327, 2330, 2333, 2334, 2332, 2335, 2336, 2337,
+     2331, 2347, 2338, 3964, 3965, 2352, 3966, 2353, 3967, 2339,
+     2354, 2340,  904, 2369, 2341, 2371, 2374, 2376, 3968, 2380,
+     2381, 3969, 2384, 2385, 2386, 2387, 2382, 2388,  891, 2390,
+      899, 2389, 2392, 2393, 2391, 2396, 2397, 3970, 2398, 2403,
+     2404, 2406, 2409, 2417, 2410, 2415, 3971, 2420, 2421, 3972,
+     2423, 2422, 2426, 2431, 2432, 2433, 2434, 2435, 2436, 2440,
+     2443, 2441, 2448, 2445, 2446, 2450, 2453, 3973, 2454, 2455,
+     2460, 2461, 2464, 2462, 2465, 3974, 2472, 2466, 2474, 1065,
+     3975, 2476, 3976, 2481, 3977, 2483, 2477, 2484, 2485, 3978,
+
+     2486, 2489, 2491, 2492, 2496, 2502, 2498, 2503, 2505, 2509,
+     2504, 2511, 2516, 2513, 2517, 2520, 2514, 2522, 2523, 2526,
+     2527, 2528, 2533, 2538, 2534, 2539, 2544, 2540, 2543, 2545,
+     2547, 2548, 2549, 2553, 2562, 2563, 2564, 2565, 2566, 2574,
+      907,  410,  451, 2568, 2570, 2575, 2577, 2578, 2583, 3979,
+     2582, 3980, 2585, 2587, 2589, 2590, 2593, 2591, 2594, 2595,
+     2596, 2598, 2602, 2597, 2609, 2599, 3981, 2601, 2613, 2610,
+     2605, 2614, 2621, 2624, 2625, 2629, 3982, 2631, 1062, 2633,
+     2634, 2639, 2635, 2641, 2643, 2644, 2646, 3983, 2650, 2645,
+     2647, 2648, 3984, 2649, 2652, 2651, 2660, 2656,  896, 2659,
+
+     2661, 2666, 3985, 2667, 2670, 2672, 2679, 2681, 2680, 2683,
+     2686, 2687, 2689, 2688, 2691, 3986, 2693, 3987, 3988, 3989,
+     2696, 3990, 2698, 2699, 2701, 2702, 2704, 2709, 2710, 2711,
+     2715, 2716, 2717, 2720, 2721, 2723, 1056, 2724, 2729, 2732,
+     2734, 2736, 2712, 2738, 2739, 2740, 2742, 2747, 2751, 3991,
+     2753, 2754, 2755, 2759,  492,  533,  574,  615, 2756, 2761,
+     2762, 2766, 2763, 3992, 2764, 2768, 3993, 2773, 2770, 2774,
+     2777, 2776, 2778, 2779, 2783, 2789, 2790, 2786, 2793, 2792,
+     3994, 2791, 3995, 2796, 2801, 3996, 3997, 2809, 2810, 2811,
+     2816, 2817, 2818, 2820, 2821, 2819, 2824, 2828, 2825, 2826,
+
+     2830, 2831, 2833, 3998, 2839, 2836, 2840, 2843, 2841, 2845,
+     2844, 3999, 2851, 2852, 2856, 4000, 2854, 2857, 2859, 2860,
+     2864, 2867, 2868, 2869, 2875, 2876, 2878, 2870, 2879, 2880,
+     4001, 4002, 4003, 4004, 2884, 2881, 2887, 2891, 2892, 2893,
+     2898, 2900, 2886, 2890, 2895, 2915, 2919, 2920, 2921, 2922,
+     2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932,
+     2933, 2937, 2938, 2936, 2939, 2940, 2942, 4005, 2943, 2946,
+     2944, 2945, 4006, 2947, 2959, 2948, 2956, 2967, 2970, 2950,
+     2979, 2980, 4007, 4008, 2981, 1051, 2987, 2986, 2988, 2989,
+     2990, 2991, 2992, 2993, 2995, 2996, 2998, 2999, 2997, 3000,
+
+     3001, 4009, 4010, 3002, 3007, 3009, 4011, 3003, 3011, 3008,
+     3022, 3025, 3013, 1081, 3010, 3014, 4012, 3036, 4013, 4014,
+     4015, 3015, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051,
+     3052, 3053, 3059, 3054, 1085, 3064, 3063, 3066, 3056, 3057,
+     3061, 3073, 3068, 3074, 3065, 4016, 3067, 3071, 3069, 3072,
+     3076, 3077, 3093, 4017, 3095, 3096, 3103, 3104, 3106, 3108,
+     4018, 3109, 3110, 3111, 3112, 3113, 4019, 3114, 3116, 3119,
+     4020, 3120, 3122, 3123, 3125, 3126, 3127, 3129, 3130, 3132,
+     3131, 4021, 3134, 3133, 3139, 3137, 4022, 3138, 3144, 3158,
+     3160, 3161, 3163, 3135, 4023, 3168, 3169, 3171, 3172, 3174,
+
+     3177, 3181, 3178, 4024, 3179, 3182, 3183, 3184, 3186, 3188,
+     3189, 3190, 3192, 3193, 3196, 3197, 3199, 3198, 3201, 3206,
+     3204, 3214, 3215, 3216, 4025, 3233, 3235, 3208, 4026, 3209,
+     4027, 3213, 3211, 3236, 3220, 3237, 1086, 3242, 3243, 3246,
+     3245, 3248, 4028, 3250, 3252, 3251, 3255, 3254, 4029, 3256,
+     3257, 4030, 3259, 3258, 3260, 3264, 3266, 3265, 1088, 3267,
+     3271, 3270, 3272, 4031, 3273, 3284, 4032, 3285, 4033, 3286,
+     3287, 3294, 3295, 3297, 3299, 4034, 3300, 3301, 3302, 3306,
+     3308, 3309, 3311, 3313, 4035, 3314, 3316, 3318, 3322, 3319,
+     3320, 3323, 3321, 3331, 3324, 3328, 4036, 3335, 3332, 3333,
+
+     3341, 3344, 4037, 3352, 3353, 3354, 3355, 3356, 3357, 3359,
+     3361,  869, 4038, 3362, 1090, 3363, 3365, 3367, 3368, 3371,
+     1095, 3373, 3372, 3374, 3375, 3376, 3378, 3388, 4039, 3389,
+     3385, 3383, 3391, 3396, 3398, 1093, 3409, 3410, 3411, 3412,
+     3413, 3414, 3415, 3417, 3418, 3419, 3420, 4040, 3421, 3422,
+     3424, 3426, 3427, 3430, 3433, 3432, 3435, 3434, 3437, 3438,
+     3440, 4041, 4042, 3443, 1105, 3453, 3448, 3459, 3456, 3460,
+     3461, 3465, 4043, 3464, 3470, 3467, 3462, 4044, 3473, 3468,
+     3472, 3476, 3479, 3483, 3487, 3492, 4045, 3493, 3494, 3496,
+     3498, 4046, 3500, 3502, 3503, 4047, 3506, 3505, 3510, 3507,
+
+     3508, 3511, 3512, 3513, 3515, 3516, 3518, 3519, 3522, 3514,
+     4048, 3528, 3517, 3524, 3534, 3525, 3545, 3537, 3550, 3552,
+     3556, 3557, 3559, 4049, 4050, 3560, 3561, 3562, 3564, 3566,
+     3567, 3569, 3568, 3565, 3570, 3572, 4051, 3578, 3573, 3575,
+     3576, 3579, 3585, 3583, 3586, 3587, 3589, 4052, 4053, 3591,
+     3599, 3603, 3604, 3607, 4054, 4055, 3610, 4056, 3612, 3614,
+     3615, 3617, 3618, 3619, 3622, 3626, 3624, 3625, 3628, 3630,
+     3633, 3627, 3634, 3638, 3636, 3646, 3635, 3639, 3637, 4057,
+     3654, 3640, 3647, 3649, 3661, 3663, 3668, 3669, 4058, 3672,
+     3676, 3678, 3680, 3681, 3682, 3683, 4059, 3684, 3688, 3685,
+
+     3691, 3694, 3693, 3692, 4060, 4061, 4062, 4063, 4064, 4065,
+     3695, 4066, 3689, 4067, 3697, 3701, 3698, 3700, 3705, 3709,
+     3712, 3720, 3721, 3722, 4068, 3723, 3724, 3725, 3726, 4069,
+     3727, 4070, 3728, 3729, 3733, 4071, 3730, 4072, 3732, 4073,
+     3735, 3736, 3741, 3750, 3744, 3746, 3749, 1098, 3738, 3757,
+     4074, 3751, 3754, 3755, 3761, 3767, 3770, 3773, 3775, 1096,
+     4075, 3776, 3778, 4076, 3780, 3781, 4077, 3782, 3783, 4078,
+     3788, 4079, 3785, 4080, 3789, 3797, 3798, 3799, 3796, 3803,
+     3794, 3800, 3802, 4081, 3809, 3804, 3806, 4082, 3813, 3821,
+     3823, 3824, 4083, 4084, 4085, 3827, 3828, 4086, 3829, 4087,
+
+     4088, 3830, 3831, 3832, 3833, 3835, 4089, 3839, 3836, 3838,
+     3842, 3840, 4090, 3844, 4091, 3847, 4092, 3849, 3850, 4093,
+     3852, 3859, 4094, 4095, 3845, 3854, 3869, 3867, 4096, 3871,
+     3873, 3870, 4097, 3875, 3878, 4098, 4099, 3879, 4100, 3882,
+     3883, 4101, 3884, 3892, 3886, 3888, 3889, 3891, 3893, 3895,
+     4102, 4103, 3894, 4104,  164
     } ;
 
-static const flex_int16_t yy_def[1628] =
+static const flex_int16_t yy_def[1756] =
     {   0,
-     1622,    1, 1622, 1622, 1622, 1623, 1624, 1625, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1623, 1624, 1622, 1625, 1622,
-     1622, 1622, 1625, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1626, 1627, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1626, 1626, 1627, 1627, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622,    0, 1622, 1622, 1622, 1622, 1622
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755
     } ;
 
-static const flex_int16_t yy_nxt[3189] =
-    {   0,
+static const flex_int16_t yy_nxt[4145] =
+    {   3,
         4,    5,    6,    7,    8,    4,    9,   10,   11,   11,
        11,    4,    4,   12,   13,   14,   15,   16,   17,   18,
        19,   20,   21,   22,   23,   24,   25,   26,   27,    4,
        28,   29,   30,   31,    4,   32,   33,   34,    4,    4,
-       12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
-       22,   23,   24,   25,   26,   27,    4,   28,   29,   30,
-       31,    4,   32,   33,   34,    4,   38,   38,   40,   42,
-       52,   43,   44,   44,   44,   73,   53,   67,   68,   81,
-      100,   70,   74,   41,   38,   38,   54,  994,   69,   71,
-      130,  131,   72,  992,   79,   39,   80,   52,  132,   44,
-
-       44,   44,   73,   53,   67,   68,   81,  100,   70,   74,
-       41,   45,   46,   54,   47,   69,   71,  130,  131,   72,
-       48,   79,   49,   80,  133,  132,  134,  135,   75,   50,
-       36,   51,  321,  322, 1601,  890,   76,  891,   45,   46,
-     1555,   47,   77, 1535,  136,  892, 1459,   48,   78,   49,
-       82,  133, 1453,  134,  135,   75,   50,   83,   51,   55,
-       84,   56,   85,   76,   86,  137,   57,   58,   87,   77,
-       59,  136,  106,   60,   88,   78,  107,   82,  138,  124,
-      125,  139, 1445,   61,   83,  126,   55,   84,   56,   85,
-      108,   86,  137,   57,   58,   87,  140,   59, 1438,  106,
-
-       60,   88,  141,  107,  142,  138,  124,  125,  139,  127,
-       61,   62,  126,  128,  145,   63,  129,  108,  143,   64,
-      144,  146,   65,  140,  147,   66, 1414, 1415, 1432,  141,
-     1412,  142,  152,  153, 1407,  154,  127,  155,   62,  163,
-      128,  145,   63,  129,  161,  143,   64,  144,  146,   65,
-      164,  147,   66,   89,   90,  148,  165,   91,  162,  152,
-      153,   92,  154,  149,  155,  172,  163,   93, 1381,  150,
-     1373,  161, 1369,  174,  173,  151, 1368,  164,  179, 1360,
-       89,   90,  148,  165,   91,  162,  180,  166,   92,  167,
-      149,  168,  172,  169,   93,   94,  150,   95,  175,   96,
-
-      174,  173,  151,   97,  170,  179,  177,  181,  171,   98,
-      184,  185,  176,  180,  166,   99,  167,  178,  168,  182,
-      169,  183,   94,  186,   95,  175,   96,  187,  188,  189,
-       97,  170,  190,  177,  181,  171,   98,  184,  185,  176,
-      191,  192,   99,  101,  178,  193,  182,  196,  183,  194,
-      186,  102,  197,  195,  187,  188,  189,  103,  198,  190,
-      104,  105, 1355,  199,  200, 1336, 1323,  191,  192, 1321,
-      101,  204,  193, 1317,  196, 1307,  194, 1296,  102,  197,
-      195,  205,  206,  208,  103,  198,  201,  104,  105,  109,
-      199,  200,  110,  111,  209,  112,  202,  207,  204,  113,
-
-      114,  115,  203,  116,  117, 1289,  211,  210,  205,  206,
-      208,  217, 1288,  201,  218,  219,  109,  212,  214,  110,
-      111,  209,  112,  202,  207,  213,  113,  114,  115,  203,
-      116,  117,  118,  211,  215,  216,  220,  221,  217,  119,
-      120,  218,  219,  121,  212,  214,  229, 1287,  238,  239,
-      122,  242,  213,  243,  230, 1286,  123, 1285, 1284,  118,
-      234,  215,  216,  220,  221,  231,  119,  120,  236,  232,
-      121,  233,  240,  229,  235,  238,  239,  122,  242,  244,
-      243,  230,  241,  123,  156,  157,  245,  234,  246,  158,
-      237,  247,  231,  248,  250,  236,  232,  159,  233,  240,
-
-      251,  235,  160, 1278,  257, 1265,  244,  262,  258,  241,
-     1261,  156,  157,  245,  259,  246,  158,  237,  247,  260,
-      248,  250,  261,  263,  159,  264,  266,  251,  267,  160,
-      222,  257,  223,  224,  262,  258,  268,  225,  269,  226,
-      270,  259,  227,  265,  271,  273,  260,  274,  228,  261,
-      263,  272,  264,  266,  275,  267, 1259,  222,  276,  223,
-      224,  278,  279,  268,  225,  269,  226,  270,  280,  227,
-      265,  271,  273,  281,  274,  228,  252,  282,  272,  283,
-      284,  275,  285,  253,  254,  276,  286,  287,  278,  279,
-      255,  288,  289,  290,  291,  280,  256,  293,  292,  294,
-
-      281,  295,  296,  252,  282,  297,  283,  284,  298,  285,
-      253,  254,  299,  286,  287,  300,  301,  255,  288,  289,
-      290,  291,  302,  256,  293,  292,  294,  303,  295,  296,
-      304,  305,  297,  306,  307,  298,  310,  308,  311,  299,
-      312,  313,  300,  301,  314,  315,  316,  317,  318,  302,
-      309,  320,  323,  324,  303,  327,  325,  304,  305,  326,
-      306,  307,  328,  310,  308,  311,  329,  312,  313,  330,
-      331,  314,  315,  316,  317,  318,  332,  309,  320,  323,
-      324,  334,  327,  325,  335,  336,  326,  338,  339,  328,
-      340,  337,  341,  329,  342,  343,  330,  331,  344,  345,
-
-      346,  347,  349,  332,  350,  351,  348,  352,  334,  353,
-      354,  335,  336,  355,  338,  339,  356,  340,  357,  341,
-      358,  342,  343,  359,  360,  344,  345,  346,  347,  349,
-      361,  350,  351,  348,  352,  362,  353,  354,  363,  364,
-      355,  368,  365,  356,  366,  357,  369,  358,  370,  371,
-      359,  360,  372,  373,  374,  375,  376,  361,  377,  378,
-      379,  380,  362,  381,  383,  363,  364,  385,  368,  365,
-      386,  366,  387,  369,  384,  370,  371,  388,  389,  372,
-      373,  374,  375,  376,  390,  377,  378,  379,  380,  391,
-      381,  383,  394,  392,  385,  395,  396,  386,  397,  387,
-
-      398,  384,  393,  400,  388,  389,  401,  402,  403,  404,
-      405,  390,  407,  409,  399,  410,  391,  411,  412,  394,
-      392,  413,  395,  396,  415,  397,  416,  398,  417,  418,
-      400,  419,  420,  401,  402,  403,  404,  405,  421,  407,
-      409,  399,  410,  422,  411,  412,  423,  424,  413,  425,
-      426,  415,  427,  416,  429,  417,  418,  430,  419,  420,
-      431,  432,  433,  434,  435,  421,  436,  437,  438,  439,
-      422,  440,  441,  423,  424,  442,  425,  426,  443,  427,
-      445,  429,  449, 1249,  430,  450,  446,  431,  432,  433,
-      434,  435,  447,  436,  437,  438,  439,  453,  440,  441,
-
-      451,  452,  442,  455,  456,  443,  457,  445,  459,  449,
-      448,  460,  450,  446, 1247,  468,  469,  470,  471,  447,
-     1232,  473,  474,  472,  453, 1215,  475,  451,  452,  477,
-      455,  456,  478,  457,  479,  459,  480,  481,  460,  461,
-      462,  463,  468,  469,  470,  471,  486,  464,  473,  474,
-      472,  465,  466,  475,  482,  488,  477,  489,  467,  478,
-      490,  479,  491,  480,  481,  492,  461,  462,  463,  493,
-      494,  495,  483,  486,  464,  496,  498,  499,  465,  466,
-      484,  482,  488,  500,  489,  467,  502,  490,  505,  491,
-      503,  506,  492,  501,  507,  504,  493,  494,  495,  483,
-
-      508,  509,  496,  498,  499,  510,  511,  512,  513,  514,
-      500,  519, 1198,  502,  520,  505,  521,  503,  506,  522,
-      523,  507,  504,  524,  525,  526,  527,  508,  509,  515,
-      516,  528,  510,  511,  512,  513,  514,  530,  519,  517,
-      531,  520,  532,  521,  533,  518,  522,  523,  534,  535,
-      524,  525,  526,  527,  536,  537,  515,  516,  528,  538,
-      539,  542,  543,  540,  530,  545,  517,  531,  541,  532,
-      546,  533,  518,  547,  548,  534,  535,  549,  550,  544,
-      551,  536,  537,  552,  554,  555,  538,  539,  542,  543,
-      540,  556,  545,  558,  559,  541,  560,  546,  561,  562,
-
-      547,  548,  563,  564,  549,  550,  544,  551,  565,  566,
-      552,  554,  555,  567,  568,  569,  570,  571,  556,  572,
-      558,  559,  573,  560,  574,  561,  562,  576,  577,  563,
-      564,  578,  579,  580,  575,  565,  566,  581,  584,  585,
-      567,  568,  569,  570,  571,  586,  572,  587,  588,  573,
-      589,  574,  590,  592,  576,  577,  593,  595,  578,  579,
-      580,  575,  591,  597,  581,  584,  585,  598,  594,  599,
-      600,  596,  586,  601,  587,  588,  602,  589,  603,  590,
-      592,  604,  607,  593,  595,  605,  608,  609,  610,  591,
-      597,  611,  606,  612,  598,  594,  599,  600,  596,  616,
-
-      601,  614,  617,  602,  618,  603,  620,  615,  604,  607,
-      621,  622,  605,  608,  609,  610,  623,  626,  611,  606,
-      612,  619,  624,  627,  628,  625,  616,  629,  614,  617,
-      630,  618,  631,  620,  615,  632,  633,  621,  622,  634,
-      635,  636,  638,  623,  626,  640,  641,  642,  619,  624,
-      627,  628,  625,  646,  629,  647,  648,  630,  649,  631,
-      643,  650,  632,  633,  644,  651,  634,  635,  636,  638,
-      645,  652,  640,  641,  642,  653,  654,  655,  656,  657,
-      646,  658,  647,  648,  659,  649,  660,  643,  650,  661,
-      663,  644,  651,  665,  666,  667,  668,  645,  652,  669,
-
-      670,  671,  653,  654,  655,  656,  657,  673,  658,  674,
-      675,  659,  676,  660,  677,  678,  661,  663,  679,  672,
-      665,  666,  667,  668,  680,  681,  669,  670,  671,  682,
-      683,  684,  686,  688,  673,  689,  674,  675,  691,  676,
-      692,  677,  678,  693,  694,  679,  695,  697,  698,  699,
-      700,  680,  681,  701,  702,  704,  682,  683,  684,  686,
-      688,  705,  689,  710,  706,  691,  711,  692,  708,  709,
-      693,  694,  707,  695,  697,  698,  699,  700,  712,  713,
-      701,  702,  704,  714,  715,  716,  717,  718,  705,  719,
-      710,  706,  720,  711,  721,  708,  709,  722,  723,  707,
-
-      724,  725,  726,  727,  728,  712,  713,  729,  730,  731,
-      714,  715,  716,  717,  718,  732,  719,  734,  735,  720,
-      736,  721,  737,  738,  722,  723,  739,  724,  725,  726,
-      727,  728,  740,  741,  729,  730,  731,  742,  744,  745,
-      746,  747,  732,  748,  734,  735,  749,  736,  750,  737,
-      738,  751,  754,  739,  752,  753,  755,  756,  757,  740,
-      741,  765,  766, 1184,  742,  744,  745,  746,  747, 1176,
-      748,  767,  768,  749,  769,  750,  771,  772,  751,  754,
-      774,  752,  753,  755,  756,  757,  758,  775,  765,  766,
-      759,  776,  760,  777,  761,  778,  762,  763,  767,  768,
-
-      779,  769,  764,  771,  772,  780,  781,  774,  783,  784,
-      785,  786,  787,  758,  775,  788,  789,  759,  776,  760,
-      777,  761,  778,  762,  763,  790,  791,  779,  792,  764,
-      793,  794,  780,  781,  795,  783,  784,  785,  786,  787,
-      796,  797,  788,  789,  799,  801,  803,  804,  805,  806,
-      807,  808,  790,  791,  809,  792,  811,  793,  794,  812,
-      813,  795,  814,  815,  816,  817,  818,  796,  797, 1172,
-      822,  799,  801,  803,  804,  805,  806,  807,  808,  823,
-      824,  809,  825,  811,  826,  827,  812,  813,  828,  814,
-      815,  816,  817,  818,  819,  820,  821,  822,  829,  830,
-
-      831,  832,  833,  834,  835,  836,  823,  824,  837,  825,
-      838,  826,  827,  839,  840,  828,  841,  842,  843,  845,
-      847,  819,  820,  821,  848,  829,  830,  831,  832,  833,
-      834,  835,  836,  849,  850,  837,  851,  838,  852,  853,
-      839,  840,  854,  841,  842,  843,  845,  847,  855,  856,
-      857,  848,  858,  859,  860,  861,  862,  863,  864,  865,
-      849,  850,  866,  851,  867,  852,  853,  868,  876,  854,
-      877,  878,  879,  880,  881,  855,  856,  857,  882,  858,
-      859,  860,  861,  862,  863,  864,  865,  883,  885,  866,
-      886,  867,  888,  889,  868,  876,  893,  877,  878,  879,
-
-      880,  881,  894,  895,  896,  882,  897,  898,  899,  900,
-      901,  902,  907,  911,  883,  885,  912,  886,  904,  888,
-      889,  913,  905,  893,  914,  906,  915,  908,  916,  894,
-      895,  896,  909,  897,  898,  899,  900,  901,  902,  907,
-      911,  917,  918,  912,  910,  904,  919,  920,  913,  905,
-      921,  914,  906,  915,  908,  916,  922,  923,  924,  909,
-      925,  926,  927,  928,  929,  930,  931,  932,  917,  918,
-      933,  910,  934,  919,  920,  935,  936,  921,  938,  939,
-      940,  942,  943,  922,  923,  924,  944,  925,  926,  927,
-      928,  929,  930,  931,  932,  945,  946,  933,  947,  934,
-
-      948,  949,  935,  936,  951,  938,  939,  940,  942,  943,
-      952,  950,  953,  944,  954,  955,  956,  957,  958,  959,
-      960,  961,  945,  946,  962,  947,  963,  948,  949,  964,
-      965,  951,  966,  967,  968,  969,  970,  952,  950,  953,
-      971,  954,  955,  956,  957,  958,  959,  960,  961,  972,
-      973,  962,  974,  963,  975,  976,  964,  965,  977,  966,
-      967,  968,  969,  970,  979,  980,  981,  971,  982,  983,
-      984,  985,  986,  987,  988,  989,  972,  973,  990,  974,
-      991,  975,  976,  996,  890,  977,  891,  997, 1000, 1002,
-     1003,  979,  980,  981,  892,  982,  983,  984,  985,  986,
-
-      987,  988,  989, 1004, 1005,  990, 1006,  991, 1007, 1008,
-      996, 1009, 1010, 1011,  997, 1000, 1002, 1003, 1013, 1014,
-     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1026, 1023, 1027,
-     1004, 1005, 1024, 1006, 1028, 1007, 1008, 1029, 1009, 1010,
-     1011, 1030, 1032, 1033, 1034, 1013, 1014, 1015, 1016, 1017,
-     1018, 1019, 1020, 1021, 1026, 1023, 1027, 1035, 1036, 1024,
-     1037, 1028, 1038, 1039, 1029, 1042, 1043, 1045, 1030, 1032,
-     1033, 1034, 1040, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
-     1041, 1054, 1056, 1057, 1035, 1036, 1058, 1037, 1059, 1038,
-     1039, 1060, 1042, 1043, 1045, 1061, 1062, 1063, 1064, 1040,
-
-     1046, 1047, 1048, 1049, 1050, 1051, 1052, 1041, 1054, 1056,
-     1057, 1065, 1066, 1058, 1067, 1059, 1068, 1069, 1060, 1070,
-     1071, 1072, 1061, 1062, 1063, 1064, 1075, 1076, 1073, 1077,
-     1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1065, 1066,
-     1086, 1067, 1087, 1068, 1069, 1074, 1070, 1071, 1072, 1088,
-     1089, 1090, 1091, 1075, 1076, 1073, 1077, 1078, 1079, 1080,
-     1081, 1082, 1083, 1084, 1085, 1092, 1093, 1086, 1094, 1087,
-     1095, 1096, 1074, 1097, 1098, 1099, 1088, 1089, 1090, 1091,
-     1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
-     1110, 1111, 1092, 1093, 1112, 1094, 1113, 1095, 1096, 1114,
-
-     1097, 1098, 1099, 1115, 1117, 1118, 1119, 1100, 1101, 1102,
-     1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1120,
-     1121, 1112, 1122, 1113, 1123, 1124, 1114, 1125, 1126, 1127,
-     1115, 1117, 1118, 1119, 1128, 1129, 1130, 1131, 1132, 1133,
-     1134, 1136, 1137, 1138, 1139, 1140, 1120, 1121, 1141, 1122,
-     1142, 1123, 1124, 1143, 1125, 1126, 1127, 1144, 1145, 1146,
-     1147, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1136, 1137,
-     1138, 1139, 1140, 1148, 1149, 1141, 1150, 1142, 1151, 1152,
-     1143, 1153, 1154, 1155, 1144, 1145, 1146, 1147, 1157, 1158,
-     1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168,
-
-     1148, 1149, 1169, 1150, 1170, 1151, 1152, 1171, 1153, 1154,
-     1155, 1173, 1174, 1175, 1177, 1157, 1158, 1159, 1160, 1161,
-     1162, 1163, 1164, 1165, 1166, 1167, 1168, 1178, 1179, 1169,
-     1180, 1170, 1181, 1182, 1171, 1183, 1185, 1186, 1173, 1174,
-     1175, 1177, 1187, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
-     1188, 1196, 1197, 1199, 1178, 1179, 1200, 1180, 1201, 1181,
-     1182, 1202, 1183, 1185, 1186, 1203, 1204, 1205, 1206, 1187,
-     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1207, 1196, 1197,
-     1199, 1208, 1209, 1200, 1210, 1201, 1212, 1213, 1202, 1214,
-     1211, 1216, 1203, 1204, 1205, 1206, 1217, 1218, 1219, 1220,
-
-     1221, 1222, 1223, 1224, 1207, 1225, 1226, 1227, 1208, 1209,
-     1230, 1210, 1228, 1212, 1213, 1231, 1214, 1211, 1216, 1229,
-     1233, 1234, 1235, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1224, 1236, 1225, 1226, 1227, 1237, 1238, 1230, 1239, 1228,
-     1240, 1241, 1231, 1242, 1243, 1244, 1229, 1233, 1234, 1235,
-     1245, 1246, 1248, 1250, 1251, 1252, 1253, 1254, 1236, 1255,
-     1256, 1257, 1237, 1238, 1258, 1239, 1260, 1240, 1241, 1262,
-     1242, 1243, 1244, 1263, 1264, 1266, 1267, 1245, 1246, 1248,
-     1250, 1251, 1252, 1253, 1254, 1268, 1255, 1256, 1257, 1269,
-     1270, 1258, 1271, 1260, 1272, 1273, 1262, 1274, 1275, 1276,
-
-     1263, 1264, 1266, 1267, 1277, 1279, 1280, 1281, 1282, 1283,
-     1290, 1291, 1268, 1292, 1293, 1294, 1269, 1270, 1295, 1271,
-     1297, 1272, 1273, 1298, 1274, 1275, 1276, 1299, 1300, 1301,
-     1302, 1277, 1279, 1280, 1281, 1282, 1283, 1290, 1291, 1303,
-     1292, 1293, 1294, 1304, 1305, 1295, 1306, 1297, 1308, 1310,
-     1298, 1311, 1312, 1313, 1299, 1300, 1301, 1302, 1314, 1315,
-     1316, 1318, 1319, 1320, 1322, 1309, 1303, 1324, 1325, 1328,
-     1304, 1305, 1329, 1306, 1330, 1308, 1310, 1331, 1311, 1312,
-     1313, 1326, 1332, 1333, 1334, 1314, 1315, 1316, 1318, 1319,
-     1320, 1322, 1309, 1335, 1324, 1325, 1328, 1337, 1327, 1329,
-
-     1338, 1330, 1339, 1340, 1331, 1341, 1342, 1343, 1326, 1332,
-     1333, 1334, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
-     1335, 1352, 1353, 1354, 1337, 1327, 1356, 1338, 1357, 1339,
-     1340, 1358, 1341, 1342, 1343, 1359, 1361, 1362, 1363, 1344,
-     1345, 1346, 1347, 1348, 1349, 1350, 1351, 1364, 1352, 1353,
-     1354, 1365, 1366, 1356, 1367, 1357, 1370, 1371, 1358, 1372,
-     1374, 1375, 1359, 1361, 1362, 1363, 1378, 1379, 1376, 1380,
-     1382, 1383, 1384, 1385, 1364, 1386, 1387, 1388, 1365, 1366,
-     1389, 1367, 1390, 1370, 1371, 1377, 1372, 1374, 1375, 1393,
-     1394, 1395, 1396, 1378, 1379, 1376, 1380, 1382, 1383, 1384,
-
-     1385, 1391, 1386, 1387, 1388, 1397, 1392, 1389, 1398, 1390,
-     1399, 1400, 1377, 1401, 1402, 1403, 1393, 1394, 1395, 1396,
-     1404, 1405, 1406, 1408, 1409, 1410, 1411, 1413, 1391, 1416,
-     1417, 1418, 1397, 1392, 1419, 1398, 1420, 1399, 1400, 1421,
-     1401, 1402, 1403, 1422, 1423, 1424, 1425, 1404, 1405, 1406,
-     1408, 1409, 1410, 1411, 1413, 1426, 1416, 1417, 1418, 1427,
-     1428, 1419, 1429, 1420, 1430, 1431, 1421, 1433, 1434, 1435,
-     1422, 1423, 1424, 1425, 1436, 1437, 1439, 1440, 1441, 1442,
-     1443, 1444, 1426, 1446, 1447, 1448, 1427, 1428, 1449, 1429,
-     1450, 1430, 1431, 1451, 1433, 1434, 1435, 1452, 1454, 1455,
-
-     1456, 1436, 1437, 1439, 1440, 1441, 1442, 1443, 1444, 1457,
-     1446, 1447, 1448, 1458, 1460, 1449, 1461, 1450, 1462, 1463,
-     1451, 1464, 1465, 1466, 1452, 1454, 1455, 1456, 1467, 1468,
-     1469, 1470, 1471, 1472, 1473, 1474, 1457, 1475, 1476, 1477,
-     1458, 1460, 1478, 1461, 1479, 1462, 1463, 1480, 1464, 1465,
-     1466, 1481, 1482, 1483, 1484, 1467, 1468, 1469, 1470, 1471,
-     1472, 1473, 1474, 1485, 1475, 1476, 1477, 1486, 1487, 1478,
-     1488, 1479, 1489, 1490, 1480, 1491, 1492, 1493, 1481, 1482,
-     1483, 1484, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
-     1485, 1502, 1503, 1504, 1486, 1487, 1505, 1488, 1506, 1489,
-
-     1490, 1507, 1491, 1492, 1493, 1508, 1509, 1510, 1511, 1494,
-     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1512, 1502, 1503,
-     1504, 1513, 1514, 1505, 1515, 1506, 1516, 1517, 1507, 1518,
-     1519, 1520, 1508, 1509, 1510, 1511, 1521, 1522, 1523, 1524,
-     1525, 1526, 1527, 1528, 1512, 1529, 1530, 1531, 1513, 1514,
-     1532, 1515, 1533, 1516, 1517, 1534, 1518, 1519, 1520, 1536,
-     1537, 1538, 1539, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
-     1528, 1540, 1529, 1530, 1531, 1541, 1542, 1532, 1543, 1533,
-     1544, 1545, 1534, 1546, 1547, 1548, 1536, 1537, 1538, 1539,
-     1549, 1550, 1551, 1552, 1554, 1553, 1556, 1557, 1540, 1558,
-
-     1559, 1560, 1541, 1542, 1563, 1543, 1564, 1544, 1545, 1565,
-     1546, 1547, 1548, 1561, 1566, 1567, 1568, 1549, 1550, 1551,
-     1552, 1554, 1553, 1556, 1557, 1569, 1558, 1559, 1560, 1570,
-     1562, 1563, 1571, 1564, 1572, 1573, 1565, 1574, 1575, 1576,
-     1561, 1566, 1567, 1568, 1577, 1578, 1579, 1580, 1581, 1582,
-     1583, 1584, 1569, 1585, 1586, 1587, 1570, 1562, 1588, 1571,
-     1589, 1572, 1573, 1590, 1574, 1575, 1576, 1591, 1592, 1593,
-     1594, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1595,
-     1585, 1586, 1587, 1596, 1597, 1588, 1598, 1589, 1599, 1600,
-     1590, 1602, 1603, 1604, 1591, 1592, 1593, 1594, 1605, 1606,
-
-     1607, 1608, 1609, 1610, 1611, 1612, 1595, 1613, 1614, 1615,
-     1596, 1597, 1616, 1598, 1617, 1599, 1600, 1618, 1602, 1603,
-     1604, 1619, 1620, 1621, 1156, 1605, 1606, 1607, 1608, 1609,
-     1610, 1611, 1612, 1135, 1613, 1614, 1615, 1116,  995, 1616,
-      995, 1617,  993,  993, 1618, 1055, 1053, 1044, 1619, 1620,
-     1621,   37,   37, 1031, 1025, 1022, 1012, 1001,  999,  998,
-      995,  993,  978,  941,  937,  903,  887,  884,  875,  874,
-      873,  872,  871,  870,  869,  846,  844,  810,  802,  800,
-      798,  782,  773,  770,  743,  733,  703,  696,  690,  687,
-      685,  664,  662,  639,  637,  613,  583,  582,  557,  553,
-
-      529,  497,  487,  485,  476,  458,  454,  444,  428,  414,
-      408,  406,  382,  367,  333,  319,  277,  249,   35,   35,
-     1622,    3, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622
+        3,    4,    5,    6,    7,    8,    4,    9,   10,   11,
+       11,   11,    4,    4,   12,   13,   14,   15,   16,   17,
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+        4,   28,   29,   30,   31,    4,   32,   33,   34,    4,
+        4,    3,   37,   37,   38,   38,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,    3,   37,   37,   38,   38,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,    3, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755,    3,   36,   36, 1755,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,    3,   39,   39,    3,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,    3,   36,   36,    3,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,    3,   39,   39,
+        3,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,    3,   39,
+       39,    3,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,    3,
+     1055, 1055,    3, 1056, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+        3, 1057, 1057,    3, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1058, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057,    3, 1055, 1055,    3, 1056, 1055, 1055, 1055, 1055,
+
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055,    3, 1055, 1055,    3, 1056, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055,    3, 1057, 1057,    3, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1058, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057,    3, 1057, 1057,    3, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1058, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057,    3,    3,    3,    3,   35,
+        3,    3,    3,   35,    3,   44,   44,   44,    3,   44,
+       44,   44,  167,  110,  168,    3,  111,  112,    3,  113,
+      456,    3,   70,  114,  115,  116,  457,  117,  118,  225,
+       71,  226,  227,   72,   45,   46,  228,   47,  229,    3,
+
+        3,  230,    3,   48,  458,   49,   42,  231,   43,  232,
+      101,    3,   50,   55,   51,   56,    3,    3,  528,  529,
+       57,   58,    3,  530,   59,    3,  531,   60,  532,    3,
+      472,  473,  474,  134,  533,  534,    3,   61,  475,    3,
+      793,    3,  476,  477,  794,  169,  795,  170,  796,  478,
+      797,  798,    3,   95,    3,   96,  799,   97,  171,  343,
+        3,   98,  172,  173,   82,  344,   62,   99,  119,    3,
+       63,    3,  174,  100,   64,  120,  121,   65,   87,  122,
+       66,    3,   88,   90,   91,  102,  123,   92,   89,    3,
+        3,   93,  124,  103,    3,  157,  158,   94,    3,  104,
+
+      159,    3,  105,  106,  327,  328,    3,  256,  160,    3,
+      275,    3,   75,  161,  257,  258,    3,  276,   79,    3,
+       76,  259,    3,    3,   83,  149,   77,  260,   80,    3,
+       81,   84,   78,  150,   85,  234,   86,  107,   52,  151,
+        3,  108,    3,    3,   53,  152,  235,    3,   67,   68,
+      236,    3,  237,    3,   54,  109,  128,  494,   40,   69,
+      129,    3,    3,  130,  204,    3,  125,  126,    3,  217,
+        3,    3,  127,   41,  205,  495,    3,  732,  196, 1473,
+      206,    3,  197,  496,    3,  218,  219,  733,  515,  665,
+        3,  135,  516,  666,  734,    3,    3,  517,    3,  667,
+
+      865,  866,  867,    3,    3,  941,    3,  942,  941,  957,
+      942, 1109,  961,  958,   73,  943,  959,  962,  943,    3,
+     1110,   74,    3,    3,    3,    3,    3,    3, 1111,  963,
+      153,  154,    3,    3,    3,    3,    3,  176,    3,    3,
+      162,  178,    3,    3,  144,    3,  145,  208,    3,  238,
+      209,  177,  179,  201,  163,  240,  183,    3,  184,  198,
+      215,  212,  268,  239,  199,  210,  202,    3,  216,    3,
+      262,  244,  264,    3,  213,  265,  263,  241,    3,    3,
+      269,  245,    3,  296,    3,    3,    3,  297,    3,    3,
+      320,  321,    3,  289,    3,    3,  290,    3,  313,    3,
+
+        3,    3,    3,    3,  331,  741,  742,  332,  140,  147,
+      354,  314,  391,    3,  406,  355,  400,  372,    3,  373,
+      462,  463,  392,  593,  483,  401,  556,  513,  407,  484,
+      610,  557,    3,  594,  560,    3,    3,  514,    3,    3,
+      611,    3,    3,    3,    3,    3,    3,    3,    3,  615,
+        3,  561,    3,  721,  613,    3,    3,  639,  626,  166,
+      672,    3,  739,  616,    3,  627,  614,  635,  698,  722,
+      740, 1143,  645,  636,  640,  646,  673,  787,  788, 1090,
+        3, 1007, 1271, 1091,    3,    3,  699,    3, 1144,    3,
+     1272, 1008,    3,    3,    3,    3, 1297,    3,    3,    3,
+
+        3, 1406, 1298, 1426,    3,    3, 1475,    3, 1476, 1315,
+     1482, 1689, 1497,    3, 1524, 1525, 1316, 1498, 1407,    3,
+     1427,    3, 1677,  131, 1678,  132,  133, 1483, 1690,    3,
+      137,    3,    3,  136,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,  138,    3,  141,    3,
+        3,  148,  139,  155,    3,    3,    3,    3,  164,  182,
+      146,  186,  142,    3,  143,  175,    3,  180,    3,  185,
+        3,  165,  189,  156,  191,    3,  181,  192,    3,  187,
+      188,    3,  194,    3,  193,  190,    3,    3,    3,  195,
+        3,  211,    3,  203,    3,    3,  207,    3,    3,    3,
+
+        3,  200,    3,    3,  214,  222,  223,    3,  220,  233,
+        3,  243,  242,  224,  221,    3,  248,    3,    3,    3,
+        3,    3,  247,    3,    3,    3,  251,    3,  246,  249,
+      250,    3,    3,    3,    3,  252,  261,  270,  271,  254,
+        3,  267,    3,  255,    3,  266,  272,  253,  278,  274,
+      279,    3,    3,    3,    3,    3,    3,    3,  280,    3,
+        3,  273,    3,  277,    3,    3,    3,  282,    3,  283,
+      286,    3,    3,    3,  281,  284,    3,    3,  294,  300,
+      299,  292,  291,  285,    3,  287,  288,  304,    3,  293,
+      303,    3,    3,  301,  295,  306,    3,    3,    3,    3,
+
+      298,    3,  307,  302,  305,    3,  308,    3,  311,  309,
+        3,    3,    3,  310,  312,    3,  318,  317,    3,    3,
+        3,    3,    3,  319,    3,  315,  316,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,  326,  334,  325,
+      322,  323,    3,  335,    3,  329,  341,  333,    3,  349,
+        3,  324,  330,  338,  336,  337,    3,    3,    3,  347,
+        3,  350,  342,  340,    3,    3,  348,  345,  339,  346,
+      351,    3,  356,    3,  352,    3,    3,    3,  358,    3,
+        3,    3,  359,    3,  353,    3,    3,    3,    3,  357,
+        3,    3,  361,  362,    3,    3,  366,  360,    3,    3,
+
+      370,    3,    3,    3,    3,  364,    3,  369,  363,    3,
+        3,  365,  367,  381,    3,  371,  368,    3,  376,  377,
+      374,    3,    3,  375,  382,  379,  378,  389,  385,  380,
+      387,  384,    3,    3,  383,    3,    3,  386,    3,  393,
+        3,    3,  388,    3,    3,    3,    3,  395,    3,  394,
+        3,    3,    3,  398,    3,    3,    3,  390,  396,    3,
+      397,  399,    3,    3,    3,  402,  404,  405,  403,    3,
+        3,    3,  408,  410,    3,  416,    3,  409,  412,  411,
+      419,  413,  420,    3,    3,    3,    3,    3,    3,    3,
+        3,  421,    3,    3,  414,  415,  417,  422,    3,  428,
+
+        3,  418,  426,  425,    3,  430,  424,  431,  432,    3,
+        3,  423,    3,    3,    3,  436,  427,  429,    3,    3,
+        3,    3,  437,  434,  433,    3,    3,    3,    3,  435,
+        3,  442,    3,  438,  439,  440,    3,  446,    3,    3,
+        3,    3,    3,  443,  450,    3,    3,    3,    3,  444,
+      441,  445,    3,  447,  449,    3,  455,    3,  448,    3,
+      451,  452,  466,  464,  453,    3,  460,    3,    3,    3,
+      467,  459,  454,    3,  461,  470,    3,  471,    3,  468,
+        3,  481,  465,  479,  480,    3,  469,    3,    3,    3,
+        3,    3,    3,  485,  486,    3,    3,    3,    3,    3,
+
+      482,    3,    3,  487,    3,    3,    3,  493,  489,    3,
+      492,    3,  490,  500,  501,    3,  491,    3,  488,  508,
+        3,    3,    3,    3,  502,    3,  503,  498,    3,  504,
+      497,    3,  499,  505,  507,  510,  506,    3,  511,  518,
+        3,  521,  512,    3,  519,  520,  509,  522,    3,    3,
+        3,    3,    3,    3,    3,  523,  526,  535,  525,    3,
+        3,    3,  536,  524,    3,  527,    3,  537,    3,    3,
+        3,    3,  538,  539,    3,    3,  542,    3,  540,    3,
+        3,    3,    3,  549,  543,  541,    3,    3,  544,  550,
+        3,    3,    3,    3,    3,  546,    3,  554,  547,  555,
+
+      548,  545,  551,    3,    3,  564,  565,  563,  552,  570,
+      553,  562,  558,    3,  559,    3,    3,    3,  573,  568,
+        3,  567,  569,  566,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,  571,    3,    3,    3,  572,  576,
+      574,  581,  577,  579,    3,    3,  583,  587,    3,  578,
+      585,    3,    3,    3,    3,  582,  575,  584,  580,  589,
+        3,    3,  592,  590,  588,  591,  595,    3,    3,    3,
+        3,  586,  598,  597,    3,    3,  600,    3,    3,    3,
+        3,    3,    3,    3,    3,  599,    3,    3,  596,    3,
+        3,  607,  608,    3,    3,  604,    3,  605,  609,  601,
+
+      619,  620,    3,  621,    3,  623,  606,  602,  603,  612,
+      622,  617,    3,  625,    3,  631,    3,    3,  618,    3,
+      630,  624,    3,    3,    3,  628,    3,  629,    3,    3,
+        3,    3,    3,    3,    3,  632,    3,    3,    3,    3,
+        3,    3,    3,    3,  641,  633,  648,  638,  650,  643,
+      642,  644,  637,  647,  634,  653,  656,  649,  651,  658,
+        3,    3,  652,  654,  655,  657,    3,    3,    3,    3,
+        3,    3,    3,    3,  660,  664,  659,    3,    3,  661,
+      675,    3,  669,    3,    3,    3,    3,  670,  668,  671,
+        3,    3,  674,    3,  662,    3,    3,    3,    3,  663,
+
+      680,    3,    3,  676,  678,  677,    3,  686,  679,    3,
+        3,  682,    3,  683,  689,  684,    3,  685,  681,    3,
+        3,    3,    3,  692,    3,  687,    3,    3,  694,    3,
+      691,  693,    3,    3,  701,  688,  690,  695,  697,  704,
+      696,    3,  702,    3,    3,    3,    3,  700,    3,    3,
+        3,  710,  703,    3,    3,  707,  705,    3,    3,  706,
+        3,  709,  708,  717,    3,    3,    3,  711,    3,    3,
+      712,    3,    3,    3,    3,    3,    3,  725,  714,  723,
+      719,  716,  727,  730,  713,  720,  715,  735,  729,  724,
+      718,  728,    3,    3,    3,  737,    3,    3,    3,    3,
+
+        3,  731,    3,  745,  726,    3,  743,    3,  738,  744,
+      746,    3,    3,  736,    3,  750,    3,    3,    3,  747,
+        3,    3,    3,    3,    3,  749,  751,    3,    3,    3,
+        3,    3,  748,  752,  753,  760,  762,  761,    3,  757,
+      754,    3,  764,  755,  756,  758,  766,  763,  759,    3,
+        3,    3,  765,  769,    3,  772,  768,  770,    3,    3,
+        3,    3,  773,    3,    3,    3,    3,  767,    3,    3,
+        3,  776,    3,  775,    3,  771,    3,    3,  774,  779,
+      780,    3,  786,    3,    3,    3,    3,  778,  784,    3,
+      789,    3,  783,  781,    3,    3,    3,    3,  777,  792,
+
+      782,  785,  791,  790,    3,    3,  800,    3,    3,    3,
+      801,    3,  804,  803,  802,    3,  806,    3,    3,    3,
+      811,    3,  807,  810,    3,  814,  805,  808,  809,  815,
+        3,    3,  813,  817,    3,    3,    3,  812,  818,    3,
+        3,  816,  822,    3,    3,    3,    3,  820,  823,  819,
+      827,  826,    3,    3,    3,    3,    3,    3,    3,    3,
+      824,  821,    3,  832,    3,  828,  833,  825,    3,    3,
+      829,  831,    3,  837,  830,    3,    3,    3,    3,    3,
+      834,    3,    3,  838,  842,    3,  835,  836,    3,    3,
+      844,  840,    3,  845,  846,  853,  849,  839,  847,  841,
+
+      850,    3,  848,  854,  843,    3,    3,    3,    3,    3,
+      857,    3,    3,  852,    3,  855,  856,    3,  851,    3,
+        3,  861,  862,    3,    3,  868,  858,    3,    3,    3,
+      860,  863,  869,    3,    3,    3,  859,  864,    3,    3,
+        3,  871,  873,    3,    3,  872,  875,    3,    3,    3,
+        3,  878,    3,    3,  870,  874,  877,  879,  881,  876,
+      880,  884,  882,  883,  891,    3,  885,  886,  888,    3,
+        3,    3,    3,    3,    3,    3,  887,    3,    3,    3,
+        3,    3,    3,    3,  889,    3,    3,  893,    3,    3,
+        3,    3,    3,  890,  900,    3,  899,  906,  897,  894,
+
+        3,  903,  895,  898,  907,  892,  901,  902,    3,    3,
+      896,  904,  911,  905,  913,    3,  908,    3,  912,    3,
+      915,  910,    3,  909,    3,    3,    3,    3,  914,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,  923,    3,    3,    3,  925,  916,  917,
+      928,    3,    3,    3,  933,  918,  926,  919,  929,  920,
+      924,  927,  921,  934,  922,  932,  930,  931,    3,  936,
+        3,  945,  937,    3,  939,    3,  940,  935,  938,    3,
+        3,    3,  944,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,  948,  946,    3,    3,    3,  950,  947,
+
+      951,  952,    3,    3,  954,    3,  949,  967,    3,    3,
+      953,  960,  955,  965,    3,  964,    3,  968,  971,    3,
+        3,    3,    3,  976,  969,    3,  970,  956,  972,  966,
+        3,    3,    3,    3,    3,    3,  973,  978,  980,    3,
+        3,  974,    3,  975,    3,    3,  977,    3,  983,    3,
+      985,  982,    3,    3,    3,  979,  984,  989,  981,    3,
+        3,    3,  991,    3,    3,    3,  987,  988,  993,  990,
+      986,    3,  992,    3,  994,    3,    3, 1002, 1000,  996,
+        3, 1001,    3,    3,    3,    3,  997,  998,    3,  995,
+        3,    3, 1005, 1004, 1009,    3, 1003,    3, 1010,  999,
+
+     1013,    3,    3,    3,    3, 1006, 1016, 1017,    3, 1015,
+        3, 1011,    3,    3, 1012,    3,    3, 1014, 1023,    3,
+     1025,    3,    3, 1021, 1018,    3,    3,    3, 1020, 1026,
+     1019, 1027,    3,    3, 1029, 1022, 1030,    3,    3,    3,
+     1024, 1031,    3,    3,    3, 1028,    3,    3,    3, 1032,
+     1033, 1039,    3, 1034, 1035, 1036, 1040, 1041, 1044, 1038,
+     1043,    3,    3,    3,    3,    3, 1047,    3, 1045,    3,
+     1048, 1042, 1037,    3,    3, 1046,    3,    3, 1049, 1050,
+     1052,    3,    3, 1060,    3, 1051,    3, 1053,    3,    3,
+        3, 1054,    3,    3,    3,    3,    3,    3,    3, 1059,
+
+        3,    3, 1066, 1067,    3, 1063, 1068, 1072,    3,    3,
+     1069, 1075,    3,    3, 1061, 1064, 1062, 1070, 1071, 1076,
+        3, 1065, 1073,    3,    3, 1078, 1080, 1082,    3, 1074,
+        3, 1079,    3,    3,    3, 1084, 1077, 1083,    3, 1081,
+        3, 1086,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3, 1085, 1092, 1088,    3, 1094, 1087,    3,    3,
+        3, 1103, 1096, 1099, 1102,    3,    3, 1097, 1106,    3,
+     1089,    3, 1098, 1093, 1095, 1100, 1105, 1107,    3,    3,
+        3, 1104,    3, 1108, 1101,    3,    3,    3,    3, 1112,
+        3, 1115,    3, 1113, 1119,    3, 1118,    3,    3, 1122,
+
+        3,    3, 1116,    3, 1120, 1114, 1124, 1117,    3,    3,
+        3,    3, 1126, 1121,    3,    3,    3, 1127, 1131,    3,
+        3, 1133,    3,    3, 1128, 1134, 1123, 1125,    3, 1132,
+     1129,    3, 1136,    3, 1130,    3, 1150,    3,    3,    3,
+     1135,    3, 1145, 1137, 1138, 1139,    3, 1147, 1140, 1141,
+        3, 1142,    3,    3,    3,    3, 1149, 1151,    3, 1146,
+        3,    3,    3,    3, 1148,    3, 1152,    3, 1156,    3,
+     1153, 1155,    3,    3, 1154,    3,    3,    3,    3, 1157,
+     1163, 1158,    3, 1164, 1160,    3, 1159, 1161,    3,    3,
+        3,    3,    3, 1162, 1167,    3, 1165, 1169, 1171, 1166,
+
+        3, 1170, 1168, 1178, 1173, 1177, 1175, 1179,    3,    3,
+        3, 1174, 1172, 1180, 1176,    3,    3,    3,    3,    3,
+        3, 1181, 1182,    3,    3,    3, 1184,    3, 1185,    3,
+        3, 1187,    3, 1183, 1188,    3, 1192, 1193,    3,    3,
+        3, 1186,    3,    3,    3, 1197, 1189, 1190, 1191, 1194,
+        3,    3, 1200,    3, 1196,    3,    3, 1198,    3,    3,
+     1201, 1204, 1205,    3, 1195, 1206,    3,    3,    3,    3,
+     1199, 1202, 1209, 1203,    3,    3, 1208,    3,    3,    3,
+        3, 1210, 1207,    3, 1212,    3,    3, 1213, 1211,    3,
+        3,    3,    3, 1219,    3, 1220, 1222,    3, 1215,    3,
+
+     1217, 1216, 1221, 1214, 1226, 1224, 1218, 1223, 1227, 1228,
+     1229, 1233, 1225, 1232,    3, 1230, 1234, 1231,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3, 1237, 1238,    3,    3,    3,    3,    3,
+     1240,    3,    3,    3,    3,    3,    3,    3, 1246,    3,
+     1241, 1236, 1245, 1255, 1235,    3, 1247, 1242,    3, 1244,
+     1249, 1239, 1252, 1248, 1251, 1243,    3, 1261, 1250,    3,
+     1259, 1254, 1253, 1258, 1257, 1263, 1262, 1264,    3,    3,
+        3, 1256, 1267, 1266, 1260,    3,    3,    3,    3,    3,
+        3,    3,    3, 1265,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3, 1269, 1273, 1275,    3,    3,    3,    3,
+        3, 1270,    3,    3,    3, 1288, 1277, 1278, 1268, 1283,
+     1291,    3, 1276, 1280,    3, 1274, 1292, 1281, 1282, 1279,
+     1286, 1284, 1287, 1289, 1290,    3, 1285, 1294, 1293, 1300,
+     1296, 1299, 1295,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3, 1302,    3,    3, 1301,    3, 1305,
+        3, 1304,    3,    3,    3,    3,    3,    3,    3, 1314,
+        3,    3,    3,    3, 1303,    3,    3, 1306, 1307, 1308,
+     1309, 1310, 1311, 1320, 1313, 1317, 1312, 1325, 1318, 1319,
+     1323, 1324,    3, 1327,    3,    3, 1321, 1326, 1328, 1330,
+
+     1322, 1329,    3,    3, 1332,    3, 1331,    3,    3,    3,
+        3,    3,    3,    3, 1333,    3, 1334, 1335,    3,    3,
+     1337,    3,    3, 1339,    3,    3,    3, 1342,    3,    3,
+        3,    3,    3,    3,    3, 1336,    3,    3,    3, 1344,
+     1345, 1348, 1341,    3, 1343, 1338, 1347, 1346, 1340, 1356,
+     1358, 1351, 1357, 1349, 1360, 1350, 1361,    3, 1352,    3,
+        3, 1354,    3, 1363, 1362, 1368, 1353,    3,    3, 1355,
+        3,    3, 1359,    3, 1366, 1364,    3,    3,    3, 1367,
+        3,    3,    3,    3, 1369,    3, 1365,    3,    3,    3,
+     1370,    3,    3, 1377, 1376,    3,    3,    3,    3, 1371,
+
+        3, 1373, 1374,    3, 1375,    3, 1386,    3,    3, 1385,
+        3, 1372,    3,    3,    3,    3, 1384, 1387, 1391,    3,
+     1393, 1378, 1379, 1380, 1392, 1381, 1389, 1382, 1383, 1394,
+     1388, 1395,    3, 1396,    3,    3,    3, 1390, 1399, 1400,
+     1401,    3,    3, 1402,    3,    3, 1397,    3, 1404,    3,
+        3,    3, 1398,    3,    3,    3,    3,    3,    3,    3,
+     1408, 1410, 1411,    3,    3,    3,    3, 1409, 1403,    3,
+        3,    3,    3, 1419, 1420, 1422, 1405, 1418, 1412, 1414,
+     1416, 1413, 1417,    3,    3,    3,    3, 1428, 1429, 1430,
+     1415, 1424, 1432,    3,    3, 1425,    3, 1421,    3,    3,
+
+        3,    3, 1435, 1423, 1431,    3, 1434,    3,    3, 1437,
+        3, 1438,    3,    3, 1433,    3, 1440,    3,    3,    3,
+        3,    3,    3,    3, 1441, 1439, 1436,    3, 1442, 1443,
+        3,    3,    3, 1444,    3, 1445, 1446, 1453, 1447, 1451,
+        3, 1455, 1456,    3, 1457, 1448, 1449, 1450, 1452, 1462,
+     1460,    3,    3,    3,    3,    3,    3, 1463,    3, 1454,
+        3,    3,    3, 1458,    3, 1459,    3,    3, 1466, 1461,
+        3,    3,    3,    3,    3,    3, 1468,    3, 1470, 1471,
+     1469, 1467,    3, 1464,    3, 1487, 1465,    3,    3, 1480,
+        3, 1486, 1479, 1484, 1474,    3, 1478,    3, 1481, 1489,
+
+     1472, 1490, 1477, 1488, 1485, 1492, 1491, 1494,    3,    3,
+        3,    3,    3,    3,    3, 1493,    3,    3,    3,    3,
+        3,    3, 1499,    3, 1495,    3,    3, 1500, 1496,    3,
+     1503,    3,    3,    3,    3, 1501,    3,    3, 1510,    3,
+     1504, 1505,    3, 1506, 1507, 1508, 1509,    3, 1514, 1502,
+     1518, 1517,    3, 1519, 1511,    3, 1512, 1516,    3,    3,
+        3,    3, 1515,    3,    3, 1513,    3,    3, 1523,    3,
+     1521,    3,    3, 1526, 1531,    3, 1520, 1530,    3, 1522,
+     1532, 1527,    3, 1529, 1528, 1533,    3, 1534, 1535, 1536,
+     1537,    3,    3,    3, 1538,    3, 1542,    3, 1539,    3,
+
+     1541,    3,    3, 1540,    3,    3,    3,    3, 1543,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3, 1546,
+     1549,    3, 1547,    3,    3, 1556, 1545,    3, 1558, 1548,
+     1552, 1544, 1553,    3, 1554, 1551,    3, 1559, 1555, 1560,
+     1561, 1550, 1562, 1563,    3, 1566, 1564, 1567, 1568,    3,
+     1557,    3, 1570, 1565, 1569,    3,    3, 1572,    3,    3,
+        3,    3, 1571,    3,    3,    3,    3,    3,    3,    3,
+     1574,    3,    3, 1578,    3,    3, 1577,    3,    3, 1580,
+     1573, 1576,    3, 1585,    3,    3,    3, 1579,    3, 1586,
+        3, 1581, 1582, 1583, 1587, 1575, 1584, 1589,    3, 1590,
+
+     1588, 1592,    3,    3, 1597, 1593,    3, 1595, 1591,    3,
+     1594,    3, 1596,    3,    3, 1598,    3,    3,    3, 1602,
+     1600,    3, 1599,    3,    3,    3,    3,    3, 1604,    3,
+     1601, 1603,    3,    3,    3,    3,    3,    3,    3,    3,
+     1611, 1613, 1614, 1616, 1618,    3,    3,    3,    3, 1605,
+     1621, 1606, 1607,    3, 1608, 1609, 1610, 1612, 1615, 1620,
+        3, 1619,    3, 1622, 1617, 1624, 1623,    3,    3, 1625,
+     1626,    3, 1627, 1628, 1629,    3, 1631,    3, 1630,    3,
+        3,    3,    3,    3,    3, 1632, 1633,    3,    3, 1634,
+        3,    3,    3,    3,    3, 1636,    3,    3, 1638,    3,
+
+        3, 1641, 1635, 1639,    3, 1644, 1637, 1645,    3, 1642,
+     1646,    3, 1643, 1647, 1650, 1640, 1648, 1651, 1649,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+     1652,    3,    3, 1655,    3,    3, 1656,    3, 1654, 1653,
+        3, 1659, 1662,    3, 1666,    3, 1657, 1668,    3,    3,
+        3, 1663, 1658,    3,    3, 1661,    3, 1669, 1665, 1670,
+        3, 1671, 1660, 1673, 1664, 1667,    3, 1672, 1674,    3,
+     1680, 1679,    3, 1676,    3,    3, 1675,    3, 1684,    3,
+        3,    3,    3, 1683,    3, 1682, 1687,    3,    3, 1686,
+     1681, 1692, 1688,    3, 1685,    3,    3,    3,    3,    3,
+
+     1691,    3,    3,    3, 1696,    3, 1695, 1705,    3, 1698,
+     1699, 1693,    3, 1694, 1700, 1701, 1697, 1703, 1702, 1704,
+        3, 1706,    3,    3, 1708, 1710,    3,    3,    3,    3,
+        3,    3,    3, 1707,    3,    3, 1709,    3,    3,    3,
+     1711,    3, 1712,    3,    3, 1717,    3, 1718,    3,    3,
+     1714,    3, 1716,    3, 1713, 1725, 1724, 1721,    3, 1715,
+     1728, 1719, 1723, 1720, 1729, 1727,    3, 1731,    3,    3,
+        3, 1732,    3, 1722,    3, 1726, 1733,    3,    3, 1730,
+     1735,    3,    3,    3, 1734,    3, 1736,    3,    3, 1739,
+        3,    3,    3,    3,    3,    3,    3, 1740, 1737, 1738,
+
+        3,    3,    3,    3, 1745, 1746,    3, 1741, 1751, 1743,
+     1742, 1748, 1744, 1747, 1749, 1753,    3,    3,    3, 1754,
+        3, 1750,    3,    3,    3, 1752,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[3189] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+static const flex_int16_t yy_chk[4145] =
+    {   1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    7,    7,    9,   10,
-       13,   10,   11,   11,   11,   18,   13,   16,   16,   21,
-       26,   17,   18,    9,   37,   37,   13, 1627,   16,   17,
-       33,   34,   17, 1626,   20, 1625,   20,   13,   41,   44,
-
-       44,   44,   18,   13,   16,   16,   21,   26,   17,   18,
-        9,   12,   12,   13,   12,   16,   17,   33,   34,   17,
-       12,   20,   12,   20,   45,   41,   46,   47,   19,   12,
-     1623,   12,  186,  186, 1593,  784,   19,  784,   12,   12,
-     1529,   12,   19, 1505,   48,  784, 1411,   12,   19,   12,
-       22,   45, 1404,   46,   47,   19,   12,   22,   12,   14,
-       22,   14,   22,   19,   23,   49,   14,   14,   23,   19,
-       14,   48,   28,   14,   23,   19,   28,   22,   50,   31,
-       31,   51, 1396,   14,   22,   31,   14,   22,   14,   22,
-       28,   23,   49,   14,   14,   23,   52,   14, 1388,   28,
-
-       14,   23,   53,   28,   54,   50,   31,   31,   51,   32,
-       14,   15,   31,   32,   56,   15,   32,   28,   55,   15,
-       55,   57,   15,   52,   58,   15, 1361, 1361, 1380,   53,
-     1357,   54,   60,   60, 1352,   61,   32,   62,   15,   65,
-       32,   56,   15,   32,   64,   55,   15,   55,   57,   15,
-       66,   58,   15,   24,   24,   59,   67,   24,   64,   60,
-       60,   24,   61,   59,   62,   70,   65,   24, 1325,   59,
-     1318,   64, 1314,   71,   70,   59, 1313,   66,   74, 1304,
-       24,   24,   59,   67,   24,   64,   75,   68,   24,   68,
-       59,   69,   70,   69,   24,   25,   59,   25,   72,   25,
-
-       71,   70,   59,   25,   69,   74,   73,   76,   69,   25,
-       78,   79,   72,   75,   68,   25,   68,   73,   69,   77,
-       69,   77,   25,   80,   25,   72,   25,   81,   82,   83,
-       25,   69,   84,   73,   76,   69,   25,   78,   79,   72,
-       85,   86,   25,   27,   73,   87,   77,   89,   77,   88,
-       80,   27,   89,   88,   81,   82,   83,   27,   90,   84,
-       27,   27, 1298,   91,   92, 1277, 1262,   85,   86, 1260,
-       27,   94,   87, 1255,   89, 1245,   88, 1231,   27,   89,
-       88,   95,   96,   97,   27,   90,   93,   27,   27,   29,
-       91,   92,   29,   29,   98,   29,   93,   96,   94,   29,
-
-       29,   29,   93,   29,   29, 1224,   99,   98,   95,   96,
-       97,  102, 1223,   93,  103,  104,   29,  100,  101,   29,
-       29,   98,   29,   93,   96,  100,   29,   29,   29,   93,
-       29,   29,   30,   99,  101,  101,  105,  106,  102,   30,
-       30,  103,  104,   30,  100,  101,  108, 1222,  112,  113,
-       30,  115,  100,  116,  109, 1221,   30, 1220, 1219,   30,
-      110,  101,  101,  105,  106,  109,   30,   30,  111,  109,
-       30,  109,  114,  108,  110,  112,  113,   30,  115,  117,
-      116,  109,  114,   30,   63,   63,  118,  110,  119,   63,
-      111,  120,  109,  121,  123,  111,  109,   63,  109,  114,
-
-      124,  110,   63, 1212,  126, 1197,  117,  129,  127,  114,
-     1192,   63,   63,  118,  127,  119,   63,  111,  120,  128,
-      121,  123,  128,  130,   63,  131,  132,  124,  133,   63,
-      107,  126,  107,  107,  129,  127,  134,  107,  135,  107,
-      137,  127,  107,  131,  138,  139,  128,  140,  107,  128,
-      130,  138,  131,  132,  142,  133, 1190,  107,  143,  107,
-      107,  145,  146,  134,  107,  135,  107,  137,  147,  107,
-      131,  138,  139,  148,  140,  107,  125,  149,  138,  150,
-      151,  142,  152,  125,  125,  143,  153,  154,  145,  146,
-      125,  155,  156,  157,  158,  147,  125,  159,  158,  160,
-
-      148,  162,  163,  125,  149,  164,  150,  151,  165,  152,
-      125,  125,  166,  153,  154,  167,  168,  125,  155,  156,
-      157,  158,  169,  125,  159,  158,  160,  170,  162,  163,
-      171,  172,  164,  173,  174,  165,  176,  175,  177,  166,
-      178,  179,  167,  168,  180,  181,  181,  182,  183,  169,
-      175,  185,  187,  188,  170,  190,  189,  171,  172,  189,
-      173,  174,  191,  176,  175,  177,  192,  178,  179,  193,
-      194,  180,  181,  181,  182,  183,  196,  175,  185,  187,
-      188,  198,  190,  189,  199,  200,  189,  201,  202,  191,
-      203,  200,  204,  192,  205,  206,  193,  194,  207,  208,
-
-      209,  210,  211,  196,  212,  213,  210,  214,  198,  215,
-      216,  199,  200,  217,  201,  202,  218,  203,  219,  204,
-      220,  205,  206,  221,  222,  207,  208,  209,  210,  211,
-      223,  212,  213,  210,  214,  224,  215,  216,  225,  227,
-      217,  230,  228,  218,  228,  219,  231,  220,  232,  234,
-      221,  222,  235,  237,  238,  239,  240,  223,  242,  244,
-      245,  246,  224,  247,  249,  225,  227,  250,  230,  228,
-      251,  228,  252,  231,  249,  232,  234,  253,  254,  235,
-      237,  238,  239,  240,  255,  242,  244,  245,  246,  256,
-      247,  249,  258,  257,  250,  259,  260,  251,  261,  252,
-
-      262,  249,  257,  263,  253,  254,  264,  266,  267,  268,
-      269,  255,  272,  275,  262,  276,  256,  277,  278,  258,
-      257,  279,  259,  260,  281,  261,  282,  262,  283,  284,
-      263,  285,  286,  264,  266,  267,  268,  269,  287,  272,
-      275,  262,  276,  290,  277,  278,  291,  292,  279,  294,
-      295,  281,  296,  282,  298,  283,  284,  299,  285,  286,
-      300,  301,  302,  303,  304,  287,  305,  306,  308,  309,
-      290,  310,  311,  291,  292,  312,  294,  295,  313,  296,
-      315,  298,  318, 1178,  299,  319,  316,  300,  301,  302,
-      303,  304,  316,  305,  306,  308,  309,  324,  310,  311,
-
-      320,  320,  312,  326,  327,  313,  328,  315,  330,  318,
-      316,  331,  319,  316, 1175,  334,  335,  336,  337,  316,
-     1159,  338,  339,  337,  324, 1143,  342,  320,  320,  344,
-      326,  327,  346,  328,  347,  330,  348,  349,  331,  333,
-      333,  333,  334,  335,  336,  337,  353,  333,  338,  339,
-      337,  333,  333,  342,  350,  357,  344,  358,  333,  346,
-      359,  347,  360,  348,  349,  361,  333,  333,  333,  362,
-      363,  364,  350,  353,  333,  365,  367,  368,  333,  333,
-      350,  350,  357,  369,  358,  333,  370,  359,  371,  360,
-      370,  372,  361,  369,  374,  370,  362,  363,  364,  350,
-
-      375,  376,  365,  367,  368,  377,  378,  379,  380,  381,
-      369,  383, 1120,  370,  384,  371,  386,  370,  372,  387,
-      388,  374,  370,  389,  390,  391,  393,  375,  376,  382,
-      382,  394,  377,  378,  379,  380,  381,  396,  383,  382,
-      397,  384,  398,  386,  399,  382,  387,  388,  400,  401,
-      389,  390,  391,  393,  402,  403,  382,  382,  394,  404,
-      405,  407,  408,  406,  396,  410,  382,  397,  406,  398,
-      411,  399,  382,  413,  414,  400,  401,  416,  418,  408,
-      419,  402,  403,  420,  423,  425,  404,  405,  407,  408,
-      406,  426,  410,  428,  430,  406,  431,  411,  432,  433,
-
-      413,  414,  434,  435,  416,  418,  408,  419,  436,  437,
-      420,  423,  425,  439,  442,  443,  444,  445,  426,  446,
-      428,  430,  447,  431,  448,  432,  433,  450,  451,  434,
-      435,  452,  453,  454,  448,  436,  437,  455,  458,  459,
-      439,  442,  443,  444,  445,  460,  446,  461,  462,  447,
-      463,  448,  464,  465,  450,  451,  466,  467,  452,  453,
-      454,  448,  464,  468,  455,  458,  459,  469,  466,  470,
-      471,  467,  460,  472,  461,  462,  473,  463,  474,  464,
-      465,  475,  477,  466,  467,  476,  478,  479,  480,  464,
-      468,  481,  476,  482,  469,  466,  470,  471,  467,  485,
-
-      472,  484,  486,  473,  487,  474,  488,  484,  475,  477,
-      489,  490,  476,  478,  479,  480,  491,  494,  481,  476,
-      482,  487,  493,  495,  496,  493,  485,  497,  484,  486,
-      498,  487,  499,  488,  484,  501,  502,  489,  490,  503,
-      504,  505,  508,  491,  494,  512,  513,  514,  487,  493,
-      495,  496,  493,  516,  497,  517,  518,  498,  519,  499,
-      515,  520,  501,  502,  515,  521,  503,  504,  505,  508,
-      515,  522,  512,  513,  514,  523,  524,  525,  526,  527,
-      516,  528,  517,  518,  529,  519,  530,  515,  520,  533,
-      536,  515,  521,  538,  540,  541,  542,  515,  522,  543,
-
-      544,  545,  523,  524,  525,  526,  527,  546,  528,  547,
-      548,  529,  550,  530,  551,  552,  533,  536,  553,  545,
-      538,  540,  541,  542,  554,  555,  543,  544,  545,  556,
-      557,  558,  560,  563,  546,  564,  547,  548,  566,  550,
-      567,  551,  552,  568,  569,  553,  570,  572,  573,  574,
-      575,  554,  555,  576,  577,  580,  556,  557,  558,  560,
-      563,  581,  564,  584,  582,  566,  587,  567,  583,  583,
-      568,  569,  582,  570,  572,  573,  574,  575,  588,  589,
-      576,  577,  580,  590,  591,  592,  593,  594,  581,  595,
-      584,  582,  596,  587,  598,  583,  583,  599,  600,  582,
-
-      601,  602,  604,  605,  606,  588,  589,  607,  608,  609,
-      590,  591,  592,  593,  594,  610,  595,  612,  613,  596,
-      614,  598,  615,  616,  599,  600,  617,  601,  602,  604,
-      605,  606,  618,  619,  607,  608,  609,  620,  624,  625,
-      627,  628,  610,  629,  612,  613,  630,  614,  631,  615,
-      616,  632,  634,  617,  633,  633,  635,  637,  638,  618,
-      619,  641,  642, 1106,  620,  624,  625,  627,  628, 1097,
-      629,  643,  644,  630,  645,  631,  647,  648,  632,  634,
-      650,  633,  633,  635,  637,  638,  639,  652,  641,  642,
-      639,  653,  639,  654,  639,  656,  639,  639,  643,  644,
-
-      657,  645,  639,  647,  648,  658,  659,  650,  662,  663,
-      664,  665,  666,  639,  652,  667,  668,  639,  653,  639,
-      654,  639,  656,  639,  639,  669,  670,  657,  671,  639,
-      672,  673,  658,  659,  675,  662,  663,  664,  665,  666,
-      678,  679,  667,  668,  681,  683,  685,  686,  687,  688,
-      689,  690,  669,  670,  691,  671,  695,  672,  673,  696,
-      697,  675,  698,  699,  700,  701,  702,  678,  679, 1092,
-      704,  681,  683,  685,  686,  687,  688,  689,  690,  705,
-      706,  691,  707,  695,  708,  709,  696,  697,  710,  698,
-      699,  700,  701,  702,  703,  703,  703,  704,  711,  712,
-
-      713,  714,  715,  716,  717,  718,  705,  706,  719,  707,
-      720,  708,  709,  721,  723,  710,  724,  727,  728,  730,
-      732,  703,  703,  703,  733,  711,  712,  713,  714,  715,
-      716,  717,  718,  734,  735,  719,  736,  720,  737,  738,
-      721,  723,  739,  724,  727,  728,  730,  732,  740,  741,
-      743,  733,  744,  745,  746,  748,  749,  751,  752,  753,
-      734,  735,  755,  736,  756,  737,  738,  757,  765,  739,
-      767,  768,  769,  770,  771,  740,  741,  743,  772,  744,
-      745,  746,  748,  749,  751,  752,  753,  773,  777,  755,
-      779,  756,  782,  783,  757,  765,  785,  767,  768,  769,
-
-      770,  771,  786,  787,  788,  772,  790,  791,  793,  794,
-      795,  796,  799,  801,  773,  777,  802,  779,  798,  782,
-      783,  803,  798,  785,  804,  798,  805,  800,  806,  786,
-      787,  788,  800,  790,  791,  793,  794,  795,  796,  799,
-      801,  808,  809,  802,  800,  798,  810,  811,  803,  798,
-      812,  804,  798,  805,  800,  806,  813,  815,  816,  800,
-      818,  819,  820,  821,  822,  823,  824,  825,  808,  809,
-      826,  800,  827,  810,  811,  828,  829,  812,  831,  833,
-      834,  836,  837,  813,  815,  816,  838,  818,  819,  820,
-      821,  822,  823,  824,  825,  839,  841,  826,  842,  827,
-
-      843,  844,  828,  829,  846,  831,  833,  834,  836,  837,
-      848,  844,  850,  838,  851,  852,  853,  855,  856,  857,
-      858,  859,  839,  841,  860,  842,  861,  843,  844,  862,
-      863,  846,  864,  865,  866,  867,  868,  848,  844,  850,
-      869,  851,  852,  853,  855,  856,  857,  858,  859,  870,
-      871,  860,  872,  861,  873,  874,  862,  863,  875,  864,
-      865,  866,  867,  868,  877,  878,  879,  869,  880,  881,
-      882,  883,  884,  885,  886,  887,  870,  871,  888,  872,
-      889,  873,  874,  893,  890,  875,  890,  894,  897,  901,
-      902,  877,  878,  879,  890,  880,  881,  882,  883,  884,
-
-      885,  886,  887,  903,  904,  888,  905,  889,  906,  907,
-      893,  908,  909,  910,  894,  897,  901,  902,  912,  913,
-      915,  916,  917,  918,  919,  920,  921,  926,  924,  927,
-      903,  904,  924,  905,  928,  906,  907,  929,  908,  909,
-      910,  931,  933,  934,  936,  912,  913,  915,  916,  917,
-      918,  919,  920,  921,  926,  924,  927,  937,  938,  924,
-      939,  928,  940,  941,  929,  942,  943,  946,  931,  933,
-      934,  936,  941,  947,  948,  949,  950,  951,  952,  953,
-      941,  955,  957,  959,  937,  938,  963,  939,  964,  940,
-      941,  965,  942,  943,  946,  966,  967,  968,  969,  941,
-
-      947,  948,  949,  950,  951,  952,  953,  941,  955,  957,
-      959,  970,  971,  963,  972,  964,  973,  974,  965,  975,
-      976,  977,  966,  967,  968,  969,  979,  980,  978,  981,
-      982,  983,  984,  985,  986,  988,  989,  990,  970,  971,
-      991,  972,  996,  973,  974,  978,  975,  976,  977,  997,
-      998,  999, 1001,  979,  980,  978,  981,  982,  983,  984,
-      985,  986,  988,  989,  990, 1002, 1003,  991, 1004,  996,
-     1005, 1006,  978, 1007, 1008, 1009,  997,  998,  999, 1001,
-     1010, 1011, 1012, 1013, 1014, 1015, 1017, 1019, 1021, 1022,
-     1023, 1024, 1002, 1003, 1025, 1004, 1026, 1005, 1006, 1027,
-
-     1007, 1008, 1009, 1028, 1030, 1031, 1032, 1010, 1011, 1012,
-     1013, 1014, 1015, 1017, 1019, 1021, 1022, 1023, 1024, 1033,
-     1035, 1025, 1036, 1026, 1037, 1038, 1027, 1039, 1040, 1041,
-     1028, 1030, 1031, 1032, 1043, 1044, 1045, 1047, 1048, 1049,
-     1050, 1052, 1053, 1054, 1055, 1056, 1033, 1035, 1057, 1036,
-     1058, 1037, 1038, 1059, 1039, 1040, 1041, 1060, 1065, 1066,
-     1067, 1043, 1044, 1045, 1047, 1048, 1049, 1050, 1052, 1053,
-     1054, 1055, 1056, 1068, 1069, 1057, 1070, 1058, 1071, 1072,
-     1059, 1073, 1074, 1075, 1060, 1065, 1066, 1067, 1077, 1078,
-     1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
-
-     1068, 1069, 1089, 1070, 1090, 1071, 1072, 1091, 1073, 1074,
-     1075, 1094, 1095, 1096, 1099, 1077, 1078, 1079, 1080, 1081,
-     1082, 1083, 1084, 1085, 1086, 1087, 1088, 1100, 1101, 1089,
-     1102, 1090, 1103, 1104, 1091, 1105, 1107, 1109, 1094, 1095,
-     1096, 1099, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
-     1110, 1118, 1119, 1121, 1100, 1101, 1122, 1102, 1125, 1103,
-     1104, 1126, 1105, 1107, 1109, 1127, 1129, 1130, 1131, 1110,
-     1111, 1112, 1113, 1114, 1115, 1116, 1117, 1132, 1118, 1119,
-     1121, 1133, 1134, 1122, 1135, 1125, 1136, 1137, 1126, 1139,
-     1135, 1144, 1127, 1129, 1130, 1131, 1145, 1146, 1147, 1148,
-
-     1149, 1150, 1151, 1152, 1132, 1153, 1154, 1155, 1133, 1134,
-     1157, 1135, 1156, 1136, 1137, 1158, 1139, 1135, 1144, 1156,
-     1160, 1161, 1162, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
-     1152, 1164, 1153, 1154, 1155, 1165, 1166, 1157, 1167, 1156,
-     1168, 1169, 1158, 1170, 1171, 1172, 1156, 1160, 1161, 1162,
-     1173, 1174, 1176, 1179, 1180, 1181, 1182, 1184, 1164, 1185,
-     1186, 1188, 1165, 1166, 1189, 1167, 1191, 1168, 1169, 1193,
-     1170, 1171, 1172, 1194, 1196, 1198, 1199, 1173, 1174, 1176,
-     1179, 1180, 1181, 1182, 1184, 1201, 1185, 1186, 1188, 1202,
-     1203, 1189, 1204, 1191, 1205, 1206, 1193, 1207, 1209, 1210,
-
-     1194, 1196, 1198, 1199, 1211, 1213, 1214, 1215, 1216, 1218,
-     1225, 1226, 1201, 1227, 1228, 1229, 1202, 1203, 1230, 1204,
-     1232, 1205, 1206, 1233, 1207, 1209, 1210, 1235, 1236, 1237,
-     1239, 1211, 1213, 1214, 1215, 1216, 1218, 1225, 1226, 1241,
-     1227, 1228, 1229, 1242, 1243, 1230, 1244, 1232, 1246, 1247,
-     1233, 1248, 1249, 1250, 1235, 1236, 1237, 1239, 1251, 1253,
-     1254, 1256, 1257, 1259, 1261, 1246, 1241, 1263, 1264, 1266,
-     1242, 1243, 1267, 1244, 1268, 1246, 1247, 1269, 1248, 1249,
-     1250, 1265, 1271, 1272, 1274, 1251, 1253, 1254, 1256, 1257,
-     1259, 1261, 1246, 1276, 1263, 1264, 1266, 1278, 1265, 1267,
-
-     1279, 1268, 1280, 1281, 1269, 1283, 1284, 1285, 1265, 1271,
-     1272, 1274, 1286, 1287, 1288, 1289, 1290, 1292, 1293, 1294,
-     1276, 1295, 1296, 1297, 1278, 1265, 1300, 1279, 1301, 1280,
-     1281, 1302, 1283, 1284, 1285, 1303, 1306, 1307, 1308, 1286,
-     1287, 1288, 1289, 1290, 1292, 1293, 1294, 1309, 1295, 1296,
-     1297, 1310, 1311, 1300, 1312, 1301, 1316, 1317, 1302, 1317,
-     1319, 1320, 1303, 1306, 1307, 1308, 1322, 1323, 1321, 1324,
-     1326, 1327, 1328, 1330, 1309, 1331, 1332, 1333, 1310, 1311,
-     1334, 1312, 1335, 1316, 1317, 1321, 1317, 1319, 1320, 1337,
-     1338, 1339, 1340, 1322, 1323, 1321, 1324, 1326, 1327, 1328,
-
-     1330, 1336, 1331, 1332, 1333, 1341, 1336, 1334, 1342, 1335,
-     1343, 1344, 1321, 1345, 1346, 1347, 1337, 1338, 1339, 1340,
-     1349, 1350, 1351, 1353, 1354, 1355, 1356, 1360, 1336, 1362,
-     1363, 1364, 1341, 1336, 1365, 1342, 1366, 1343, 1344, 1367,
-     1345, 1346, 1347, 1368, 1370, 1371, 1372, 1349, 1350, 1351,
-     1353, 1354, 1355, 1356, 1360, 1373, 1362, 1363, 1364, 1375,
-     1376, 1365, 1377, 1366, 1378, 1379, 1367, 1382, 1383, 1384,
-     1368, 1370, 1371, 1372, 1385, 1387, 1389, 1391, 1392, 1393,
-     1394, 1395, 1373, 1397, 1398, 1399, 1375, 1376, 1400, 1377,
-     1401, 1378, 1379, 1402, 1382, 1383, 1384, 1403, 1406, 1407,
-
-     1408, 1385, 1387, 1389, 1391, 1392, 1393, 1394, 1395, 1409,
-     1397, 1398, 1399, 1410, 1412, 1400, 1413, 1401, 1416, 1417,
-     1402, 1418, 1419, 1420, 1403, 1406, 1407, 1408, 1421, 1422,
-     1423, 1424, 1425, 1426, 1427, 1428, 1409, 1429, 1430, 1431,
-     1410, 1412, 1432, 1413, 1433, 1416, 1417, 1434, 1418, 1419,
-     1420, 1435, 1438, 1439, 1440, 1421, 1422, 1423, 1424, 1425,
-     1426, 1427, 1428, 1441, 1429, 1430, 1431, 1442, 1445, 1432,
-     1447, 1433, 1448, 1449, 1434, 1450, 1451, 1452, 1435, 1438,
-     1439, 1440, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
-     1441, 1461, 1462, 1463, 1442, 1445, 1465, 1447, 1466, 1448,
-
-     1449, 1467, 1450, 1451, 1452, 1468, 1469, 1470, 1471, 1453,
-     1454, 1455, 1456, 1457, 1458, 1459, 1460, 1472, 1461, 1462,
-     1463, 1473, 1474, 1465, 1475, 1466, 1476, 1477, 1467, 1478,
-     1479, 1481, 1468, 1469, 1470, 1471, 1482, 1483, 1484, 1485,
-     1486, 1487, 1494, 1496, 1472, 1498, 1499, 1500, 1473, 1474,
-     1501, 1475, 1502, 1476, 1477, 1503, 1478, 1479, 1481, 1506,
-     1507, 1508, 1510, 1482, 1483, 1484, 1485, 1486, 1487, 1494,
-     1496, 1512, 1498, 1499, 1500, 1513, 1514, 1501, 1516, 1502,
-     1518, 1520, 1503, 1521, 1522, 1523, 1506, 1507, 1508, 1510,
-     1524, 1525, 1526, 1527, 1528, 1527, 1530, 1531, 1512, 1532,
-
-     1533, 1534, 1513, 1514, 1537, 1516, 1538, 1518, 1520, 1540,
-     1521, 1522, 1523, 1535, 1541, 1543, 1544, 1524, 1525, 1526,
-     1527, 1528, 1527, 1530, 1531, 1546, 1532, 1533, 1534, 1548,
-     1535, 1537, 1550, 1538, 1551, 1552, 1540, 1553, 1554, 1555,
-     1535, 1541, 1543, 1544, 1556, 1557, 1558, 1559, 1561, 1562,
-     1563, 1564, 1546, 1568, 1569, 1571, 1548, 1535, 1574, 1550,
-     1575, 1551, 1552, 1576, 1553, 1554, 1555, 1578, 1579, 1580,
-     1581, 1556, 1557, 1558, 1559, 1561, 1562, 1563, 1564, 1582,
-     1568, 1569, 1571, 1584, 1586, 1574, 1588, 1575, 1589, 1590,
-     1576, 1594, 1595, 1596, 1578, 1579, 1580, 1581, 1598, 1599,
-
-     1600, 1601, 1602, 1605, 1607, 1608, 1582, 1610, 1611, 1612,
-     1584, 1586, 1613, 1588, 1614, 1589, 1590, 1615, 1594, 1595,
-     1596, 1616, 1617, 1620, 1076, 1598, 1599, 1600, 1601, 1602,
-     1605, 1607, 1608, 1051, 1610, 1611, 1612, 1029,  995, 1613,
-      994, 1614,  993,  992, 1615,  956,  954,  944, 1616, 1617,
-     1620, 1624, 1624,  932,  925,  923,  911,  899,  896,  895,
-      892,  891,  876,  835,  830,  797,  781,  774,  764,  763,
-      762,  761,  760,  759,  758,  731,  729,  692,  684,  682,
-      680,  661,  649,  646,  622,  611,  578,  571,  565,  561,
-      559,  537,  534,  511,  506,  483,  457,  456,  427,  421,
-
-      395,  366,  355,  352,  343,  329,  325,  314,  297,  280,
-      273,  270,  248,  229,  197,  184,  144,  122,   35,    5,
-        3, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622,
-     1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+     1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+
+     1755, 1755, 1755, 1755,    6,    6,    6,    3,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    8,    8,    8,    4,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,   36,   36,   36,   38,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   39,   39,   39,
+       40,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   43,   43,
+       43,   42,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,  942,
+      942,  942,  137,  942,  942,  942,  942,  942,  942,  942,
+      942,  942,  942,  942,  942,  942,  942,  942,  942,  942,
+      942,  942,  942,  942,  942,  942,  942,  942,  942,  942,
+      942,  942,  942,  942,  942,  942,  942,  942,  942,  942,
+      943,  943,  943,  142,  943,  943,  943,  943,  943,  943,
+      943,  943,  943,  943,  943,  943,  943,  943,  943,  943,
+      943,  943,  943,  943,  943,  943,  943,  943,  943,  943,
+      943,  943,  943,  943,  943,  943,  943,  943,  943,  943,
+      943, 1055, 1055, 1055,  162, 1055, 1055, 1055, 1055, 1055,
+
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1056, 1056, 1056,  197, 1056, 1056, 1056, 1056,
+     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+     1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+     1056, 1056, 1056, 1057, 1057, 1057,  229, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1057, 1058, 1058, 1058,  237, 1058, 1058,
+     1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+     1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+     1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+     1058, 1058, 1058, 1058, 1058,   29,   11,    5,   68,    5,
+       44,   35,  240,   35,  321,   11,   11,   11,   17,   44,
+       44,   44,   68,   29,   68,  108,   29,   29,   12,   29,
+      321,   26,   17,   29,   29,   29,  321,   29,   29,  108,
+       17,  108,  108,   17,   12,   12,  108,   12,  108,   14,
+
+       10,  108,  390,   12,  321,   12,   10,  108,   10,  108,
+       26,  245,   12,   14,   12,   14,  339,   45,  390,  390,
+       14,   14,  661,  390,   14,  203,  390,   14,  390,   69,
+      339,  339,  339,   45,  390,  390,   21,   14,  339,   25,
+      661,   70,  339,  339,  661,   69,  661,   69,  661,  339,
+      661,  661,   15,   25,   30,   25,  661,   25,   69,  203,
+       23,   25,   69,   70,   21,  203,   15,   25,   30,   24,
+       15,   27,   70,   25,   15,   30,   30,   15,   23,   30,
+       15,   63,   23,   24,   24,   27,   30,   24,   23,  139,
+      126,   24,   30,   27,  188,   63,   63,   24,   19,   27,
+
+       63,   20,   27,   27,  188,  188,  247,  126,   63,   22,
+      139,   59,   19,   63,  126,  126,   13,  139,   20,  110,
+       19,  126,   16,   28,   22,   59,   19,  126,   20,  269,
+       20,   22,   19,   59,   22,  110,   22,   28,   13,   59,
+       31,   28,   32,  357,   13,   59,  110,   94,   16,   16,
+      110,    9,  110,  102,   13,   28,   32,  357,    9,   16,
+       32,  596,   89,   32,   94,   46,   31,   31, 1412,  102,
+      378,  528,   31,    9,   94,  357,  278,  596,   89, 1412,
+       94,  293,   89,  357,  736,  102,  102,  596,  378,  528,
+      839,   46,  378,  528,  596,  999,   18,  378,  841,  528,
+
+      736,  736,  736,  823,   60,  823,  941,  823,  941,  839,
+      941,  999,  841,  839,   18,  823,  839,  841,  941,   55,
+      999,   18,   64,   72,   77,   73,   96,   90,  999,  841,
+       60,   60,   97,   92,   99,  111,  294,   72,  112,  298,
+       64,   73,  101,  115,   55,  128,   55,   96,  132,  111,
+       97,   72,   73,   92,   64,  112,   77,  129,   77,   90,
+      101,   99,  132,  111,   90,   97,   92,  153,  101,  159,
+      128,  115,  129,  182,   99,  129,  128,  112,  176,  191,
+      132,  115,  213,  159,  231,  261,  253,  159,  326,  603,
+      182,  182,  266,  153,   51,   57,  153,  377,  176,  414,
+
+      312,  458,  344,  322,  191,  603,  603,  191,   51,   57,
+      213,  176,  253,  475,  266,  213,  261,  231,  417,  231,
+      326,  326,  253,  458,  344,  261,  414,  377,  266,  344,
+      475,  414,  477,  458,  417,  478,  488,  377,  586,  496,
+      475,  499,  533,  505,  602,   67,  562,  327,  328,  478,
+     1186,  417,  329,  586,  477, 1037,  655,  499,  488,   67,
+      533,  979,  602,  478,  890,  488,  477,  496,  562,  586,
+      602, 1037,  505,  496,  499,  505,  533,  655,  655,  979,
+     1214,  890, 1186,  979, 1235, 1337,  562, 1359, 1037, 1415,
+     1186,  890, 1436,  338, 1421, 1660, 1214, 1648,   33,   41,
+
+       47, 1337, 1214, 1359, 1465,   48, 1415,   34, 1415, 1235,
+     1421, 1660, 1436,   49, 1465, 1465, 1235, 1436, 1337,   50,
+     1359,   52, 1648,   33, 1648,   34,   41, 1421, 1660,   53,
+       48,   54,   56,   47,   58,   62,   65,   61,   66,   74,
+       71,   75,   76,   79,   80,   81,   49,   83,   52,   84,
+       82,   58,   50,   61,   78,   85,   86,   88,   65,   76,
+       56,   79,   53,   91,   54,   71,   93,   74,   87,   78,
+       95,   66,   82,   62,   84,   98,   75,   85,  100,   80,
+       81,  103,   87,  104,   86,   83,  107,  105,  106,   88,
+      113,   98,  114,   93,  116,  109,   95,  117,  119,  120,
+
+      121,   91,  118,  122,  100,  105,  106,  123,  103,  109,
+      124,  114,  113,  107,  104,  125,  118,  130,  127,  131,
+      134,  133,  117,  136,  135,  140,  121,  138,  116,  119,
+      120,  141,  143,  144,  145,  122,  127,  133,  134,  124,
+      146,  131,  147,  125,  148,  130,  135,  123,  141,  138,
+      143,  149,  150,  151,  152,  154,  155,  156,  144,  157,
+      158,  136,  160,  140,  161,  163,  164,  146,  166,  147,
+      150,  165,  167,  168,  145,  148,  170,  169,  157,  163,
+      161,  155,  154,  149,  171,  151,  152,  167,  173,  156,
+      166,  172,  174,  164,  158,  169,  175,  177,  178,  179,
+
+      160,  180,  170,  165,  168,  181,  171,  183,  174,  172,
+      184,  185,  186,  173,  175,  187,  180,  179,  189,  190,
+      192,  195,  193,  181,  194,  177,  178,  196,  199,  198,
+      200,  202,  201,  204,  210,  208,  205,  187,  193,  186,
+      183,  184,  206,  194,  209,  189,  201,  192,  207,  208,
+      211,  185,  190,  198,  195,  196,  212,  214,  215,  206,
+      216,  209,  202,  200,  217,  218,  207,  204,  199,  205,
+      210,  219,  214,  220,  211,  221,  222,  223,  216,  224,
+      225,  226,  217,  233,  212,  227,  228,  230,  232,  215,
+      234,  236,  219,  220,  238,  241,  224,  218,  239,  242,
+
+      228,  243,  235,  244,  248,  222,  246,  227,  221,  251,
+      249,  223,  225,  241,  250,  230,  226,  252,  234,  235,
+      232,  254,  256,  233,  242,  238,  236,  251,  246,  239,
+      249,  244,  255,  257,  243,  259,  260,  248,  258,  254,
+      262,  263,  250,  265,  264,  267,  268,  256,  270,  255,
+      271,  272,  273,  259,  274,  275,  277,  252,  257,  276,
+      258,  260,  280,  281,  282,  262,  264,  265,  263,  279,
+      283,  284,  267,  270,  285,  276,  286,  268,  272,  271,
+      280,  273,  281,  288,  287,  289,  290,  291,  295,  292,
+      296,  282,  297,  302,  274,  275,  277,  283,  299,  289,
+
+      300,  279,  287,  286,  301,  291,  285,  292,  295,  303,
+      304,  284,  305,  306,  307,  300,  288,  290,  308,  310,
+      309,  314,  301,  297,  296,  311,  313,  315,  316,  299,
+      317,  306,  319,  302,  303,  304,  318,  310,  320,  323,
+      324,  325,  331,  307,  315,  330,  335,  332,  337,  308,
+      305,  309,  333,  311,  314,  334,  320,  336,  313,  342,
+      316,  317,  332,  330,  318,  340,  324,  343,  345,  341,
+      333,  323,  319,  346,  325,  336,  349,  337,  350,  334,
+      351,  342,  331,  340,  341,  353,  335,  354,  355,  356,
+      359,  360,  362,  345,  346,  364,  366,  365,  367,  368,
+
+      343,  371,  369,  349,  370,  372,  373,  356,  351,  375,
+      355,  380,  353,  364,  365,  376,  354,  374,  350,  372,
+      382,  379,  385,  388,  366,  383,  367,  360,  384,  368,
+      359,  386,  362,  369,  371,  374,  370,  389,  375,  379,
+      387,  383,  376,  391,  380,  382,  373,  384,  392,  394,
+      395,  396,  397,  398,  399,  385,  388,  391,  387,  401,
+      402,  403,  392,  386,  404,  389,  405,  394,  406,  407,
+      409,  408,  395,  396,  410,  412,  399,  411,  397,  415,
+      419,  413,  420,  407,  401,  398,  416,  422,  402,  408,
+      425,  423,  428,  430,  431,  404,  435,  412,  405,  413,
+
+      406,  403,  409,  427,  429,  422,  423,  420,  410,  430,
+      411,  419,  415,  433,  416,  436,  437,  438,  435,  428,
+      441,  427,  429,  425,  440,  443,  442,  444,  445,  446,
+      447,  450,  449,  452,  431,  453,  455,  454,  433,  438,
+      436,  444,  440,  442,  456,  457,  446,  452,  461,  441,
+      449,  462,  460,  464,  463,  445,  437,  447,  443,  454,
+      465,  466,  457,  455,  453,  456,  460,  467,  468,  469,
+      470,  450,  463,  462,  471,  472,  465,  474,  473,  479,
+      480,  476,  484,  482,  481,  464,  483,  485,  461,  486,
+      492,  472,  473,  487,  489,  469,  490,  470,  474,  466,
+
+      481,  482,  491,  483,  493,  485,  471,  467,  468,  476,
+      484,  479,  494,  487,  495,  492,  497,  500,  480,  498,
+      491,  486,  501,  502,  503,  489,  508,  490,  507,  510,
+      509,  511,  506,  515,  514,  493,  519,  517,  512,  524,
+      516,  527,  518,  535,  500,  494,  507,  498,  509,  502,
+      501,  503,  497,  506,  495,  512,  516,  508,  510,  518,
+      521,  525,  511,  514,  515,  517,  526,  529,  530,  531,
+      534,  532,  536,  537,  521,  527,  519,  538,  540,  524,
+      535,  539,  530,  541,  542,  543,  544,  531,  529,  532,
+      545,  546,  534,  549,  525,  550,  553,  552,  554,  526,
+
+      540,  556,  557,  536,  538,  537,  558,  546,  539,  564,
+      559,  542,  560,  543,  552,  544,  561,  545,  541,  563,
+      565,  567,  568,  556,  569,  549,  570,  571,  558,  572,
+      554,  557,  573,  574,  564,  550,  553,  559,  561,  568,
+      560,  575,  565,  576,  577,  578,  579,  563,  581,  582,
+      583,  574,  567,  584,  587,  571,  569,  588,  585,  570,
+      589,  573,  572,  582,  590,  594,  592,  575,  591,  595,
+      576,  593,  597,  598,  600,  601,  608,  589,  578,  587,
+      584,  581,  591,  594,  577,  585,  579,  597,  593,  588,
+      583,  592,  604,  607,  610,  600,  609,  611,  612,  613,
+
+      614,  595,  615,  608,  590,  616,  604,  618,  601,  607,
+      609,  619,  620,  598,  621,  613,  623,  625,  622,  610,
+      626,  630,  627,  628,  629,  612,  614,  632,  633,  631,
+      635,  638,  611,  615,  616,  625,  627,  626,  634,  621,
+      618,  637,  629,  619,  620,  622,  631,  628,  623,  636,
+      639,  640,  630,  634,  641,  637,  633,  635,  643,  645,
+      649,  646,  638,  650,  651,  648,  652,  632,  654,  653,
+      657,  641,  656,  640,  660,  636,  659,  664,  639,  646,
+      648,  663,  654,  665,  666,  667,  668,  645,  652,  669,
+      656,  670,  651,  649,  673,  671,  672,  675,  643,  660,
+
+      650,  653,  659,  657,  674,  676,  663,  678,  680,  347,
+      664,  679,  667,  666,  665,  682,  669,  684,  683,  685,
+      674,  687,  670,  673,  688,  678,  668,  671,  672,  679,
+      689,  690,  676,  682,  691,  692,  693,  675,  683,  694,
+      696,  680,  688,  695,  699,  697,  698,  685,  689,  684,
+      693,  692,  700,  702,  706,  705,  707,  708,  709,  710,
+      690,  687,  711,  698,  712,  694,  699,  691,  718,  715,
+      695,  697,  713,  706,  696,  714,  716,  717,  720,  721,
+      700,  722,  719,  707,  711,  725,  702,  705,  726,  727,
+      713,  709,  728,  714,  715,  722,  718,  708,  716,  710,
+
+      719,  729,  717,  725,  712,  730,  731,  732,  733,  734,
+      728,  737,  735,  721,  738,  726,  727,  739,  720,  740,
+      741,  732,  733,  743,  742,  737,  729,  745,  744,  746,
+      731,  734,  738,  747,  750,  748,  730,  735,  749,  753,
+      758,  740,  742,  752,  764,  741,  744,  751,  754,  757,
+      761,  747,  762,  763,  739,  743,  746,  748,  750,  745,
+      749,  753,  751,  752,  764,  765,  754,  757,  761,  766,
+      767,  768,  769,  770,  772,  771,  758,  773,  774,  777,
+      778,  775,  779,  780,  762,  783,  782,  766,  784,  786,
+      787,  788,  790,  763,  773,  792,  772,  780,  770,  767,
+
+      791,  777,  768,  771,  782,  765,  774,  775,  793,  794,
+      769,  778,  787,  779,  790,  795,  783,  796,  788,  797,
+      792,  786,  798,  784,  799,  800,  803,  802,  791,  804,
+      811,  807,  805,  806,  808,  809,  810,  813,  820,  822,
+      825,  348,  352,  800,  358,  361,  812,  803,  793,  794,
+      806,  816,  818,  821,  811,  795,  804,  796,  807,  797,
+      802,  805,  798,  812,  799,  810,  808,  809,  824,  816,
+      826,  825,  818,  827,  821,  828,  822,  813,  820,  830,
+      831,  837,  824,  833,  834,  835,  836,  838,  842,  840,
+      845,  843,  844,  828,  826,  846,  847,  849,  831,  827,
+
+      833,  834,  850,  851,  836,  852,  830,  845,  853,  855,
+      835,  840,  837,  843,  856,  842,  854,  846,  850,  858,
+      859,  862,  861,  855,  847,  863,  849,  838,  851,  844,
+      864,  865,  866,  867,  868,  869,  852,  858,  861,  870,
+      872,  853,  871,  854,  874,  875,  856,  873,  864,  876,
+      866,  863,  877,  879,  880,  859,  865,  870,  862,  881,
+      882,  884,  872,  883,  885,  888,  868,  869,  874,  871,
+      867,  887,  873,  889,  875,  892,  897,  884,  882,  877,
+      894,  883,  896,  898,  899,  901,  879,  880,  902,  876,
+      903,  904,  888,  887,  892,  905,  885,  907,  894,  881,
+
+      898,  906,  908,  911,  909,  889,  902,  903,  910,  901,
+      912,  896,  914,  917,  897,  913,  915,  899,  909,  916,
+      911,  918,  919,  907,  904,  920,  921,  922,  906,  912,
+      905,  913,  923,  925,  915,  908,  916,  924,  926,  928,
+      910,  917,  929,  927,  930,  914,  931,  932,  933,  918,
+      919,  925,  934,  920,  921,  922,  926,  927,  930,  924,
+      929,  935,  936,  937,  938,  939,  933,  944,  931,  945,
+      934,  928,  923,  940,  946,  932,  947,  948,  935,  936,
+      938,  951,  949,  945,  953,  937,  954,  939,  955,  956,
+      958,  940,  957,  959,  960,  961,  964,  962,  966,  944,
+
+      968,  963,  953,  954,  971,  948,  955,  959,  965,  970,
+      956,  962,  969,  972,  946,  949,  947,  957,  958,  963,
+      973,  951,  960,  974,  975,  965,  968,  970,  976,  961,
+      978,  966,  980,  981,  983,  972,  964,  971,  982,  969,
+      984,  974,  985,  986,  990,  987,  991,  992,  994,  989,
+      996,  995,  973,  980,  976,  998,  982,  975, 1000,  997,
+     1001,  992,  984,  987,  991, 1002, 1004,  985,  996, 1005,
+      978, 1006,  986,  981,  983,  989,  995,  997, 1007, 1009,
+     1008,  994, 1010,  998,  990, 1011, 1012, 1014, 1013, 1000,
+     1015, 1004, 1017, 1001, 1008, 1021, 1007, 1023, 1024, 1011,
+
+     1025, 1026, 1005, 1027, 1009, 1002, 1013, 1006, 1028, 1029,
+     1030, 1043, 1015, 1010, 1031, 1032, 1033, 1017, 1025, 1034,
+     1035, 1027, 1036, 1038, 1021, 1028, 1012, 1014, 1039, 1026,
+     1023, 1040, 1030, 1041, 1024, 1042, 1043, 1044, 1045, 1046,
+     1029, 1047, 1038, 1031, 1032, 1033, 1048, 1040, 1034, 1035,
+     1049, 1036, 1051, 1052, 1053, 1059, 1042, 1044, 1054, 1039,
+     1060, 1061, 1063, 1065, 1041, 1062, 1045, 1066, 1049, 1069,
+     1046, 1048, 1068, 1070, 1047, 1072, 1071, 1073, 1074, 1051,
+     1061, 1052, 1075, 1062, 1054, 1078, 1053, 1059, 1076, 1077,
+     1082, 1080, 1079, 1060, 1066, 1084, 1063, 1069, 1071, 1065,
+
+     1085, 1070, 1068, 1078, 1073, 1077, 1075, 1079, 1088, 1089,
+     1090, 1074, 1072, 1080, 1076, 1091, 1092, 1093, 1096, 1094,
+     1095, 1082, 1084, 1097, 1099, 1100, 1088, 1098, 1089, 1101,
+     1102, 1091, 1103, 1085, 1092, 1106, 1096, 1097, 1105, 1107,
+     1109, 1090, 1108, 1111, 1110, 1101, 1093, 1094, 1095, 1098,
+     1113, 1114, 1105, 1117, 1100, 1115, 1118, 1102, 1119, 1120,
+     1106, 1109, 1110, 1121, 1099, 1111, 1122, 1123, 1124, 1128,
+     1103, 1107, 1115, 1108, 1125, 1126, 1114, 1127, 1129, 1130,
+     1136, 1117, 1113, 1135, 1119, 1143, 1137, 1120, 1118, 1144,
+     1138, 1139, 1140, 1126, 1145, 1127, 1129, 1141, 1122, 1142,
+
+     1124, 1123, 1128, 1121, 1137, 1135, 1125, 1130, 1138, 1139,
+     1140, 1144, 1136, 1143, 1146, 1141, 1145, 1142, 1147, 1148,
+     1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
+     1159, 1160, 1161, 1148, 1149, 1164, 1162, 1163, 1165, 1166,
+     1151, 1167, 1169, 1171, 1172, 1170, 1174, 1176, 1157, 1180,
+     1152, 1147, 1156, 1166, 1146, 1177, 1158, 1153, 1175, 1155,
+     1160, 1150, 1163, 1159, 1162, 1154, 1178, 1174, 1161, 1179,
+     1171, 1165, 1164, 1170, 1169, 1176, 1175, 1177, 1181, 1182,
+     1185, 1167, 1180, 1179, 1172, 1188, 1187, 1189, 1190, 1191,
+     1192, 1193, 1194, 1178, 1195, 1196, 1199, 1197, 1198, 1200,
+
+     1201, 1204, 1208, 1182, 1187, 1189, 1205, 1210, 1206, 1215,
+     1209, 1185, 1213, 1216, 1222, 1204, 1191, 1192, 1181, 1197,
+     1208, 1211, 1190, 1194, 1212, 1188, 1209, 1195, 1196, 1193,
+     1200, 1198, 1201, 1205, 1206, 1218, 1199, 1211, 1210, 1216,
+     1213, 1215, 1212, 1223, 1224, 1225, 1226, 1227, 1228, 1229,
+     1230, 1231, 1232, 1234, 1222, 1239, 1240, 1218, 1233, 1225,
+     1241, 1224, 1237, 1236, 1245, 1238, 1247, 1243, 1249, 1234,
+     1248, 1250, 1242, 1244, 1223, 1251, 1252, 1226, 1227, 1228,
+     1229, 1230, 1231, 1239, 1233, 1236, 1232, 1244, 1237, 1238,
+     1242, 1243, 1253, 1247, 1255, 1256, 1240, 1245, 1248, 1250,
+
+     1241, 1249, 1257, 1258, 1252, 1259, 1251, 1260, 1262, 1263,
+     1264, 1265, 1266, 1268, 1253, 1269, 1255, 1256, 1270, 1272,
+     1258, 1273, 1274, 1260, 1275, 1276, 1277, 1264, 1278, 1279,
+     1281, 1280, 1284, 1283, 1294, 1257, 1286, 1288, 1285, 1266,
+     1268, 1272, 1263, 1289, 1265, 1259, 1270, 1269, 1262, 1280,
+     1283, 1275, 1281, 1273, 1285, 1274, 1286, 1290, 1276, 1291,
+     1292, 1278, 1293, 1289, 1288, 1294, 1277, 1296, 1297, 1279,
+     1298, 1299, 1284, 1300, 1292, 1290, 1301, 1303, 1305, 1293,
+     1302, 1306, 1307, 1308, 1296, 1309, 1291, 1310, 1311, 1312,
+     1297, 1313, 1314, 1305, 1303, 1315, 1316, 1318, 1317, 1298,
+
+     1319, 1300, 1301, 1321, 1302, 1320, 1314, 1328, 1330, 1313,
+     1333, 1299, 1332, 1322, 1323, 1324, 1312, 1315, 1319, 1335,
+     1321, 1306, 1307, 1308, 1320, 1309, 1317, 1310, 1311, 1322,
+     1316, 1323, 1326, 1324, 1327, 1334, 1336, 1318, 1328, 1330,
+     1332, 1338, 1339, 1333, 1341, 1340, 1326, 1342, 1335, 1344,
+     1346, 1345, 1327, 1348, 1347, 1350, 1351, 1354, 1353, 1355,
+     1338, 1340, 1341, 1356, 1358, 1357, 1360, 1339, 1334, 1362,
+     1361, 1363, 1365, 1351, 1353, 1355, 1336, 1350, 1342, 1345,
+     1347, 1344, 1348, 1366, 1368, 1370, 1371, 1360, 1361, 1362,
+     1346, 1357, 1365, 1372, 1373, 1358, 1374, 1354, 1375, 1377,
+
+     1378, 1379, 1370, 1356, 1363, 1380, 1368, 1381, 1382, 1372,
+     1383, 1373, 1384, 1386, 1366, 1387, 1375, 1388, 1390, 1391,
+     1393, 1389, 1392, 1395, 1377, 1374, 1371, 1396, 1378, 1379,
+     1394, 1399, 1400, 1380, 1398, 1381, 1382, 1390, 1383, 1388,
+     1401, 1392, 1393, 1402, 1394, 1384, 1386, 1387, 1389, 1400,
+     1398, 1404, 1405, 1406, 1407, 1408, 1409, 1401, 1410, 1391,
+     1411, 1414, 1416, 1395, 1417, 1396, 1418, 1419, 1405, 1399,
+     1420, 1423, 1422, 1424, 1425, 1426, 1407, 1427, 1409, 1410,
+     1408, 1406, 1432, 1402, 1431, 1425, 1404, 1428, 1430, 1419,
+     1433, 1424, 1418, 1422, 1414, 1434, 1417, 1435, 1420, 1427,
+
+     1411, 1428, 1416, 1426, 1423, 1431, 1430, 1433, 1437, 1438,
+     1439, 1440, 1441, 1442, 1443, 1432, 1444, 1445, 1446, 1447,
+     1449, 1450, 1437, 1451, 1434, 1452, 1453, 1438, 1435, 1454,
+     1441, 1456, 1455, 1458, 1457, 1439, 1459, 1460, 1449, 1461,
+     1442, 1443, 1464, 1444, 1445, 1446, 1447, 1467, 1453, 1440,
+     1457, 1456, 1466, 1458, 1450, 1469, 1451, 1455, 1468, 1470,
+     1471, 1477, 1454, 1474, 1472, 1452, 1476, 1480, 1464, 1475,
+     1460, 1481, 1479, 1466, 1471, 1482, 1459, 1470, 1483, 1461,
+     1472, 1467, 1484, 1469, 1468, 1474, 1485, 1475, 1476, 1477,
+     1479, 1486, 1488, 1489, 1480, 1490, 1484, 1491, 1481, 1493,
+
+     1483, 1494, 1495, 1482, 1498, 1497, 1500, 1501, 1485, 1499,
+     1502, 1503, 1504, 1510, 1505, 1506, 1513, 1507, 1508, 1489,
+     1493, 1509, 1490, 1514, 1516, 1501, 1488, 1512, 1503, 1491,
+     1497, 1486, 1498, 1515, 1499, 1495, 1518, 1504, 1500, 1505,
+     1506, 1494, 1507, 1508, 1517, 1512, 1509, 1513, 1514, 1519,
+     1502, 1520, 1516, 1510, 1515, 1521, 1522, 1518, 1523, 1526,
+     1527, 1528, 1517, 1529, 1534, 1530, 1531, 1533, 1532, 1535,
+     1520, 1536, 1539, 1526, 1540, 1541, 1523, 1538, 1542, 1528,
+     1519, 1522, 1544, 1533, 1543, 1545, 1546, 1527, 1547, 1534,
+     1550, 1529, 1530, 1531, 1535, 1521, 1532, 1538, 1551, 1539,
+
+     1536, 1541, 1552, 1553, 1546, 1542, 1554, 1544, 1540, 1557,
+     1543, 1559, 1545, 1560, 1561, 1547, 1562, 1563, 1564, 1553,
+     1551, 1565, 1550, 1567, 1568, 1566, 1572, 1569, 1557, 1570,
+     1552, 1554, 1571, 1573, 1577, 1575, 1579, 1574, 1578, 1582,
+     1565, 1567, 1568, 1570, 1572, 1576, 1583,  363, 1584, 1559,
+     1575, 1560, 1561, 1581, 1562, 1563, 1564, 1566, 1569, 1574,
+     1585, 1573, 1586, 1576, 1571, 1578, 1577, 1587, 1588, 1579,
+     1581, 1590, 1582, 1583, 1584, 1591, 1586, 1592, 1585, 1593,
+     1594, 1595, 1596, 1598, 1600, 1587, 1588, 1599, 1613, 1590,
+     1601, 1604, 1603, 1602, 1611, 1592, 1615, 1617, 1594, 1618,
+
+     1616, 1598, 1591, 1595, 1619, 1601, 1593, 1602, 1620, 1599,
+     1603, 1621, 1600, 1604, 1615, 1596, 1611, 1616, 1613, 1622,
+     1623, 1624, 1626, 1627, 1628, 1629, 1631, 1633, 1634, 1637,
+     1617, 1639, 1635, 1620, 1641, 1642, 1621, 1649, 1619, 1618,
+     1643, 1624, 1628, 1645, 1634, 1646, 1622, 1637, 1647, 1644,
+     1652, 1629, 1623, 1653, 1654, 1627, 1650, 1639, 1633, 1641,
+     1655, 1642, 1626, 1644, 1631, 1635, 1656, 1643, 1645, 1657,
+     1650, 1649, 1658, 1647, 1659, 1662, 1646, 1663, 1655, 1665,
+     1666, 1668, 1669, 1654, 1673, 1653, 1658, 1671, 1675, 1657,
+     1652, 1663, 1659, 1681, 1656, 1679, 1676, 1677, 1678, 1682,
+
+     1662, 1683, 1680, 1686, 1669, 1687, 1668, 1681, 1685, 1673,
+     1675, 1665, 1689, 1666, 1676, 1677, 1671, 1679, 1678, 1680,
+     1690, 1682, 1691, 1692, 1685, 1687, 1696, 1697, 1699, 1702,
+     1703, 1704, 1705, 1683, 1706, 1709, 1686, 1710, 1708, 1712,
+     1689, 1711, 1690, 1714, 1725, 1699, 1716, 1702, 1718, 1719,
+     1692, 1721, 1697, 1726, 1691, 1710, 1709, 1705, 1722, 1696,
+     1714, 1703, 1708, 1704, 1716, 1712, 1728, 1719, 1727, 1732,
+     1730, 1721, 1731, 1706, 1734, 1711, 1722, 1735, 1738, 1718,
+     1726, 1740, 1741, 1743, 1725, 1745, 1727, 1746, 1747, 1731,
+     1748, 1744, 1749, 1753, 1750,  381,  393, 1732, 1728, 1730,
+
+      400,  418,  421,  424, 1741, 1743,  426, 1734, 1748, 1738,
+     1735, 1745, 1740, 1744, 1746, 1750,  432,  434,  439, 1753,
+      448, 1747,  451,  459,  504, 1749,  513,  520,  522,  523,
+      547,  548,  551,  555,  566,  580,  599,  605,  606,  617,
+      624,  642,  644,  647,  658,  662,  677,  681,  686,  701,
+      703,  704,  723,  724,  755,  756,  759,  760,  776,  781,
+      785,  789,  801,  814,  815,  817,  819,  829,  832,  848,
+      857,  860,  878,  886,  891,  893,  895,  900,  950,  952,
+      967,  977,  988,  993, 1003, 1016, 1018, 1019, 1020, 1022,
+     1050, 1064, 1067, 1081, 1083, 1086, 1087, 1104, 1112, 1116,
+
+     1131, 1132, 1133, 1134, 1168, 1173, 1183, 1184, 1202, 1203,
+     1207, 1217, 1219, 1220, 1221, 1246, 1254, 1261, 1267, 1271,
+     1282, 1287, 1295, 1304, 1325, 1329, 1331, 1343, 1349, 1352,
+     1364, 1367, 1369, 1376, 1385, 1397, 1403, 1413, 1429, 1448,
+     1462, 1463, 1473, 1478, 1487, 1492, 1496, 1511, 1524, 1525,
+     1537, 1548, 1549, 1555, 1556, 1558, 1580, 1589, 1597, 1605,
+     1606, 1607, 1608, 1609, 1610, 1612, 1614, 1625, 1630, 1632,
+     1636, 1638, 1640, 1651, 1661, 1664, 1667, 1670, 1672, 1674,
+     1684, 1688, 1693, 1694, 1695, 1698, 1700, 1701, 1707, 1713,
+     1715, 1717, 1720, 1723, 1724, 1729, 1733, 1736, 1737, 1739,
+
+     1742, 1751, 1752, 1754,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1750,8 +2001,8 @@ conf_yy_fatal_error(const char *msg)
   return 0;
 }
 
-#line 1754 "conf_lexer.c"
-#line 1755 "conf_lexer.c"
+#line 2005 "conf_lexer.c"
+#line 2006 "conf_lexer.c"
 
 #define INITIAL 0
 
@@ -1968,7 +2219,7 @@ YY_DECL
 	{
 #line 85 "conf_lexer.l"
 
-#line 1972 "conf_lexer.c"
+#line 2223 "conf_lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2001,13 +2252,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1623 )
+				if ( yy_current_state >= 1756 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1622 );
+		while ( yy_current_state != 1755 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2146,1208 +2397,1273 @@ YY_RULE_SETUP
 case 16:
 YY_RULE_SETUP
 #line 141 "conf_lexer.l"
-{ return AUTOCONN; }
+{ return AUTH_TIMEOUT; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 142 "conf_lexer.l"
-{ return AWAY_COUNT; }
+{ return AUTOCONN; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 143 "conf_lexer.l"
-{ return AWAY_TIME; }
+{ return AWAY_COUNT; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 144 "conf_lexer.l"
-{ return T_BIND; }
+{ return AWAY_TIME; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 145 "conf_lexer.l"
-{ return BOT; }
+{ return T_BIND; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 146 "conf_lexer.l"
-{ return CALLER_ID_WAIT; }
+{ return BOT; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 147 "conf_lexer.l"
-{ return T_CALLERID; }
+{ return CALLER_ID_WAIT; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 148 "conf_lexer.l"
-{ return CAN_FLOOD; }
+{ return T_CALLERID; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 149 "conf_lexer.l"
-{ return T_CCONN; }
+{ return CAN_FLOOD; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 150 "conf_lexer.l"
-{ return CHANNEL; }
+{ return T_CCONN; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 151 "conf_lexer.l"
-{ return CIDR_BITLEN_IPV4; }
+{ return CHANNEL; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 152 "conf_lexer.l"
-{ return CIDR_BITLEN_IPV6; }
+{ return CIDR_BITLEN_IPV4; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 153 "conf_lexer.l"
-{ return CLASS; }
+{ return CIDR_BITLEN_IPV6; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 154 "conf_lexer.l"
-{ return CLIENT; }
+{ return CLASS; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 155 "conf_lexer.l"
-{ return CLOSE; }
+{ return CLIENT; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 156 "conf_lexer.l"
-{ return T_CLUSTER; }
+{ return CLOSE; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 157 "conf_lexer.l"
-{ return T_COMMAND; }
+{ return T_CLUSTER; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 158 "conf_lexer.l"
-{ return CONNECT; }
+{ return T_COMMAND; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 159 "conf_lexer.l"
-{ return CONNECTFREQ; }
+{ return T_COMPRESSED; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 160 "conf_lexer.l"
-{ return CYCLE_ON_HOST_CHANGE; }
+{ return CONNECT; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 161 "conf_lexer.l"
-{ return T_DEAF; }
+{ return CONNECTFREQ; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 162 "conf_lexer.l"
-{ return T_DEBUG; }
+{ return CYCLE_ON_HOST_CHANGE; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 163 "conf_lexer.l"
-{ return DEFAULT_FLOODCOUNT; }
+{ return T_DEAF; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 164 "conf_lexer.l"
-{ return DEFAULT_FLOODTIME; }
+{ return T_DEBUG; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 165 "conf_lexer.l"
-{ return DEFAULT_JOIN_FLOOD_COUNT; }
+{ return DEFAULT_FLOODCOUNT; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 166 "conf_lexer.l"
-{ return DEFAULT_JOIN_FLOOD_TIME; }
+{ return DEFAULT_FLOODTIME; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 167 "conf_lexer.l"
-{ return DEFAULT_MAX_CLIENTS; }
+{ return DEFAULT_JOIN_FLOOD_COUNT; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 168 "conf_lexer.l"
-{ return DEFER; }
+{ return DEFAULT_JOIN_FLOOD_TIME; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 169 "conf_lexer.l"
-{ return DENY; }
+{ return DEFAULT_MAX_CLIENTS; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 170 "conf_lexer.l"
-{ return DESCRIPTION; }
+{ return DEFER; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 171 "conf_lexer.l"
-{ return DIE; }
+{ return DENY; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 172 "conf_lexer.l"
-{ return DISABLE_AUTH; }
+{ return DESCRIPTION; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 173 "conf_lexer.l"
-{ return DISABLE_FAKE_CHANNELS; }
+{ return DIE; }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 174 "conf_lexer.l"
-{ return DISABLE_REMOTE_COMMANDS; }
+{ return DISABLE_AUTH; }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 175 "conf_lexer.l"
-{ return T_DLINE; }
+{ return DISABLE_FAKE_CHANNELS; }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 176 "conf_lexer.l"
-{ return DLINE_MIN_CIDR; }
+{ return DISABLE_REMOTE_COMMANDS; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 177 "conf_lexer.l"
-{ return DLINE_MIN_CIDR6; }
+{ return T_DLINE; }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 178 "conf_lexer.l"
-{ return DOTS_IN_IDENT; }
+{ return DLINE_MIN_CIDR; }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 179 "conf_lexer.l"
-{ return EMAIL; }
+{ return DLINE_MIN_CIDR6; }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 180 "conf_lexer.l"
-{ return ENABLE_EXTBANS; }
+{ return DOTS_IN_IDENT; }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 181 "conf_lexer.l"
-{ return ENCRYPTED; }
+{ return EMAIL; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 182 "conf_lexer.l"
-{ return EXCEED_LIMIT; }
+{ return ENABLE_EXTBANS; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 183 "conf_lexer.l"
-{ return EXEMPT; }
+{ return ENCRYPTED; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 184 "conf_lexer.l"
-{ return EXPIRATION; }
+{ return EXCEED_LIMIT; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 185 "conf_lexer.l"
-{ return T_EXTERNAL; }
+{ return EXEMPT; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 186 "conf_lexer.l"
-{ return FAILED_OPER_NOTICE; }
+{ return EXPIRATION; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 187 "conf_lexer.l"
-{ return T_FARCONNECT; }
+{ return T_EXTERNAL; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 188 "conf_lexer.l"
-{ return T_FILE; }
+{ return FAILED_OPER_NOTICE; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 189 "conf_lexer.l"
-{ return IRCD_FLAGS; }
+{ return T_FARCONNECT; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 190 "conf_lexer.l"
-{ return FLATTEN_LINKS; }
+{ return T_FILE; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 191 "conf_lexer.l"
-{ return FLATTEN_LINKS_DELAY; }
+{ return IRCD_FLAGS; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 192 "conf_lexer.l"
-{ return FLATTEN_LINKS_FILE; }
+{ return FLATTEN_LINKS; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 193 "conf_lexer.l"
-{ return T_FLOOD; }
+{ return FLATTEN_LINKS_DELAY; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 194 "conf_lexer.l"
-{ return GECOS; }
+{ return FLATTEN_LINKS_FILE; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 195 "conf_lexer.l"
-{ return GENERAL; }
+{ return T_FLOOD; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 196 "conf_lexer.l"
-{ return KLINE_MIN_CIDR; }
+{ return FLOOD_BURST; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 197 "conf_lexer.l"
-{ return KLINE_MIN_CIDR6; }
+{ return FLOOD_RATE; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 198 "conf_lexer.l"
-{ return T_GLOBOPS; }
+{ return GECOS; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 199 "conf_lexer.l"
-{ return NEED_IDENT; }
+{ return GENERAL; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 200 "conf_lexer.l"
-{ return HIDDEN; }
+{ return KLINE_MIN_CIDR; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 201 "conf_lexer.l"
-{ return HIDDEN_NAME; }
+{ return KLINE_MIN_CIDR6; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 202 "conf_lexer.l"
-{ return HIDE_CHANS; }
+{ return T_GLOBOPS; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 203 "conf_lexer.l"
-{ return HIDE_IDLE; }
+{ return NEED_IDENT; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 204 "conf_lexer.l"
-{ return HIDE_IDLE_FROM_OPERS; }
+{ return HIDDEN; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 205 "conf_lexer.l"
-{ return HIDE_SERVER_IPS; }
+{ return HIDDEN_NAME; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 206 "conf_lexer.l"
-{ return HIDE_SERVERS; }
+{ return HIDE_CHANS; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 207 "conf_lexer.l"
-{ return HIDE_SERVICES; }
+{ return HIDE_IDLE; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 208 "conf_lexer.l"
-{ return HOST; }
+{ return HIDE_IDLE_FROM_OPERS; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 209 "conf_lexer.l"
-{ return HUB; }
+{ return HIDE_SERVER_IPS; }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 210 "conf_lexer.l"
-{ return HUB_MASK; }
+{ return HIDE_SERVERS; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 211 "conf_lexer.l"
-{ return T_INVISIBLE; }
+{ return HIDE_SERVICES; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 212 "conf_lexer.l"
-{ return INVISIBLE_ON_CONNECT; }
+{ return HOST; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 213 "conf_lexer.l"
-{ return INVITE_CLIENT_COUNT; }
+{ return HUB; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 214 "conf_lexer.l"
-{ return INVITE_CLIENT_TIME; }
+{ return HUB_MASK; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 215 "conf_lexer.l"
-{ return INVITE_DELAY_CHANNEL; }
+{ return IDENT_CACHE_TIME; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 216 "conf_lexer.l"
-{ return INVITE_EXPIRE_TIME; }
+{ return IDENT_MAX_PENDING; }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 217 "conf_lexer.l"
-{ return IP; }
+{ return IDENT_TIMEOUT; }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 218 "conf_lexer.l"
-{ return T_IPV4; }
+{ return T_INVISIBLE; }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 219 "conf_lexer.l"
-{ return T_IPV6; }
+{ return INVISIBLE_ON_CONNECT; }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 220 "conf_lexer.l"
-{ return JOIN; }
+{ return INVITE_CLIENT_COUNT; }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 221 "conf_lexer.l"
-{ return KILL; }
+{ return INVITE_CLIENT_TIME; }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 222 "conf_lexer.l"
-{ return KILL_CHASE_TIME_LIMIT; }
+{ return INVITE_DELAY_CHANNEL; }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 223 "conf_lexer.l"
-{ return KLINE; }
+{ return INVITE_EXPIRE_TIME; }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 224 "conf_lexer.l"
-{ return KLINE_EXEMPT; }
+{ return IP; }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 225 "conf_lexer.l"
-{ return KNOCK_CLIENT_COUNT; }
+{ return T_IPV4; }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 226 "conf_lexer.l"
-{ return KNOCK_CLIENT_TIME; }
+{ return T_IPV6; }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 227 "conf_lexer.l"
-{ return KNOCK_DELAY_CHANNEL; }
+{ return JOIN; }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 228 "conf_lexer.l"
-{ return LEAF_MASK; }
+{ return KILL; }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 229 "conf_lexer.l"
-{ return LISTEN; }
+{ return KILL_CHASE_TIME_LIMIT; }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 230 "conf_lexer.l"
-{ return T_LOCOPS; }
+{ return KLINE; }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 231 "conf_lexer.l"
-{ return T_LOG; }
+{ return KLINE_EXEMPT; }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 232 "conf_lexer.l"
-{ return MASK; }
+{ return KNOCK_CLIENT_COUNT; }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 233 "conf_lexer.l"
-{ return MAX_ACCEPT; }
+{ return KNOCK_CLIENT_TIME; }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 234 "conf_lexer.l"
-{ return MAX_BANS; }
+{ return KNOCK_DELAY_CHANNEL; }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 235 "conf_lexer.l"
-{ return MAX_BANS_LARGE; }
+{ return LEAF_MASK; }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 236 "conf_lexer.l"
-{ return MAX_CHANNELS; }
+{ return LISTEN; }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 237 "conf_lexer.l"
-{ return MAX_IDLE; }
+{ return T_LOCOPS; }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 238 "conf_lexer.l"
-{ return MAX_INVITES; }
+{ return T_LOG; }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 239 "conf_lexer.l"
-{ return MAX_MONITOR; }
+{ return MASK; }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 240 "conf_lexer.l"
-{ return MAX_NICK_CHANGES; }
+{ return MAX_ACCEPT; }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 241 "conf_lexer.l"
-{ return MAX_NICK_LENGTH; }
+{ return MAX_BANS; }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 242 "conf_lexer.l"
-{ return MAX_NICK_TIME; }
+{ return MAX_BANS_LARGE; }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 243 "conf_lexer.l"
-{ return MAX_NUMBER; }
+{ return MAX_CHANNELS; }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 244 "conf_lexer.l"
-{ return MAX_TARGETS; }
+{ return MAX_IDLE; }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 245 "conf_lexer.l"
-{ return MAX_TOPIC_LENGTH; }
+{ return MAX_INVITES; }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 246 "conf_lexer.l"
-{ return MIN_IDLE; }
+{ return MAX_MONITOR; }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 247 "conf_lexer.l"
-{ return MIN_NONWILDCARD; }
+{ return MAX_NICK_CHANGES; }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 248 "conf_lexer.l"
-{ return MIN_NONWILDCARD_SIMPLE; }
+{ return MAX_NICK_LENGTH; }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 249 "conf_lexer.l"
-{ return MODULE; }
+{ return MAX_NICK_TIME; }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 250 "conf_lexer.l"
-{ return MODULES; }
+{ return MAX_NUMBER; }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 251 "conf_lexer.l"
-{ return MOTD; }
+{ return MAX_TARGETS; }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 252 "conf_lexer.l"
-{ return NAME; }
+{ return MAX_TOPIC_LENGTH; }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 253 "conf_lexer.l"
-{ return T_NCHANGE; }
+{ return T_METRICS; }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 254 "conf_lexer.l"
-{ return NEED_IDENT; }
+{ return MIN_IDLE; }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 255 "conf_lexer.l"
-{ return NEED_PASSWORD; }
+{ return MIN_NONWILDCARD; }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 256 "conf_lexer.l"
-{ return NETWORK_DESCRIPTION; }
+{ return MIN_NONWILDCARD_SIMPLE; }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 257 "conf_lexer.l"
-{ return NETWORK_NAME; }
+{ return MODULE; }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 258 "conf_lexer.l"
-{ return NICK; }
+{ return MODULES; }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 259 "conf_lexer.l"
-{ return NO_OPER_FLOOD; }
+{ return MOTD; }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 260 "conf_lexer.l"
-{ return NO_TILDE; }
+{ return NAME; }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 261 "conf_lexer.l"
-{ return T_NONONREG; }
+{ return T_NCHANGE; }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 262 "conf_lexer.l"
-{ return NUMBER_PER_CIDR; }
+{ return NEED_IDENT; }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 263 "conf_lexer.l"
-{ return NUMBER_PER_IP_GLOBAL; }
+{ return NEED_PASSWORD; }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 264 "conf_lexer.l"
-{ return NUMBER_PER_IP_LOCAL; }
+{ return NETWORK_DESCRIPTION; }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 265 "conf_lexer.l"
-{ return OPERATOR; }
+{ return NETWORK_NAME; }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 266 "conf_lexer.l"
-{ return OPER_ONLY_UMODES; }
+{ return NICK; }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 267 "conf_lexer.l"
-{ return OPER_UMODES; }
+{ return NO_OPER_FLOOD; }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 268 "conf_lexer.l"
-{ return OPERATOR; }
+{ return NO_TILDE; }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 269 "conf_lexer.l"
-{ return OPERS_BYPASS_CALLERID; }
+{ return T_NONONREG; }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 270 "conf_lexer.l"
-{ return T_OPME; }
+{ return NUMBER_PER_CIDR; }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 271 "conf_lexer.l"
-{ return PACE_WAIT; }
+{ return NUMBER_PER_IP_GLOBAL; }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 272 "conf_lexer.l"
-{ return PACE_WAIT_SIMPLE; }
+{ return NUMBER_PER_IP_LOCAL; }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 273 "conf_lexer.l"
-{ return PASSWORD; }
+{ return OPERATOR; }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 274 "conf_lexer.l"
-{ return PATH; }
+{ return OPER_ONLY_UMODES; }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 275 "conf_lexer.l"
-{ return PING_COOKIE; }
+{ return OPER_UMODES; }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 276 "conf_lexer.l"
-{ return PING_TIME; }
+{ return OPERATOR; }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 277 "conf_lexer.l"
-{ return PORT; }
+{ return OPERS_BYPASS_CALLERID; }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 278 "conf_lexer.l"
-{ return T_PREPEND; }
+{ return T_OPME; }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 279 "conf_lexer.l"
-{ return T_PSEUDO; }
+{ return PACE_WAIT; }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 280 "conf_lexer.l"
-{ return RANDOM_IDLE; }
+{ return PACE_WAIT_SIMPLE; }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 281 "conf_lexer.l"
-{ return REASON; }
+{ return PASSWORD; }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 282 "conf_lexer.l"
-{ return T_RECVQ; }
+{ return PATH; }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 283 "conf_lexer.l"
-{ return REDIRPORT; }
+{ return PING_COOKIE; }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 284 "conf_lexer.l"
-{ return REDIRSERV; }
+{ return PING_TIME; }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 285 "conf_lexer.l"
-{ return REHASH; }
+{ return PORT; }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 286 "conf_lexer.l"
-{ return T_REJ; }
+{ return T_PREPEND; }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 287 "conf_lexer.l"
-{ return REMOTE; }
+{ return T_PSEUDO; }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 288 "conf_lexer.l"
-{ return REMOTEBAN; }
+{ return RANDOM_IDLE; }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 289 "conf_lexer.l"
-{ return T_RESTART; }
+{ return REASON; }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 290 "conf_lexer.l"
-{ return RESV; }
+{ return T_RECVQ; }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 291 "conf_lexer.l"
-{ return RESV_EXEMPT; }
+{ return REDIRPORT; }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 292 "conf_lexer.l"
-{ return RSA_PRIVATE_KEY_FILE; }
+{ return REDIRSERV; }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 293 "conf_lexer.l"
-{ return SEND_PASSWORD; }
+{ return REHASH; }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 294 "conf_lexer.l"
-{ return SENDQ; }
+{ return T_REJ; }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 295 "conf_lexer.l"
-{ return T_SERVER; }
+{ return REMOTE; }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 296 "conf_lexer.l"
-{ return SERVERHIDE; }
+{ return REMOTEBAN; }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 297 "conf_lexer.l"
-{ return SERVERINFO; }
+{ return T_RESTART; }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 298 "conf_lexer.l"
-{ return T_SERVICE; }
+{ return RESV; }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 299 "conf_lexer.l"
-{ return T_SERVNOTICE; }
+{ return RESV_EXEMPT; }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 300 "conf_lexer.l"
-{ return T_SET; }
+{ return REUSEPORT; }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 301 "conf_lexer.l"
-{ return T_SHARED; }
+{ return RSA_PRIVATE_KEY_FILE; }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 302 "conf_lexer.l"
-{ return SHORT_MOTD; }
+{ return SEND_PASSWORD; }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 303 "conf_lexer.l"
-{ return IRCD_SID; }
+{ return SENDQ; }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 304 "conf_lexer.l"
-{ return T_SIZE; }
+{ return T_SERVER; }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 305 "conf_lexer.l"
-{ return T_SKILL; }
+{ return SERVERHIDE; }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 306 "conf_lexer.l"
-{ return T_SOFTCALLERID; }
+{ return SERVERINFO; }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 307 "conf_lexer.l"
-{ return SPOOF; }
+{ return T_SERVICE; }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 308 "conf_lexer.l"
-{ return T_SPY; }
+{ return T_SERVNOTICE; }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 309 "conf_lexer.l"
-{ return SQUIT; }
+{ return T_SET; }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 310 "conf_lexer.l"
-{ return T_TLS; }
+{ return T_SHARED; }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 311 "conf_lexer.l"
-{ return STATS_E_DISABLED; }
+{ return SHORT_MOTD; }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 312 "conf_lexer.l"
-{ return STATS_I_OPER_ONLY; }
+{ return IRCD_SID; }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 313 "conf_lexer.l"
-{ return STATS_K_OPER_ONLY; }
+{ return T_SIZE; }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 314 "conf_lexer.l"
-{ return STATS_M_OPER_ONLY; }
+{ return T_SKILL; }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 315 "conf_lexer.l"
-{ return STATS_O_OPER_ONLY; }
+{ return T_SOFTCALLERID; }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 316 "conf_lexer.l"
-{ return STATS_P_OPER_ONLY; }
+{ return SPOOF; }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 317 "conf_lexer.l"
-{ return STATS_U_OPER_ONLY; }
+{ return T_SPY; }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 318 "conf_lexer.l"
-{ return T_TARGET; }
+{ return SQUIT; }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 319 "conf_lexer.l"
-{ return THROTTLE_COUNT; }
+{ return T_TLS; }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 320 "conf_lexer.l"
-{ return THROTTLE_TIME; }
+{ return STATS_E_DISABLED; }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 321 "conf_lexer.l"
-{ return TIMEOUT; }
+{ return STATS_I_OPER_ONLY; }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 322 "conf_lexer.l"
-{ return T_TLS; }
+{ return STATS_K_OPER_ONLY; }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 323 "conf_lexer.l"
-{ return TLS_CERTIFICATE_FILE; }
+{ return STATS_M_OPER_ONLY; }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 324 "conf_lexer.l"
-{ return TLS_CERTIFICATE_FINGERPRINT; }
+{ return STATS_O_OPER_ONLY; }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 325 "conf_lexer.l"
-{ return TLS_CIPHER_LIST; }
+{ return STATS_P_OPER_ONLY; }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 326 "conf_lexer.l"
-{ return TLS_CIPHER_SUITES; }
+{ return STATS_U_OPER_ONLY; }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 327 "conf_lexer.l"
-{ return TLS_CONNECTION_REQUIRED; }
+{ return T_TARGET; }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 328 "conf_lexer.l"
-{ return TLS_DH_PARAM_FILE; }
+{ return THROTTLE_COUNT; }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 329 "conf_lexer.l"
-{ return TLS_MESSAGE_DIGEST_ALGORITHM; }
+{ return THROTTLE_TIME; }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 330 "conf_lexer.l"
-{ return TLS_SUPPORTED_GROUPS; }
+{ return TIMEOUT; }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 331 "conf_lexer.l"
-{ return TS_MAX_DELTA; }
+{ return T_TLS; }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 332 "conf_lexer.l"
-{ return TS_WARN_DELTA; }
+{ return TLS_CERTIFICATE_FILE; }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 333 "conf_lexer.l"
-{ return TYPE; }
+{ return TLS_CERTIFICATE_FINGERPRINT; }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 334 "conf_lexer.l"
-{ return T_UMODES; }
+{ return TLS_CIPHER_LIST; }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 335 "conf_lexer.l"
-{ return T_UNDLINE; }
+{ return TLS_CIPHER_SUITES; }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 336 "conf_lexer.l"
-{ return UNKLINE; }
+{ return TLS_CONNECTION_REQUIRED; }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 337 "conf_lexer.l"
-{ return T_UNLIMITED; }
+{ return TLS_DH_PARAM_FILE; }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 338 "conf_lexer.l"
-{ return T_UNRESV; }
+{ return TLS_HANDSHAKE_THREADS; }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 339 "conf_lexer.l"
-{ return T_UNXLINE; }
+{ return TLS_KERNEL_OFFLOAD; }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 340 "conf_lexer.l"
-{ return USE_LOGGING; }
+{ return TLS_MESSAGE_DIGEST_ALGORITHM; }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 341 "conf_lexer.l"
-{ return USER; }
+{ return TLS_SESSION_CACHE_SIZE; }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 342 "conf_lexer.l"
-{ return T_WALLOP; }
+{ return TLS_SUPPORTED_GROUPS; }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 343 "conf_lexer.l"
-{ return T_WALLOPS; }
+{ return TLS_TICKET_KEY_FILE; }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 344 "conf_lexer.l"
-{ return WARN_NO_CONNECT_BLOCK; }
+{ return TS_MAX_DELTA; }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 345 "conf_lexer.l"
-{ return T_WEBIRC; }
+{ return TS_WARN_DELTA; }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 346 "conf_lexer.l"
-{ return WHOIS; }
+{ return TYPE; }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 347 "conf_lexer.l"
-{ return WHOWAS_HISTORY_LENGTH; }
+{ return T_UMODES; }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 348 "conf_lexer.l"
-{ return XLINE; }
+{ return T_UNDLINE; }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 349 "conf_lexer.l"
-{ return XLINE_EXEMPT; }
+{ return UNKLINE; }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
-#line 351 "conf_lexer.l"
-{ yylval.number = 1; return TBOOL; }
+#line 350 "conf_lexer.l"
+{ return T_UNLIMITED; }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 352 "conf_lexer.l"
-{ yylval.number = 0; return TBOOL; }
+#line 351 "conf_lexer.l"
+{ return T_UNRESV; }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
-#line 354 "conf_lexer.l"
-{ return YEARS; }
+#line 352 "conf_lexer.l"
+{ return T_UNXLINE; }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
-#line 355 "conf_lexer.l"
-{ return YEARS; }
+#line 353 "conf_lexer.l"
+{ return USE_LOGGING; }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
-#line 356 "conf_lexer.l"
-{ return MONTHS; }
+#line 354 "conf_lexer.l"
+{ return USER; }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
-#line 357 "conf_lexer.l"
-{ return MONTHS; }
+#line 355 "conf_lexer.l"
+{ return T_WALLOP; }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
-#line 358 "conf_lexer.l"
-{ return WEEKS; }
+#line 356 "conf_lexer.l"
+{ return T_WALLOPS; }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
-#line 359 "conf_lexer.l"
-{ return WEEKS; }
+#line 357 "conf_lexer.l"
+{ return WARN_NO_CONNECT_BLOCK; }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
-#line 360 "conf_lexer.l"
-{ return DAYS; }
+#line 358 "conf_lexer.l"
+{ return T_WEBIRC; }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
-#line 361 "conf_lexer.l"
-{ return DAYS; }
+#line 359 "conf_lexer.l"
+{ return WHOIS; }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
-#line 362 "conf_lexer.l"
-{ return HOURS; }
+#line 360 "conf_lexer.l"
+{ return WHOWAS_HISTORY_LENGTH; }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
-#line 363 "conf_lexer.l"
-{ return HOURS; }
+#line 361 "conf_lexer.l"
+{ return XLINE; }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
-#line 364 "conf_lexer.l"
-{ return MINUTES; }
+#line 362 "conf_lexer.l"
+{ return XLINE_EXEMPT; }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
-#line 365 "conf_lexer.l"
-{ return MINUTES; }
+#line 364 "conf_lexer.l"
+{ yylval.number = 1; return TBOOL; }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
-#line 366 "conf_lexer.l"
-{ return SECONDS; }
+#line 365 "conf_lexer.l"
+{ yylval.number = 0; return TBOOL; }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 367 "conf_lexer.l"
-{ return SECONDS; }
+{ return YEARS; }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
-#line 369 "conf_lexer.l"
-{ return BYTES; }
+#line 368 "conf_lexer.l"
+{ return YEARS; }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
-#line 370 "conf_lexer.l"
-{ return BYTES; }
+#line 369 "conf_lexer.l"
+{ return MONTHS; }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
-#line 371 "conf_lexer.l"
-{ return KBYTES; }
+#line 370 "conf_lexer.l"
+{ return MONTHS; }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
-#line 372 "conf_lexer.l"
-{ return KBYTES; }
+#line 371 "conf_lexer.l"
+{ return WEEKS; }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
-#line 373 "conf_lexer.l"
-{ return KBYTES; }
+#line 372 "conf_lexer.l"
+{ return WEEKS; }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
-#line 374 "conf_lexer.l"
-{ return KBYTES; }
+#line 373 "conf_lexer.l"
+{ return DAYS; }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
-#line 375 "conf_lexer.l"
-{ return KBYTES; }
+#line 374 "conf_lexer.l"
+{ return DAYS; }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
-#line 376 "conf_lexer.l"
-{ return MBYTES; }
+#line 375 "conf_lexer.l"
+{ return HOURS; }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
-#line 377 "conf_lexer.l"
-{ return MBYTES; }
+#line 376 "conf_lexer.l"
+{ return HOURS; }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
-#line 378 "conf_lexer.l"
-{ return MBYTES; }
+#line 377 "conf_lexer.l"
+{ return MINUTES; }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
-#line 379 "conf_lexer.l"
-{ return MBYTES; }
+#line 378 "conf_lexer.l"
+{ return MINUTES; }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
-#line 380 "conf_lexer.l"
-{ return MBYTES; }
+#line 379 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
-#line 381 "conf_lexer.l"
-{ return TWODOTS; }
+#line 380 "conf_lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
+#line 382 "conf_lexer.l"
+{ return BYTES; }
+	YY_BREAK
+case 255:
+YY_RULE_SETUP
 #line 383 "conf_lexer.l"
+{ return BYTES; }
+	YY_BREAK
+case 256:
+YY_RULE_SETUP
+#line 384 "conf_lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 257:
+YY_RULE_SETUP
+#line 385 "conf_lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 258:
+YY_RULE_SETUP
+#line 386 "conf_lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 259:
+YY_RULE_SETUP
+#line 387 "conf_lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 260:
+YY_RULE_SETUP
+#line 388 "conf_lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 261:
+YY_RULE_SETUP
+#line 389 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 262:
+YY_RULE_SETUP
+#line 390 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 263:
+YY_RULE_SETUP
+#line 391 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 264:
+YY_RULE_SETUP
+#line 392 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 265:
+YY_RULE_SETUP
+#line 393 "conf_lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 266:
+YY_RULE_SETUP
+#line 394 "conf_lexer.l"
+{ return TWODOTS; }
+	YY_BREAK
+case 267:
+YY_RULE_SETUP
+#line 396 "conf_lexer.l"
 { return yytext[0]; }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 384 "conf_lexer.l"
+#line 397 "conf_lexer.l"
 { if (ieof() == true) yyterminate(); }
 	YY_BREAK
-case 255:
+case 268:
 YY_RULE_SETUP
-#line 386 "conf_lexer.l"
+#line 399 "conf_lexer.l"
 ECHO;
 	YY_BREAK
-#line 3351 "conf_lexer.c"
+#line 3667 "conf_lexer.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3643,7 +3959,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1623 )
+			if ( yy_current_state >= 1756 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3671,11 +3987,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1623 )
+		if ( yy_current_state >= 1756 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1622);
+	yy_is_jam = (yy_current_state == 1755);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4314,8 +4630,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 386 "conf_lexer.l"
-
+#line 399 "conf_lexer.l"
 
 /* C-comment ignoring routine -kre*/
 static void
@@ -4431,4 +4746,3 @@ ieof(void)
   strlcpy(conffilebuf, file->conffile, sizeof(conffilebuf));
   return false;
 }
-
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -144,6 +145,8 @@ static struct
     max_total,
     max_sendq,
     max_recvq,
+    flood_burst,
+    flood_rate,
     max_channels,
     cidr_bitlen_ipv4,
     cidr_bitlen_ipv6,
@@ -171,7 +174,7 @@ reset_block_state(void)
 }
 
 
-#line 175 "conf_parser.c"
+#line 178 "conf_parser.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -194,14 +197,6 @@ reset_block_state(void)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
 /* Use api.header.include to #include this header
    instead of duplicating it here.  */
 #ifndef YY_YY_CONF_PARSER_H_INCLUDED
@@ -214,483 +209,518 @@ reset_block_state(void)
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ACCEPT_PASSWORD = 258,
-    ADMIN = 259,
-    AFTYPE = 260,
-    ANTI_NICK_FLOOD = 261,
-    ANTI_SPAM_EXIT_MESSAGE_TIME = 262,
-    AUTOCONN = 263,
-    AWAY_COUNT = 264,
-    AWAY_TIME = 265,
-    BOT = 266,
-    BYTES = 267,
-    KBYTES = 268,
-    MBYTES = 269,
-    CALLER_ID_WAIT = 270,
-    CAN_FLOOD = 271,
-    CHANNEL = 272,
-    CIDR_BITLEN_IPV4 = 273,
-    CIDR_BITLEN_IPV6 = 274,
-    CLASS = 275,
-    CLIENT = 276,
-    CLOSE = 277,
-    CONNECT = 278,
-    CONNECTFREQ = 279,
-    CYCLE_ON_HOST_CHANGE = 280,
-    DEFAULT_FLOODCOUNT = 281,
-    DEFAULT_FLOODTIME = 282,
-    DEFAULT_JOIN_FLOOD_COUNT = 283,
-    DEFAULT_JOIN_FLOOD_TIME = 284,
-    DEFAULT_MAX_CLIENTS = 285,
-    DEFER = 286,
-    DENY = 287,
-    DESCRIPTION = 288,
-    DIE = 289,
-    DISABLE_AUTH = 290,
-    DISABLE_FAKE_CHANNELS = 291,
-    DISABLE_REMOTE_COMMANDS = 292,
-    DLINE_MIN_CIDR = 293,
-    DLINE_MIN_CIDR6 = 294,
-    DOTS_IN_IDENT = 295,
-    EMAIL = 296,
-    ENABLE_EXTBANS = 297,
-    ENCRYPTED = 298,
-    EXCEED_LIMIT = 299,
-    EXEMPT = 300,
-    EXPIRATION = 301,
-    FAILED_OPER_NOTICE = 302,
-    FLATTEN_LINKS = 303,
-    FLATTEN_LINKS_DELAY = 304,
-    FLATTEN_LINKS_FILE = 305,
-    GECOS = 306,
-    GENERAL = 307,
-    HIDDEN = 308,
-    HIDDEN_NAME = 309,
-    HIDE_CHANS = 310,
-    HIDE_IDLE = 311,
-    HIDE_IDLE_FROM_OPERS = 312,
-    HIDE_SERVER_IPS = 313,
-    HIDE_SERVERS = 314,
-    HIDE_SERVICES = 315,
-    HOST = 316,
-    HUB = 317,
-    HUB_MASK = 318,
-    INVISIBLE_ON_CONNECT = 319,
-    INVITE_CLIENT_COUNT = 320,
-    INVITE_CLIENT_TIME = 321,
-    INVITE_DELAY_CHANNEL = 322,
-    INVITE_EXPIRE_TIME = 323,
-    IP = 324,
-    IRCD_AUTH = 325,
-    IRCD_FLAGS = 326,
-    IRCD_SID = 327,
-    JOIN = 328,
-    KILL = 329,
-    KILL_CHASE_TIME_LIMIT = 330,
-    KLINE = 331,
-    KLINE_EXEMPT = 332,
-    KLINE_MIN_CIDR = 333,
-    KLINE_MIN_CIDR6 = 334,
-    KNOCK_CLIENT_COUNT = 335,
-    KNOCK_CLIENT_TIME = 336,
-    KNOCK_DELAY_CHANNEL = 337,
-    LEAF_MASK = 338,
-    LISTEN = 339,
-    MASK = 340,
-    MAX_ACCEPT = 341,
-    MAX_BANS = 342,
-    MAX_BANS_LARGE = 343,
-    MAX_CHANNELS = 344,
-    MAX_IDLE = 345,
-    MAX_INVITES = 346,
-    MAX_MONITOR = 347,
-    MAX_NICK_CHANGES = 348,
-    MAX_NICK_LENGTH = 349,
-    MAX_NICK_TIME = 350,
-    MAX_NUMBER = 351,
-    MAX_TARGETS = 352,
-    MAX_TOPIC_LENGTH = 353,
-    MIN_IDLE = 354,
-    MIN_NONWILDCARD = 355,
-    MIN_NONWILDCARD_SIMPLE = 356,
-    MODULE = 357,
-    MODULES = 358,
-    MOTD = 359,
-    NAME = 360,
-    NEED_IDENT = 361,
-    NEED_PASSWORD = 362,
-    NETWORK_DESCRIPTION = 363,
-    NETWORK_NAME = 364,
-    NICK = 365,
-    NO_OPER_FLOOD = 366,
-    NO_TILDE = 367,
-    NUMBER_PER_CIDR = 368,
-    NUMBER_PER_IP_GLOBAL = 369,
-    NUMBER_PER_IP_LOCAL = 370,
-    OPER_ONLY_UMODES = 371,
-    OPER_UMODES = 372,
-    OPERATOR = 373,
-    OPERS_BYPASS_CALLERID = 374,
-    PACE_WAIT = 375,
-    PACE_WAIT_SIMPLE = 376,
-    PASSWORD = 377,
-    PATH = 378,
-    PING_COOKIE = 379,
-    PING_TIME = 380,
-    PORT = 381,
-    RANDOM_IDLE = 382,
-    REASON = 383,
-    REDIRPORT = 384,
-    REDIRSERV = 385,
-    REHASH = 386,
-    REMOTE = 387,
-    REMOTEBAN = 388,
-    RESV = 389,
-    RESV_EXEMPT = 390,
-    RSA_PRIVATE_KEY_FILE = 391,
-    SECONDS = 392,
-    MINUTES = 393,
-    HOURS = 394,
-    DAYS = 395,
-    WEEKS = 396,
-    MONTHS = 397,
-    YEARS = 398,
-    SEND_PASSWORD = 399,
-    SENDQ = 400,
-    SERVERHIDE = 401,
-    SERVERINFO = 402,
-    SHORT_MOTD = 403,
-    SPOOF = 404,
-    SQUIT = 405,
-    STATS_E_DISABLED = 406,
-    STATS_I_OPER_ONLY = 407,
-    STATS_K_OPER_ONLY = 408,
-    STATS_M_OPER_ONLY = 409,
-    STATS_O_OPER_ONLY = 410,
-    STATS_P_OPER_ONLY = 411,
-    STATS_U_OPER_ONLY = 412,
-    T_ALL = 413,
-    T_BIND = 414,
-    T_CALLERID = 415,
-    T_CCONN = 416,
-    T_COMMAND = 417,
-    T_CLUSTER = 418,
-    T_DEAF = 419,
-    T_DEBUG = 420,
-    T_DLINE = 421,
-    T_EXTERNAL = 422,
-    T_FARCONNECT = 423,
-    T_FILE = 424,
-    T_FLOOD = 425,
-    T_GLOBOPS = 426,
-    T_INVISIBLE = 427,
-    T_IPV4 = 428,
-    T_IPV6 = 429,
-    T_LOCOPS = 430,
-    T_LOG = 431,
-    T_NCHANGE = 432,
-    T_NONONREG = 433,
-    T_OPME = 434,
-    T_PREPEND = 435,
-    T_PSEUDO = 436,
-    T_RECVQ = 437,
-    T_REJ = 438,
-    T_RESTART = 439,
-    T_SERVER = 440,
-    T_SERVICE = 441,
-    T_SERVNOTICE = 442,
-    T_SET = 443,
-    T_SHARED = 444,
-    T_SIZE = 445,
-    T_SKILL = 446,
-    T_SOFTCALLERID = 447,
-    T_SPY = 448,
-    T_TARGET = 449,
-    T_TLS = 450,
-    T_UMODES = 451,
-    T_UNDLINE = 452,
-    T_UNLIMITED = 453,
-    T_UNRESV = 454,
-    T_UNXLINE = 455,
-    T_WALLOP = 456,
-    T_WALLOPS = 457,
-    T_WEBIRC = 458,
-    TBOOL = 459,
-    THROTTLE_COUNT = 460,
-    THROTTLE_TIME = 461,
-    TIMEOUT = 462,
-    TLS_CERTIFICATE_FILE = 463,
-    TLS_CERTIFICATE_FINGERPRINT = 464,
-    TLS_CIPHER_LIST = 465,
-    TLS_CIPHER_SUITES = 466,
-    TLS_CONNECTION_REQUIRED = 467,
-    TLS_DH_PARAM_FILE = 468,
-    TLS_MESSAGE_DIGEST_ALGORITHM = 469,
-    TLS_SUPPORTED_GROUPS = 470,
-    TS_MAX_DELTA = 471,
-    TS_WARN_DELTA = 472,
-    TWODOTS = 473,
-    TYPE = 474,
-    UNKLINE = 475,
-    USE_LOGGING = 476,
-    USER = 477,
-    VHOST = 478,
-    VHOST6 = 479,
-    WARN_NO_CONNECT_BLOCK = 480,
-    WHOIS = 481,
-    WHOWAS_HISTORY_LENGTH = 482,
-    XLINE = 483,
-    XLINE_EXEMPT = 484,
-    QSTRING = 485,
-    NUMBER = 486
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ACCEPT_PASSWORD = 258,         /* ACCEPT_PASSWORD  */
+    ADMIN = 259,                   /* ADMIN  */
+    AFTYPE = 260,                  /* AFTYPE  */
+    ANTI_NICK_FLOOD = 261,         /* ANTI_NICK_FLOOD  */
+    ANTI_SPAM_EXIT_MESSAGE_TIME = 262, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+    AUTH_TIMEOUT = 263,            /* AUTH_TIMEOUT  */
+    AUTOCONN = 264,                /* AUTOCONN  */
+    AWAY_COUNT = 265,              /* AWAY_COUNT  */
+    AWAY_TIME = 266,               /* AWAY_TIME  */
+    BOT = 267,                     /* BOT  */
+    BYTES = 268,                   /* BYTES  */
+    KBYTES = 269,                  /* KBYTES  */
+    MBYTES = 270,                  /* MBYTES  */
+    CALLER_ID_WAIT = 271,          /* CALLER_ID_WAIT  */
+    CAN_FLOOD = 272,               /* CAN_FLOOD  */
+    CHANNEL = 273,                 /* CHANNEL  */
+    CIDR_BITLEN_IPV4 = 274,        /* CIDR_BITLEN_IPV4  */
+    CIDR_BITLEN_IPV6 = 275,        /* CIDR_BITLEN_IPV6  */
+    CLASS = 276,                   /* CLASS  */
+    CLIENT = 277,                  /* CLIENT  */
+    CLOSE = 278,                   /* CLOSE  */
+    CONNECT = 279,                 /* CONNECT  */
+    CONNECTFREQ = 280,             /* CONNECTFREQ  */
+    CYCLE_ON_HOST_CHANGE = 281,    /* CYCLE_ON_HOST_CHANGE  */
+    DEFAULT_FLOODCOUNT = 282,      /* DEFAULT_FLOODCOUNT  */
+    DEFAULT_FLOODTIME = 283,       /* DEFAULT_FLOODTIME  */
+    DEFAULT_JOIN_FLOOD_COUNT = 284, /* DEFAULT_JOIN_FLOOD_COUNT  */
+    DEFAULT_JOIN_FLOOD_TIME = 285, /* DEFAULT_JOIN_FLOOD_TIME  */
+    DEFAULT_MAX_CLIENTS = 286,     /* DEFAULT_MAX_CLIENTS  */
+    DEFER = 287,                   /* DEFER  */
+    DENY = 288,                    /* DENY  */
+    DESCRIPTION = 289,             /* DESCRIPTION  */
+    DIE = 290,                     /* DIE  */
+    DISABLE_AUTH = 291,            /* DISABLE_AUTH  */
+    DISABLE_FAKE_CHANNELS = 292,   /* DISABLE_FAKE_CHANNELS  */
+    DISABLE_REMOTE_COMMANDS = 293, /* DISABLE_REMOTE_COMMANDS  */
+    DLINE_MIN_CIDR = 294,          /* DLINE_MIN_CIDR  */
+    DLINE_MIN_CIDR6 = 295,         /* DLINE_MIN_CIDR6  */
+    DOTS_IN_IDENT = 296,           /* DOTS_IN_IDENT  */
+    EMAIL = 297,                   /* EMAIL  */
+    ENABLE_EXTBANS = 298,          /* ENABLE_EXTBANS  */
+    ENCRYPTED = 299,               /* ENCRYPTED  */
+    EXCEED_LIMIT = 300,            /* EXCEED_LIMIT  */
+    EXEMPT = 301,                  /* EXEMPT  */
+    EXPIRATION = 302,              /* EXPIRATION  */
+    FAILED_OPER_NOTICE = 303,      /* FAILED_OPER_NOTICE  */
+    FLATTEN_LINKS = 304,           /* FLATTEN_LINKS  */
+    FLATTEN_LINKS_DELAY = 305,     /* FLATTEN_LINKS_DELAY  */
+    FLATTEN_LINKS_FILE = 306,      /* FLATTEN_LINKS_FILE  */
+    FLOOD_BURST = 307,             /* FLOOD_BURST  */
+    FLOOD_RATE = 308,              /* FLOOD_RATE  */
+    GECOS = 309,                   /* GECOS  */
+    GENERAL = 310,                 /* GENERAL  */
+    HIDDEN = 311,                  /* HIDDEN  */
+    HIDDEN_NAME = 312,             /* HIDDEN_NAME  */
+    HIDE_CHANS = 313,              /* HIDE_CHANS  */
+    HIDE_IDLE = 314,               /* HIDE_IDLE  */
+    HIDE_IDLE_FROM_OPERS = 315,    /* HIDE_IDLE_FROM_OPERS  */
+    HIDE_SERVER_IPS = 316,         /* HIDE_SERVER_IPS  */
+    HIDE_SERVERS = 317,            /* HIDE_SERVERS  */
+    HIDE_SERVICES = 318,           /* HIDE_SERVICES  */
+    HOST = 319,                    /* HOST  */
+    HUB = 320,                     /* HUB  */
+    HUB_MASK = 321,                /* HUB_MASK  */
+    IDENT_CACHE_TIME = 322,        /* IDENT_CACHE_TIME  */
+    IDENT_MAX_PENDING = 323,       /* IDENT_MAX_PENDING  */
+    IDENT_TIMEOUT = 324,           /* IDENT_TIMEOUT  */
+    INVISIBLE_ON_CONNECT = 325,    /* INVISIBLE_ON_CONNECT  */
+    INVITE_CLIENT_COUNT = 326,     /* INVITE_CLIENT_COUNT  */
+    INVITE_CLIENT_TIME = 327,      /* INVITE_CLIENT_TIME  */
+    INVITE_DELAY_CHANNEL = 328,    /* INVITE_DELAY_CHANNEL  */
+    INVITE_EXPIRE_TIME = 329,      /* INVITE_EXPIRE_TIME  */
+    IP = 330,                      /* IP  */
+    IRCD_AUTH = 331,               /* IRCD_AUTH  */
+    IRCD_FLAGS = 332,              /* IRCD_FLAGS  */
+    IRCD_SID = 333,                /* IRCD_SID  */
+    JOIN = 334,                    /* JOIN  */
+    KILL = 335,                    /* KILL  */
+    KILL_CHASE_TIME_LIMIT = 336,   /* KILL_CHASE_TIME_LIMIT  */
+    KLINE = 337,                   /* KLINE  */
+    KLINE_EXEMPT = 338,            /* KLINE_EXEMPT  */
+    KLINE_MIN_CIDR = 339,          /* KLINE_MIN_CIDR  */
+    KLINE_MIN_CIDR6 = 340,         /* KLINE_MIN_CIDR6  */
+    KNOCK_CLIENT_COUNT = 341,      /* KNOCK_CLIENT_COUNT  */
+    KNOCK_CLIENT_TIME = 342,       /* KNOCK_CLIENT_TIME  */
+    KNOCK_DELAY_CHANNEL = 343,     /* KNOCK_DELAY_CHANNEL  */
+    LEAF_MASK = 344,               /* LEAF_MASK  */
+    LISTEN = 345,                  /* LISTEN  */
+    MASK = 346,                    /* MASK  */
+    MAX_ACCEPT = 347,              /* MAX_ACCEPT  */
+    MAX_BANS = 348,                /* MAX_BANS  */
+    MAX_BANS_LARGE = 349,          /* MAX_BANS_LARGE  */
+    MAX_CHANNELS = 350,            /* MAX_CHANNELS  */
+    MAX_IDLE = 351,                /* MAX_IDLE  */
+    MAX_INVITES = 352,             /* MAX_INVITES  */
+    MAX_MONITOR = 353,             /* MAX_MONITOR  */
+    MAX_NICK_CHANGES = 354,        /* MAX_NICK_CHANGES  */
+    MAX_NICK_LENGTH = 355,         /* MAX_NICK_LENGTH  */
+    MAX_NICK_TIME = 356,           /* MAX_NICK_TIME  */
+    MAX_NUMBER = 357,              /* MAX_NUMBER  */
+    MAX_TARGETS = 358,             /* MAX_TARGETS  */
+    MAX_TOPIC_LENGTH = 359,        /* MAX_TOPIC_LENGTH  */
+    MIN_IDLE = 360,                /* MIN_IDLE  */
+    MIN_NONWILDCARD = 361,         /* MIN_NONWILDCARD  */
+    MIN_NONWILDCARD_SIMPLE = 362,  /* MIN_NONWILDCARD_SIMPLE  */
+    MODULE = 363,                  /* MODULE  */
+    MODULES = 364,                 /* MODULES  */
+    MOTD = 365,                    /* MOTD  */
+    NAME = 366,                    /* NAME  */
+    NEED_IDENT = 367,              /* NEED_IDENT  */
+    NEED_PASSWORD = 368,           /* NEED_PASSWORD  */
+    NETWORK_DESCRIPTION = 369,     /* NETWORK_DESCRIPTION  */
+    NETWORK_NAME = 370,            /* NETWORK_NAME  */
+    NICK = 371,                    /* NICK  */
+    NO_OPER_FLOOD = 372,           /* NO_OPER_FLOOD  */
+    NO_TILDE = 373,                /* NO_TILDE  */
+    NUMBER_PER_CIDR = 374,         /* NUMBER_PER_CIDR  */
+    NUMBER_PER_IP_GLOBAL = 375,    /* NUMBER_PER_IP_GLOBAL  */
+    NUMBER_PER_IP_LOCAL = 376,     /* NUMBER_PER_IP_LOCAL  */
+    OPER_ONLY_UMODES = 377,        /* OPER_ONLY_UMODES  */
+    OPER_UMODES = 378,             /* OPER_UMODES  */
+    OPERATOR = 379,                /* OPERATOR  */
+    OPERS_BYPASS_CALLERID = 380,   /* OPERS_BYPASS_CALLERID  */
+    PACE_WAIT = 381,               /* PACE_WAIT  */
+    PACE_WAIT_SIMPLE = 382,        /* PACE_WAIT_SIMPLE  */
+    PASSWORD = 383,                /* PASSWORD  */
+    PATH = 384,                    /* PATH  */
+    PING_COOKIE = 385,             /* PING_COOKIE  */
+    PING_TIME = 386,               /* PING_TIME  */
+    PORT = 387,                    /* PORT  */
+    RANDOM_IDLE = 388,             /* RANDOM_IDLE  */
+    REASON = 389,                  /* REASON  */
+    REDIRPORT = 390,               /* REDIRPORT  */
+    REDIRSERV = 391,               /* REDIRSERV  */
+    REHASH = 392,                  /* REHASH  */
+    REMOTE = 393,                  /* REMOTE  */
+    REMOTEBAN = 394,               /* REMOTEBAN  */
+    RESV = 395,                    /* RESV  */
+    RESV_EXEMPT = 396,             /* RESV_EXEMPT  */
+    REUSEPORT = 397,               /* REUSEPORT  */
+    RSA_PRIVATE_KEY_FILE = 398,    /* RSA_PRIVATE_KEY_FILE  */
+    SECONDS = 399,                 /* SECONDS  */
+    MINUTES = 400,                 /* MINUTES  */
+    HOURS = 401,                   /* HOURS  */
+    DAYS = 402,                    /* DAYS  */
+    WEEKS = 403,                   /* WEEKS  */
+    MONTHS = 404,                  /* MONTHS  */
+    YEARS = 405,                   /* YEARS  */
+    SEND_PASSWORD = 406,           /* SEND_PASSWORD  */
+    SENDQ = 407,                   /* SENDQ  */
+    SERVERHIDE = 408,              /* SERVERHIDE  */
+    SERVERINFO = 409,              /* SERVERINFO  */
+    SHORT_MOTD = 410,              /* SHORT_MOTD  */
+    SPOOF = 411,                   /* SPOOF  */
+    SQUIT = 412,                   /* SQUIT  */
+    STATS_E_DISABLED = 413,        /* STATS_E_DISABLED  */
+    STATS_I_OPER_ONLY = 414,       /* STATS_I_OPER_ONLY  */
+    STATS_K_OPER_ONLY = 415,       /* STATS_K_OPER_ONLY  */
+    STATS_M_OPER_ONLY = 416,       /* STATS_M_OPER_ONLY  */
+    STATS_O_OPER_ONLY = 417,       /* STATS_O_OPER_ONLY  */
+    STATS_P_OPER_ONLY = 418,       /* STATS_P_OPER_ONLY  */
+    STATS_U_OPER_ONLY = 419,       /* STATS_U_OPER_ONLY  */
+    T_ALL = 420,                   /* T_ALL  */
+    T_BIND = 421,                  /* T_BIND  */
+    T_CALLERID = 422,              /* T_CALLERID  */
+    T_CCONN = 423,                 /* T_CCONN  */
+    T_COMMAND = 424,               /* T_COMMAND  */
+    T_CLUSTER = 425,               /* T_CLUSTER  */
+    T_COMPRESSED = 426,            /* T_COMPRESSED  */
+    T_DEAF = 427,                  /* T_DEAF  */
+    T_DEBUG = 428,                 /* T_DEBUG  */
+    T_DLINE = 429,                 /* T_DLINE  */
+    T_EXTERNAL = 430,              /* T_EXTERNAL  */
+    T_FARCONNECT = 431,            /* T_FARCONNECT  */
+    T_FILE = 432,                  /* T_FILE  */
+    T_FLOOD = 433,                 /* T_FLOOD  */
+    T_GLOBOPS = 434,               /* T_GLOBOPS  */
+    T_INVISIBLE = 435,             /* T_INVISIBLE  */
+    T_IPV4 = 436,                  /* T_IPV4  */
+    T_IPV6 = 437,                  /* T_IPV6  */
+    T_LOCOPS = 438,                /* T_LOCOPS  */
+    T_LOG = 439,                   /* T_LOG  */
+    T_METRICS = 440,               /* T_METRICS  */
+    T_NCHANGE = 441,               /* T_NCHANGE  */
+    T_NONONREG = 442,              /* T_NONONREG  */
+    T_OPME = 443,                  /* T_OPME  */
+    T_PREPEND = 444,               /* T_PREPEND  */
+    T_PSEUDO = 445,                /* T_PSEUDO  */
+    T_RECVQ = 446,                 /* T_RECVQ  */
+    T_REJ = 447,                   /* T_REJ  */
+    T_RESTART = 448,               /* T_RESTART  */
+    T_SERVER = 449,                /* T_SERVER  */
+    T_SERVICE = 450,               /* T_SERVICE  */
+    T_SERVNOTICE = 451,            /* T_SERVNOTICE  */
+    T_SET = 452,                   /* T_SET  */
+    T_SHARED = 453,                /* T_SHARED  */
+    T_SIZE = 454,                  /* T_SIZE  */
+    T_SKILL = 455,                 /* T_SKILL  */
+    T_SOFTCALLERID = 456,          /* T_SOFTCALLERID  */
+    T_SPY = 457,                   /* T_SPY  */
+    T_TARGET = 458,                /* T_TARGET  */
+    T_TLS = 459,                   /* T_TLS  */
+    T_UMODES = 460,                /* T_UMODES  */
+    T_UNDLINE = 461,               /* T_UNDLINE  */
+    T_UNLIMITED = 462,             /* T_UNLIMITED  */
+    T_UNRESV = 463,                /* T_UNRESV  */
+    T_UNXLINE = 464,               /* T_UNXLINE  */
+    T_WALLOP = 465,                /* T_WALLOP  */
+    T_WALLOPS = 466,               /* T_WALLOPS  */
+    T_WEBIRC = 467,                /* T_WEBIRC  */
+    TBOOL = 468,                   /* TBOOL  */
+    THROTTLE_COUNT = 469,          /* THROTTLE_COUNT  */
+    THROTTLE_TIME = 470,           /* THROTTLE_TIME  */
+    TIMEOUT = 471,                 /* TIMEOUT  */
+    TLS_CERTIFICATE_FILE = 472,    /* TLS_CERTIFICATE_FILE  */
+    TLS_CERTIFICATE_FINGERPRINT = 473, /* TLS_CERTIFICATE_FINGERPRINT  */
+    TLS_CIPHER_LIST = 474,         /* TLS_CIPHER_LIST  */
+    TLS_CIPHER_SUITES = 475,       /* TLS_CIPHER_SUITES  */
+    TLS_CONNECTION_REQUIRED = 476, /* TLS_CONNECTION_REQUIRED  */
+    TLS_DH_PARAM_FILE = 477,       /* TLS_DH_PARAM_FILE  */
+    TLS_HANDSHAKE_THREADS = 478,   /* TLS_HANDSHAKE_THREADS  */
+    TLS_KERNEL_OFFLOAD = 479,      /* TLS_KERNEL_OFFLOAD  */
+    TLS_MESSAGE_DIGEST_ALGORITHM = 480, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+    TLS_SESSION_CACHE_SIZE = 481,  /* TLS_SESSION_CACHE_SIZE  */
+    TLS_SUPPORTED_GROUPS = 482,    /* TLS_SUPPORTED_GROUPS  */
+    TLS_TICKET_KEY_FILE = 483,     /* TLS_TICKET_KEY_FILE  */
+    TS_MAX_DELTA = 484,            /* TS_MAX_DELTA  */
+    TS_WARN_DELTA = 485,           /* TS_WARN_DELTA  */
+    TWODOTS = 486,                 /* TWODOTS  */
+    TYPE = 487,                    /* TYPE  */
+    UNKLINE = 488,                 /* UNKLINE  */
+    USE_LOGGING = 489,             /* USE_LOGGING  */
+    USER = 490,                    /* USER  */
+    VHOST = 491,                   /* VHOST  */
+    VHOST6 = 492,                  /* VHOST6  */
+    WARN_NO_CONNECT_BLOCK = 493,   /* WARN_NO_CONNECT_BLOCK  */
+    WHOIS = 494,                   /* WHOIS  */
+    WHOWAS_HISTORY_LENGTH = 495,   /* WHOWAS_HISTORY_LENGTH  */
+    XLINE = 496,                   /* XLINE  */
+    XLINE_EXEMPT = 497,            /* XLINE_EXEMPT  */
+    QSTRING = 498,                 /* QSTRING  */
+    NUMBER = 499                   /* NUMBER  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ACCEPT_PASSWORD 258
 #define ADMIN 259
 #define AFTYPE 260
 #define ANTI_NICK_FLOOD 261
 #define ANTI_SPAM_EXIT_MESSAGE_TIME 262
-#define AUTOCONN 263
-#define AWAY_COUNT 264
-#define AWAY_TIME 265
-#define BOT 266
-#define BYTES 267
-#define KBYTES 268
-#define MBYTES 269
-#define CALLER_ID_WAIT 270
-#define CAN_FLOOD 271
-#define CHANNEL 272
-#define CIDR_BITLEN_IPV4 273
-#define CIDR_BITLEN_IPV6 274
-#define CLASS 275
-#define CLIENT 276
-#define CLOSE 277
-#define CONNECT 278
-#define CONNECTFREQ 279
-#define CYCLE_ON_HOST_CHANGE 280
-#define DEFAULT_FLOODCOUNT 281
-#define DEFAULT_FLOODTIME 282
-#define DEFAULT_JOIN_FLOOD_COUNT 283
-#define DEFAULT_JOIN_FLOOD_TIME 284
-#define DEFAULT_MAX_CLIENTS 285
-#define DEFER 286
-#define DENY 287
-#define DESCRIPTION 288
-#define DIE 289
-#define DISABLE_AUTH 290
-#define DISABLE_FAKE_CHANNELS 291
-#define DISABLE_REMOTE_COMMANDS 292
-#define DLINE_MIN_CIDR 293
-#define DLINE_MIN_CIDR6 294
-#define DOTS_IN_IDENT 295
-#define EMAIL 296
-#define ENABLE_EXTBANS 297
-#define ENCRYPTED 298
-#define EXCEED_LIMIT 299
-#define EXEMPT 300
-#define EXPIRATION 301
-#define FAILED_OPER_NOTICE 302
-#define FLATTEN_LINKS 303
-#define FLATTEN_LINKS_DELAY 304
-#define FLATTEN_LINKS_FILE 305
-#define GECOS 306
-#define GENERAL 307
-#define HIDDEN 308
-#define HIDDEN_NAME 309
-#define HIDE_CHANS 310
-#define HIDE_IDLE 311
-#define HIDE_IDLE_FROM_OPERS 312
-#define HIDE_SERVER_IPS 313
-#define HIDE_SERVERS 314
-#define HIDE_SERVICES 315
-#define HOST 316
-#define HUB 317
-#define HUB_MASK 318
-#define INVISIBLE_ON_CONNECT 319
-#define INVITE_CLIENT_COUNT 320
-#define INVITE_CLIENT_TIME 321
-#define INVITE_DELAY_CHANNEL 322
-#define INVITE_EXPIRE_TIME 323
-#define IP 324
-#define IRCD_AUTH 325
-#define IRCD_FLAGS 326
-#define IRCD_SID 327
-#define JOIN 328
-#define KILL 329
-#define KILL_CHASE_TIME_LIMIT 330
-#define KLINE 331
-#define KLINE_EXEMPT 332
-#define KLINE_MIN_CIDR 333
-#define KLINE_MIN_CIDR6 334
-#define KNOCK_CLIENT_COUNT 335
-#define KNOCK_CLIENT_TIME 336
-#define KNOCK_DELAY_CHANNEL 337
-#define LEAF_MASK 338
-#define LISTEN 339
-#define MASK 340
-#define MAX_ACCEPT 341
-#define MAX_BANS 342
-#define MAX_BANS_LARGE 343
-#define MAX_CHANNELS 344
-#define MAX_IDLE 345
-#define MAX_INVITES 346
-#define MAX_MONITOR 347
-#define MAX_NICK_CHANGES 348
-#define MAX_NICK_LENGTH 349
-#define MAX_NICK_TIME 350
-#define MAX_NUMBER 351
-#define MAX_TARGETS 352
-#define MAX_TOPIC_LENGTH 353
-#define MIN_IDLE 354
-#define MIN_NONWILDCARD 355
-#define MIN_NONWILDCARD_SIMPLE 356
-#define MODULE 357
-#define MODULES 358
-#define MOTD 359
-#define NAME 360
-#define NEED_IDENT 361
-#define NEED_PASSWORD 362
-#define NETWORK_DESCRIPTION 363
-#define NETWORK_NAME 364
-#define NICK 365
-#define NO_OPER_FLOOD 366
-#define NO_TILDE 367
-#define NUMBER_PER_CIDR 368
-#define NUMBER_PER_IP_GLOBAL 369
-#define NUMBER_PER_IP_LOCAL 370
-#define OPER_ONLY_UMODES 371
-#define OPER_UMODES 372
-#define OPERATOR 373
-#define OPERS_BYPASS_CALLERID 374
-#define PACE_WAIT 375
-#define PACE_WAIT_SIMPLE 376
-#define PASSWORD 377
-#define PATH 378
-#define PING_COOKIE 379
-#define PING_TIME 380
-#define PORT 381
-#define RANDOM_IDLE 382
-#define REASON 383
-#define REDIRPORT 384
-#define REDIRSERV 385
-#define REHASH 386
-#define REMOTE 387
-#define REMOTEBAN 388
-#define RESV 389
-#define RESV_EXEMPT 390
-#define RSA_PRIVATE_KEY_FILE 391
-#define SECONDS 392
-#define MINUTES 393
-#define HOURS 394
-#define DAYS 395
-#define WEEKS 396
-#define MONTHS 397
-#define YEARS 398
-#define SEND_PASSWORD 399
-#define SENDQ 400
-#define SERVERHIDE 401
-#define SERVERINFO 402
-#define SHORT_MOTD 403
-#define SPOOF 404
-#define SQUIT 405
-#define STATS_E_DISABLED 406
-#define STATS_I_OPER_ONLY 407
-#define STATS_K_OPER_ONLY 408
-#define STATS_M_OPER_ONLY 409
-#define STATS_O_OPER_ONLY 410
-#define STATS_P_OPER_ONLY 411
-#define STATS_U_OPER_ONLY 412
-#define T_ALL 413
-#define T_BIND 414
-#define T_CALLERID 415
-#define T_CCONN 416
-#define T_COMMAND 417
-#define T_CLUSTER 418
-#define T_DEAF 419
-#define T_DEBUG 420
-#define T_DLINE 421
-#define T_EXTERNAL 422
-#define T_FARCONNECT 423
-#define T_FILE 424
-#define T_FLOOD 425
-#define T_GLOBOPS 426
-#define T_INVISIBLE 427
-#define T_IPV4 428
-#define T_IPV6 429
-#define T_LOCOPS 430
-#define T_LOG 431
-#define T_NCHANGE 432
-#define T_NONONREG 433
-#define T_OPME 434
-#define T_PREPEND 435
-#define T_PSEUDO 436
-#define T_RECVQ 437
-#define T_REJ 438
-#define T_RESTART 439
-#define T_SERVER 440
-#define T_SERVICE 441
-#define T_SERVNOTICE 442
-#define T_SET 443
-#define T_SHARED 444
-#define T_SIZE 445
-#define T_SKILL 446
-#define T_SOFTCALLERID 447
-#define T_SPY 448
-#define T_TARGET 449
-#define T_TLS 450
-#define T_UMODES 451
-#define T_UNDLINE 452
-#define T_UNLIMITED 453
-#define T_UNRESV 454
-#define T_UNXLINE 455
-#define T_WALLOP 456
-#define T_WALLOPS 457
-#define T_WEBIRC 458
-#define TBOOL 459
-#define THROTTLE_COUNT 460
-#define THROTTLE_TIME 461
-#define TIMEOUT 462
-#define TLS_CERTIFICATE_FILE 463
-#define TLS_CERTIFICATE_FINGERPRINT 464
-#define TLS_CIPHER_LIST 465
-#define TLS_CIPHER_SUITES 466
-#define TLS_CONNECTION_REQUIRED 467
-#define TLS_DH_PARAM_FILE 468
-#define TLS_MESSAGE_DIGEST_ALGORITHM 469
-#define TLS_SUPPORTED_GROUPS 470
-#define TS_MAX_DELTA 471
-#define TS_WARN_DELTA 472
-#define TWODOTS 473
-#define TYPE 474
-#define UNKLINE 475
-#define USE_LOGGING 476
-#define USER 477
-#define VHOST 478
-#define VHOST6 479
-#define WARN_NO_CONNECT_BLOCK 480
-#define WHOIS 481
-#define WHOWAS_HISTORY_LENGTH 482
-#define XLINE 483
-#define XLINE_EXEMPT 484
-#define QSTRING 485
-#define NUMBER 486
+#define AUTH_TIMEOUT 263
+#define AUTOCONN 264
+#define AWAY_COUNT 265
+#define AWAY_TIME 266
+#define BOT 267
+#define BYTES 268
+#define KBYTES 269
+#define MBYTES 270
+#define CALLER_ID_WAIT 271
+#define CAN_FLOOD 272
+#define CHANNEL 273
+#define CIDR_BITLEN_IPV4 274
+#define CIDR_BITLEN_IPV6 275
+#define CLASS 276
+#define CLIENT 277
+#define CLOSE 278
+#define CONNECT 279
+#define CONNECTFREQ 280
+#define CYCLE_ON_HOST_CHANGE 281
+#define DEFAULT_FLOODCOUNT 282
+#define DEFAULT_FLOODTIME 283
+#define DEFAULT_JOIN_FLOOD_COUNT 284
+#define DEFAULT_JOIN_FLOOD_TIME 285
+#define DEFAULT_MAX_CLIENTS 286
+#define DEFER 287
+#define DENY 288
+#define DESCRIPTION 289
+#define DIE 290
+#define DISABLE_AUTH 291
+#define DISABLE_FAKE_CHANNELS 292
+#define DISABLE_REMOTE_COMMANDS 293
+#define DLINE_MIN_CIDR 294
+#define DLINE_MIN_CIDR6 295
+#define DOTS_IN_IDENT 296
+#define EMAIL 297
+#define ENABLE_EXTBANS 298
+#define ENCRYPTED 299
+#define EXCEED_LIMIT 300
+#define EXEMPT 301
+#define EXPIRATION 302
+#define FAILED_OPER_NOTICE 303
+#define FLATTEN_LINKS 304
+#define FLATTEN_LINKS_DELAY 305
+#define FLATTEN_LINKS_FILE 306
+#define FLOOD_BURST 307
+#define FLOOD_RATE 308
+#define GECOS 309
+#define GENERAL 310
+#define HIDDEN 311
+#define HIDDEN_NAME 312
+#define HIDE_CHANS 313
+#define HIDE_IDLE 314
+#define HIDE_IDLE_FROM_OPERS 315
+#define HIDE_SERVER_IPS 316
+#define HIDE_SERVERS 317
+#define HIDE_SERVICES 318
+#define HOST 319
+#define HUB 320
+#define HUB_MASK 321
+#define IDENT_CACHE_TIME 322
+#define IDENT_MAX_PENDING 323
+#define IDENT_TIMEOUT 324
+#define INVISIBLE_ON_CONNECT 325
+#define INVITE_CLIENT_COUNT 326
+#define INVITE_CLIENT_TIME 327
+#define INVITE_DELAY_CHANNEL 328
+#define INVITE_EXPIRE_TIME 329
+#define IP 330
+#define IRCD_AUTH 331
+#define IRCD_FLAGS 332
+#define IRCD_SID 333
+#define JOIN 334
+#define KILL 335
+#define KILL_CHASE_TIME_LIMIT 336
+#define KLINE 337
+#define KLINE_EXEMPT 338
+#define KLINE_MIN_CIDR 339
+#define KLINE_MIN_CIDR6 340
+#define KNOCK_CLIENT_COUNT 341
+#define KNOCK_CLIENT_TIME 342
+#define KNOCK_DELAY_CHANNEL 343
+#define LEAF_MASK 344
+#define LISTEN 345
+#define MASK 346
+#define MAX_ACCEPT 347
+#define MAX_BANS 348
+#define MAX_BANS_LARGE 349
+#define MAX_CHANNELS 350
+#define MAX_IDLE 351
+#define MAX_INVITES 352
+#define MAX_MONITOR 353
+#define MAX_NICK_CHANGES 354
+#define MAX_NICK_LENGTH 355
+#define MAX_NICK_TIME 356
+#define MAX_NUMBER 357
+#define MAX_TARGETS 358
+#define MAX_TOPIC_LENGTH 359
+#define MIN_IDLE 360
+#define MIN_NONWILDCARD 361
+#define MIN_NONWILDCARD_SIMPLE 362
+#define MODULE 363
+#define MODULES 364
+#define MOTD 365
+#define NAME 366
+#define NEED_IDENT 367
+#define NEED_PASSWORD 368
+#define NETWORK_DESCRIPTION 369
+#define NETWORK_NAME 370
+#define NICK 371
+#define NO_OPER_FLOOD 372
+#define NO_TILDE 373
+#define NUMBER_PER_CIDR 374
+#define NUMBER_PER_IP_GLOBAL 375
+#define NUMBER_PER_IP_LOCAL 376
+#define OPER_ONLY_UMODES 377
+#define OPER_UMODES 378
+#define OPERATOR 379
+#define OPERS_BYPASS_CALLERID 380
+#define PACE_WAIT 381
+#define PACE_WAIT_SIMPLE 382
+#define PASSWORD 383
+#define PATH 384
+#define PING_COOKIE 385
+#define PING_TIME 386
+#define PORT 387
+#define RANDOM_IDLE 388
+#define REASON 389
+#define REDIRPORT 390
+#define REDIRSERV 391
+#define REHASH 392
+#define REMOTE 393
+#define REMOTEBAN 394
+#define RESV 395
+#define RESV_EXEMPT 396
+#define REUSEPORT 397
+#define RSA_PRIVATE_KEY_FILE 398
+#define SECONDS 399
+#define MINUTES 400
+#define HOURS 401
+#define DAYS 402
+#define WEEKS 403
+#define MONTHS 404
+#define YEARS 405
+#define SEND_PASSWORD 406
+#define SENDQ 407
+#define SERVERHIDE 408
+#define SERVERINFO 409
+#define SHORT_MOTD 410
+#define SPOOF 411
+#define SQUIT 412
+#define STATS_E_DISABLED 413
+#define STATS_I_OPER_ONLY 414
+#define STATS_K_OPER_ONLY 415
+#define STATS_M_OPER_ONLY 416
+#define STATS_O_OPER_ONLY 417
+#define STATS_P_OPER_ONLY 418
+#define STATS_U_OPER_ONLY 419
+#define T_ALL 420
+#define T_BIND 421
+#define T_CALLERID 422
+#define T_CCONN 423
+#define T_COMMAND 424
+#define T_CLUSTER 425
+#define T_COMPRESSED 426
+#define T_DEAF 427
+#define T_DEBUG 428
+#define T_DLINE 429
+#define T_EXTERNAL 430
+#define T_FARCONNECT 431
+#define T_FILE 432
+#define T_FLOOD 433
+#define T_GLOBOPS 434
+#define T_INVISIBLE 435
+#define T_IPV4 436
+#define T_IPV6 437
+#define T_LOCOPS 438
+#define T_LOG 439
+#define T_METRICS 440
+#define T_NCHANGE 441
+#define T_NONONREG 442
+#define T_OPME 443
+#define T_PREPEND 444
+#define T_PSEUDO 445
+#define T_RECVQ 446
+#define T_REJ 447
+#define T_RESTART 448
+#define T_SERVER 449
+#define T_SERVICE 450
+#define T_SERVNOTICE 451
+#define T_SET 452
+#define T_SHARED 453
+#define T_SIZE 454
+#define T_SKILL 455
+#define T_SOFTCALLERID 456
+#define T_SPY 457
+#define T_TARGET 458
+#define T_TLS 459
+#define T_UMODES 460
+#define T_UNDLINE 461
+#define T_UNLIMITED 462
+#define T_UNRESV 463
+#define T_UNXLINE 464
+#define T_WALLOP 465
+#define T_WALLOPS 466
+#define T_WEBIRC 467
+#define TBOOL 468
+#define THROTTLE_COUNT 469
+#define THROTTLE_TIME 470
+#define TIMEOUT 471
+#define TLS_CERTIFICATE_FILE 472
+#define TLS_CERTIFICATE_FINGERPRINT 473
+#define TLS_CIPHER_LIST 474
+#define TLS_CIPHER_SUITES 475
+#define TLS_CONNECTION_REQUIRED 476
+#define TLS_DH_PARAM_FILE 477
+#define TLS_HANDSHAKE_THREADS 478
+#define TLS_KERNEL_OFFLOAD 479
+#define TLS_MESSAGE_DIGEST_ALGORITHM 480
+#define TLS_SESSION_CACHE_SIZE 481
+#define TLS_SUPPORTED_GROUPS 482
+#define TLS_TICKET_KEY_FILE 483
+#define TS_MAX_DELTA 484
+#define TS_WARN_DELTA 485
+#define TWODOTS 486
+#define TYPE 487
+#define UNKLINE 488
+#define USE_LOGGING 489
+#define USER 490
+#define VHOST 491
+#define VHOST6 492
+#define WARN_NO_CONNECT_BLOCK 493
+#define WHOIS 494
+#define WHOWAS_HISTORY_LENGTH 495
+#define XLINE 496
+#define XLINE_EXEMPT 497
+#define QSTRING 498
+#define NUMBER 499
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 133 "conf_parser.y"
+#line 135 "conf_parser.y"
 
   int number;
   char *string;
 
-#line 694 "conf_parser.c"
+#line 724 "conf_parser.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -701,9 +731,573 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONF_PARSER_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ACCEPT_PASSWORD = 3,            /* ACCEPT_PASSWORD  */
+  YYSYMBOL_ADMIN = 4,                      /* ADMIN  */
+  YYSYMBOL_AFTYPE = 5,                     /* AFTYPE  */
+  YYSYMBOL_ANTI_NICK_FLOOD = 6,            /* ANTI_NICK_FLOOD  */
+  YYSYMBOL_ANTI_SPAM_EXIT_MESSAGE_TIME = 7, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+  YYSYMBOL_AUTH_TIMEOUT = 8,               /* AUTH_TIMEOUT  */
+  YYSYMBOL_AUTOCONN = 9,                   /* AUTOCONN  */
+  YYSYMBOL_AWAY_COUNT = 10,                /* AWAY_COUNT  */
+  YYSYMBOL_AWAY_TIME = 11,                 /* AWAY_TIME  */
+  YYSYMBOL_BOT = 12,                       /* BOT  */
+  YYSYMBOL_BYTES = 13,                     /* BYTES  */
+  YYSYMBOL_KBYTES = 14,                    /* KBYTES  */
+  YYSYMBOL_MBYTES = 15,                    /* MBYTES  */
+  YYSYMBOL_CALLER_ID_WAIT = 16,            /* CALLER_ID_WAIT  */
+  YYSYMBOL_CAN_FLOOD = 17,                 /* CAN_FLOOD  */
+  YYSYMBOL_CHANNEL = 18,                   /* CHANNEL  */
+  YYSYMBOL_CIDR_BITLEN_IPV4 = 19,          /* CIDR_BITLEN_IPV4  */
+  YYSYMBOL_CIDR_BITLEN_IPV6 = 20,          /* CIDR_BITLEN_IPV6  */
+  YYSYMBOL_CLASS = 21,                     /* CLASS  */
+  YYSYMBOL_CLIENT = 22,                    /* CLIENT  */
+  YYSYMBOL_CLOSE = 23,                     /* CLOSE  */
+  YYSYMBOL_CONNECT = 24,                   /* CONNECT  */
+  YYSYMBOL_CONNECTFREQ = 25,               /* CONNECTFREQ  */
+  YYSYMBOL_CYCLE_ON_HOST_CHANGE = 26,      /* CYCLE_ON_HOST_CHANGE  */
+  YYSYMBOL_DEFAULT_FLOODCOUNT = 27,        /* DEFAULT_FLOODCOUNT  */
+  YYSYMBOL_DEFAULT_FLOODTIME = 28,         /* DEFAULT_FLOODTIME  */
+  YYSYMBOL_DEFAULT_JOIN_FLOOD_COUNT = 29,  /* DEFAULT_JOIN_FLOOD_COUNT  */
+  YYSYMBOL_DEFAULT_JOIN_FLOOD_TIME = 30,   /* DEFAULT_JOIN_FLOOD_TIME  */
+  YYSYMBOL_DEFAULT_MAX_CLIENTS = 31,       /* DEFAULT_MAX_CLIENTS  */
+  YYSYMBOL_DEFER = 32,                     /* DEFER  */
+  YYSYMBOL_DENY = 33,                      /* DENY  */
+  YYSYMBOL_DESCRIPTION = 34,               /* DESCRIPTION  */
+  YYSYMBOL_DIE = 35,                       /* DIE  */
+  YYSYMBOL_DISABLE_AUTH = 36,              /* DISABLE_AUTH  */
+  YYSYMBOL_DISABLE_FAKE_CHANNELS = 37,     /* DISABLE_FAKE_CHANNELS  */
+  YYSYMBOL_DISABLE_REMOTE_COMMANDS = 38,   /* DISABLE_REMOTE_COMMANDS  */
+  YYSYMBOL_DLINE_MIN_CIDR = 39,            /* DLINE_MIN_CIDR  */
+  YYSYMBOL_DLINE_MIN_CIDR6 = 40,           /* DLINE_MIN_CIDR6  */
+  YYSYMBOL_DOTS_IN_IDENT = 41,             /* DOTS_IN_IDENT  */
+  YYSYMBOL_EMAIL = 42,                     /* EMAIL  */
+  YYSYMBOL_ENABLE_EXTBANS = 43,            /* ENABLE_EXTBANS  */
+  YYSYMBOL_ENCRYPTED = 44,                 /* ENCRYPTED  */
+  YYSYMBOL_EXCEED_LIMIT = 45,              /* EXCEED_LIMIT  */
+  YYSYMBOL_EXEMPT = 46,                    /* EXEMPT  */
+  YYSYMBOL_EXPIRATION = 47,                /* EXPIRATION  */
+  YYSYMBOL_FAILED_OPER_NOTICE = 48,        /* FAILED_OPER_NOTICE  */
+  YYSYMBOL_FLATTEN_LINKS = 49,             /* FLATTEN_LINKS  */
+  YYSYMBOL_FLATTEN_LINKS_DELAY = 50,       /* FLATTEN_LINKS_DELAY  */
+  YYSYMBOL_FLATTEN_LINKS_FILE = 51,        /* FLATTEN_LINKS_FILE  */
+  YYSYMBOL_FLOOD_BURST = 52,               /* FLOOD_BURST  */
+  YYSYMBOL_FLOOD_RATE = 53,                /* FLOOD_RATE  */
+  YYSYMBOL_GECOS = 54,                     /* GECOS  */
+  YYSYMBOL_GENERAL = 55,                   /* GENERAL  */
+  YYSYMBOL_HIDDEN = 56,                    /* HIDDEN  */
+  YYSYMBOL_HIDDEN_NAME = 57,               /* HIDDEN_NAME  */
+  YYSYMBOL_HIDE_CHANS = 58,                /* HIDE_CHANS  */
+  YYSYMBOL_HIDE_IDLE = 59,                 /* HIDE_IDLE  */
+  YYSYMBOL_HIDE_IDLE_FROM_OPERS = 60,      /* HIDE_IDLE_FROM_OPERS  */
+  YYSYMBOL_HIDE_SERVER_IPS = 61,           /* HIDE_SERVER_IPS  */
+  YYSYMBOL_HIDE_SERVERS = 62,              /* HIDE_SERVERS  */
+  YYSYMBOL_HIDE_SERVICES = 63,             /* HIDE_SERVICES  */
+  YYSYMBOL_HOST = 64,                      /* HOST  */
+  YYSYMBOL_HUB = 65,                       /* HUB  */
+  YYSYMBOL_HUB_MASK = 66,                  /* HUB_MASK  */
+  YYSYMBOL_IDENT_CACHE_TIME = 67,          /* IDENT_CACHE_TIME  */
+  YYSYMBOL_IDENT_MAX_PENDING = 68,         /* IDENT_MAX_PENDING  */
+  YYSYMBOL_IDENT_TIMEOUT = 69,             /* IDENT_TIMEOUT  */
+  YYSYMBOL_INVISIBLE_ON_CONNECT = 70,      /* INVISIBLE_ON_CONNECT  */
+  YYSYMBOL_INVITE_CLIENT_COUNT = 71,       /* INVITE_CLIENT_COUNT  */
+  YYSYMBOL_INVITE_CLIENT_TIME = 72,        /* INVITE_CLIENT_TIME  */
+  YYSYMBOL_INVITE_DELAY_CHANNEL = 73,      /* INVITE_DELAY_CHANNEL  */
+  YYSYMBOL_INVITE_EXPIRE_TIME = 74,        /* INVITE_EXPIRE_TIME  */
+  YYSYMBOL_IP = 75,                        /* IP  */
+  YYSYMBOL_IRCD_AUTH = 76,                 /* IRCD_AUTH  */
+  YYSYMBOL_IRCD_FLAGS = 77,                /* IRCD_FLAGS  */
+  YYSYMBOL_IRCD_SID = 78,                  /* IRCD_SID  */
+  YYSYMBOL_JOIN = 79,                      /* JOIN  */
+  YYSYMBOL_KILL = 80,                      /* KILL  */
+  YYSYMBOL_KILL_CHASE_TIME_LIMIT = 81,     /* KILL_CHASE_TIME_LIMIT  */
+  YYSYMBOL_KLINE = 82,                     /* KLINE  */
+  YYSYMBOL_KLINE_EXEMPT = 83,              /* KLINE_EXEMPT  */
+  YYSYMBOL_KLINE_MIN_CIDR = 84,            /* KLINE_MIN_CIDR  */
+  YYSYMBOL_KLINE_MIN_CIDR6 = 85,           /* KLINE_MIN_CIDR6  */
+  YYSYMBOL_KNOCK_CLIENT_COUNT = 86,        /* KNOCK_CLIENT_COUNT  */
+  YYSYMBOL_KNOCK_CLIENT_TIME = 87,         /* KNOCK_CLIENT_TIME  */
+  YYSYMBOL_KNOCK_DELAY_CHANNEL = 88,       /* KNOCK_DELAY_CHANNEL  */
+  YYSYMBOL_LEAF_MASK = 89,                 /* LEAF_MASK  */
+  YYSYMBOL_LISTEN = 90,                    /* LISTEN  */
+  YYSYMBOL_MASK = 91,                      /* MASK  */
+  YYSYMBOL_MAX_ACCEPT = 92,                /* MAX_ACCEPT  */
+  YYSYMBOL_MAX_BANS = 93,                  /* MAX_BANS  */
+  YYSYMBOL_MAX_BANS_LARGE = 94,            /* MAX_BANS_LARGE  */
+  YYSYMBOL_MAX_CHANNELS = 95,              /* MAX_CHANNELS  */
+  YYSYMBOL_MAX_IDLE = 96,                  /* MAX_IDLE  */
+  YYSYMBOL_MAX_INVITES = 97,               /* MAX_INVITES  */
+  YYSYMBOL_MAX_MONITOR = 98,               /* MAX_MONITOR  */
+  YYSYMBOL_MAX_NICK_CHANGES = 99,          /* MAX_NICK_CHANGES  */
+  YYSYMBOL_MAX_NICK_LENGTH = 100,          /* MAX_NICK_LENGTH  */
+  YYSYMBOL_MAX_NICK_TIME = 101,            /* MAX_NICK_TIME  */
+  YYSYMBOL_MAX_NUMBER = 102,               /* MAX_NUMBER  */
+  YYSYMBOL_MAX_TARGETS = 103,              /* MAX_TARGETS  */
+  YYSYMBOL_MAX_TOPIC_LENGTH = 104,         /* MAX_TOPIC_LENGTH  */
+  YYSYMBOL_MIN_IDLE = 105,                 /* MIN_IDLE  */
+  YYSYMBOL_MIN_NONWILDCARD = 106,          /* MIN_NONWILDCARD  */
+  YYSYMBOL_MIN_NONWILDCARD_SIMPLE = 107,   /* MIN_NONWILDCARD_SIMPLE  */
+  YYSYMBOL_MODULE = 108,                   /* MODULE  */
+  YYSYMBOL_MODULES = 109,                  /* MODULES  */
+  YYSYMBOL_MOTD = 110,                     /* MOTD  */
+  YYSYMBOL_NAME = 111,                     /* NAME  */
+  YYSYMBOL_NEED_IDENT = 112,               /* NEED_IDENT  */
+  YYSYMBOL_NEED_PASSWORD = 113,            /* NEED_PASSWORD  */
+  YYSYMBOL_NETWORK_DESCRIPTION = 114,      /* NETWORK_DESCRIPTION  */
+  YYSYMBOL_NETWORK_NAME = 115,             /* NETWORK_NAME  */
+  YYSYMBOL_NICK = 116,                     /* NICK  */
+  YYSYMBOL_NO_OPER_FLOOD = 117,            /* NO_OPER_FLOOD  */
+  YYSYMBOL_NO_TILDE = 118,                 /* NO_TILDE  */
+  YYSYMBOL_NUMBER_PER_CIDR = 119,          /* NUMBER_PER_CIDR  */
+  YYSYMBOL_NUMBER_PER_IP_GLOBAL = 120,     /* NUMBER_PER_IP_GLOBAL  */
+  YYSYMBOL_NUMBER_PER_IP_LOCAL = 121,      /* NUMBER_PER_IP_LOCAL  */
+  YYSYMBOL_OPER_ONLY_UMODES = 122,         /* OPER_ONLY_UMODES  */
+  YYSYMBOL_OPER_UMODES = 123,              /* OPER_UMODES  */
+  YYSYMBOL_OPERATOR = 124,                 /* OPERATOR  */
+  YYSYMBOL_OPERS_BYPASS_CALLERID = 125,    /* OPERS_BYPASS_CALLERID  */
+  YYSYMBOL_PACE_WAIT = 126,                /* PACE_WAIT  */
+  YYSYMBOL_PACE_WAIT_SIMPLE = 127,         /* PACE_WAIT_SIMPLE  */
+  YYSYMBOL_PASSWORD = 128,                 /* PASSWORD  */
+  YYSYMBOL_PATH = 129,                     /* PATH  */
+  YYSYMBOL_PING_COOKIE = 130,              /* PING_COOKIE  */
+  YYSYMBOL_PING_TIME = 131,                /* PING_TIME  */
+  YYSYMBOL_PORT = 132,                     /* PORT  */
+  YYSYMBOL_RANDOM_IDLE = 133,              /* RANDOM_IDLE  */
+  YYSYMBOL_REASON = 134,                   /* REASON  */
+  YYSYMBOL_REDIRPORT = 135,                /* REDIRPORT  */
+  YYSYMBOL_REDIRSERV = 136,                /* REDIRSERV  */
+  YYSYMBOL_REHASH = 137,                   /* REHASH  */
+  YYSYMBOL_REMOTE = 138,                   /* REMOTE  */
+  YYSYMBOL_REMOTEBAN = 139,                /* REMOTEBAN  */
+  YYSYMBOL_RESV = 140,                     /* RESV  */
+  YYSYMBOL_RESV_EXEMPT = 141,              /* RESV_EXEMPT  */
+  YYSYMBOL_REUSEPORT = 142,                /* REUSEPORT  */
+  YYSYMBOL_RSA_PRIVATE_KEY_FILE = 143,     /* RSA_PRIVATE_KEY_FILE  */
+  YYSYMBOL_SECONDS = 144,                  /* SECONDS  */
+  YYSYMBOL_MINUTES = 145,                  /* MINUTES  */
+  YYSYMBOL_HOURS = 146,                    /* HOURS  */
+  YYSYMBOL_DAYS = 147,                     /* DAYS  */
+  YYSYMBOL_WEEKS = 148,                    /* WEEKS  */
+  YYSYMBOL_MONTHS = 149,                   /* MONTHS  */
+  YYSYMBOL_YEARS = 150,                    /* YEARS  */
+  YYSYMBOL_SEND_PASSWORD = 151,            /* SEND_PASSWORD  */
+  YYSYMBOL_SENDQ = 152,                    /* SENDQ  */
+  YYSYMBOL_SERVERHIDE = 153,               /* SERVERHIDE  */
+  YYSYMBOL_SERVERINFO = 154,               /* SERVERINFO  */
+  YYSYMBOL_SHORT_MOTD = 155,               /* SHORT_MOTD  */
+  YYSYMBOL_SPOOF = 156,                    /* SPOOF  */
+  YYSYMBOL_SQUIT = 157,                    /* SQUIT  */
+  YYSYMBOL_STATS_E_DISABLED = 158,         /* STATS_E_DISABLED  */
+  YYSYMBOL_STATS_I_OPER_ONLY = 159,        /* STATS_I_OPER_ONLY  */
+  YYSYMBOL_STATS_K_OPER_ONLY = 160,        /* STATS_K_OPER_ONLY  */
+  YYSYMBOL_STATS_M_OPER_ONLY = 161,        /* STATS_M_OPER_ONLY  */
+  YYSYMBOL_STATS_O_OPER_ONLY = 162,        /* STATS_O_OPER_ONLY  */
+  YYSYMBOL_STATS_P_OPER_ONLY = 163,        /* STATS_P_OPER_ONLY  */
+  YYSYMBOL_STATS_U_OPER_ONLY = 164,        /* STATS_U_OPER_ONLY  */
+  YYSYMBOL_T_ALL = 165,                    /* T_ALL  */
+  YYSYMBOL_T_BIND = 166,                   /* T_BIND  */
+  YYSYMBOL_T_CALLERID = 167,               /* T_CALLERID  */
+  YYSYMBOL_T_CCONN = 168,                  /* T_CCONN  */
+  YYSYMBOL_T_COMMAND = 169,                /* T_COMMAND  */
+  YYSYMBOL_T_CLUSTER = 170,                /* T_CLUSTER  */
+  YYSYMBOL_T_COMPRESSED = 171,             /* T_COMPRESSED  */
+  YYSYMBOL_T_DEAF = 172,                   /* T_DEAF  */
+  YYSYMBOL_T_DEBUG = 173,                  /* T_DEBUG  */
+  YYSYMBOL_T_DLINE = 174,                  /* T_DLINE  */
+  YYSYMBOL_T_EXTERNAL = 175,               /* T_EXTERNAL  */
+  YYSYMBOL_T_FARCONNECT = 176,             /* T_FARCONNECT  */
+  YYSYMBOL_T_FILE = 177,                   /* T_FILE  */
+  YYSYMBOL_T_FLOOD = 178,                  /* T_FLOOD  */
+  YYSYMBOL_T_GLOBOPS = 179,                /* T_GLOBOPS  */
+  YYSYMBOL_T_INVISIBLE = 180,              /* T_INVISIBLE  */
+  YYSYMBOL_T_IPV4 = 181,                   /* T_IPV4  */
+  YYSYMBOL_T_IPV6 = 182,                   /* T_IPV6  */
+  YYSYMBOL_T_LOCOPS = 183,                 /* T_LOCOPS  */
+  YYSYMBOL_T_LOG = 184,                    /* T_LOG  */
+  YYSYMBOL_T_METRICS = 185,                /* T_METRICS  */
+  YYSYMBOL_T_NCHANGE = 186,                /* T_NCHANGE  */
+  YYSYMBOL_T_NONONREG = 187,               /* T_NONONREG  */
+  YYSYMBOL_T_OPME = 188,                   /* T_OPME  */
+  YYSYMBOL_T_PREPEND = 189,                /* T_PREPEND  */
+  YYSYMBOL_T_PSEUDO = 190,                 /* T_PSEUDO  */
+  YYSYMBOL_T_RECVQ = 191,                  /* T_RECVQ  */
+  YYSYMBOL_T_REJ = 192,                    /* T_REJ  */
+  YYSYMBOL_T_RESTART = 193,                /* T_RESTART  */
+  YYSYMBOL_T_SERVER = 194,                 /* T_SERVER  */
+  YYSYMBOL_T_SERVICE = 195,                /* T_SERVICE  */
+  YYSYMBOL_T_SERVNOTICE = 196,             /* T_SERVNOTICE  */
+  YYSYMBOL_T_SET = 197,                    /* T_SET  */
+  YYSYMBOL_T_SHARED = 198,                 /* T_SHARED  */
+  YYSYMBOL_T_SIZE = 199,                   /* T_SIZE  */
+  YYSYMBOL_T_SKILL = 200,                  /* T_SKILL  */
+  YYSYMBOL_T_SOFTCALLERID = 201,           /* T_SOFTCALLERID  */
+  YYSYMBOL_T_SPY = 202,                    /* T_SPY  */
+  YYSYMBOL_T_TARGET = 203,                 /* T_TARGET  */
+  YYSYMBOL_T_TLS = 204,                    /* T_TLS  */
+  YYSYMBOL_T_UMODES = 205,                 /* T_UMODES  */
+  YYSYMBOL_T_UNDLINE = 206,                /* T_UNDLINE  */
+  YYSYMBOL_T_UNLIMITED = 207,              /* T_UNLIMITED  */
+  YYSYMBOL_T_UNRESV = 208,                 /* T_UNRESV  */
+  YYSYMBOL_T_UNXLINE = 209,                /* T_UNXLINE  */
+  YYSYMBOL_T_WALLOP = 210,                 /* T_WALLOP  */
+  YYSYMBOL_T_WALLOPS = 211,                /* T_WALLOPS  */
+  YYSYMBOL_T_WEBIRC = 212,                 /* T_WEBIRC  */
+  YYSYMBOL_TBOOL = 213,                    /* TBOOL  */
+  YYSYMBOL_THROTTLE_COUNT = 214,           /* THROTTLE_COUNT  */
+  YYSYMBOL_THROTTLE_TIME = 215,            /* THROTTLE_TIME  */
+  YYSYMBOL_TIMEOUT = 216,                  /* TIMEOUT  */
+  YYSYMBOL_TLS_CERTIFICATE_FILE = 217,     /* TLS_CERTIFICATE_FILE  */
+  YYSYMBOL_TLS_CERTIFICATE_FINGERPRINT = 218, /* TLS_CERTIFICATE_FINGERPRINT  */
+  YYSYMBOL_TLS_CIPHER_LIST = 219,          /* TLS_CIPHER_LIST  */
+  YYSYMBOL_TLS_CIPHER_SUITES = 220,        /* TLS_CIPHER_SUITES  */
+  YYSYMBOL_TLS_CONNECTION_REQUIRED = 221,  /* TLS_CONNECTION_REQUIRED  */
+  YYSYMBOL_TLS_DH_PARAM_FILE = 222,        /* TLS_DH_PARAM_FILE  */
+  YYSYMBOL_TLS_HANDSHAKE_THREADS = 223,    /* TLS_HANDSHAKE_THREADS  */
+  YYSYMBOL_TLS_KERNEL_OFFLOAD = 224,       /* TLS_KERNEL_OFFLOAD  */
+  YYSYMBOL_TLS_MESSAGE_DIGEST_ALGORITHM = 225, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+  YYSYMBOL_TLS_SESSION_CACHE_SIZE = 226,   /* TLS_SESSION_CACHE_SIZE  */
+  YYSYMBOL_TLS_SUPPORTED_GROUPS = 227,     /* TLS_SUPPORTED_GROUPS  */
+  YYSYMBOL_TLS_TICKET_KEY_FILE = 228,      /* TLS_TICKET_KEY_FILE  */
+  YYSYMBOL_TS_MAX_DELTA = 229,             /* TS_MAX_DELTA  */
+  YYSYMBOL_TS_WARN_DELTA = 230,            /* TS_WARN_DELTA  */
+  YYSYMBOL_TWODOTS = 231,                  /* TWODOTS  */
+  YYSYMBOL_TYPE = 232,                     /* TYPE  */
+  YYSYMBOL_UNKLINE = 233,                  /* UNKLINE  */
+  YYSYMBOL_USE_LOGGING = 234,              /* USE_LOGGING  */
+  YYSYMBOL_USER = 235,                     /* USER  */
+  YYSYMBOL_VHOST = 236,                    /* VHOST  */
+  YYSYMBOL_VHOST6 = 237,                   /* VHOST6  */
+  YYSYMBOL_WARN_NO_CONNECT_BLOCK = 238,    /* WARN_NO_CONNECT_BLOCK  */
+  YYSYMBOL_WHOIS = 239,                    /* WHOIS  */
+  YYSYMBOL_WHOWAS_HISTORY_LENGTH = 240,    /* WHOWAS_HISTORY_LENGTH  */
+  YYSYMBOL_XLINE = 241,                    /* XLINE  */
+  YYSYMBOL_XLINE_EXEMPT = 242,             /* XLINE_EXEMPT  */
+  YYSYMBOL_QSTRING = 243,                  /* QSTRING  */
+  YYSYMBOL_NUMBER = 244,                   /* NUMBER  */
+  YYSYMBOL_245_ = 245,                     /* ';'  */
+  YYSYMBOL_246_ = 246,                     /* '}'  */
+  YYSYMBOL_247_ = 247,                     /* '{'  */
+  YYSYMBOL_248_ = 248,                     /* '='  */
+  YYSYMBOL_249_ = 249,                     /* ','  */
+  YYSYMBOL_250_ = 250,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 251,                 /* $accept  */
+  YYSYMBOL_conf = 252,                     /* conf  */
+  YYSYMBOL_conf_item = 253,                /* conf_item  */
+  YYSYMBOL_timespec_ = 254,                /* timespec_  */
+  YYSYMBOL_timespec = 255,                 /* timespec  */
+  YYSYMBOL_sizespec_ = 256,                /* sizespec_  */
+  YYSYMBOL_sizespec = 257,                 /* sizespec  */
+  YYSYMBOL_modules_entry = 258,            /* modules_entry  */
+  YYSYMBOL_modules_items = 259,            /* modules_items  */
+  YYSYMBOL_modules_item = 260,             /* modules_item  */
+  YYSYMBOL_modules_module = 261,           /* modules_module  */
+  YYSYMBOL_modules_path = 262,             /* modules_path  */
+  YYSYMBOL_serverinfo_entry = 263,         /* serverinfo_entry  */
+  YYSYMBOL_serverinfo_items = 264,         /* serverinfo_items  */
+  YYSYMBOL_serverinfo_item = 265,          /* serverinfo_item  */
+  YYSYMBOL_serverinfo_tls_certificate_file = 266, /* serverinfo_tls_certificate_file  */
+  YYSYMBOL_serverinfo_rsa_private_key_file = 267, /* serverinfo_rsa_private_key_file  */
+  YYSYMBOL_serverinfo_tls_dh_param_file = 268, /* serverinfo_tls_dh_param_file  */
+  YYSYMBOL_serverinfo_tls_cipher_list = 269, /* serverinfo_tls_cipher_list  */
+  YYSYMBOL_serverinfo_tls_cipher_suites = 270, /* serverinfo_tls_cipher_suites  */
+  YYSYMBOL_serverinfo_tls_message_digest_algorithm = 271, /* serverinfo_tls_message_digest_algorithm  */
+  YYSYMBOL_serverinfo_tls_supported_groups = 272, /* serverinfo_tls_supported_groups  */
+  YYSYMBOL_serverinfo_name = 273,          /* serverinfo_name  */
+  YYSYMBOL_serverinfo_sid = 274,           /* serverinfo_sid  */
+  YYSYMBOL_serverinfo_description = 275,   /* serverinfo_description  */
+  YYSYMBOL_serverinfo_network_name = 276,  /* serverinfo_network_name  */
+  YYSYMBOL_serverinfo_network_description = 277, /* serverinfo_network_description  */
+  YYSYMBOL_serverinfo_default_max_clients = 278, /* serverinfo_default_max_clients  */
+  YYSYMBOL_serverinfo_max_nick_length = 279, /* serverinfo_max_nick_length  */
+  YYSYMBOL_serverinfo_max_topic_length = 280, /* serverinfo_max_topic_length  */
+  YYSYMBOL_serverinfo_hub = 281,           /* serverinfo_hub  */
+  YYSYMBOL_serverinfo_tls_handshake_threads = 282, /* serverinfo_tls_handshake_threads  */
+  YYSYMBOL_serverinfo_tls_kernel_offload = 283, /* serverinfo_tls_kernel_offload  */
+  YYSYMBOL_serverinfo_tls_session_cache_size = 284, /* serverinfo_tls_session_cache_size  */
+  YYSYMBOL_serverinfo_tls_ticket_key_file = 285, /* serverinfo_tls_ticket_key_file  */
+  YYSYMBOL_admin_entry = 286,              /* admin_entry  */
+  YYSYMBOL_admin_items = 287,              /* admin_items  */
+  YYSYMBOL_admin_item = 288,               /* admin_item  */
+  YYSYMBOL_admin_name = 289,               /* admin_name  */
+  YYSYMBOL_admin_email = 290,              /* admin_email  */
+  YYSYMBOL_admin_description = 291,        /* admin_description  */
+  YYSYMBOL_motd_entry = 292,               /* motd_entry  */
+  YYSYMBOL_293_1 = 293,                    /* $@1  */
+  YYSYMBOL_motd_items = 294,               /* motd_items  */
+  YYSYMBOL_motd_item = 295,                /* motd_item  */
+  YYSYMBOL_motd_mask = 296,                /* motd_mask  */
+  YYSYMBOL_motd_file = 297,                /* motd_file  */
+  YYSYMBOL_pseudo_entry = 298,             /* pseudo_entry  */
+  YYSYMBOL_299_2 = 299,                    /* $@2  */
+  YYSYMBOL_pseudo_items = 300,             /* pseudo_items  */
+  YYSYMBOL_pseudo_item = 301,              /* pseudo_item  */
+  YYSYMBOL_pseudo_command = 302,           /* pseudo_command  */
+  YYSYMBOL_pseudo_name = 303,              /* pseudo_name  */
+  YYSYMBOL_pseudo_prepend = 304,           /* pseudo_prepend  */
+  YYSYMBOL_pseudo_target = 305,            /* pseudo_target  */
+  YYSYMBOL_logging_entry = 306,            /* logging_entry  */
+  YYSYMBOL_logging_items = 307,            /* logging_items  */
+  YYSYMBOL_logging_item = 308,             /* logging_item  */
+  YYSYMBOL_logging_use_logging = 309,      /* logging_use_logging  */
+  YYSYMBOL_logging_file_entry = 310,       /* logging_file_entry  */
+  YYSYMBOL_311_3 = 311,                    /* $@3  */
+  YYSYMBOL_logging_file_items = 312,       /* logging_file_items  */
+  YYSYMBOL_logging_file_item = 313,        /* logging_file_item  */
+  YYSYMBOL_logging_file_name = 314,        /* logging_file_name  */
+  YYSYMBOL_logging_file_size = 315,        /* logging_file_size  */
+  YYSYMBOL_logging_file_type = 316,        /* logging_file_type  */
+  YYSYMBOL_317_4 = 317,                    /* $@4  */
+  YYSYMBOL_logging_file_type_items = 318,  /* logging_file_type_items  */
+  YYSYMBOL_logging_file_type_item = 319,   /* logging_file_type_item  */
+  YYSYMBOL_oper_entry = 320,               /* oper_entry  */
+  YYSYMBOL_321_5 = 321,                    /* $@5  */
+  YYSYMBOL_oper_items = 322,               /* oper_items  */
+  YYSYMBOL_oper_item = 323,                /* oper_item  */
+  YYSYMBOL_oper_name = 324,                /* oper_name  */
+  YYSYMBOL_oper_user = 325,                /* oper_user  */
+  YYSYMBOL_oper_password = 326,            /* oper_password  */
+  YYSYMBOL_oper_whois = 327,               /* oper_whois  */
+  YYSYMBOL_oper_encrypted = 328,           /* oper_encrypted  */
+  YYSYMBOL_oper_tls_certificate_fingerprint = 329, /* oper_tls_certificate_fingerprint  */
+  YYSYMBOL_oper_tls_connection_required = 330, /* oper_tls_connection_required  */
+  YYSYMBOL_oper_class = 331,               /* oper_class  */
+  YYSYMBOL_oper_umodes = 332,              /* oper_umodes  */
+  YYSYMBOL_333_6 = 333,                    /* $@6  */
+  YYSYMBOL_oper_umodes_items = 334,        /* oper_umodes_items  */
+  YYSYMBOL_oper_umodes_item = 335,         /* oper_umodes_item  */
+  YYSYMBOL_oper_flags = 336,               /* oper_flags  */
+  YYSYMBOL_337_7 = 337,                    /* $@7  */
+  YYSYMBOL_oper_flags_items = 338,         /* oper_flags_items  */
+  YYSYMBOL_oper_flags_item = 339,          /* oper_flags_item  */
+  YYSYMBOL_class_entry = 340,              /* class_entry  */
+  YYSYMBOL_341_8 = 341,                    /* $@8  */
+  YYSYMBOL_class_items = 342,              /* class_items  */
+  YYSYMBOL_class_item = 343,               /* class_item  */
+  YYSYMBOL_class_name = 344,               /* class_name  */
+  YYSYMBOL_class_ping_time = 345,          /* class_ping_time  */
+  YYSYMBOL_class_number_per_ip_local = 346, /* class_number_per_ip_local  */
+  YYSYMBOL_class_number_per_ip_global = 347, /* class_number_per_ip_global  */
+  YYSYMBOL_class_connectfreq = 348,        /* class_connectfreq  */
+  YYSYMBOL_class_max_channels = 349,       /* class_max_channels  */
+  YYSYMBOL_class_max_number = 350,         /* class_max_number  */
+  YYSYMBOL_class_sendq = 351,              /* class_sendq  */
+  YYSYMBOL_class_recvq = 352,              /* class_recvq  */
+  YYSYMBOL_class_flood_burst = 353,        /* class_flood_burst  */
+  YYSYMBOL_class_flood_rate = 354,         /* class_flood_rate  */
+  YYSYMBOL_class_cidr_bitlen_ipv4 = 355,   /* class_cidr_bitlen_ipv4  */
+  YYSYMBOL_class_cidr_bitlen_ipv6 = 356,   /* class_cidr_bitlen_ipv6  */
+  YYSYMBOL_class_number_per_cidr = 357,    /* class_number_per_cidr  */
+  YYSYMBOL_class_min_idle = 358,           /* class_min_idle  */
+  YYSYMBOL_class_max_idle = 359,           /* class_max_idle  */
+  YYSYMBOL_class_flags = 360,              /* class_flags  */
+  YYSYMBOL_361_9 = 361,                    /* $@9  */
+  YYSYMBOL_class_flags_items = 362,        /* class_flags_items  */
+  YYSYMBOL_class_flags_item = 363,         /* class_flags_item  */
+  YYSYMBOL_listen_entry = 364,             /* listen_entry  */
+  YYSYMBOL_365_10 = 365,                   /* $@10  */
+  YYSYMBOL_listen_flags = 366,             /* listen_flags  */
+  YYSYMBOL_367_11 = 367,                   /* $@11  */
+  YYSYMBOL_listen_flags_items = 368,       /* listen_flags_items  */
+  YYSYMBOL_listen_flags_item = 369,        /* listen_flags_item  */
+  YYSYMBOL_listen_items = 370,             /* listen_items  */
+  YYSYMBOL_listen_item = 371,              /* listen_item  */
+  YYSYMBOL_listen_port = 372,              /* listen_port  */
+  YYSYMBOL_373_12 = 373,                   /* $@12  */
+  YYSYMBOL_port_items = 374,               /* port_items  */
+  YYSYMBOL_port_item = 375,                /* port_item  */
+  YYSYMBOL_listen_address = 376,           /* listen_address  */
+  YYSYMBOL_listen_host = 377,              /* listen_host  */
+  YYSYMBOL_auth_entry = 378,               /* auth_entry  */
+  YYSYMBOL_379_13 = 379,                   /* $@13  */
+  YYSYMBOL_auth_items = 380,               /* auth_items  */
+  YYSYMBOL_auth_item = 381,                /* auth_item  */
+  YYSYMBOL_auth_user = 382,                /* auth_user  */
+  YYSYMBOL_auth_passwd = 383,              /* auth_passwd  */
+  YYSYMBOL_auth_class = 384,               /* auth_class  */
+  YYSYMBOL_auth_encrypted = 385,           /* auth_encrypted  */
+  YYSYMBOL_auth_flags = 386,               /* auth_flags  */
+  YYSYMBOL_387_14 = 387,                   /* $@14  */
+  YYSYMBOL_auth_flags_items = 388,         /* auth_flags_items  */
+  YYSYMBOL_auth_flags_item = 389,          /* auth_flags_item  */
+  YYSYMBOL_auth_spoof = 390,               /* auth_spoof  */
+  YYSYMBOL_auth_redir_serv = 391,          /* auth_redir_serv  */
+  YYSYMBOL_auth_redir_port = 392,          /* auth_redir_port  */
+  YYSYMBOL_resv_entry = 393,               /* resv_entry  */
+  YYSYMBOL_394_15 = 394,                   /* $@15  */
+  YYSYMBOL_resv_items = 395,               /* resv_items  */
+  YYSYMBOL_resv_item = 396,                /* resv_item  */
+  YYSYMBOL_resv_mask = 397,                /* resv_mask  */
+  YYSYMBOL_resv_reason = 398,              /* resv_reason  */
+  YYSYMBOL_resv_exempt = 399,              /* resv_exempt  */
+  YYSYMBOL_service_entry = 400,            /* service_entry  */
+  YYSYMBOL_service_items = 401,            /* service_items  */
+  YYSYMBOL_service_item = 402,             /* service_item  */
+  YYSYMBOL_service_name = 403,             /* service_name  */
+  YYSYMBOL_shared_entry = 404,             /* shared_entry  */
+  YYSYMBOL_405_16 = 405,                   /* $@16  */
+  YYSYMBOL_shared_items = 406,             /* shared_items  */
+  YYSYMBOL_shared_item = 407,              /* shared_item  */
+  YYSYMBOL_shared_name = 408,              /* shared_name  */
+  YYSYMBOL_shared_user = 409,              /* shared_user  */
+  YYSYMBOL_shared_type = 410,              /* shared_type  */
+  YYSYMBOL_411_17 = 411,                   /* $@17  */
+  YYSYMBOL_shared_types = 412,             /* shared_types  */
+  YYSYMBOL_shared_type_item = 413,         /* shared_type_item  */
+  YYSYMBOL_cluster_entry = 414,            /* cluster_entry  */
+  YYSYMBOL_415_18 = 415,                   /* $@18  */
+  YYSYMBOL_cluster_items = 416,            /* cluster_items  */
+  YYSYMBOL_cluster_item = 417,             /* cluster_item  */
+  YYSYMBOL_cluster_name = 418,             /* cluster_name  */
+  YYSYMBOL_cluster_type = 419,             /* cluster_type  */
+  YYSYMBOL_420_19 = 420,                   /* $@19  */
+  YYSYMBOL_cluster_types = 421,            /* cluster_types  */
+  YYSYMBOL_cluster_type_item = 422,        /* cluster_type_item  */
+  YYSYMBOL_connect_entry = 423,            /* connect_entry  */
+  YYSYMBOL_424_20 = 424,                   /* $@20  */
+  YYSYMBOL_connect_items = 425,            /* connect_items  */
+  YYSYMBOL_connect_item = 426,             /* connect_item  */
+  YYSYMBOL_connect_name = 427,             /* connect_name  */
+  YYSYMBOL_connect_host = 428,             /* connect_host  */
+  YYSYMBOL_connect_timeout = 429,          /* connect_timeout  */
+  YYSYMBOL_connect_bind = 430,             /* connect_bind  */
+  YYSYMBOL_connect_send_password = 431,    /* connect_send_password  */
+  YYSYMBOL_connect_accept_password = 432,  /* connect_accept_password  */
+  YYSYMBOL_connect_tls_certificate_fingerprint = 433, /* connect_tls_certificate_fingerprint  */
+  YYSYMBOL_connect_port = 434,             /* connect_port  */
+  YYSYMBOL_connect_aftype = 435,           /* connect_aftype  */
+  YYSYMBOL_connect_flags = 436,            /* connect_flags  */
+  YYSYMBOL_437_21 = 437,                   /* $@21  */
+  YYSYMBOL_connect_flags_items = 438,      /* connect_flags_items  */
+  YYSYMBOL_connect_flags_item = 439,       /* connect_flags_item  */
+  YYSYMBOL_connect_encrypted = 440,        /* connect_encrypted  */
+  YYSYMBOL_connect_hub_mask = 441,         /* connect_hub_mask  */
+  YYSYMBOL_connect_leaf_mask = 442,        /* connect_leaf_mask  */
+  YYSYMBOL_connect_class = 443,            /* connect_class  */
+  YYSYMBOL_connect_tls_cipher_list = 444,  /* connect_tls_cipher_list  */
+  YYSYMBOL_kill_entry = 445,               /* kill_entry  */
+  YYSYMBOL_446_22 = 446,                   /* $@22  */
+  YYSYMBOL_kill_items = 447,               /* kill_items  */
+  YYSYMBOL_kill_item = 448,                /* kill_item  */
+  YYSYMBOL_kill_user = 449,                /* kill_user  */
+  YYSYMBOL_kill_reason = 450,              /* kill_reason  */
+  YYSYMBOL_deny_entry = 451,               /* deny_entry  */
+  YYSYMBOL_452_23 = 452,                   /* $@23  */
+  YYSYMBOL_deny_items = 453,               /* deny_items  */
+  YYSYMBOL_deny_item = 454,                /* deny_item  */
+  YYSYMBOL_deny_ip = 455,                  /* deny_ip  */
+  YYSYMBOL_deny_reason = 456,              /* deny_reason  */
+  YYSYMBOL_exempt_entry = 457,             /* exempt_entry  */
+  YYSYMBOL_exempt_items = 458,             /* exempt_items  */
+  YYSYMBOL_exempt_item = 459,              /* exempt_item  */
+  YYSYMBOL_exempt_ip = 460,                /* exempt_ip  */
+  YYSYMBOL_gecos_entry = 461,              /* gecos_entry  */
+  YYSYMBOL_462_24 = 462,                   /* $@24  */
+  YYSYMBOL_gecos_items = 463,              /* gecos_items  */
+  YYSYMBOL_gecos_item = 464,               /* gecos_item  */
+  YYSYMBOL_gecos_name = 465,               /* gecos_name  */
+  YYSYMBOL_gecos_reason = 466,             /* gecos_reason  */
+  YYSYMBOL_general_entry = 467,            /* general_entry  */
+  YYSYMBOL_general_items = 468,            /* general_items  */
+  YYSYMBOL_general_item = 469,             /* general_item  */
+  YYSYMBOL_general_away_count = 470,       /* general_away_count  */
+  YYSYMBOL_general_away_time = 471,        /* general_away_time  */
+  YYSYMBOL_general_max_monitor = 472,      /* general_max_monitor  */
+  YYSYMBOL_general_whowas_history_length = 473, /* general_whowas_history_length  */
+  YYSYMBOL_general_cycle_on_host_change = 474, /* general_cycle_on_host_change  */
+  YYSYMBOL_general_dline_min_cidr = 475,   /* general_dline_min_cidr  */
+  YYSYMBOL_general_dline_min_cidr6 = 476,  /* general_dline_min_cidr6  */
+  YYSYMBOL_general_kline_min_cidr = 477,   /* general_kline_min_cidr  */
+  YYSYMBOL_general_kline_min_cidr6 = 478,  /* general_kline_min_cidr6  */
+  YYSYMBOL_general_kill_chase_time_limit = 479, /* general_kill_chase_time_limit  */
+  YYSYMBOL_general_failed_oper_notice = 480, /* general_failed_oper_notice  */
+  YYSYMBOL_general_anti_nick_flood = 481,  /* general_anti_nick_flood  */
+  YYSYMBOL_general_max_nick_time = 482,    /* general_max_nick_time  */
+  YYSYMBOL_general_max_nick_changes = 483, /* general_max_nick_changes  */
+  YYSYMBOL_general_max_accept = 484,       /* general_max_accept  */
+  YYSYMBOL_general_anti_spam_exit_message_time = 485, /* general_anti_spam_exit_message_time  */
+  YYSYMBOL_general_ts_warn_delta = 486,    /* general_ts_warn_delta  */
+  YYSYMBOL_general_ts_max_delta = 487,     /* general_ts_max_delta  */
+  YYSYMBOL_general_invisible_on_connect = 488, /* general_invisible_on_connect  */
+  YYSYMBOL_general_warn_no_connect_block = 489, /* general_warn_no_connect_block  */
+  YYSYMBOL_general_stats_e_disabled = 490, /* general_stats_e_disabled  */
+  YYSYMBOL_general_stats_m_oper_only = 491, /* general_stats_m_oper_only  */
+  YYSYMBOL_general_stats_o_oper_only = 492, /* general_stats_o_oper_only  */
+  YYSYMBOL_general_stats_P_oper_only = 493, /* general_stats_P_oper_only  */
+  YYSYMBOL_general_stats_u_oper_only = 494, /* general_stats_u_oper_only  */
+  YYSYMBOL_general_stats_k_oper_only = 495, /* general_stats_k_oper_only  */
+  YYSYMBOL_general_stats_i_oper_only = 496, /* general_stats_i_oper_only  */
+  YYSYMBOL_general_pace_wait = 497,        /* general_pace_wait  */
+  YYSYMBOL_general_caller_id_wait = 498,   /* general_caller_id_wait  */
+  YYSYMBOL_general_opers_bypass_callerid = 499, /* general_opers_bypass_callerid  */
+  YYSYMBOL_general_pace_wait_simple = 500, /* general_pace_wait_simple  */
+  YYSYMBOL_general_short_motd = 501,       /* general_short_motd  */
+  YYSYMBOL_general_no_oper_flood = 502,    /* general_no_oper_flood  */
+  YYSYMBOL_general_dots_in_ident = 503,    /* general_dots_in_ident  */
+  YYSYMBOL_general_max_targets = 504,      /* general_max_targets  */
+  YYSYMBOL_general_ping_cookie = 505,      /* general_ping_cookie  */
+  YYSYMBOL_general_disable_auth = 506,     /* general_disable_auth  */
+  YYSYMBOL_general_auth_timeout = 507,     /* general_auth_timeout  */
+  YYSYMBOL_general_ident_timeout = 508,    /* general_ident_timeout  */
+  YYSYMBOL_general_ident_cache_time = 509, /* general_ident_cache_time  */
+  YYSYMBOL_general_ident_max_pending = 510, /* general_ident_max_pending  */
+  YYSYMBOL_general_throttle_count = 511,   /* general_throttle_count  */
+  YYSYMBOL_general_throttle_time = 512,    /* general_throttle_time  */
+  YYSYMBOL_general_oper_umodes = 513,      /* general_oper_umodes  */
+  YYSYMBOL_514_25 = 514,                   /* $@25  */
+  YYSYMBOL_umode_oitems = 515,             /* umode_oitems  */
+  YYSYMBOL_umode_oitem = 516,              /* umode_oitem  */
+  YYSYMBOL_general_oper_only_umodes = 517, /* general_oper_only_umodes  */
+  YYSYMBOL_518_26 = 518,                   /* $@26  */
+  YYSYMBOL_umode_items = 519,              /* umode_items  */
+  YYSYMBOL_umode_item = 520,               /* umode_item  */
+  YYSYMBOL_general_min_nonwildcard = 521,  /* general_min_nonwildcard  */
+  YYSYMBOL_general_min_nonwildcard_simple = 522, /* general_min_nonwildcard_simple  */
+  YYSYMBOL_general_default_floodcount = 523, /* general_default_floodcount  */
+  YYSYMBOL_general_default_floodtime = 524, /* general_default_floodtime  */
+  YYSYMBOL_channel_entry = 525,            /* channel_entry  */
+  YYSYMBOL_channel_items = 526,            /* channel_items  */
+  YYSYMBOL_channel_item = 527,             /* channel_item  */
+  YYSYMBOL_channel_enable_extbans = 528,   /* channel_enable_extbans  */
+  YYSYMBOL_channel_disable_fake_channels = 529, /* channel_disable_fake_channels  */
+  YYSYMBOL_channel_invite_client_count = 530, /* channel_invite_client_count  */
+  YYSYMBOL_channel_invite_client_time = 531, /* channel_invite_client_time  */
+  YYSYMBOL_channel_invite_delay_channel = 532, /* channel_invite_delay_channel  */
+  YYSYMBOL_channel_invite_expire_time = 533, /* channel_invite_expire_time  */
+  YYSYMBOL_channel_knock_client_count = 534, /* channel_knock_client_count  */
+  YYSYMBOL_channel_knock_client_time = 535, /* channel_knock_client_time  */
+  YYSYMBOL_channel_knock_delay_channel = 536, /* channel_knock_delay_channel  */
+  YYSYMBOL_channel_max_channels = 537,     /* channel_max_channels  */
+  YYSYMBOL_channel_max_invites = 538,      /* channel_max_invites  */
+  YYSYMBOL_channel_max_bans = 539,         /* channel_max_bans  */
+  YYSYMBOL_channel_max_bans_large = 540,   /* channel_max_bans_large  */
+  YYSYMBOL_channel_default_join_flood_count = 541, /* channel_default_join_flood_count  */
+  YYSYMBOL_channel_default_join_flood_time = 542, /* channel_default_join_flood_time  */
+  YYSYMBOL_serverhide_entry = 543,         /* serverhide_entry  */
+  YYSYMBOL_serverhide_items = 544,         /* serverhide_items  */
+  YYSYMBOL_serverhide_item = 545,          /* serverhide_item  */
+  YYSYMBOL_serverhide_flatten_links = 546, /* serverhide_flatten_links  */
+  YYSYMBOL_serverhide_flatten_links_delay = 547, /* serverhide_flatten_links_delay  */
+  YYSYMBOL_serverhide_flatten_links_file = 548, /* serverhide_flatten_links_file  */
+  YYSYMBOL_serverhide_disable_remote_commands = 549, /* serverhide_disable_remote_commands  */
+  YYSYMBOL_serverhide_hide_servers = 550,  /* serverhide_hide_servers  */
+  YYSYMBOL_serverhide_hide_services = 551, /* serverhide_hide_services  */
+  YYSYMBOL_serverhide_hidden_name = 552,   /* serverhide_hidden_name  */
+  YYSYMBOL_serverhide_hidden = 553,        /* serverhide_hidden  */
+  YYSYMBOL_serverhide_hide_server_ips = 554 /* serverhide_hide_server_ips  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
 
 
@@ -744,6 +1338,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -803,6 +1409,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_int16 yy_state_t;
 
@@ -821,6 +1428,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -839,17 +1447,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -878,7 +1492,7 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -943,8 +1557,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -1009,25 +1622,27 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1240
+#define YYLAST   1282
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  238
+#define YYNTOKENS  251
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  294
+#define YYNNTS  304
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  665
+#define YYNRULES  689
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1311
+#define YYNSTATES  1365
 
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   486
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   499
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -1037,15 +1652,15 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   236,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   237,   232,
-       2,   235,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   249,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   250,   245,
+       2,   248,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   234,     2,   233,     2,     2,     2,     2,
+       2,     2,     2,   247,     2,   246,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1081,137 +1696,151 @@ static const yytype_uint8 yytranslate[] =
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   227,   228,   229,   230,   231
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   366,   366,   367,   370,   371,   372,   373,   374,   375,
-     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
-     386,   387,   388,   389,   390,   391,   392,   393,   397,   397,
-     398,   399,   400,   401,   402,   403,   404,   405,   408,   408,
-     409,   410,   411,   412,   419,   421,   421,   422,   422,   422,
-     424,   430,   440,   442,   442,   443,   444,   445,   446,   447,
-     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
-     458,   459,   462,   471,   480,   489,   498,   507,   516,   525,
-     540,   555,   565,   579,   588,   611,   634,   657,   667,   669,
-     669,   670,   671,   672,   673,   675,   684,   693,   707,   706,
-     724,   724,   725,   725,   725,   727,   733,   744,   743,   762,
-     762,   763,   763,   763,   763,   763,   765,   771,   777,   783,
-     805,   806,   806,   808,   808,   809,   811,   818,   818,   831,
-     832,   834,   834,   835,   835,   837,   845,   848,   854,   853,
-     859,   859,   860,   864,   868,   872,   876,   880,   884,   888,
-     899,   898,   961,   961,   962,   963,   964,   965,   966,   967,
-     968,   969,   970,   971,   972,   974,   980,   986,   992,   998,
-    1009,  1015,  1026,  1033,  1032,  1038,  1038,  1039,  1043,  1047,
-    1051,  1055,  1059,  1063,  1067,  1071,  1075,  1079,  1083,  1087,
-    1091,  1095,  1099,  1103,  1107,  1111,  1115,  1119,  1123,  1130,
-    1129,  1135,  1135,  1136,  1140,  1144,  1148,  1152,  1156,  1160,
-    1164,  1168,  1172,  1176,  1180,  1184,  1188,  1192,  1196,  1200,
-    1204,  1208,  1212,  1216,  1220,  1224,  1228,  1232,  1236,  1240,
-    1244,  1248,  1259,  1258,  1314,  1314,  1315,  1316,  1317,  1318,
-    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
-    1329,  1330,  1332,  1338,  1344,  1350,  1356,  1362,  1368,  1374,
-    1380,  1387,  1393,  1399,  1405,  1414,  1424,  1423,  1429,  1429,
-    1430,  1434,  1445,  1444,  1451,  1450,  1455,  1455,  1456,  1460,
-    1464,  1468,  1472,  1478,  1478,  1479,  1479,  1479,  1479,  1479,
-    1481,  1481,  1483,  1483,  1485,  1498,  1515,  1521,  1532,  1531,
-    1578,  1578,  1579,  1580,  1581,  1582,  1583,  1584,  1585,  1586,
-    1587,  1589,  1595,  1601,  1607,  1619,  1618,  1624,  1624,  1625,
-    1629,  1633,  1637,  1641,  1645,  1649,  1653,  1657,  1663,  1677,
-    1686,  1700,  1699,  1714,  1714,  1715,  1715,  1715,  1715,  1717,
-    1723,  1729,  1739,  1741,  1741,  1742,  1742,  1744,  1761,  1760,
-    1783,  1783,  1784,  1784,  1784,  1784,  1786,  1792,  1812,  1811,
-    1817,  1817,  1818,  1822,  1826,  1830,  1834,  1838,  1842,  1846,
-    1850,  1854,  1865,  1864,  1883,  1883,  1884,  1884,  1884,  1886,
-    1893,  1892,  1898,  1898,  1899,  1903,  1907,  1911,  1915,  1919,
-    1923,  1927,  1931,  1935,  1946,  1945,  2023,  2023,  2024,  2025,
-    2026,  2027,  2028,  2029,  2030,  2031,  2032,  2033,  2034,  2035,
-    2036,  2037,  2038,  2039,  2041,  2047,  2053,  2059,  2065,  2078,
-    2091,  2097,  2103,  2107,  2114,  2113,  2118,  2118,  2119,  2123,
-    2129,  2140,  2146,  2152,  2158,  2174,  2173,  2197,  2197,  2198,
-    2198,  2198,  2200,  2220,  2231,  2230,  2255,  2255,  2256,  2256,
-    2256,  2258,  2264,  2274,  2276,  2276,  2277,  2277,  2279,  2297,
-    2296,  2317,  2317,  2318,  2318,  2318,  2320,  2326,  2336,  2338,
-    2338,  2339,  2340,  2341,  2342,  2343,  2344,  2345,  2346,  2347,
-    2348,  2349,  2350,  2351,  2352,  2353,  2354,  2355,  2356,  2357,
-    2358,  2359,  2360,  2361,  2362,  2363,  2364,  2365,  2366,  2367,
-    2368,  2369,  2370,  2371,  2372,  2373,  2374,  2375,  2376,  2377,
-    2378,  2379,  2380,  2381,  2382,  2383,  2384,  2387,  2392,  2397,
-    2402,  2407,  2412,  2417,  2422,  2427,  2432,  2437,  2442,  2447,
-    2452,  2457,  2462,  2467,  2472,  2477,  2482,  2487,  2492,  2497,
-    2502,  2507,  2512,  2517,  2522,  2527,  2532,  2537,  2542,  2547,
-    2552,  2557,  2562,  2567,  2572,  2577,  2583,  2582,  2587,  2587,
-    2588,  2591,  2594,  2597,  2600,  2603,  2606,  2609,  2612,  2615,
-    2618,  2621,  2624,  2627,  2630,  2633,  2636,  2639,  2642,  2645,
-    2648,  2651,  2657,  2656,  2661,  2661,  2662,  2665,  2668,  2671,
-    2674,  2677,  2680,  2683,  2686,  2689,  2692,  2695,  2698,  2701,
-    2704,  2707,  2710,  2713,  2716,  2719,  2724,  2729,  2734,  2739,
-    2748,  2750,  2750,  2751,  2752,  2753,  2754,  2755,  2756,  2757,
-    2758,  2759,  2760,  2761,  2762,  2763,  2764,  2765,  2766,  2768,
-    2773,  2778,  2783,  2788,  2793,  2798,  2803,  2808,  2813,  2818,
-    2823,  2828,  2833,  2838,  2847,  2849,  2849,  2850,  2851,  2852,
-    2853,  2854,  2855,  2856,  2857,  2858,  2859,  2861,  2867,  2883,
-    2892,  2898,  2904,  2910,  2919,  2925
+       0,   381,   381,   382,   385,   386,   387,   388,   389,   390,
+     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
+     401,   402,   403,   404,   405,   406,   407,   408,   412,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   423,   423,
+     424,   425,   426,   427,   434,   436,   436,   437,   437,   437,
+     439,   445,   455,   457,   457,   458,   459,   460,   461,   462,
+     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
+     473,   474,   475,   476,   477,   478,   481,   490,   499,   508,
+     517,   526,   535,   544,   559,   574,   584,   598,   607,   630,
+     653,   676,   682,   688,   694,   700,   713,   715,   715,   716,
+     717,   718,   719,   721,   730,   739,   753,   752,   770,   770,
+     771,   771,   771,   773,   779,   790,   789,   808,   808,   809,
+     809,   809,   809,   809,   811,   817,   823,   829,   851,   852,
+     852,   854,   854,   855,   857,   864,   864,   877,   878,   880,
+     880,   881,   881,   883,   891,   894,   900,   899,   905,   905,
+     906,   910,   914,   918,   922,   926,   930,   934,   938,   949,
+     948,  1011,  1011,  1012,  1013,  1014,  1015,  1016,  1017,  1018,
+    1019,  1020,  1021,  1022,  1024,  1030,  1036,  1042,  1048,  1059,
+    1065,  1076,  1083,  1082,  1088,  1088,  1089,  1093,  1097,  1101,
+    1105,  1109,  1113,  1117,  1121,  1125,  1129,  1133,  1137,  1141,
+    1145,  1149,  1153,  1157,  1161,  1165,  1169,  1173,  1180,  1179,
+    1185,  1185,  1186,  1190,  1194,  1198,  1202,  1206,  1210,  1214,
+    1218,  1222,  1226,  1230,  1234,  1238,  1242,  1246,  1250,  1254,
+    1258,  1262,  1266,  1270,  1274,  1278,  1282,  1286,  1290,  1294,
+    1298,  1309,  1308,  1368,  1368,  1369,  1370,  1371,  1372,  1373,
+    1374,  1375,  1376,  1377,  1378,  1379,  1380,  1381,  1382,  1383,
+    1384,  1385,  1386,  1388,  1394,  1400,  1406,  1412,  1418,  1424,
+    1430,  1436,  1443,  1450,  1457,  1463,  1469,  1475,  1484,  1494,
+    1493,  1499,  1499,  1500,  1504,  1515,  1514,  1521,  1520,  1525,
+    1525,  1526,  1530,  1534,  1538,  1542,  1546,  1550,  1556,  1556,
+    1557,  1557,  1557,  1557,  1557,  1559,  1559,  1561,  1561,  1563,
+    1576,  1593,  1599,  1610,  1609,  1656,  1656,  1657,  1658,  1659,
+    1660,  1661,  1662,  1663,  1664,  1665,  1667,  1673,  1679,  1685,
+    1697,  1696,  1702,  1702,  1703,  1707,  1711,  1715,  1719,  1723,
+    1727,  1731,  1735,  1741,  1755,  1764,  1778,  1777,  1792,  1792,
+    1793,  1793,  1793,  1793,  1795,  1801,  1807,  1817,  1819,  1819,
+    1820,  1820,  1822,  1839,  1838,  1861,  1861,  1862,  1862,  1862,
+    1862,  1864,  1870,  1890,  1889,  1895,  1895,  1896,  1900,  1904,
+    1908,  1912,  1916,  1920,  1924,  1928,  1932,  1943,  1942,  1961,
+    1961,  1962,  1962,  1962,  1964,  1971,  1970,  1976,  1976,  1977,
+    1981,  1985,  1989,  1993,  1997,  2001,  2005,  2009,  2013,  2024,
+    2023,  2101,  2101,  2102,  2103,  2104,  2105,  2106,  2107,  2108,
+    2109,  2110,  2111,  2112,  2113,  2114,  2115,  2116,  2117,  2119,
+    2125,  2131,  2137,  2143,  2156,  2169,  2175,  2181,  2185,  2192,
+    2191,  2196,  2196,  2197,  2201,  2205,  2211,  2222,  2228,  2234,
+    2240,  2256,  2255,  2279,  2279,  2280,  2280,  2280,  2282,  2302,
+    2313,  2312,  2337,  2337,  2338,  2338,  2338,  2340,  2346,  2356,
+    2358,  2358,  2359,  2359,  2361,  2379,  2378,  2398,  2398,  2399,
+    2399,  2399,  2401,  2407,  2417,  2419,  2419,  2420,  2421,  2422,
+    2423,  2424,  2425,  2426,  2427,  2428,  2429,  2430,  2431,  2432,
+    2433,  2434,  2435,  2436,  2437,  2438,  2439,  2440,  2441,  2442,
+    2443,  2444,  2445,  2446,  2447,  2448,  2449,  2450,  2451,  2452,
+    2453,  2454,  2455,  2456,  2457,  2458,  2459,  2460,  2461,  2462,
+    2463,  2464,  2465,  2466,  2467,  2468,  2469,  2472,  2477,  2482,
+    2487,  2492,  2497,  2502,  2507,  2512,  2517,  2522,  2527,  2532,
+    2537,  2542,  2547,  2552,  2557,  2562,  2567,  2572,  2577,  2582,
+    2587,  2592,  2597,  2602,  2607,  2612,  2617,  2622,  2627,  2632,
+    2637,  2642,  2647,  2652,  2657,  2662,  2667,  2672,  2677,  2682,
+    2688,  2687,  2692,  2692,  2693,  2696,  2699,  2702,  2705,  2708,
+    2711,  2714,  2717,  2720,  2723,  2726,  2729,  2732,  2735,  2738,
+    2741,  2744,  2747,  2750,  2753,  2756,  2762,  2761,  2766,  2766,
+    2767,  2770,  2773,  2776,  2779,  2782,  2785,  2788,  2791,  2794,
+    2797,  2800,  2803,  2806,  2809,  2812,  2815,  2818,  2821,  2824,
+    2829,  2834,  2839,  2844,  2853,  2855,  2855,  2856,  2857,  2858,
+    2859,  2860,  2861,  2862,  2863,  2864,  2865,  2866,  2867,  2868,
+    2869,  2870,  2871,  2873,  2878,  2883,  2888,  2893,  2898,  2903,
+    2908,  2913,  2918,  2923,  2928,  2933,  2938,  2943,  2952,  2954,
+    2954,  2955,  2956,  2957,  2958,  2959,  2960,  2961,  2962,  2963,
+    2964,  2966,  2972,  2988,  2997,  3003,  3009,  3015,  3024,  3030
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ACCEPT_PASSWORD", "ADMIN", "AFTYPE",
-  "ANTI_NICK_FLOOD", "ANTI_SPAM_EXIT_MESSAGE_TIME", "AUTOCONN",
-  "AWAY_COUNT", "AWAY_TIME", "BOT", "BYTES", "KBYTES", "MBYTES",
-  "CALLER_ID_WAIT", "CAN_FLOOD", "CHANNEL", "CIDR_BITLEN_IPV4",
-  "CIDR_BITLEN_IPV6", "CLASS", "CLIENT", "CLOSE", "CONNECT", "CONNECTFREQ",
-  "CYCLE_ON_HOST_CHANGE", "DEFAULT_FLOODCOUNT", "DEFAULT_FLOODTIME",
-  "DEFAULT_JOIN_FLOOD_COUNT", "DEFAULT_JOIN_FLOOD_TIME",
-  "DEFAULT_MAX_CLIENTS", "DEFER", "DENY", "DESCRIPTION", "DIE",
-  "DISABLE_AUTH", "DISABLE_FAKE_CHANNELS", "DISABLE_REMOTE_COMMANDS",
-  "DLINE_MIN_CIDR", "DLINE_MIN_CIDR6", "DOTS_IN_IDENT", "EMAIL",
-  "ENABLE_EXTBANS", "ENCRYPTED", "EXCEED_LIMIT", "EXEMPT", "EXPIRATION",
-  "FAILED_OPER_NOTICE", "FLATTEN_LINKS", "FLATTEN_LINKS_DELAY",
-  "FLATTEN_LINKS_FILE", "GECOS", "GENERAL", "HIDDEN", "HIDDEN_NAME",
-  "HIDE_CHANS", "HIDE_IDLE", "HIDE_IDLE_FROM_OPERS", "HIDE_SERVER_IPS",
-  "HIDE_SERVERS", "HIDE_SERVICES", "HOST", "HUB", "HUB_MASK",
-  "INVISIBLE_ON_CONNECT", "INVITE_CLIENT_COUNT", "INVITE_CLIENT_TIME",
-  "INVITE_DELAY_CHANNEL", "INVITE_EXPIRE_TIME", "IP", "IRCD_AUTH",
-  "IRCD_FLAGS", "IRCD_SID", "JOIN", "KILL", "KILL_CHASE_TIME_LIMIT",
-  "KLINE", "KLINE_EXEMPT", "KLINE_MIN_CIDR", "KLINE_MIN_CIDR6",
-  "KNOCK_CLIENT_COUNT", "KNOCK_CLIENT_TIME", "KNOCK_DELAY_CHANNEL",
-  "LEAF_MASK", "LISTEN", "MASK", "MAX_ACCEPT", "MAX_BANS",
-  "MAX_BANS_LARGE", "MAX_CHANNELS", "MAX_IDLE", "MAX_INVITES",
-  "MAX_MONITOR", "MAX_NICK_CHANGES", "MAX_NICK_LENGTH", "MAX_NICK_TIME",
-  "MAX_NUMBER", "MAX_TARGETS", "MAX_TOPIC_LENGTH", "MIN_IDLE",
-  "MIN_NONWILDCARD", "MIN_NONWILDCARD_SIMPLE", "MODULE", "MODULES", "MOTD",
-  "NAME", "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESCRIPTION",
-  "NETWORK_NAME", "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER_PER_CIDR",
+  "\"end of file\"", "error", "\"invalid token\"", "ACCEPT_PASSWORD",
+  "ADMIN", "AFTYPE", "ANTI_NICK_FLOOD", "ANTI_SPAM_EXIT_MESSAGE_TIME",
+  "AUTH_TIMEOUT", "AUTOCONN", "AWAY_COUNT", "AWAY_TIME", "BOT", "BYTES",
+  "KBYTES", "MBYTES", "CALLER_ID_WAIT", "CAN_FLOOD", "CHANNEL",
+  "CIDR_BITLEN_IPV4", "CIDR_BITLEN_IPV6", "CLASS", "CLIENT", "CLOSE",
+  "CONNECT", "CONNECTFREQ", "CYCLE_ON_HOST_CHANGE", "DEFAULT_FLOODCOUNT",
+  "DEFAULT_FLOODTIME", "DEFAULT_JOIN_FLOOD_COUNT",
+  "DEFAULT_JOIN_FLOOD_TIME", "DEFAULT_MAX_CLIENTS", "DEFER", "DENY",
+  "DESCRIPTION", "DIE", "DISABLE_AUTH", "DISABLE_FAKE_CHANNELS",
+  "DISABLE_REMOTE_COMMANDS", "DLINE_MIN_CIDR", "DLINE_MIN_CIDR6",
+  "DOTS_IN_IDENT", "EMAIL", "ENABLE_EXTBANS", "ENCRYPTED", "EXCEED_LIMIT",
+  "EXEMPT", "EXPIRATION", "FAILED_OPER_NOTICE", "FLATTEN_LINKS",
+  "FLATTEN_LINKS_DELAY", "FLATTEN_LINKS_FILE", "FLOOD_BURST", "FLOOD_RATE",
+  "GECOS", "GENERAL", "HIDDEN", "HIDDEN_NAME", "HIDE_CHANS", "HIDE_IDLE",
+  "HIDE_IDLE_FROM_OPERS", "HIDE_SERVER_IPS", "HIDE_SERVERS",
+  "HIDE_SERVICES", "HOST", "HUB", "HUB_MASK", "IDENT_CACHE_TIME",
+  "IDENT_MAX_PENDING", "IDENT_TIMEOUT", "INVISIBLE_ON_CONNECT",
+  "INVITE_CLIENT_COUNT", "INVITE_CLIENT_TIME", "INVITE_DELAY_CHANNEL",
+  "INVITE_EXPIRE_TIME", "IP", "IRCD_AUTH", "IRCD_FLAGS", "IRCD_SID",
+  "JOIN", "KILL", "KILL_CHASE_TIME_LIMIT", "KLINE", "KLINE_EXEMPT",
+  "KLINE_MIN_CIDR", "KLINE_MIN_CIDR6", "KNOCK_CLIENT_COUNT",
+  "KNOCK_CLIENT_TIME", "KNOCK_DELAY_CHANNEL", "LEAF_MASK", "LISTEN",
+  "MASK", "MAX_ACCEPT", "MAX_BANS", "MAX_BANS_LARGE", "MAX_CHANNELS",
+  "MAX_IDLE", "MAX_INVITES", "MAX_MONITOR", "MAX_NICK_CHANGES",
+  "MAX_NICK_LENGTH", "MAX_NICK_TIME", "MAX_NUMBER", "MAX_TARGETS",
+  "MAX_TOPIC_LENGTH", "MIN_IDLE", "MIN_NONWILDCARD",
+  "MIN_NONWILDCARD_SIMPLE", "MODULE", "MODULES", "MOTD", "NAME",
+  "NEED_IDENT", "NEED_PASSWORD", "NETWORK_DESCRIPTION", "NETWORK_NAME",
+  "NICK", "NO_OPER_FLOOD", "NO_TILDE", "NUMBER_PER_CIDR",
   "NUMBER_PER_IP_GLOBAL", "NUMBER_PER_IP_LOCAL", "OPER_ONLY_UMODES",
   "OPER_UMODES", "OPERATOR", "OPERS_BYPASS_CALLERID", "PACE_WAIT",
   "PACE_WAIT_SIMPLE", "PASSWORD", "PATH", "PING_COOKIE", "PING_TIME",
   "PORT", "RANDOM_IDLE", "REASON", "REDIRPORT", "REDIRSERV", "REHASH",
-  "REMOTE", "REMOTEBAN", "RESV", "RESV_EXEMPT", "RSA_PRIVATE_KEY_FILE",
-  "SECONDS", "MINUTES", "HOURS", "DAYS", "WEEKS", "MONTHS", "YEARS",
-  "SEND_PASSWORD", "SENDQ", "SERVERHIDE", "SERVERINFO", "SHORT_MOTD",
-  "SPOOF", "SQUIT", "STATS_E_DISABLED", "STATS_I_OPER_ONLY",
+  "REMOTE", "REMOTEBAN", "RESV", "RESV_EXEMPT", "REUSEPORT",
+  "RSA_PRIVATE_KEY_FILE", "SECONDS", "MINUTES", "HOURS", "DAYS", "WEEKS",
+  "MONTHS", "YEARS", "SEND_PASSWORD", "SENDQ", "SERVERHIDE", "SERVERINFO",
+  "SHORT_MOTD", "SPOOF", "SQUIT", "STATS_E_DISABLED", "STATS_I_OPER_ONLY",
   "STATS_K_OPER_ONLY", "STATS_M_OPER_ONLY", "STATS_O_OPER_ONLY",
   "STATS_P_OPER_ONLY", "STATS_U_OPER_ONLY", "T_ALL", "T_BIND",
-  "T_CALLERID", "T_CCONN", "T_COMMAND", "T_CLUSTER", "T_DEAF", "T_DEBUG",
-  "T_DLINE", "T_EXTERNAL", "T_FARCONNECT", "T_FILE", "T_FLOOD",
-  "T_GLOBOPS", "T_INVISIBLE", "T_IPV4", "T_IPV6", "T_LOCOPS", "T_LOG",
-  "T_NCHANGE", "T_NONONREG", "T_OPME", "T_PREPEND", "T_PSEUDO", "T_RECVQ",
-  "T_REJ", "T_RESTART", "T_SERVER", "T_SERVICE", "T_SERVNOTICE", "T_SET",
-  "T_SHARED", "T_SIZE", "T_SKILL", "T_SOFTCALLERID", "T_SPY", "T_TARGET",
-  "T_TLS", "T_UMODES", "T_UNDLINE", "T_UNLIMITED", "T_UNRESV", "T_UNXLINE",
-  "T_WALLOP", "T_WALLOPS", "T_WEBIRC", "TBOOL", "THROTTLE_COUNT",
-  "THROTTLE_TIME", "TIMEOUT", "TLS_CERTIFICATE_FILE",
-  "TLS_CERTIFICATE_FINGERPRINT", "TLS_CIPHER_LIST", "TLS_CIPHER_SUITES",
-  "TLS_CONNECTION_REQUIRED", "TLS_DH_PARAM_FILE",
-  "TLS_MESSAGE_DIGEST_ALGORITHM", "TLS_SUPPORTED_GROUPS", "TS_MAX_DELTA",
+  "T_CALLERID", "T_CCONN", "T_COMMAND", "T_CLUSTER", "T_COMPRESSED",
+  "T_DEAF", "T_DEBUG", "T_DLINE", "T_EXTERNAL", "T_FARCONNECT", "T_FILE",
+  "T_FLOOD", "T_GLOBOPS", "T_INVISIBLE", "T_IPV4", "T_IPV6", "T_LOCOPS",
+  "T_LOG", "T_METRICS", "T_NCHANGE", "T_NONONREG", "T_OPME", "T_PREPEND",
+  "T_PSEUDO", "T_RECVQ", "T_REJ", "T_RESTART", "T_SERVER", "T_SERVICE",
+  "T_SERVNOTICE", "T_SET", "T_SHARED", "T_SIZE", "T_SKILL",
+  "T_SOFTCALLERID", "T_SPY", "T_TARGET", "T_TLS", "T_UMODES", "T_UNDLINE",
+  "T_UNLIMITED", "T_UNRESV", "T_UNXLINE", "T_WALLOP", "T_WALLOPS",
+  "T_WEBIRC", "TBOOL", "THROTTLE_COUNT", "THROTTLE_TIME", "TIMEOUT",
+  "TLS_CERTIFICATE_FILE", "TLS_CERTIFICATE_FINGERPRINT", "TLS_CIPHER_LIST",
+  "TLS_CIPHER_SUITES", "TLS_CONNECTION_REQUIRED", "TLS_DH_PARAM_FILE",
+  "TLS_HANDSHAKE_THREADS", "TLS_KERNEL_OFFLOAD",
+  "TLS_MESSAGE_DIGEST_ALGORITHM", "TLS_SESSION_CACHE_SIZE",
+  "TLS_SUPPORTED_GROUPS", "TLS_TICKET_KEY_FILE", "TS_MAX_DELTA",
   "TS_WARN_DELTA", "TWODOTS", "TYPE", "UNKLINE", "USE_LOGGING", "USER",
   "VHOST", "VHOST6", "WARN_NO_CONNECT_BLOCK", "WHOIS",
   "WHOWAS_HISTORY_LENGTH", "XLINE", "XLINE_EXEMPT", "QSTRING", "NUMBER",
@@ -1227,14 +1856,16 @@ static const char *const yytname[] =
   "serverinfo_description", "serverinfo_network_name",
   "serverinfo_network_description", "serverinfo_default_max_clients",
   "serverinfo_max_nick_length", "serverinfo_max_topic_length",
-  "serverinfo_hub", "admin_entry", "admin_items", "admin_item",
-  "admin_name", "admin_email", "admin_description", "motd_entry", "$@1",
-  "motd_items", "motd_item", "motd_mask", "motd_file", "pseudo_entry",
-  "$@2", "pseudo_items", "pseudo_item", "pseudo_command", "pseudo_name",
-  "pseudo_prepend", "pseudo_target", "logging_entry", "logging_items",
-  "logging_item", "logging_use_logging", "logging_file_entry", "$@3",
-  "logging_file_items", "logging_file_item", "logging_file_name",
-  "logging_file_size", "logging_file_type", "$@4",
+  "serverinfo_hub", "serverinfo_tls_handshake_threads",
+  "serverinfo_tls_kernel_offload", "serverinfo_tls_session_cache_size",
+  "serverinfo_tls_ticket_key_file", "admin_entry", "admin_items",
+  "admin_item", "admin_name", "admin_email", "admin_description",
+  "motd_entry", "$@1", "motd_items", "motd_item", "motd_mask", "motd_file",
+  "pseudo_entry", "$@2", "pseudo_items", "pseudo_item", "pseudo_command",
+  "pseudo_name", "pseudo_prepend", "pseudo_target", "logging_entry",
+  "logging_items", "logging_item", "logging_use_logging",
+  "logging_file_entry", "$@3", "logging_file_items", "logging_file_item",
+  "logging_file_name", "logging_file_size", "logging_file_type", "$@4",
   "logging_file_type_items", "logging_file_type_item", "oper_entry", "$@5",
   "oper_items", "oper_item", "oper_name", "oper_user", "oper_password",
   "oper_whois", "oper_encrypted", "oper_tls_certificate_fingerprint",
@@ -1244,17 +1875,18 @@ static const char *const yytname[] =
   "class_items", "class_item", "class_name", "class_ping_time",
   "class_number_per_ip_local", "class_number_per_ip_global",
   "class_connectfreq", "class_max_channels", "class_max_number",
-  "class_sendq", "class_recvq", "class_cidr_bitlen_ipv4",
-  "class_cidr_bitlen_ipv6", "class_number_per_cidr", "class_min_idle",
-  "class_max_idle", "class_flags", "$@9", "class_flags_items",
-  "class_flags_item", "listen_entry", "$@10", "listen_flags", "$@11",
-  "listen_flags_items", "listen_flags_item", "listen_items", "listen_item",
-  "listen_port", "$@12", "port_items", "port_item", "listen_address",
-  "listen_host", "auth_entry", "$@13", "auth_items", "auth_item",
-  "auth_user", "auth_passwd", "auth_class", "auth_encrypted", "auth_flags",
-  "$@14", "auth_flags_items", "auth_flags_item", "auth_spoof",
-  "auth_redir_serv", "auth_redir_port", "resv_entry", "$@15", "resv_items",
-  "resv_item", "resv_mask", "resv_reason", "resv_exempt", "service_entry",
+  "class_sendq", "class_recvq", "class_flood_burst", "class_flood_rate",
+  "class_cidr_bitlen_ipv4", "class_cidr_bitlen_ipv6",
+  "class_number_per_cidr", "class_min_idle", "class_max_idle",
+  "class_flags", "$@9", "class_flags_items", "class_flags_item",
+  "listen_entry", "$@10", "listen_flags", "$@11", "listen_flags_items",
+  "listen_flags_item", "listen_items", "listen_item", "listen_port",
+  "$@12", "port_items", "port_item", "listen_address", "listen_host",
+  "auth_entry", "$@13", "auth_items", "auth_item", "auth_user",
+  "auth_passwd", "auth_class", "auth_encrypted", "auth_flags", "$@14",
+  "auth_flags_items", "auth_flags_item", "auth_spoof", "auth_redir_serv",
+  "auth_redir_port", "resv_entry", "$@15", "resv_items", "resv_item",
+  "resv_mask", "resv_reason", "resv_exempt", "service_entry",
   "service_items", "service_item", "service_name", "shared_entry", "$@16",
   "shared_items", "shared_item", "shared_name", "shared_user",
   "shared_type", "$@17", "shared_types", "shared_type_item",
@@ -1289,6 +1921,8 @@ static const char *const yytname[] =
   "general_opers_bypass_callerid", "general_pace_wait_simple",
   "general_short_motd", "general_no_oper_flood", "general_dots_in_ident",
   "general_max_targets", "general_ping_cookie", "general_disable_auth",
+  "general_auth_timeout", "general_ident_timeout",
+  "general_ident_cache_time", "general_ident_max_pending",
   "general_throttle_count", "general_throttle_time", "general_oper_umodes",
   "$@25", "umode_oitems", "umode_oitem", "general_oper_only_umodes",
   "$@26", "umode_items", "umode_item", "general_min_nonwildcard",
@@ -1308,869 +1942,870 @@ static const char *const yytname[] =
   "serverhide_hide_services", "serverhide_hidden_name",
   "serverhide_hidden", "serverhide_hide_server_ips", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,    59,   125,   123,    61,    44,    58
-};
-# endif
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF (-981)
+#define YYPACT_NINF (-1034)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-128)
+#define YYTABLE_NINF (-136)
 
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -981,   902,  -981,  -173,  -229,  -202,  -981,  -981,  -981,  -184,
-    -981,  -177,  -981,  -981,  -981,  -172,  -981,  -981,  -981,  -163,
-    -161,  -981,  -123,  -981,  -106,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,   281,   927,   -97,   -96,   -80,    27,   -56,   398,   -48,
-     -45,   -34,    51,   -25,    -6,    -2,   558,   547,    20,    12,
-      36,    15,    49,  -212,    54,    56,    61,    14,  -981,  -981,
-    -981,  -981,  -981,    68,    70,    71,    72,    75,    81,    82,
-      91,    92,    94,    96,    97,    98,    99,   100,     2,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,   846,   633,    23,  -981,   102,
-      16,  -981,  -981,    42,  -981,   104,   106,   108,   110,   112,
-     117,   124,   127,   137,   138,   139,   140,   148,   149,   150,
-     152,   153,   154,   156,   158,   160,   163,   174,   180,   181,
-    -981,  -981,   182,   187,   191,   192,   193,   194,   196,   197,
-     199,   200,   206,   207,   208,   213,   214,   215,   217,   218,
-      39,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,   359,    40,   349,
-      83,   219,   221,    25,  -981,  -981,  -981,    50,   335,   264,
-    -981,   223,   225,   230,   231,   232,   233,   234,   236,   239,
-     164,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,   171,   243,   245,   250,   251,   252,   257,   261,   262,
-     265,   268,   269,   270,   271,   277,   278,   285,   143,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,    57,   284,   286,    13,
-    -981,  -981,  -981,   363,   220,  -981,   300,    28,  -981,  -981,
-       8,  -981,   307,   308,   309,   310,  -981,   224,   312,   336,
-     337,   314,   312,   312,   312,   325,   312,   312,   327,   329,
-     332,   333,   334,  -981,   339,   330,   340,   341,  -981,   343,
-     347,   348,   350,   351,   352,   353,   355,   357,   361,   362,
-     179,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,   342,   364,   365,
-     366,   367,   370,   378,  -981,   385,   386,   387,   392,   397,
-     405,   407,   408,   237,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,   411,   412,    38,  -981,  -981,  -981,   338,   401,  -981,
-    -981,   414,   415,   115,  -981,  -981,  -981,   368,   312,   399,
-     312,   312,   380,   420,   312,   450,   427,   432,   434,   462,
-     463,   312,   437,   439,   441,   444,   446,   312,   448,   451,
-     453,   477,   452,   454,   481,   312,   312,   486,   487,   488,
-     489,   493,   494,   495,   497,   501,   475,   312,   312,   312,
-     504,   476,   479,  -981,   480,   474,   478,  -981,   482,   484,
-     485,   490,   491,    55,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,   499,   500,    80,  -981,  -981,  -981,
-     483,   506,   507,  -981,   508,  -981,    26,  -981,  -981,  -981,
-    -981,  -981,   492,   498,   512,  -981,   513,   511,   515,     3,
-    -981,  -981,  -981,   516,   518,   519,  -981,   521,   528,  -981,
-     529,   530,   531,   532,   168,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,   537,   535,   536,   538,
-      79,  -981,  -981,  -981,  -981,   510,   517,   312,   502,   520,
-     544,   525,   543,   572,   549,  -981,  -981,   505,   554,   583,
-     559,   560,   563,   567,   568,   569,   570,   573,   574,   576,
-     577,   578,   582,   581,  -981,   584,   579,  -981,    62,  -981,
-    -981,  -981,  -981,   598,   585,  -981,    52,   586,   580,   587,
-     588,   589,   105,  -981,  -981,  -981,  -981,  -981,   590,   593,
-    -981,   594,   592,  -981,   595,    41,  -981,  -981,  -981,  -981,
-     596,   597,   599,  -981,   600,   228,   601,   602,   603,   604,
-     605,   606,   607,   609,   614,   621,   623,   625,   626,   628,
-    -981,  -981,   619,   632,   312,   631,   637,   312,   638,   312,
-     591,   641,   642,   643,   312,   647,   647,   648,  -981,  -981,
-     649,   -64,   651,   680,   658,   661,   660,   663,   666,   667,
-     671,   674,   312,   677,   678,   679,  -981,   682,   686,   688,
-    -981,   689,  -981,   694,   696,   695,  -981,   697,   698,   699,
-     700,   701,   705,   706,   707,   708,   709,   711,   712,   714,
-     716,   717,   718,   720,   725,   726,   730,   732,   733,   734,
-     735,   736,   722,   618,   738,   741,   742,   743,   745,   746,
-     747,   748,   749,   750,   751,   752,   753,   755,   756,   757,
-     758,   764,  -981,  -981,   767,   794,   675,   769,   687,   770,
-     771,   772,   778,  -981,   773,   774,   779,  -981,  -981,   782,
-     783,   784,   786,   789,  -981,   790,   791,  -981,  -981,   795,
-     796,   792,  -981,  -981,   797,   825,   798,   800,   801,   799,
-     802,   831,   807,   808,   809,  -981,  -981,   810,   812,   813,
-     814,  -981,   815,   818,   819,   820,   821,   822,   823,   824,
-     826,  -981,   827,   828,   829,   830,   832,   834,   835,   836,
-     837,   838,   839,   840,   841,   842,   843,   844,  -981,  -981,
-     833,   804,   845,  -981,   847,  -981,   121,  -981,   850,   851,
-     852,   854,   853,  -981,   855,  -981,  -981,   856,   857,   859,
-     858,  -981,  -981,  -981,  -981,  -981,   312,   312,   312,   312,
-     312,   312,   312,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,   861,
-     862,   863,    -4,   864,   865,   866,   867,   868,   869,   870,
-     871,   872,    22,   873,   874,  -981,   875,   876,   877,   878,
-     879,   880,   881,     4,   882,   883,   884,   885,   886,   887,
-     888,   889,  -981,   890,   891,  -981,  -981,   892,   893,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -214,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -213,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,   894,
-     895,   395,   896,   897,   898,   899,   900,  -981,   901,   903,
-    -981,   904,   905,   266,   916,   906,  -981,  -981,  -981,  -981,
-     907,   908,  -981,   909,   911,   460,   912,   913,   684,   914,
-     915,   917,   918,  -981,   919,   920,   921,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,   922,   503,  -981,  -981,   923,   924,   925,
-    -981,   111,  -981,  -981,  -981,  -981,   926,   929,   930,   931,
-    -981,  -981,   932,   552,   933,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -211,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,   647,
-     647,   647,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -199,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-     722,  -981,   618,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -160,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-     -87,  -981,   935,   786,   936,  -981,  -981,  -981,  -981,  -981,
-    -981,   934,  -981,   937,   938,  -981,  -981,   939,   940,  -981,
-    -981,   941,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,   -75,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-     -61,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-     -53,  -981,  -981,   942,  -137,   944,   948,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,   -30,  -981,  -981,  -981,    -4,  -981,  -981,
-    -981,  -981,     4,  -981,  -981,  -981,   395,  -981,   266,  -981,
-    -981,  -981,  1006,   435,  1016,   910,  1024,  1025,  -981,   460,
-    -981,   684,  -981,   503,   949,   950,   951,   345,  -981,  -981,
-     552,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,    -7,  -981,  -981,  -981,   345,
-    -981
+   -1034,   745, -1034,  -199,  -234,  -229, -1034, -1034, -1034,  -219,
+   -1034,  -214, -1034, -1034, -1034,  -207, -1034, -1034, -1034,  -195,
+    -191, -1034,  -185, -1034,  -169, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034,    16,  1039,  -162,  -160,  -131,    11,  -107,   479,   -90,
+     -80,   -63,    75,   -52,   -46,   -32,   626,   592,   -31,   123,
+     -30,    28,   -28,   -25,   -14,   -13,   -10,     3, -1034, -1034,
+   -1034, -1034, -1034,    -8,    -3,    36,    37,    57,    58,    62,
+      64,    78,    86,    88,    91,    96,    98,    99,   170, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034,   985,   589,    19, -1034,   105,
+      25, -1034, -1034,    31, -1034,   107,   108,   114,   115,   116,
+     119,   121,   122,   124,   125,   126,   128,   129,   130,   132,
+     133,   136,   141,   142,   143,   144,   145,   147,   153,   154,
+     156,   157,   158,   160, -1034, -1034,   162,   164,   165,   167,
+     169,   171,   172,   173,   180,   186,   188,   190,   191,   192,
+     193,   195,   196,   197,    63, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034,   294,    18,   332,    59,   198,
+     199,    14, -1034, -1034, -1034,    26,   393,     2, -1034,   201,
+     204,   205,   208,   209,   211,   212,   213,   214,     4, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   103,
+     215,   218,   219,   220,   224,   226,   227,   229,   231,   233,
+     235,   236,   246,   260,   261,   262,   263,   264,   265,   268,
+      94, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034,    23,   179,   269,    56, -1034, -1034, -1034,   241,
+     176, -1034,   274,    35, -1034, -1034,   117, -1034,   182,   281,
+     282,   283, -1034,   187,   234,   317,   319,   287,   234,   234,
+     234,   290,   234,   234,   291,   292,   293,   295,   297, -1034,
+     298,   296,   302,   303,   304,   306, -1034,   307,   309,   310,
+     313,   324,   325,   326,   327,   328,   331,   333,   177, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034,   300,   335,   336,
+     339,   343,   347,   349, -1034,   351,   355,   359,   360,   365,
+     374,   376,   377,   322, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034,   381,   382,    40, -1034, -1034, -1034,   323,   320, -1034,
+   -1034,   383,   387,    24, -1034, -1034, -1034,   354,   234,   234,
+     392,   234,   234,   357,   402,   234,   435,   405,   406,   407,
+     439,   234,   410,   234,   443,   234,   414,   415,   416,   417,
+     418,   234,   419,   421,   423,   455,   424,   426,   456,   234,
+     234,   458,   466,   467,   472,   473,   477,   478,   482,   484,
+     440,   234,   234,   234,   485,   457,   454, -1034,   465,   463,
+     464, -1034,   468,   470,   475,   476,   480,   247, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   481,   483,
+      48, -1034, -1034, -1034,   469,   486,   488, -1034,   489, -1034,
+     104, -1034, -1034, -1034, -1034, -1034,   487,   490,   493, -1034,
+     496,   494,   495,    82, -1034, -1034, -1034,   502,   503,   504,
+   -1034,   506,   508, -1034,   509,   511,   512,   513,   230, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+     505,   516,   519,   520,    29, -1034, -1034, -1034, -1034,   500,
+     507,   234,   527,   514,   529,   562,   564,   566,   535, -1034,
+   -1034,   537,   539,   570,   541,   542,   543,   545,   546,   547,
+     550,   551,   552,   553,   554,   557,   590,   559,   560,   567,
+     579,   568, -1034,   581,   576, -1034,    30, -1034, -1034, -1034,
+   -1034,   616,   585, -1034,   315,   586,   584,   593,   594,   596,
+      43, -1034, -1034, -1034, -1034, -1034,   591,   588, -1034,   595,
+     597, -1034,   598,    34, -1034, -1034, -1034, -1034,   602,   604,
+     605, -1034,   606,   471,   607,   608,   611,   613,   615,   617,
+     619,   620,   622,   625,   628,   631,   633,   634, -1034, -1034,
+     627,   636,   234,   637,   638,   635,   640,   234,   643,   234,
+     618,   644,   646,   649,   234,   651,   651,   652, -1034, -1034,
+     653,    -6,   657,   624,   658,   659,   656,   662,   663,   664,
+     667,   670,   234,   671,   674,   673, -1034,   676,   677,   678,
+   -1034,   680, -1034,   679,   684,   681, -1034,   685,   686,   687,
+     688,   689,   692,   693,   694,   696,   697,   700,   701,   704,
+     705,   706,   709,   712,   714,   716,   717,   719,   720,   723,
+     724,   725,   726,   728,   729,   730,   847,   780,   732,   733,
+     734,   740,   742,   748,   750,   752,   753,   755,   756,   761,
+     762,   764,   766,   768,   776,   779, -1034, -1034,   785,   708,
+     781,   788,   791,   789,   793,   798,   797, -1034,   801,   802,
+     805, -1034, -1034,   803,   808,   804,   809,   810, -1034,   811,
+     813, -1034, -1034,   817,   818,   814, -1034, -1034,   820,   715,
+     806,   821,   822,   819,   823,   857,   828,   829,   830, -1034,
+   -1034,   831,   834,   835,   838, -1034,   839,   840,   841,   843,
+     844,   846,   848,   849,   850, -1034,   852,   853,   854,   855,
+     856,   858,   862,   863,   864,   869,   870,   872,   873,   874,
+     875,   876,   877,   878,   879,   883, -1034, -1034,   836,   825,
+     884, -1034,   885, -1034,   100, -1034,   859,   888,   892,   895,
+     894, -1034,   896, -1034, -1034,   897,   898,   899,   900, -1034,
+   -1034, -1034, -1034, -1034,   234,   234,   234,   234,   234,   234,
+     234, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034,   902,   903,   904,
+     905,   906,   -51,   907,   908,   909,   910,   911,   912,   913,
+     914,   915,     8,   916,   917, -1034,   918,   919,   920,   921,
+     922,   923,   924,   183,   925,   926,   927,   928,   929,   930,
+     932,   933, -1034,   934,   935, -1034, -1034,   936,   937, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,  -211,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034,  -206, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034,   938,   939,   314,   940,   941,   942,   943,
+     944, -1034,   945,   946, -1034,   947,   948,   329,   501,   949,
+   -1034, -1034, -1034, -1034,   950,   951, -1034,   952,   954,   565,
+     955,   956,   816,   957,   958,   959,   960, -1034,   961,   962,
+     963, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034,   964,   683, -1034, -1034,   965,   966,   967, -1034,    15,
+   -1034, -1034, -1034, -1034,   968,   971,   972,   973, -1034, -1034,
+     974,   703,   975, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,  -186, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   651,
+     651,   651, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034,  -177, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034,   847, -1034,   780, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034,  -168, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034,  -165, -1034,   977,   809,   978, -1034, -1034,
+   -1034, -1034, -1034, -1034,   842, -1034,   893,   976, -1034, -1034,
+     979,   980, -1034, -1034,   981, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034,  -157, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034,  -137, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034,   -89, -1034, -1034,   901,  -193,   984,   982,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034,   -58, -1034, -1034, -1034,
+     -51, -1034, -1034, -1034, -1034,   183, -1034, -1034, -1034,   314,
+   -1034,   329, -1034, -1034, -1034,   587,   767,  1056,  1071,  1074,
+    1084, -1034,   565, -1034,   816, -1034,   683,   983,   988,   989,
+     318, -1034, -1034,   703, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   -39,
+   -1034, -1034, -1034,   318, -1034
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,     0,     0,     0,   232,   394,   444,     0,
-     459,     0,   298,   435,   272,     0,    98,   150,   331,     0,
-       0,   372,     0,   107,     0,   348,     3,    23,    11,     4,
+       2,     0,     1,     0,     0,     0,   241,   409,   460,     0,
+     475,     0,   313,   451,   285,     0,   106,   159,   346,     0,
+       0,   387,     0,   115,     0,   363,     3,    23,    11,     4,
       24,    25,     5,     6,     8,     9,    10,    13,    14,    15,
       16,    17,    18,    19,    20,    22,    21,     7,    12,    26,
       27,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    90,    91,
-      93,    92,   628,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   612,
-     627,   626,   615,   616,   617,   618,   619,   620,   621,   622,
-     623,   613,   614,   624,   625,     0,     0,     0,   457,     0,
-       0,   455,   456,     0,   516,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    98,    99,
+     101,   100,   652,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   636,
+     651,   650,   639,   640,   641,   642,   643,   644,   645,   646,
+     647,   637,   638,   648,   649,     0,     0,     0,   473,     0,
+       0,   471,   472,     0,   536,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   606,   580,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     582,   556,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   486,   487,   488,   534,   494,
+     535,   529,   530,   531,   532,   498,   489,   490,   491,   492,
+     493,   495,   496,   497,   499,   500,   533,   504,   505,   506,
+     507,   503,   502,   508,   515,   516,   509,   510,   511,   501,
+     513,   523,   524,   525,   526,   527,   528,   521,   522,   514,
+     512,   519,   520,   517,   518,     0,     0,     0,     0,     0,
+       0,     0,    46,    47,    48,     0,     0,     0,   680,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   670,
+     671,   672,   673,   674,   675,   676,   678,   677,   679,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   470,   471,   472,   514,   478,   515,   509,   510,   511,
-     512,   482,   473,   474,   475,   476,   477,   479,   480,   481,
-     483,   484,   513,   488,   489,   490,   491,   487,   486,   492,
-     499,   500,   493,   494,   495,   485,   497,   507,   508,   505,
-     506,   498,   496,   503,   504,   501,   502,     0,     0,     0,
-       0,     0,     0,     0,    46,    47,    48,     0,     0,     0,
-     656,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   646,   647,   648,   649,   650,   651,   652,   654,   653,
-     655,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-      67,    65,    63,    68,    69,    70,    64,    55,    66,    57,
-      58,    59,    60,    61,    62,    56,     0,     0,     0,     0,
-     122,   123,   124,     0,     0,   346,     0,     0,   344,   345,
-       0,    94,     0,     0,     0,     0,    89,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   611,     0,     0,     0,     0,   266,     0,
+       0,    54,    67,    65,    63,    68,    69,    70,    64,    55,
+      66,    57,    58,    59,    60,    61,    62,    56,    71,    72,
+      73,    74,     0,     0,     0,     0,   130,   131,   132,     0,
+       0,   361,     0,     0,   359,   360,     0,   102,     0,     0,
+       0,     0,    97,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   635,
+       0,     0,     0,     0,     0,     0,   279,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   244,
+     245,   248,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   246,   247,   249,   259,   260,   261,     0,     0,     0,
+       0,     0,     0,     0,   439,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   412,   413,   414,   415,   416,   417,
+     418,   419,   421,   420,   423,   427,   424,   425,   426,   422,
+     466,     0,     0,     0,   463,   464,   465,     0,     0,   470,
+     481,     0,     0,     0,   478,   479,   480,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   235,   236,   239,   241,   242,   243,   244,   245,   246,
-     247,   237,   238,   240,   248,   249,   250,     0,     0,     0,
-       0,     0,     0,     0,   424,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   397,   398,   399,   400,   401,   402,
-     403,   404,   406,   405,   408,   412,   409,   410,   411,   407,
-     450,     0,     0,     0,   447,   448,   449,     0,     0,   454,
-     465,     0,     0,     0,   462,   463,   464,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   485,     0,     0,
+       0,   330,     0,     0,     0,     0,     0,     0,   316,   317,
+     318,   319,   324,   320,   321,   322,   323,   457,     0,     0,
+       0,   454,   455,   456,     0,     0,     0,   287,     0,   301,
+       0,   299,   300,   302,   303,    49,     0,     0,     0,    45,
+       0,     0,     0,     0,   109,   110,   111,     0,     0,     0,
+     208,     0,     0,   182,     0,     0,     0,     0,     0,   162,
+     163,   164,   165,   166,   169,   170,   171,   168,   167,   172,
+       0,     0,     0,     0,     0,   349,   350,   351,   352,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   669,
+      75,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   469,     0,     0,     0,   315,     0,     0,
-       0,     0,     0,     0,   301,   302,   303,   304,   309,   305,
-     306,   307,   308,   441,     0,     0,     0,   438,   439,   440,
-       0,     0,     0,   274,     0,   286,     0,   284,   285,   287,
-     288,    49,     0,     0,     0,    45,     0,     0,     0,     0,
-     101,   102,   103,     0,     0,     0,   199,     0,     0,   173,
-       0,     0,     0,     0,     0,   153,   154,   155,   156,   157,
-     160,   161,   162,   159,   158,   163,     0,     0,     0,     0,
-       0,   334,   335,   336,   337,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   645,    71,     0,     0,     0,
+       0,     0,    53,     0,     0,   395,     0,   390,   391,   392,
+     133,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,   118,   119,   121,   120,   122,     0,     0,   358,     0,
+       0,   373,     0,     0,   366,   367,   368,   369,     0,     0,
+       0,    96,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   634,   262,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    53,     0,     0,   380,     0,   375,
-     376,   377,   125,     0,     0,   121,     0,     0,     0,     0,
-       0,     0,     0,   110,   111,   113,   112,   114,     0,     0,
-     343,     0,     0,   358,     0,     0,   351,   352,   353,   354,
-       0,     0,     0,    88,     0,    28,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   243,   428,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     610,   251,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   234,   413,
+       0,     0,     0,     0,     0,     0,   411,     0,     0,     0,
+     462,     0,   469,     0,     0,     0,   477,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   396,     0,     0,     0,
-     446,     0,   453,     0,     0,     0,   461,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   484,   325,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   315,     0,     0,
+       0,   453,   304,     0,     0,     0,     0,     0,   298,     0,
+       0,    44,   112,     0,     0,     0,   108,   173,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   161,
+     353,     0,     0,     0,     0,   348,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   668,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   468,   310,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   300,     0,     0,     0,   437,   289,     0,
-       0,     0,     0,     0,   283,     0,     0,    44,   104,     0,
-       0,     0,   100,   164,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   152,   338,     0,     0,     0,
-       0,   333,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   644,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    52,   378,
-       0,     0,     0,   374,     0,   120,     0,   115,     0,     0,
-       0,     0,     0,   109,     0,   342,   355,     0,     0,     0,
-       0,   350,    97,    96,    95,   642,    28,    28,    28,    28,
-      28,    28,    28,    30,    29,   643,   630,   629,   631,   632,
-     633,   634,   635,   636,   637,   640,   641,   638,   639,     0,
+       0,     0,     0,     0,     0,     0,    52,   393,     0,     0,
+       0,   389,     0,   128,     0,   123,     0,     0,     0,     0,
+       0,   117,     0,   357,   370,     0,     0,     0,     0,   365,
+     105,   104,   103,   666,    28,    28,    28,    28,    28,    28,
+      28,    30,    29,   667,   654,   653,   655,   656,   657,   658,
+     659,   660,   661,   664,   665,   662,   663,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    38,     0,     0,   233,     0,     0,     0,     0,
+       0,     0,    38,     0,     0,   242,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   395,     0,     0,   445,   458,     0,     0,   460,
-     528,   532,   517,   518,   545,   521,   608,   609,   553,   522,
-     523,   550,   527,   535,   526,   524,   525,   531,   519,   530,
-     529,   551,   606,   607,   549,   586,   605,   592,   601,   587,
-     588,   589,   596,   604,   590,   598,   602,   593,   603,   594,
-     597,   591,   600,   595,   599,     0,   585,   560,   581,   565,
-     566,   567,   577,   561,   562,   563,   572,   580,   564,   574,
-     578,   569,   579,   570,   573,   568,   576,   571,   575,     0,
-     559,   546,   544,   547,   552,   548,   537,   543,   542,   538,
-     539,   540,   541,   554,   555,   534,   533,   536,   520,     0,
-       0,     0,     0,     0,     0,     0,     0,   299,     0,     0,
-     436,     0,     0,     0,   294,   290,   293,   273,    50,    51,
-       0,     0,    99,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   151,     0,     0,     0,   332,   660,   657,
-     658,   659,   664,   663,   665,   661,   662,    84,    81,    87,
-      80,    85,    86,    79,    83,    82,    73,    72,    75,    76,
-      74,    77,    78,     0,     0,   373,   126,     0,     0,     0,
-     138,     0,   130,   131,   133,   132,     0,     0,     0,     0,
-     108,   347,     0,     0,     0,   349,    31,    32,    33,    34,
-      35,    36,    37,   261,   262,   256,   271,   270,     0,   269,
-     257,   265,   258,   264,   252,   263,   255,   254,   253,    38,
-      38,    38,    40,    39,   259,   260,   419,   422,   423,   433,
-     430,   415,   431,   428,   429,     0,   427,   432,   414,   421,
-     418,   417,   416,   420,   434,   451,   452,   466,   467,   583,
-       0,   557,     0,   313,   314,   323,   319,   320,   322,   327,
-     324,   325,   326,   321,     0,   318,   312,   330,   329,   328,
-     311,   443,   442,   297,   296,   281,   282,   279,   280,   278,
-       0,   277,     0,     0,     0,   105,   106,   172,   169,   219,
-     231,   206,   215,     0,   204,   209,   225,     0,   218,   223,
-     229,   208,   211,   220,   222,   226,   216,   224,   212,   230,
-     214,   221,   210,   213,     0,   202,   165,   167,   177,   198,
-     182,   183,   184,   194,   178,   179,   180,   189,   197,   181,
-     191,   195,   186,   196,   187,   190,   185,   193,   188,   192,
-       0,   176,   170,   171,   166,   168,   341,   339,   340,   379,
-     384,   390,   393,   386,   392,   387,   391,   389,   385,   388,
-       0,   383,   134,     0,     0,     0,     0,   129,   117,   116,
-     118,   119,   356,   362,   368,   371,   364,   370,   365,   369,
-     367,   363,   366,     0,   361,   357,   267,     0,    41,    42,
-      43,   425,     0,   584,   558,   316,     0,   275,     0,   295,
-     292,   291,     0,     0,     0,     0,     0,     0,   200,     0,
-     174,     0,   381,     0,     0,     0,     0,     0,   128,   359,
-       0,   268,   426,   317,   276,   205,   228,   203,   227,   217,
-     207,   201,   175,   382,   135,   137,   136,   148,   147,   143,
-     145,   149,   146,   142,   144,     0,   141,   360,   139,     0,
-     140
+       0,     0,   410,     0,     0,   461,   474,     0,     0,   476,
+     548,   552,   574,   537,   538,   565,   541,   632,   633,   573,
+     542,   543,   570,   547,   576,   577,   575,   555,   546,   544,
+     545,   551,   539,   550,   549,   571,   630,   631,   569,   610,
+     629,   616,   625,   611,   612,   613,   620,   628,   614,   622,
+     626,   617,   627,   618,   621,   615,   624,   619,   623,     0,
+     609,   584,   605,   589,   590,   591,   601,   585,   586,   587,
+     596,   604,   588,   598,   602,   593,   603,   594,   597,   592,
+     600,   595,   599,     0,   583,   566,   564,   567,   572,   568,
+     557,   563,   562,   558,   559,   560,   561,   578,   579,   554,
+     553,   556,   540,     0,     0,     0,     0,     0,     0,     0,
+       0,   314,     0,     0,   452,     0,     0,     0,   309,   305,
+     308,   286,    50,    51,     0,     0,   107,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   160,     0,     0,
+       0,   347,   684,   681,   682,   683,   688,   687,   689,   685,
+     686,    88,    85,    91,    84,    89,    90,    83,    87,    86,
+      77,    76,    79,    80,    78,    92,    93,    81,    94,    82,
+      95,     0,     0,   388,   134,     0,     0,     0,   146,     0,
+     138,   139,   141,   140,     0,     0,     0,     0,   116,   362,
+       0,     0,     0,   364,    31,    32,    33,    34,    35,    36,
+      37,   274,   275,   267,   272,   273,   284,   283,     0,   282,
+     268,   278,   269,   277,   263,   276,   266,   265,   264,    38,
+      38,    38,    40,    39,   270,   271,   434,   437,   438,   449,
+     446,   430,   447,   443,   445,   444,     0,   442,   448,   429,
+     436,   433,   432,   431,   435,   450,   467,   468,   482,   483,
+     607,     0,   581,     0,   328,   329,   338,   334,   335,   337,
+     342,   339,   340,   341,   336,     0,   333,   327,   345,   344,
+     343,   326,   459,   458,   312,   311,   294,   295,   292,   296,
+     297,   293,   291,     0,   290,     0,     0,     0,   113,   114,
+     181,   178,   228,   240,   215,   224,     0,   213,   218,   234,
+       0,   227,   232,   238,   217,   220,   229,   231,   235,   225,
+     233,   221,   239,   223,   230,   219,   222,     0,   211,   174,
+     176,   186,   207,   191,   192,   193,   203,   187,   188,   189,
+     198,   206,   190,   200,   204,   195,   205,   196,   199,   194,
+     202,   197,   201,     0,   185,   179,   180,   175,   177,   356,
+     354,   355,   394,   399,   405,   408,   401,   407,   402,   406,
+     404,   400,   403,     0,   398,   142,     0,     0,     0,     0,
+     137,   125,   124,   126,   127,   371,   377,   383,   386,   379,
+     385,   380,   384,   382,   378,   381,     0,   376,   372,   280,
+       0,    41,    42,    43,   440,     0,   608,   582,   331,     0,
+     288,     0,   310,   307,   306,     0,     0,     0,     0,     0,
+       0,   209,     0,   183,     0,   396,     0,     0,     0,     0,
+       0,   136,   374,     0,   281,   441,   332,   289,   214,   237,
+     212,   236,   226,   216,   210,   184,   397,   143,   145,   144,
+     156,   155,   151,   153,   157,   154,   158,   150,   152,     0,
+     149,   375,   147,     0,   148
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -981,  -981,  -981,  -293,  -306,  -980,  -635,  -981,  -981,   946,
-    -981,  -981,  -981,  -981,   777,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,   980,  -981,  -981,  -981,  -981,  -981,  -981,
-     668,  -981,  -981,  -981,  -981,  -981,   608,  -981,  -981,  -981,
-    -981,  -981,  -981,   928,  -981,  -981,  -981,  -981,   129,  -981,
-    -981,  -981,  -981,  -981,  -136,  -981,  -981,  -981,   670,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-     -86,  -981,  -981,  -981,   -83,  -981,  -981,  -981,   848,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,   -60,  -981,  -981,  -981,
-    -981,  -981,   -69,  -981,   710,  -981,  -981,  -981,    48,  -981,
-    -981,  -981,  -981,  -981,   729,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,   -63,  -981,  -981,  -981,  -981,  -981,  -981,   664,
-    -981,  -981,  -981,  -981,  -981,   943,  -981,  -981,  -981,  -981,
-     610,  -981,  -981,  -981,  -981,  -981,   -85,  -981,  -981,  -981,
-     629,  -981,  -981,  -981,  -981,   -74,  -981,  -981,  -981,   849,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,   -54,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,   724,  -981,  -981,  -981,  -981,  -981,   811,  -981,  -981,
-    -981,  -981,  1081,  -981,  -981,  -981,  -981,   803,  -981,  -981,
-    -981,  -981,  1032,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,    95,  -981,  -981,  -981,    93,
-    -981,  -981,  -981,  -981,  -981,  -981,  1110,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981,   969,  -981,  -981,  -981,  -981,  -981,
-    -981,  -981,  -981,  -981
+   -1034, -1034, -1034,  -358,  -322, -1033,  -665, -1034, -1034,   993,
+   -1034, -1034, -1034, -1034,   446, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034,  1148, -1034, -1034,
+   -1034, -1034, -1034, -1034,   713, -1034, -1034, -1034, -1034, -1034,
+     629, -1034, -1034, -1034, -1034, -1034, -1034,   953, -1034, -1034,
+   -1034, -1034,   146, -1034, -1034, -1034, -1034, -1034,  -126, -1034,
+   -1034, -1034,   702, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034,   -86, -1034, -1034, -1034,   -81, -1034,
+   -1034, -1034,   886, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034,   -57, -1034, -1034, -1034, -1034, -1034,   -69, -1034,
+     735, -1034, -1034, -1034,    50, -1034, -1034, -1034, -1034, -1034,
+     760, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   -61, -1034,
+   -1034, -1034, -1034, -1034, -1034,   695, -1034, -1034, -1034, -1034,
+   -1034,   969, -1034, -1034, -1034, -1034,   630, -1034, -1034, -1034,
+   -1034, -1034,   -83, -1034, -1034, -1034,   655, -1034, -1034, -1034,
+   -1034,   -74, -1034, -1034, -1034,   861, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,   -50, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034,   757, -1034, -1034,
+   -1034, -1034, -1034,   851, -1034, -1034, -1034, -1034,  1136, -1034,
+   -1034, -1034, -1034,   837, -1034, -1034, -1034, -1034,  1085, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034,   102, -1034, -1034, -1034,   101,
+   -1034, -1034, -1034, -1034, -1034, -1034,  1163, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034,  1015, -1034, -1034, -1034, -1034, -1034,
+   -1034, -1034, -1034, -1034
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    26,   823,   824,  1082,  1083,    27,   223,   224,
-     225,   226,    28,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,    29,    77,    78,    79,    80,    81,    30,    63,   499,
-     500,   501,   502,    31,    70,   582,   583,   584,   585,   586,
-     587,    32,   289,   290,   291,   292,   293,  1041,  1042,  1043,
-    1044,  1045,  1225,  1305,  1306,    33,    64,   514,   515,   516,
-     517,   518,   519,   520,   521,   522,   523,   524,   749,  1200,
-    1201,   525,   746,  1174,  1175,    34,    53,   340,   341,   342,
-     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
-     353,   354,   355,   356,   625,  1068,  1069,    35,    61,   485,
-     731,  1140,  1141,   486,   487,   488,  1144,   985,   986,   489,
-     490,    36,    59,   463,   464,   465,   466,   467,   468,   469,
-     716,  1124,  1125,   470,   471,   472,    37,    65,   530,   531,
-     532,   533,   534,    38,   297,   298,   299,    39,    72,   595,
-     596,   597,   598,   599,   808,  1243,  1244,    40,    68,   568,
-     569,   570,   571,   791,  1220,  1221,    41,    54,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     646,  1095,  1096,   385,   386,   387,   388,   389,    42,    60,
-     476,   477,   478,   479,    43,    55,   393,   394,   395,   396,
-      44,   120,   121,   122,    45,    57,   403,   404,   405,   406,
-      46,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
-     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
-     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   433,   949,   950,   212,   432,   925,   926,
-     213,   214,   215,   216,    47,    98,    99,   100,   101,   102,
+       0,     1,    26,   861,   862,  1132,  1133,    27,   231,   232,
+     233,   234,    28,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,    29,    77,    78,    79,    80,
+      81,    30,    63,   523,   524,   525,   526,    31,    70,   610,
+     611,   612,   613,   614,   615,    32,   305,   306,   307,   308,
+     309,  1089,  1090,  1091,  1092,  1093,  1278,  1359,  1360,    33,
+      64,   538,   539,   540,   541,   542,   543,   544,   545,   546,
+     547,   548,   783,  1253,  1254,   549,   780,  1227,  1228,    34,
+      53,   358,   359,   360,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
+     655,  1118,  1119,    35,    61,   509,   765,  1193,  1194,   510,
+     511,   512,  1197,  1029,  1030,   513,   514,    36,    59,   487,
+     488,   489,   490,   491,   492,   493,   750,  1175,  1176,   494,
+     495,   496,    37,    65,   554,   555,   556,   557,   558,    38,
+     313,   314,   315,    39,    72,   623,   624,   625,   626,   627,
+     846,  1296,  1297,    40,    68,   596,   597,   598,   599,   829,
+    1273,  1274,    41,    54,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   676,  1146,  1147,   405,
+     406,   407,   408,   409,    42,    60,   500,   501,   502,   503,
+      43,    55,   413,   414,   415,   416,    44,   120,   121,   122,
+      45,    57,   423,   424,   425,   426,    46,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   457,   993,   994,   220,   456,   969,   970,
+     221,   222,   223,   224,    47,    98,    99,   100,   101,   102,
      103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,    48,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250
+     113,   114,    48,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     853,   854,   606,    82,   496,    51,   610,   611,   612,   591,
-     614,   615,  1093,   287,   287,    73,   295,   118,  1109,  1111,
-     301,  1246,  1110,  1112,   390,  1247,   220,   480,   118,   295,
-      83,    84,    52,  1251,  1079,  1080,  1081,  1252,    85,   390,
-     124,   473,   591,   400,    86,   125,   126,    74,   127,   128,
-      56,   496,   220,  1066,   129,    75,   454,    58,   565,    49,
-      50,  1275,    62,   565,   130,   131,   132,    87,    88,    89,
-      90,    66,  1255,    67,   133,   455,  1256,   134,   135,   136,
-     526,   473,    91,    92,    93,   119,   137,   481,   497,    94,
-      95,    96,   391,    97,   852,   482,   119,   483,   456,  1248,
-    1249,  1250,   668,   138,   670,   671,   577,   391,   674,   857,
-     858,    69,  1037,   592,   139,   681,   400,   140,   141,    76,
-     296,   687,  1037,  1067,   527,   142,   457,   221,    71,   695,
-     696,   143,   144,   296,   145,   497,   146,   115,   116,   147,
-     148,   707,   708,   709,   251,  1257,   592,   401,   222,  1258,
-     149,   392,   484,   221,   117,   150,   151,  1268,   152,   153,
-     154,  1269,   566,   155,   528,   230,   392,   566,   474,   503,
-     402,  1270,   498,   252,   222,  1271,   253,   458,   123,  1272,
-     324,  -127,  -127,  1273,   459,   460,   217,   156,   504,   218,
-     157,   158,   159,   160,   161,   162,   163,   325,   326,  1094,
-     219,   231,  1279,   327,   461,   254,  1280,   529,   474,   227,
-     578,   505,   232,   233,   234,   255,  1038,   235,   236,   498,
-     401,   577,   237,   238,   239,  1308,  1038,   593,   228,  1309,
-     594,   764,   229,   288,   288,   322,   741,   256,   357,   506,
-     358,   257,   359,   402,   164,   165,   574,   305,   258,   398,
-     328,   259,   260,   852,   286,   166,   167,   360,   494,   733,
-     593,   589,   475,   594,   168,   526,   169,   579,   329,   330,
-     294,   659,   452,   507,   810,   331,   567,   462,   332,   261,
-     361,   567,    73,   300,   333,   580,   796,  1135,   722,   302,
-     508,   303,   334,   335,   336,   792,   304,  1136,   362,   581,
-     363,  1039,   475,   307,   337,   308,   309,   310,   364,   527,
-     311,  1039,   760,   726,    74,   491,   312,   313,   841,  1137,
-     365,   844,    75,   846,   338,   578,   314,   315,   851,   316,
-    1040,   317,   318,   319,   320,   321,   503,   397,   802,   407,
-    1040,   408,   366,   409,  1226,   410,   869,   411,   665,   528,
-     480,   262,   412,   263,   264,   504,   265,   266,   267,   413,
-     454,   339,   414,   367,   509,   816,   817,   818,   819,   820,
-     821,   822,   415,   416,   417,   418,   563,   510,   505,   455,
-     511,   368,   579,   419,   420,   421,    76,   422,   423,   424,
-     512,   425,   529,   426,   513,   427,   369,   544,   428,   124,
-     580,   754,   456,   546,   125,   126,   506,   127,   128,   429,
-     481,  1115,   637,   129,   581,   430,   431,   434,   482,  1297,
-     483,  1298,   435,   130,   131,   132,   436,   437,   438,   439,
-     457,   440,   441,   133,   442,   443,   134,   135,   136,  1116,
-     507,   444,   445,   446,   370,   137,   371,   372,   447,   448,
-     449,  1138,   450,   451,   492,   604,   493,   508,   535,   605,
-     536,  1139,   138,  1299,  1149,   537,   538,   539,   540,   541,
-     655,   542,  1117,   139,   543,   484,   140,   141,   547,  1300,
-     548,   458,  1150,  1151,   142,   549,   550,   551,   459,   460,
-     143,   144,   552,   145,  1152,   146,   553,   554,   147,   148,
-     555,  1118,  1119,   556,   557,   558,   559,  1120,   461,   149,
-    1301,  1302,   560,   561,   150,   151,   572,   152,   153,   154,
-     562,   573,   155,  1056,  1057,  1058,  1059,  1060,  1061,  1062,
-    1121,   509,   576,  1153,  1154,   588,  1155,   600,   601,   602,
-     607,   608,   603,   605,   510,   609,   156,   511,   251,   157,
-     158,   159,   160,   161,   162,   163,   613,   512,   616,   230,
-     617,   513,  1156,   618,   619,   622,   620,  1303,   661,  1286,
-    1157,   621,   667,  1304,   639,   623,   624,   252,   626,  1210,
-     253,   462,   627,   628,   672,   629,   630,   631,   632,  1276,
-     633,  1158,   634,  1159,  1160,   231,   635,   636,  1122,   640,
-     641,   642,   643,   164,   165,   644,   232,   233,   234,   254,
-    1161,   235,   236,   645,   166,   167,   237,   238,   239,   255,
-     647,   648,   649,   168,  1123,   169,  1162,   650,  1233,   927,
-     669,  1163,   651,   662,   357,  1164,   358,  1211,   359,  1165,
-     652,   256,   653,   654,  1166,   257,   657,   658,  1167,   663,
-     664,   673,   258,   360,   675,   259,   260,  1168,   676,  1169,
-    1170,  1212,  1171,   677,   928,   678,   679,   680,   682,  1213,
-     683,   929,   684,   930,   931,   685,   361,   686,  1214,   688,
-    1172,   691,   689,   261,   690,   694,  1234,   692,  1173,   693,
-     697,   698,   699,   700,   362,  1178,   363,   701,   702,   703,
-    1215,   704,  1216,  1217,   364,   705,   706,   711,   710,   714,
-    1235,   712,   713,   715,   762,   728,   365,   717,  1236,   718,
-     719,   763,   735,  1218,   766,   720,   721,  1237,   736,   768,
-    1179,  1219,   765,   905,   724,   725,   772,  1180,   366,  1181,
-    1182,   729,   730,   732,   737,   738,   739,   769,   743,  1238,
-     740,  1239,  1240,   744,   745,   262,   747,   263,   264,   367,
-     265,   266,   267,   748,   750,   751,   752,   753,   906,   756,
-     757,   758,  1241,   759,   767,   907,   770,   368,   932,   933,
-    1242,   771,   934,   935,   773,   936,   937,   774,   938,   775,
-     939,   776,   369,   940,   777,   941,   942,   778,   779,   780,
-     781,   943,   794,   782,   783,   944,   784,   785,   786,   945,
-     946,   947,   787,   788,   790,   798,   789,   795,   797,   948,
-     804,   847,   799,   800,   801,   805,   806,   807,   812,   813,
-     809,   814,   815,   825,   826,   827,   828,   829,   830,   831,
-     370,   832,   371,   372,  1183,  1184,   833,   324,  1185,  1186,
-     839,  1187,  1188,   834,  1189,   835,  1190,   836,   837,  1191,
-     838,  1192,  1193,   840,   325,   326,   842,  1194,   843,   845,
-     327,  1195,   848,   849,   850,  1196,  1197,  1198,   852,   856,
-     855,   859,   908,   909,   860,  1199,   910,   911,   861,   912,
-     913,   862,   914,   864,   915,   863,   865,   916,   866,   917,
-     918,   867,     2,     3,   868,   919,     4,   870,   871,   920,
-     971,   872,   873,   921,   922,   923,   874,   328,   973,     5,
-     875,   876,     6,   924,   877,     7,   878,   879,    82,   880,
-     881,   882,   883,   884,     8,   329,   330,   885,   886,   887,
-     888,   889,   331,   890,   891,   332,   892,     9,   893,   894,
-     895,   333,   896,    10,    11,    83,    84,   897,   898,   334,
-     335,   336,   899,    85,   900,   901,   902,   903,   904,    86,
-     951,   337,    12,   952,   953,   954,    13,   955,   956,   957,
-     958,   959,   960,   961,   962,   963,    14,   964,   965,   966,
-     967,   338,    87,    88,    89,    90,   968,   969,   970,   972,
-     974,   975,   976,   978,   979,    15,    16,    91,    92,    93,
-     977,   980,   981,   982,    94,    95,    96,   984,    97,   983,
-      17,   987,   988,   989,   992,   990,   991,   993,   339,   994,
-     996,   997,   999,   995,   998,  1000,    18,  1001,  1002,  1034,
-    1004,  1003,  1005,  1006,  1288,   564,  1007,  1008,    19,    20,
-    1009,  1010,  1011,  1012,  1013,  1014,  1015,   306,  1016,  1017,
-    1018,  1019,  1020,  1033,  1021,    21,  1022,  1023,  1024,  1025,
-    1026,  1027,  1028,  1029,  1030,  1031,  1032,  1035,    22,  1036,
-    1046,  1047,  1048,    23,  1049,  1050,  1052,  1051,    24,  1054,
-    1055,    25,  1053,  1063,  1064,  1065,  1070,  1071,  1072,  1073,
-    1074,  1075,  1076,  1077,  1078,  1084,  1085,  1086,  1087,  1088,
-    1089,  1090,  1091,  1092,  1097,  1098,  1099,  1100,  1101,  1102,
-    1103,  1104,  1105,  1106,  1107,  1108,  1113,  1114,  1126,  1127,
-    1128,  1129,  1130,  1131,  1142,  1132,  1133,  1134,  1285,  1145,
-    1146,  1147,  1143,  1148,  1176,  1177,  1202,  1203,  1287,  1204,
-    1205,  1206,  1207,  1208,  1209,  1222,  1289,  1290,  1228,  1223,
-    1224,  1229,  1230,  1231,  1232,  1245,  1259,   742,  1261,   495,
-    1227,  1262,  1274,  1310,  1263,  1264,  1265,  1266,  1267,  1277,
-    1278,  1294,  1295,  1296,   755,  1292,  1291,  1281,   638,  1284,
-     803,  1260,   723,  1283,   761,  1307,   734,   793,  1282,  1293,
-     727,   399,   453,  1253,   660,   811,   666,  1254,   323,   545,
-       0,     0,     0,     0,     0,     0,     0,   575,     0,     0,
-       0,     0,   656,     0,     0,     0,     0,     0,     0,     0,
+     893,   894,   634,   550,    73,   238,   638,   639,   640,  1116,
+     642,   643,   118,    51,  1328,   228,  1085,    73,    52,   497,
+     410,  1129,  1130,  1131,   593,   420,   118,   520,    56,   311,
+     550,   593,   420,    58,  1160,   619,   311,    74,  1161,  1162,
+      62,   410,   239,  1163,   605,    75,    49,    50,   551,   497,
+      74,   892,    66,   240,   241,   242,    67,   303,    75,  1299,
+     243,   244,    69,  1300,   124,   245,   246,   247,  1304,   125,
+     126,   127,  1305,   128,   129,   551,   228,  1308,    71,   130,
+    1310,  1309,  1117,   520,  1311,   115,   119,   116,  1321,   131,
+     132,   133,  1322,   552,   411,   259,  1301,  1302,  1303,   134,
+     119,  1085,   135,   136,   137,   504,   698,   699,  1323,   701,
+     702,   138,  1324,   705,    76,   411,   117,   521,   619,   711,
+     552,   713,   229,   715,   303,   260,  1086,    76,   261,   721,
+     139,   140,   141,   142,   594,   421,   553,   729,   730,   312,
+     123,   594,   421,   230,   143,   620,   312,   144,   145,   741,
+     742,   743,   498,   412,   606,   146,  1325,   225,   422,   262,
+    1326,   147,   148,   553,   149,   422,   150,   226,   505,   151,
+     152,    82,   263,   521,   412,   897,   898,   605,   340,   506,
+     153,   507,   498,   229,   227,   154,   155,  1332,   156,   157,
+     158,  1333,  1143,   159,   264,   235,   341,   342,   265,    83,
+      84,   236,   343,   522,   230,   266,  1362,    85,   267,   268,
+    1363,  1086,   607,    86,  1087,   237,   302,   310,   160,   316,
+     317,   161,   162,   163,   164,   165,   166,   167,   620,   344,
+     345,   527,   608,  -135,   318,   319,   508,   269,   320,   798,
+     323,    87,    88,    89,    90,   324,   609,  1088,   478,   321,
+     568,   528,   892,   499,   346,   595,    91,    92,    93,   522,
+     518,  1279,   595,    94,    95,    96,   621,    97,   479,   622,
+     695,   418,   347,   348,   529,   794,   830,   168,   169,   349,
+     848,   617,   350,   499,   325,   326,   689,   606,   351,   840,
+     304,   480,   170,   171,   760,   478,   352,   353,   354,  1087,
+    -135,   172,   602,   173,   515,   327,   328,   530,   355,   476,
+     329,   270,   330,   271,   272,   479,   273,   274,   275,   276,
+     277,   278,   279,   377,   481,   378,   331,   379,   775,   356,
+     879,  1166,  1088,   504,   332,   884,   333,   886,   480,   334,
+     591,   531,   891,   380,   335,   607,   336,   337,   570,   621,
+     767,  1186,   622,   417,  1144,   427,   428,   304,   532,  1167,
+     909,  1187,   429,   430,   431,   608,   381,   432,   357,   433,
+     434,   481,   435,   436,   437,   482,   438,   439,   440,   609,
+     441,   442,   483,   484,   443,  1188,   382,  1145,   383,   444,
+     445,   446,   447,   448,   527,   449,   505,  1168,  1350,   384,
+    1351,   450,   451,   485,   452,   453,   454,   506,   455,   507,
+     458,   385,   459,   460,   528,   461,   338,   462,   604,   463,
+     464,   465,   482,   667,   600,   628,  1169,  1170,   466,   483,
+     484,   632,  1171,   386,   467,   533,   468,   529,   469,   470,
+     471,   472,  1352,   473,   474,   475,   516,   517,   534,   559,
+     485,   535,   560,   561,   387,  1172,   562,   563,  1353,   564,
+     565,   566,   567,   571,   508,   536,   572,   573,   574,   537,
+     530,  1189,   575,   388,   576,   577,   788,   578,   633,   579,
+     124,   580,   486,   581,   582,   125,   126,   127,   389,   128,
+     129,  1354,  1355,   756,   583,   130,  1104,  1105,  1106,  1107,
+    1108,  1109,  1110,  1356,   531,   131,   132,   133,   584,   585,
+     586,   587,   588,   589,  1190,   134,   590,   601,   135,   136,
+     137,   532,   616,  1191,   629,   630,  1173,   138,   631,   486,
+     635,   637,   636,  1192,   641,   644,   645,   646,   390,   647,
+     391,   392,   648,   649,   650,   669,   139,   140,   141,   142,
+     651,   652,   653,  1357,   654,   656,  1174,   657,   658,  1358,
+     143,   659,   834,   144,   145,   692,   691,   697,   685,  1202,
+     703,   146,   660,   661,   662,   663,   664,   147,   148,   665,
+     149,   666,   150,   670,   671,   151,   152,   672,  1203,  1204,
+     377,   673,   378,   259,   379,   674,   153,   675,   533,   677,
+    1205,   154,   155,   678,   156,   157,   158,   679,   680,   159,
+     380,   534,  1329,   681,   535,   854,   855,   856,   857,   858,
+     859,   860,   682,   260,   683,   684,   261,   238,   536,   687,
+     688,   693,   537,   381,   160,   694,   700,   161,   162,   163,
+     164,   165,   166,   167,  1206,  1207,   704,  1208,   706,   707,
+     708,   709,   710,   382,   712,   383,   714,   262,   716,   717,
+     718,   719,   720,   722,   239,   723,   384,   724,   725,   728,
+     263,   731,   726,  1209,   727,   240,   241,   242,   385,   732,
+     733,  1210,   243,   244,   740,   734,   735,   245,   246,   247,
+     736,   737,   264,   168,   169,   738,   265,   739,   744,   746,
+     386,   745,  1211,   266,  1212,  1213,   267,   268,   170,   171,
+     747,   748,   749,   796,   762,   633,   751,   172,   752,   173,
+     797,   387,  1214,   753,   754,  1338,   592,   800,   755,   758,
+     769,   759,  1195,   770,   763,   269,   764,   766,   771,  1215,
+     388,   772,   773,   774,  1216,     2,     3,   777,  1217,     4,
+     790,   778,   779,  1218,   781,   389,   782,   784,  1219,   785,
+     786,   787,  1220,     5,   791,  1263,     6,   792,   793,     7,
+     799,  1221,   801,  1222,  1223,   802,  1224,   803,     8,   804,
+     805,   806,   807,   808,   809,  1286,   810,   811,   812,   813,
+     814,     9,   971,   815,   816,   817,   818,   819,  1225,    10,
+      11,   820,   822,   821,   823,   390,  1226,   391,   392,   270,
+     824,   271,   272,   826,   273,   274,   275,   276,   277,   278,
+     279,    12,   825,  1264,   828,    13,   827,   972,  1231,   832,
+     833,   835,   836,   843,   842,    14,   973,   900,   974,   975,
+     844,   837,   838,  1287,   839,   845,   847,   850,  1265,   851,
+     852,   853,   863,   864,    15,    16,   865,  1266,   866,   949,
+     867,   887,   868,  1232,   869,   870,  1267,   871,  1288,    17,
+     872,   877,  1233,   873,  1234,  1235,   874,  1289,   875,   876,
+     878,   880,   881,   882,   883,    18,  1290,   885,   888,  1268,
+     889,  1269,  1270,   890,   950,   892,   896,   895,    19,    20,
+     899,   901,   902,   951,   903,   904,   905,  1339,   906,  1291,
+     907,  1292,  1293,   908,   910,    21,  1271,   911,   912,   913,
+     914,  1014,   917,   915,  1272,   916,   919,   918,  1038,    22,
+     920,   921,   922,   923,   924,    23,  1294,   925,   926,   927,
+      24,   928,   929,    25,  1295,   930,   931,   976,   977,   932,
+     933,   934,   978,   979,   935,   980,   981,   936,   982,   937,
+     983,   938,   939,   984,   940,   941,   985,   986,   942,   943,
+     944,   945,   987,   946,   947,   948,   988,   995,   996,   997,
+     989,   990,   991,  1236,  1237,   998,   340,   999,  1238,  1239,
+     992,  1240,  1241,  1000,  1242,  1001,  1243,  1002,  1003,  1244,
+    1004,  1005,  1245,  1246,   341,   342,  1006,  1007,  1247,  1008,
+     343,  1009,  1248,  1010,   952,   953,  1249,  1250,  1251,   954,
+     955,  1011,   956,   957,  1012,   958,  1252,   959,  1013,  1015,
+     960,  1016,  1018,   961,   962,  1017,  1019,   344,   345,   963,
+      82,  1020,  1021,   964,  1022,  1023,  1025,   965,   966,   967,
+    1024,  1026,  1027,  1028,  1039,  1031,  1032,   968,  1033,  1036,
+    1034,  1035,   346,  1037,  1040,  1041,  1043,  1042,    83,    84,
+    1044,  1045,  1046,  1082,  1048,  1047,    85,  1049,  1050,  1081,
+     347,   348,    86,  1051,  1052,  1053,  1054,   349,  1055,  1056,
+     350,  1057,  1315,  1058,  1059,  1060,   351,  1061,  1062,  1063,
+    1064,  1065,  1094,  1066,   352,   353,   354,  1067,  1068,  1069,
+      87,    88,    89,    90,  1070,  1071,   355,  1072,  1073,  1074,
+    1075,  1076,  1077,  1078,  1079,    91,    92,    93,  1080,  1083,
+    1084,  1095,    94,    95,    96,  1096,    97,   356,  1097,  1098,
+    1100,  1099,  1102,  1316,  1327,  1103,  1101,  1111,  1112,  1113,
+    1114,  1115,  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,
+    1128,  1134,  1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,
+    1148,  1149,  1150,  1151,  1152,  1153,   357,  1154,  1155,  1156,
+    1157,  1158,  1159,  1164,  1165,  1177,  1178,  1179,  1180,  1181,
+    1182,  1183,  1184,  1185,  1340,  1198,  1199,  1200,  1196,  1201,
+    1229,  1230,  1255,  1256,  1257,  1258,  1259,  1260,  1261,  1262,
+    1275,  1341,  1342,  1281,  1276,  1277,  1282,  1283,  1284,  1285,
+    1298,  1312,  1343,  1314,   519,   322,  1317,  1331,  1347,  1318,
+    1319,  1320,  1330,  1348,  1349,  1280,   776,  1364,  1345,   841,
+     789,  1344,  1337,  1334,   668,   768,  1313,   757,  1336,   795,
+    1361,   831,  1346,   849,   686,  1335,   419,   761,   603,   477,
+     696,   339,  1306,   569,   690,  1307,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     590
+       0,     0,   618
 };
 
 static const yytype_int16 yycheck[] =
 {
-     635,   636,   308,     1,     1,   234,   312,   313,   314,     1,
-     316,   317,     8,     1,     1,     1,     1,     1,   232,   232,
-     232,   232,   236,   236,     1,   236,     1,     1,     1,     1,
-      28,    29,   234,   232,    12,    13,    14,   236,    36,     1,
-       1,     1,     1,     1,    42,     6,     7,    33,     9,    10,
-     234,     1,     1,    57,    15,    41,     1,   234,     1,   232,
-     233,   198,   234,     1,    25,    26,    27,    65,    66,    67,
-      68,   234,   232,   234,    35,    20,   236,    38,    39,    40,
-       1,     1,    80,    81,    82,    69,    47,    61,    85,    87,
-      88,    89,    69,    91,   231,    69,    69,    71,    43,  1079,
-    1080,  1081,   408,    64,   410,   411,     1,    69,   414,   173,
-     174,   234,     1,   105,    75,   421,     1,    78,    79,   105,
-     105,   427,     1,   127,    45,    86,    71,   102,   234,   435,
-     436,    92,    93,   105,    95,    85,    97,   234,   234,   100,
-     101,   447,   448,   449,     1,   232,   105,   105,   123,   236,
-     111,   128,   126,   102,   234,   116,   117,   232,   119,   120,
-     121,   236,   105,   124,    85,     1,   128,   105,   128,     1,
-     128,   232,   169,    30,   123,   236,    33,   122,   234,   232,
-       1,   169,   169,   236,   129,   130,   234,   148,    20,   234,
-     151,   152,   153,   154,   155,   156,   157,    18,    19,   195,
-     234,    37,   232,    24,   149,    62,   236,   128,   128,   234,
-     105,    43,    48,    49,    50,    72,   105,    53,    54,   169,
-     105,     1,    58,    59,    60,   232,   105,   219,   234,   236,
-     222,   537,   234,   221,   221,   233,   233,    94,     1,    71,
-       3,    98,     5,   128,   205,   206,   233,   233,   105,   233,
-      71,   108,   109,   231,   234,   216,   217,    20,   233,   233,
-     219,   233,   222,   222,   225,     1,   227,   162,    89,    90,
-     234,   233,   233,   105,   233,    96,   219,   222,    99,   136,
-      43,   219,     1,   234,   105,   180,   234,    21,   233,   235,
-     122,   235,   113,   114,   115,   233,   235,    31,    61,   194,
-      63,   190,   222,   235,   125,   235,   235,   235,    71,    45,
-     235,   190,   233,   233,    33,   232,   235,   235,   624,    53,
-      83,   627,    41,   629,   145,   105,   235,   235,   634,   235,
-     219,   235,   235,   235,   235,   235,     1,   235,   233,   235,
-     219,   235,   105,   235,   233,   235,   652,   235,   233,    85,
-       1,   208,   235,   210,   211,    20,   213,   214,   215,   235,
-       1,   182,   235,   126,   196,   137,   138,   139,   140,   141,
-     142,   143,   235,   235,   235,   235,   233,   209,    43,    20,
-     212,   144,   162,   235,   235,   235,   105,   235,   235,   235,
-     222,   235,   128,   235,   226,   235,   159,   233,   235,     1,
-     180,   233,    43,   232,     6,     7,    71,     9,    10,   235,
-      61,    16,   233,    15,   194,   235,   235,   235,    69,    74,
-      71,    76,   235,    25,    26,    27,   235,   235,   235,   235,
-      71,   235,   235,    35,   235,   235,    38,    39,    40,    44,
-     105,   235,   235,   235,   207,    47,   209,   210,   235,   235,
-     235,   185,   235,   235,   235,   231,   235,   122,   235,   231,
-     235,   195,    64,   118,     4,   235,   235,   235,   235,   235,
-     233,   235,    77,    75,   235,   126,    78,    79,   235,   134,
-     235,   122,    22,    23,    86,   235,   235,   235,   129,   130,
-      92,    93,   235,    95,    34,    97,   235,   235,   100,   101,
-     235,   106,   107,   235,   235,   235,   235,   112,   149,   111,
-     165,   166,   235,   235,   116,   117,   232,   119,   120,   121,
-     235,   235,   124,   816,   817,   818,   819,   820,   821,   822,
-     135,   196,   169,    73,    74,   235,    76,   230,   230,   230,
-     204,   204,   232,   231,   209,   231,   148,   212,     1,   151,
-     152,   153,   154,   155,   156,   157,   231,   222,   231,     1,
-     231,   226,   102,   231,   231,   235,   232,   222,   230,   134,
-     110,   232,   204,   228,   232,   235,   235,    30,   235,    76,
-      33,   222,   235,   235,   204,   235,   235,   235,   235,  1224,
-     235,   131,   235,   133,   134,    37,   235,   235,   203,   235,
-     235,   235,   235,   205,   206,   235,    48,    49,    50,    62,
-     150,    53,    54,   235,   216,   217,    58,    59,    60,    72,
-     235,   235,   235,   225,   229,   227,   166,   235,    76,    11,
-     231,   171,   235,   232,     1,   175,     3,   134,     5,   179,
-     235,    94,   235,   235,   184,    98,   235,   235,   188,   235,
-     235,   231,   105,    20,   204,   108,   109,   197,   231,   199,
-     200,   158,   202,   231,    46,   231,   204,   204,   231,   166,
-     231,    53,   231,    55,    56,   231,    43,   231,   175,   231,
-     220,   204,   231,   136,   231,   204,   134,   235,   228,   235,
-     204,   204,   204,   204,    61,    11,    63,   204,   204,   204,
-     197,   204,   199,   200,    71,   204,   231,   231,   204,   235,
-     158,   232,   232,   235,   204,   232,    83,   235,   166,   235,
-     235,   204,   230,   220,   204,   235,   235,   175,   230,   204,
-      46,   228,   230,    11,   235,   235,   231,    53,   105,    55,
-      56,   235,   235,   235,   232,   232,   235,   204,   232,   197,
-     235,   199,   200,   235,   235,   208,   235,   210,   211,   126,
-     213,   214,   215,   235,   235,   235,   235,   235,    46,   232,
-     235,   235,   220,   235,   230,    53,   204,   144,   160,   161,
-     228,   232,   164,   165,   230,   167,   168,   204,   170,   230,
-     172,   231,   159,   175,   231,   177,   178,   230,   230,   230,
-     230,   183,   204,   230,   230,   187,   230,   230,   230,   191,
-     192,   193,   230,   232,   235,   235,   232,   232,   232,   201,
-     230,   230,   235,   235,   235,   232,   232,   235,   232,   232,
-     235,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     207,   232,   209,   210,   160,   161,   232,     1,   164,   165,
-     231,   167,   168,   232,   170,   232,   172,   232,   232,   175,
-     232,   177,   178,   231,    18,    19,   235,   183,   231,   231,
-      24,   187,   231,   231,   231,   191,   192,   193,   231,   230,
-     232,   230,   160,   161,   204,   201,   164,   165,   230,   167,
-     168,   230,   170,   230,   172,   235,   230,   175,   231,   177,
-     178,   230,     0,     1,   230,   183,     4,   230,   230,   187,
-     235,   232,   230,   191,   192,   193,   230,    71,   231,    17,
-     232,   232,    20,   201,   230,    23,   230,   232,     1,   232,
-     232,   232,   232,   232,    32,    89,    90,   232,   232,   232,
-     232,   232,    96,   232,   232,    99,   232,    45,   232,   232,
-     232,   105,   232,    51,    52,    28,    29,   232,   232,   113,
-     114,   115,   232,    36,   232,   232,   232,   232,   232,    42,
-     232,   125,    70,   232,   232,   232,    74,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,    84,   232,   232,   232,
-     232,   145,    65,    66,    67,    68,   232,   230,   204,   230,
-     230,   230,   230,   230,   230,   103,   104,    80,    81,    82,
-     232,   232,   230,   230,    87,    88,    89,   231,    91,   235,
-     118,   232,   232,   232,   232,   230,   230,   230,   182,   204,
-     230,   230,   230,   235,   235,   204,   134,   230,   230,   235,
-     230,   232,   230,   230,   134,   268,   232,   232,   146,   147,
-     232,   232,   232,   232,   232,   232,   232,    77,   232,   232,
-     232,   232,   232,   230,   232,   163,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   176,   232,
-     230,   230,   230,   181,   230,   232,   230,   232,   186,   230,
-     232,   189,   235,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   218,   232,   232,   232,   132,   232,
-     232,   232,   236,   232,   232,   232,   232,   232,   132,   232,
-     232,   232,   232,   232,   232,   232,   132,   132,   232,   235,
-     235,   232,   232,   232,   232,   232,   231,   499,   232,   223,
-    1041,   237,   230,  1309,   237,   237,   237,   237,   237,   235,
-     232,   232,   232,   232,   514,  1271,  1269,  1247,   340,  1258,
-     582,  1143,   463,  1256,   530,  1280,   486,   568,  1252,  1273,
-     476,   120,   170,  1110,   393,   595,   403,  1112,    98,   240,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   289,    -1,    -1,
-      -1,    -1,   373,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     665,   666,   324,     1,     1,     1,   328,   329,   330,    60,
+     332,   333,     1,   247,   207,     1,     1,     1,   247,     1,
+       1,    13,    14,    15,     1,     1,     1,     1,   247,     1,
+       1,     1,     1,   247,   245,     1,     1,    34,   249,   245,
+     247,     1,    38,   249,     1,    42,   245,   246,    46,     1,
+      34,   244,   247,    49,    50,    51,   247,     1,    42,   245,
+      56,    57,   247,   249,     1,    61,    62,    63,   245,     6,
+       7,     8,   249,    10,    11,    46,     1,   245,   247,    16,
+     245,   249,   133,     1,   249,   247,    75,   247,   245,    26,
+      27,    28,   249,    91,    75,     1,  1129,  1130,  1131,    36,
+      75,     1,    39,    40,    41,     1,   428,   429,   245,   431,
+     432,    48,   249,   435,   111,    75,   247,    91,     1,   441,
+      91,   443,   108,   445,     1,    31,   111,   111,    34,   451,
+      67,    68,    69,    70,   111,   111,   134,   459,   460,   111,
+     247,   111,   111,   129,    81,   111,   111,    84,    85,   471,
+     472,   473,   134,   134,   111,    92,   245,   247,   134,    65,
+     249,    98,    99,   134,   101,   134,   103,   247,    64,   106,
+     107,     1,    78,    91,   134,   181,   182,     1,     1,    75,
+     117,    77,   134,   108,   247,   122,   123,   245,   125,   126,
+     127,   249,     9,   130,   100,   247,    19,    20,   104,    29,
+      30,   247,    25,   177,   129,   111,   245,    37,   114,   115,
+     249,   111,   169,    43,   199,   247,   247,   247,   155,   247,
+     245,   158,   159,   160,   161,   162,   163,   164,   111,    52,
+      53,     1,   189,   177,   248,   248,   132,   143,   248,   561,
+     248,    71,    72,    73,    74,   248,   203,   232,     1,   246,
+     246,    21,   244,   235,    77,   232,    86,    87,    88,   177,
+     246,   246,   232,    93,    94,    95,   232,    97,    21,   235,
+     246,   246,    95,    96,    44,   246,   246,   214,   215,   102,
+     246,   246,   105,   235,   248,   248,   246,   111,   111,   246,
+     234,    44,   229,   230,   246,     1,   119,   120,   121,   199,
+     177,   238,   246,   240,   245,   248,   248,    77,   131,   246,
+     248,   217,   248,   219,   220,    21,   222,   223,   224,   225,
+     226,   227,   228,     1,    77,     3,   248,     5,   246,   152,
+     652,    17,   232,     1,   248,   657,   248,   659,    44,   248,
+     246,   111,   664,    21,   248,   169,   248,   248,   245,   232,
+     246,    22,   235,   248,   171,   248,   248,   234,   128,    45,
+     682,    32,   248,   248,   248,   189,    44,   248,   191,   248,
+     248,    77,   248,   248,   248,   128,   248,   248,   248,   203,
+     248,   248,   135,   136,   248,    56,    64,   204,    66,   248,
+     248,   248,   248,   248,     1,   248,    64,    83,    80,    77,
+      82,   248,   248,   156,   248,   248,   248,    75,   248,    77,
+     248,    89,   248,   248,    21,   248,   246,   248,   177,   248,
+     248,   248,   128,   246,   245,   243,   112,   113,   248,   135,
+     136,   244,   118,   111,   248,   205,   248,    44,   248,   248,
+     248,   248,   124,   248,   248,   248,   248,   248,   218,   248,
+     156,   221,   248,   248,   132,   141,   248,   248,   140,   248,
+     248,   248,   248,   248,   132,   235,   248,   248,   248,   239,
+      77,   142,   248,   151,   248,   248,   246,   248,   244,   248,
+       1,   248,   235,   248,   248,     6,     7,     8,   166,    10,
+      11,   173,   174,   246,   248,    16,   854,   855,   856,   857,
+     858,   859,   860,   185,   111,    26,    27,    28,   248,   248,
+     248,   248,   248,   248,   185,    36,   248,   248,    39,    40,
+      41,   128,   248,   194,   243,   243,   212,    48,   245,   235,
+     213,   244,   213,   204,   244,   244,   244,   244,   216,   244,
+     218,   219,   245,   245,   248,   245,    67,    68,    69,    70,
+     248,   248,   248,   235,   248,   248,   242,   248,   248,   241,
+      81,   248,   247,    84,    85,   245,   243,   213,   246,     4,
+     213,    92,   248,   248,   248,   248,   248,    98,    99,   248,
+     101,   248,   103,   248,   248,   106,   107,   248,    23,    24,
+       1,   248,     3,     1,     5,   248,   117,   248,   205,   248,
+      35,   122,   123,   248,   125,   126,   127,   248,   248,   130,
+      21,   218,  1277,   248,   221,   144,   145,   146,   147,   148,
+     149,   150,   248,    31,   248,   248,    34,     1,   235,   248,
+     248,   248,   239,    44,   155,   248,   244,   158,   159,   160,
+     161,   162,   163,   164,    79,    80,   244,    82,   213,   244,
+     244,   244,   213,    64,   244,    66,   213,    65,   244,   244,
+     244,   244,   244,   244,    38,   244,    77,   244,   213,   213,
+      78,   213,   248,   108,   248,    49,    50,    51,    89,   213,
+     213,   116,    56,    57,   244,   213,   213,    61,    62,    63,
+     213,   213,   100,   214,   215,   213,   104,   213,   213,   245,
+     111,   244,   137,   111,   139,   140,   114,   115,   229,   230,
+     245,   248,   248,   213,   245,   244,   248,   238,   248,   240,
+     213,   132,   157,   248,   248,   138,   280,   213,   248,   248,
+     243,   248,   231,   243,   248,   143,   248,   248,   245,   174,
+     151,   245,   248,   248,   179,     0,     1,   245,   183,     4,
+     245,   248,   248,   188,   248,   166,   248,   248,   193,   248,
+     248,   248,   197,    18,   248,    82,    21,   248,   248,    24,
+     243,   206,   243,   208,   209,   213,   211,   213,    33,   213,
+     245,   244,   243,   213,   243,    82,   244,   244,   243,   243,
+     243,    46,    12,   243,   243,   243,   243,   243,   233,    54,
+      55,   244,   243,   213,   244,   216,   241,   218,   219,   217,
+     243,   219,   220,   245,   222,   223,   224,   225,   226,   227,
+     228,    76,   243,   140,   248,    80,   245,    47,    12,   213,
+     245,   245,   248,   245,   243,    90,    56,   213,    58,    59,
+     245,   248,   248,   140,   248,   248,   248,   245,   165,   245,
+     245,   245,   245,   245,   109,   110,   245,   174,   245,    12,
+     245,   243,   245,    47,   245,   245,   183,   245,   165,   124,
+     245,   244,    56,   245,    58,    59,   245,   174,   245,   245,
+     244,   244,   244,   248,   244,   140,   183,   244,   244,   206,
+     244,   208,   209,   244,    47,   244,   243,   245,   153,   154,
+     243,   243,   243,    56,   248,   243,   243,   140,   244,   206,
+     243,   208,   209,   243,   243,   170,   233,   243,   245,   243,
+     243,   213,   243,   245,   241,   245,   245,   243,   213,   184,
+     245,   245,   245,   245,   245,   190,   233,   245,   245,   245,
+     195,   245,   245,   198,   241,   245,   245,   167,   168,   245,
+     245,   245,   172,   173,   245,   175,   176,   245,   178,   245,
+     180,   245,   245,   183,   245,   245,   186,   187,   245,   245,
+     245,   245,   192,   245,   245,   245,   196,   245,   245,   245,
+     200,   201,   202,   167,   168,   245,     1,   245,   172,   173,
+     210,   175,   176,   245,   178,   245,   180,   245,   245,   183,
+     245,   245,   186,   187,    19,    20,   245,   245,   192,   245,
+      25,   245,   196,   245,   167,   168,   200,   201,   202,   172,
+     173,   245,   175,   176,   245,   178,   210,   180,   243,   248,
+     183,   243,   243,   186,   187,   244,   243,    52,    53,   192,
+       1,   243,   245,   196,   243,   243,   243,   200,   201,   202,
+     245,   243,   248,   244,   248,   245,   245,   210,   245,   245,
+     243,   243,    77,   243,   243,   243,   243,   248,    29,    30,
+     213,   243,   243,   248,   243,   245,    37,   243,   243,   243,
+      95,    96,    43,   245,   245,   245,   245,   102,   245,   245,
+     105,   245,   250,   245,   245,   245,   111,   245,   245,   245,
+     245,   245,   243,   245,   119,   120,   121,   245,   245,   245,
+      71,    72,    73,    74,   245,   245,   131,   245,   245,   245,
+     245,   245,   245,   245,   245,    86,    87,    88,   245,   245,
+     245,   243,    93,    94,    95,   243,    97,   152,   243,   245,
+     243,   245,   243,   250,   243,   245,   248,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   191,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   138,   245,   245,   245,   249,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   140,   138,   245,   248,   248,   245,   245,   245,   245,
+     245,   244,   138,   245,   231,    77,   250,   245,   245,   250,
+     250,   250,   248,   245,   245,  1089,   523,  1363,  1324,   610,
+     538,  1322,  1311,  1300,   358,   510,  1196,   487,  1309,   554,
+    1333,   596,  1326,   623,   393,  1305,   120,   500,   305,   174,
+     423,    98,  1161,   248,   413,  1163,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     297
+      -1,    -1,   313
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,   239,     0,     1,     4,    17,    20,    23,    32,    45,
-      51,    52,    70,    74,    84,   103,   104,   118,   134,   146,
-     147,   163,   176,   181,   186,   189,   240,   245,   250,   269,
-     275,   281,   289,   303,   323,   345,   359,   374,   381,   385,
-     395,   404,   426,   432,   438,   442,   448,   502,   520,   232,
-     233,   234,   234,   324,   405,   433,   234,   443,   234,   360,
-     427,   346,   234,   276,   304,   375,   234,   234,   396,   234,
-     282,   234,   386,     1,    33,    41,   105,   270,   271,   272,
-     273,   274,     1,    28,    29,    36,    42,    65,    66,    67,
-      68,    80,    81,    82,    87,    88,    89,    91,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   234,   234,   234,     1,    69,
-     439,   440,   441,   234,     1,     6,     7,     9,    10,    15,
-      25,    26,    27,    35,    38,    39,    40,    47,    64,    75,
-      78,    79,    86,    92,    93,    95,    97,   100,   101,   111,
-     116,   117,   119,   120,   121,   124,   148,   151,   152,   153,
-     154,   155,   156,   157,   205,   206,   216,   217,   225,   227,
-     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
-     459,   460,   461,   462,   463,   464,   465,   466,   467,   468,
-     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
-     479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
-     489,   490,   494,   498,   499,   500,   501,   234,   234,   234,
-       1,   102,   123,   246,   247,   248,   249,   234,   234,   234,
-       1,    37,    48,    49,    50,    53,    54,    58,    59,    60,
-     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,     1,    30,    33,    62,    72,    94,    98,   105,   108,
-     109,   136,   208,   210,   211,   213,   214,   215,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   234,     1,   221,   290,
-     291,   292,   293,   294,   234,     1,   105,   382,   383,   384,
-     234,   232,   235,   235,   235,   233,   271,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-     235,   235,   233,   504,     1,    18,    19,    24,    71,    89,
-      90,    96,    99,   105,   113,   114,   115,   125,   145,   182,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,     1,     3,     5,
-      20,    43,    61,    63,    71,    83,   105,   126,   144,   159,
-     207,   209,   210,   406,   407,   408,   409,   410,   411,   412,
-     413,   414,   415,   416,   417,   421,   422,   423,   424,   425,
-       1,    69,   128,   434,   435,   436,   437,   235,   233,   440,
-       1,   105,   128,   444,   445,   446,   447,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-     235,   235,   495,   491,   235,   235,   235,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-     235,   235,   233,   450,     1,    20,    43,    71,   122,   129,
-     130,   149,   222,   361,   362,   363,   364,   365,   366,   367,
-     371,   372,   373,     1,   128,   222,   428,   429,   430,   431,
-       1,    61,    69,    71,   126,   347,   351,   352,   353,   357,
-     358,   232,   235,   235,   233,   247,     1,    85,   169,   277,
-     278,   279,   280,     1,    20,    43,    71,   105,   122,   196,
-     209,   212,   222,   226,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   314,   315,   319,     1,    45,    85,   128,
-     376,   377,   378,   379,   380,   235,   235,   235,   235,   235,
-     235,   235,   235,   235,   233,   522,   232,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
-     235,   235,   235,   233,   252,     1,   105,   219,   397,   398,
-     399,   400,   232,   235,   233,   291,   169,     1,   105,   162,
-     180,   194,   283,   284,   285,   286,   287,   288,   235,   233,
-     383,     1,   105,   219,   222,   387,   388,   389,   390,   391,
-     230,   230,   230,   232,   231,   231,   242,   204,   204,   231,
-     242,   242,   242,   231,   242,   242,   231,   231,   231,   231,
-     232,   232,   235,   235,   235,   342,   235,   235,   235,   235,
-     235,   235,   235,   235,   235,   235,   235,   233,   326,   232,
-     235,   235,   235,   235,   235,   235,   418,   235,   235,   235,
-     235,   235,   235,   235,   235,   233,   407,   235,   235,   233,
-     435,   230,   232,   235,   235,   233,   445,   204,   242,   231,
-     242,   242,   204,   231,   242,   204,   231,   231,   231,   204,
-     204,   242,   231,   231,   231,   231,   231,   242,   231,   231,
-     231,   204,   235,   235,   204,   242,   242,   204,   204,   204,
-     204,   204,   204,   204,   204,   204,   231,   242,   242,   242,
-     204,   231,   232,   232,   235,   235,   368,   235,   235,   235,
-     235,   235,   233,   362,   235,   235,   233,   429,   232,   235,
-     235,   348,   235,   233,   352,   230,   230,   232,   232,   235,
-     235,   233,   278,   232,   235,   235,   320,   235,   235,   316,
-     235,   235,   235,   235,   233,   306,   232,   235,   235,   235,
-     233,   377,   204,   204,   242,   230,   204,   230,   204,   204,
-     204,   232,   231,   230,   204,   230,   231,   231,   230,   230,
-     230,   230,   230,   230,   230,   230,   230,   230,   232,   232,
-     235,   401,   233,   398,   204,   232,   234,   232,   235,   235,
-     235,   235,   233,   284,   230,   232,   232,   235,   392,   235,
-     233,   388,   232,   232,   232,   232,   137,   138,   139,   140,
-     141,   142,   143,   241,   242,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   231,
-     231,   242,   235,   231,   242,   231,   242,   230,   231,   231,
-     231,   242,   231,   244,   244,   232,   230,   173,   174,   230,
-     204,   230,   230,   235,   230,   230,   231,   230,   230,   242,
-     230,   230,   232,   230,   230,   232,   232,   230,   230,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,    11,    46,    53,   160,   161,
-     164,   165,   167,   168,   170,   172,   175,   177,   178,   183,
-     187,   191,   192,   193,   201,   496,   497,    11,    46,    53,
-      55,    56,   160,   161,   164,   165,   167,   168,   170,   172,
-     175,   177,   178,   183,   187,   191,   192,   193,   201,   492,
-     493,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   230,
-     204,   235,   230,   231,   230,   230,   230,   232,   230,   230,
-     232,   230,   230,   235,   231,   355,   356,   232,   232,   232,
-     230,   230,   232,   230,   204,   235,   230,   230,   235,   230,
-     204,   230,   230,   232,   230,   230,   230,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,   230,   235,   232,   232,     1,   105,   190,
-     219,   295,   296,   297,   298,   299,   230,   230,   230,   230,
-     232,   232,   230,   235,   230,   232,   241,   241,   241,   241,
-     241,   241,   241,   232,   232,   232,    57,   127,   343,   344,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,    12,
-      13,    14,   243,   244,   232,   232,   232,   232,   232,   232,
-     232,   232,   232,     8,   195,   419,   420,   232,   232,   232,
-     232,   232,   232,   232,   232,   232,   232,   232,   232,   232,
-     236,   232,   236,   232,   232,    16,    44,    77,   106,   107,
-     112,   135,   203,   229,   369,   370,   232,   232,   232,   232,
-     232,   232,   232,   232,   232,    21,    31,    53,   185,   195,
-     349,   350,   218,   236,   354,   232,   232,   232,   232,     4,
-      22,    23,    34,    73,    74,    76,   102,   110,   131,   133,
-     134,   150,   166,   171,   175,   179,   184,   188,   197,   199,
-     200,   202,   220,   228,   321,   322,   232,   232,    11,    46,
-      53,    55,    56,   160,   161,   164,   165,   167,   168,   170,
-     172,   175,   177,   178,   183,   187,   191,   192,   193,   201,
-     317,   318,   232,   232,   232,   232,   232,   232,   232,   232,
-      76,   134,   158,   166,   175,   197,   199,   200,   220,   228,
-     402,   403,   232,   235,   235,   300,   233,   296,   232,   232,
-     232,   232,   232,    76,   134,   158,   166,   175,   197,   199,
-     200,   220,   228,   393,   394,   232,   232,   236,   243,   243,
-     243,   232,   236,   497,   493,   232,   236,   232,   236,   231,
-     356,   232,   237,   237,   237,   237,   237,   237,   232,   236,
-     232,   236,   232,   236,   230,   198,   244,   235,   232,   232,
-     236,   344,   420,   370,   350,   132,   134,   132,   134,   132,
-     132,   322,   318,   403,   232,   232,   232,    74,    76,   118,
-     134,   165,   166,   222,   228,   301,   302,   394,   232,   236,
-     302
+       0,   252,     0,     1,     4,    18,    21,    24,    33,    46,
+      54,    55,    76,    80,    90,   109,   110,   124,   140,   153,
+     154,   170,   184,   190,   195,   198,   253,   258,   263,   286,
+     292,   298,   306,   320,   340,   364,   378,   393,   400,   404,
+     414,   423,   445,   451,   457,   461,   467,   525,   543,   245,
+     246,   247,   247,   341,   424,   452,   247,   462,   247,   379,
+     446,   365,   247,   293,   321,   394,   247,   247,   415,   247,
+     299,   247,   405,     1,    34,    42,   111,   287,   288,   289,
+     290,   291,     1,    29,    30,    37,    43,    71,    72,    73,
+      74,    86,    87,    88,    93,    94,    95,    97,   526,   527,
+     528,   529,   530,   531,   532,   533,   534,   535,   536,   537,
+     538,   539,   540,   541,   542,   247,   247,   247,     1,    75,
+     458,   459,   460,   247,     1,     6,     7,     8,    10,    11,
+      16,    26,    27,    28,    36,    39,    40,    41,    48,    67,
+      68,    69,    70,    81,    84,    85,    92,    98,    99,   101,
+     103,   106,   107,   117,   122,   123,   125,   126,   127,   130,
+     155,   158,   159,   160,   161,   162,   163,   164,   214,   215,
+     229,   230,   238,   240,   468,   469,   470,   471,   472,   473,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
+     484,   485,   486,   487,   488,   489,   490,   491,   492,   493,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,   503,
+     504,   505,   506,   507,   508,   509,   510,   511,   512,   513,
+     517,   521,   522,   523,   524,   247,   247,   247,     1,   108,
+     129,   259,   260,   261,   262,   247,   247,   247,     1,    38,
+      49,    50,    51,    56,    57,    61,    62,    63,   544,   545,
+     546,   547,   548,   549,   550,   551,   552,   553,   554,     1,
+      31,    34,    65,    78,   100,   104,   111,   114,   115,   143,
+     217,   219,   220,   222,   223,   224,   225,   226,   227,   228,
+     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   247,     1,   234,   307,   308,   309,   310,   311,
+     247,     1,   111,   401,   402,   403,   247,   245,   248,   248,
+     248,   246,   288,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   246,   527,
+       1,    19,    20,    25,    52,    53,    77,    95,    96,   102,
+     105,   111,   119,   120,   121,   131,   152,   191,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,   358,   359,   360,     1,     3,     5,
+      21,    44,    64,    66,    77,    89,   111,   132,   151,   166,
+     216,   218,   219,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,   435,   436,   440,   441,   442,   443,   444,
+       1,    75,   134,   453,   454,   455,   456,   248,   246,   459,
+       1,   111,   134,   463,   464,   465,   466,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   518,   514,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   246,   469,     1,    21,
+      44,    77,   128,   135,   136,   156,   235,   380,   381,   382,
+     383,   384,   385,   386,   390,   391,   392,     1,   134,   235,
+     447,   448,   449,   450,     1,    64,    75,    77,   132,   366,
+     370,   371,   372,   376,   377,   245,   248,   248,   246,   260,
+       1,    91,   177,   294,   295,   296,   297,     1,    21,    44,
+      77,   111,   128,   205,   218,   221,   235,   239,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   336,
+       1,    46,    91,   134,   395,   396,   397,   398,   399,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   246,   545,
+     245,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   246,   265,     1,   111,   232,   416,   417,   418,   419,
+     245,   248,   246,   308,   177,     1,   111,   169,   189,   203,
+     300,   301,   302,   303,   304,   305,   248,   246,   402,     1,
+     111,   232,   235,   406,   407,   408,   409,   410,   243,   243,
+     243,   245,   244,   244,   255,   213,   213,   244,   255,   255,
+     255,   244,   255,   255,   244,   244,   244,   244,   245,   245,
+     248,   248,   248,   248,   248,   361,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   246,   343,   245,
+     248,   248,   248,   248,   248,   248,   437,   248,   248,   248,
+     248,   248,   248,   248,   248,   246,   426,   248,   248,   246,
+     454,   243,   245,   248,   248,   246,   464,   213,   255,   255,
+     244,   255,   255,   213,   244,   255,   213,   244,   244,   244,
+     213,   255,   244,   255,   213,   255,   244,   244,   244,   244,
+     244,   255,   244,   244,   244,   213,   248,   248,   213,   255,
+     255,   213,   213,   213,   213,   213,   213,   213,   213,   213,
+     244,   255,   255,   255,   213,   244,   245,   245,   248,   248,
+     387,   248,   248,   248,   248,   248,   246,   381,   248,   248,
+     246,   448,   245,   248,   248,   367,   248,   246,   371,   243,
+     243,   245,   245,   248,   248,   246,   295,   245,   248,   248,
+     337,   248,   248,   333,   248,   248,   248,   248,   246,   323,
+     245,   248,   248,   248,   246,   396,   213,   213,   255,   243,
+     213,   243,   213,   213,   213,   245,   244,   243,   213,   243,
+     244,   244,   243,   243,   243,   243,   243,   243,   243,   243,
+     244,   213,   243,   244,   243,   243,   245,   245,   248,   420,
+     246,   417,   213,   245,   247,   245,   248,   248,   248,   248,
+     246,   301,   243,   245,   245,   248,   411,   248,   246,   407,
+     245,   245,   245,   245,   144,   145,   146,   147,   148,   149,
+     150,   254,   255,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   244,   244,   255,
+     244,   244,   248,   244,   255,   244,   255,   243,   244,   244,
+     244,   255,   244,   257,   257,   245,   243,   181,   182,   243,
+     213,   243,   243,   248,   243,   243,   244,   243,   243,   255,
+     243,   243,   245,   243,   243,   245,   245,   243,   243,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,    12,
+      47,    56,   167,   168,   172,   173,   175,   176,   178,   180,
+     183,   186,   187,   192,   196,   200,   201,   202,   210,   519,
+     520,    12,    47,    56,    58,    59,   167,   168,   172,   173,
+     175,   176,   178,   180,   183,   186,   187,   192,   196,   200,
+     201,   202,   210,   515,   516,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   243,   213,   248,   243,   244,   243,   243,
+     243,   245,   243,   243,   245,   243,   243,   248,   244,   374,
+     375,   245,   245,   245,   243,   243,   245,   243,   213,   248,
+     243,   243,   248,   243,   213,   243,   243,   245,   243,   243,
+     243,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   243,   248,   245,   245,     1,   111,   199,   232,   312,
+     313,   314,   315,   316,   243,   243,   243,   243,   245,   245,
+     243,   248,   243,   245,   254,   254,   254,   254,   254,   254,
+     254,   245,   245,   245,   245,   245,    60,   133,   362,   363,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,    13,
+      14,    15,   256,   257,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,     9,   171,   204,   438,   439,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   249,   245,   249,   245,   245,    17,    45,    83,   112,
+     113,   118,   141,   212,   242,   388,   389,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,    22,    32,    56,   142,
+     185,   194,   204,   368,   369,   231,   249,   373,   245,   245,
+     245,   245,     4,    23,    24,    35,    79,    80,    82,   108,
+     116,   137,   139,   140,   157,   174,   179,   183,   188,   193,
+     197,   206,   208,   209,   211,   233,   241,   338,   339,   245,
+     245,    12,    47,    56,    58,    59,   167,   168,   172,   173,
+     175,   176,   178,   180,   183,   186,   187,   192,   196,   200,
+     201,   202,   210,   334,   335,   245,   245,   245,   245,   245,
+     245,   245,   245,    82,   140,   165,   174,   183,   206,   208,
+     209,   233,   241,   421,   422,   245,   248,   248,   317,   246,
+     313,   245,   245,   245,   245,   245,    82,   140,   165,   174,
+     183,   206,   208,   209,   233,   241,   412,   413,   245,   245,
+     249,   256,   256,   256,   245,   249,   520,   516,   245,   249,
+     245,   249,   244,   375,   245,   250,   250,   250,   250,   250,
+     250,   245,   249,   245,   249,   245,   249,   243,   207,   257,
+     248,   245,   245,   249,   363,   439,   389,   369,   138,   140,
+     138,   140,   138,   138,   339,   335,   422,   245,   245,   245,
+      80,    82,   124,   140,   173,   174,   185,   235,   241,   318,
+     319,   413,   245,   249,   319
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   238,   239,   239,   240,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   240,   240,   240,   240,   241,   241,
-     242,   242,   242,   242,   242,   242,   242,   242,   243,   243,
-     244,   244,   244,   244,   245,   246,   246,   247,   247,   247,
-     248,   249,   250,   251,   251,   252,   252,   252,   252,   252,
-     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
-     252,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     270,   271,   271,   271,   271,   272,   273,   274,   276,   275,
-     277,   277,   278,   278,   278,   279,   280,   282,   281,   283,
-     283,   284,   284,   284,   284,   284,   285,   286,   287,   288,
-     289,   290,   290,   291,   291,   291,   292,   294,   293,   295,
-     295,   296,   296,   296,   296,   297,   298,   298,   300,   299,
-     301,   301,   302,   302,   302,   302,   302,   302,   302,   302,
-     304,   303,   305,   305,   306,   306,   306,   306,   306,   306,
-     306,   306,   306,   306,   306,   307,   308,   309,   310,   311,
-     312,   313,   314,   316,   315,   317,   317,   318,   318,   318,
-     318,   318,   318,   318,   318,   318,   318,   318,   318,   318,
-     318,   318,   318,   318,   318,   318,   318,   318,   318,   320,
-     319,   321,   321,   322,   322,   322,   322,   322,   322,   322,
-     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
-     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
-     322,   322,   324,   323,   325,   325,   326,   326,   326,   326,
-     326,   326,   326,   326,   326,   326,   326,   326,   326,   326,
-     326,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   342,   341,   343,   343,
-     344,   344,   346,   345,   348,   347,   349,   349,   350,   350,
-     350,   350,   350,   351,   351,   352,   352,   352,   352,   352,
-     354,   353,   355,   355,   356,   356,   357,   358,   360,   359,
-     361,   361,   362,   362,   362,   362,   362,   362,   362,   362,
-     362,   363,   364,   365,   366,   368,   367,   369,   369,   370,
-     370,   370,   370,   370,   370,   370,   370,   370,   371,   372,
-     373,   375,   374,   376,   376,   377,   377,   377,   377,   378,
-     379,   380,   381,   382,   382,   383,   383,   384,   386,   385,
-     387,   387,   388,   388,   388,   388,   389,   390,   392,   391,
-     393,   393,   394,   394,   394,   394,   394,   394,   394,   394,
-     394,   394,   396,   395,   397,   397,   398,   398,   398,   399,
-     401,   400,   402,   402,   403,   403,   403,   403,   403,   403,
-     403,   403,   403,   403,   405,   404,   406,   406,   407,   407,
-     407,   407,   407,   407,   407,   407,   407,   407,   407,   407,
-     407,   407,   407,   407,   408,   409,   410,   411,   412,   413,
-     414,   415,   416,   416,   418,   417,   419,   419,   420,   420,
-     421,   422,   423,   424,   425,   427,   426,   428,   428,   429,
-     429,   429,   430,   431,   433,   432,   434,   434,   435,   435,
-     435,   436,   437,   438,   439,   439,   440,   440,   441,   443,
-     442,   444,   444,   445,   445,   445,   446,   447,   448,   449,
-     449,   450,   450,   450,   450,   450,   450,   450,   450,   450,
-     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
-     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
-     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
-     450,   450,   450,   450,   450,   450,   450,   451,   452,   453,
-     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
-     464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
-     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
-     484,   485,   486,   487,   488,   489,   491,   490,   492,   492,
-     493,   493,   493,   493,   493,   493,   493,   493,   493,   493,
-     493,   493,   493,   493,   493,   493,   493,   493,   493,   493,
-     493,   493,   495,   494,   496,   496,   497,   497,   497,   497,
-     497,   497,   497,   497,   497,   497,   497,   497,   497,   497,
-     497,   497,   497,   497,   497,   497,   498,   499,   500,   501,
-     502,   503,   503,   504,   504,   504,   504,   504,   504,   504,
-     504,   504,   504,   504,   504,   504,   504,   504,   504,   505,
-     506,   507,   508,   509,   510,   511,   512,   513,   514,   515,
-     516,   517,   518,   519,   520,   521,   521,   522,   522,   522,
-     522,   522,   522,   522,   522,   522,   522,   523,   524,   525,
-     526,   527,   528,   529,   530,   531
+       0,   251,   252,   252,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   254,   254,
+     255,   255,   255,   255,   255,   255,   255,   255,   256,   256,
+     257,   257,   257,   257,   258,   259,   259,   260,   260,   260,
+     261,   262,   263,   264,   264,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   287,   288,
+     288,   288,   288,   289,   290,   291,   293,   292,   294,   294,
+     295,   295,   295,   296,   297,   299,   298,   300,   300,   301,
+     301,   301,   301,   301,   302,   303,   304,   305,   306,   307,
+     307,   308,   308,   308,   309,   311,   310,   312,   312,   313,
+     313,   313,   313,   314,   315,   315,   317,   316,   318,   318,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   321,
+     320,   322,   322,   323,   323,   323,   323,   323,   323,   323,
+     323,   323,   323,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   333,   332,   334,   334,   335,   335,   335,   335,
+     335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
+     335,   335,   335,   335,   335,   335,   335,   335,   337,   336,
+     338,   338,   339,   339,   339,   339,   339,   339,   339,   339,
+     339,   339,   339,   339,   339,   339,   339,   339,   339,   339,
+     339,   339,   339,   339,   339,   339,   339,   339,   339,   339,
+     339,   341,   340,   342,   342,   343,   343,   343,   343,   343,
+     343,   343,   343,   343,   343,   343,   343,   343,   343,   343,
+     343,   343,   343,   344,   345,   346,   347,   348,   349,   350,
+     351,   352,   353,   354,   355,   356,   357,   358,   359,   361,
+     360,   362,   362,   363,   363,   365,   364,   367,   366,   368,
+     368,   369,   369,   369,   369,   369,   369,   369,   370,   370,
+     371,   371,   371,   371,   371,   373,   372,   374,   374,   375,
+     375,   376,   377,   379,   378,   380,   380,   381,   381,   381,
+     381,   381,   381,   381,   381,   381,   382,   383,   384,   385,
+     387,   386,   388,   388,   389,   389,   389,   389,   389,   389,
+     389,   389,   389,   390,   391,   392,   394,   393,   395,   395,
+     396,   396,   396,   396,   397,   398,   399,   400,   401,   401,
+     402,   402,   403,   405,   404,   406,   406,   407,   407,   407,
+     407,   408,   409,   411,   410,   412,   412,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   415,   414,   416,
+     416,   417,   417,   417,   418,   420,   419,   421,   421,   422,
+     422,   422,   422,   422,   422,   422,   422,   422,   422,   424,
+     423,   425,   425,   426,   426,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,   426,   426,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,   435,   435,   437,
+     436,   438,   438,   439,   439,   439,   440,   441,   442,   443,
+     444,   446,   445,   447,   447,   448,   448,   448,   449,   450,
+     452,   451,   453,   453,   454,   454,   454,   455,   456,   457,
+     458,   458,   459,   459,   460,   462,   461,   463,   463,   464,
+     464,   464,   465,   466,   467,   468,   468,   469,   469,   469,
+     469,   469,   469,   469,   469,   469,   469,   469,   469,   469,
+     469,   469,   469,   469,   469,   469,   469,   469,   469,   469,
+     469,   469,   469,   469,   469,   469,   469,   469,   469,   469,
+     469,   469,   469,   469,   469,   469,   469,   469,   469,   469,
+     469,   469,   469,   469,   469,   469,   469,   470,   471,   472,
+     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
+     483,   484,   485,   486,   487,   488,   489,   490,   491,   492,
+     493,   494,   495,   496,   497,   498,   499,   500,   501,   502,
+     503,   504,   505,   506,   507,   508,   509,   510,   511,   512,
+     514,   513,   515,   515,   516,   516,   516,   516,   516,   516,
+     516,   516,   516,   516,   516,   516,   516,   516,   516,   516,
+     516,   516,   516,   516,   516,   516,   518,   517,   519,   519,
+     520,   520,   520,   520,   520,   520,   520,   520,   520,   520,
+     520,   520,   520,   520,   520,   520,   520,   520,   520,   520,
+     521,   522,   523,   524,   525,   526,   526,   527,   527,   527,
+     527,   527,   527,   527,   527,   527,   527,   527,   527,   527,
+     527,   527,   527,   528,   529,   530,   531,   532,   533,   534,
+     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
+     544,   545,   545,   545,   545,   545,   545,   545,   545,   545,
+     545,   546,   547,   548,   549,   550,   551,   552,   553,   554
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     1,     1,     1,     1,     1,     1,
@@ -2180,46 +2815,48 @@ static const yytype_int8 yyr2[] =
        2,     3,     3,     3,     5,     2,     1,     1,     1,     2,
        4,     4,     5,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     5,     2,
-       1,     1,     1,     1,     2,     4,     4,     4,     0,     6,
-       2,     1,     1,     1,     2,     4,     4,     0,     6,     2,
        1,     1,     1,     1,     1,     2,     4,     4,     4,     4,
-       5,     2,     1,     1,     1,     2,     4,     0,     6,     2,
-       1,     1,     1,     1,     2,     4,     4,     4,     0,     5,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     6,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     4,     4,     4,     4,     4,
-       4,     4,     4,     0,     5,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     5,     2,     1,     1,
+       1,     1,     2,     4,     4,     4,     0,     6,     2,     1,
+       1,     1,     2,     4,     4,     0,     6,     2,     1,     1,
+       1,     1,     1,     2,     4,     4,     4,     4,     5,     2,
+       1,     1,     1,     2,     4,     0,     6,     2,     1,     1,
+       1,     1,     2,     4,     4,     4,     0,     5,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       5,     3,     1,     3,     1,     3,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     3,     1,
-       1,     1,     0,     6,     2,     1,     1,     1,     1,     1,
+       6,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     4,     4,     4,     4,     4,     4,
+       4,     4,     0,     5,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     0,     5,     3,     1,
-       1,     1,     0,     6,     0,     5,     3,     1,     1,     1,
-       1,     1,     1,     2,     1,     1,     1,     1,     1,     2,
-       0,     5,     3,     1,     1,     3,     4,     4,     0,     6,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       2,     4,     4,     4,     4,     0,     5,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
-       4,     0,     6,     2,     1,     1,     1,     1,     2,     4,
-       4,     4,     5,     2,     1,     1,     1,     4,     0,     6,
-       2,     1,     1,     1,     1,     2,     4,     4,     0,     5,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     6,     2,     1,     1,     1,     2,     4,
-       0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     5,
+       3,     1,     3,     1,     3,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     3,     1,     1,
+       1,     0,     6,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     0,     5,     3,     1,     1,     1,
-       4,     4,     4,     4,     4,     0,     6,     2,     1,     1,
-       1,     1,     4,     4,     0,     6,     2,     1,     1,     1,
-       1,     4,     4,     5,     2,     1,     1,     1,     4,     0,
-       6,     2,     1,     1,     1,     1,     4,     4,     5,     2,
+       1,     1,     2,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     0,
+       5,     3,     1,     1,     1,     0,     6,     0,     5,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     1,
+       1,     1,     1,     1,     2,     0,     5,     3,     1,     1,
+       3,     4,     4,     0,     6,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     4,     4,     4,     4,
+       0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     4,     4,     4,     0,     6,     2,     1,
+       1,     1,     1,     2,     4,     4,     4,     5,     2,     1,
+       1,     1,     4,     0,     6,     2,     1,     1,     1,     1,
+       2,     4,     4,     0,     5,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     6,     2,
+       1,     1,     1,     2,     4,     0,     5,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       6,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     0,
+       5,     3,     1,     1,     1,     1,     4,     4,     4,     4,
+       4,     0,     6,     2,     1,     1,     1,     1,     4,     4,
+       0,     6,     2,     1,     1,     1,     1,     4,     4,     5,
+       2,     1,     1,     1,     4,     0,     6,     2,     1,     1,
+       1,     1,     4,     4,     5,     2,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -2228,29 +2865,30 @@ static const yytype_int8 yyr2[] =
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     0,     5,     3,     1,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       0,     5,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     5,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     5,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     4,     4,     4,     4,
-       5,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     5,     2,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     4,     4,     4,
-       4,     4,     4,     4,     4,     4
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     5,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     4,     4,     4,     4,     4,     4,     4,     4,     4
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -2272,10 +2910,9 @@ static const yytype_int8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -2292,19 +2929,16 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -2315,18 +2949,15 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -2336,12 +2967,13 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
   YYFPRINTF (yyo, ")");
 }
 
@@ -2374,7 +3006,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -2386,9 +3019,8 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2403,8 +3035,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -2427,259 +3059,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
 
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
-{
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2688,6 +3091,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2695,43 +3100,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
-
-    YYPTRDIFF_T yystacksize;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2739,16 +3137,10 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -2770,10 +3162,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -2801,7 +3194,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -2812,10 +3205,10 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -2834,6 +3227,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -2854,18 +3248,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2934,110 +3339,110 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 28:
-#line 397 "conf_parser.y"
+  case 28: /* timespec_: %empty  */
+#line 412 "conf_parser.y"
            { (yyval.number) = 0; }
-#line 2941 "conf_parser.c"
+#line 3346 "conf_parser.c"
     break;
 
-  case 30:
-#line 398 "conf_parser.y"
+  case 30: /* timespec: NUMBER timespec_  */
+#line 413 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 2947 "conf_parser.c"
+#line 3352 "conf_parser.c"
     break;
 
-  case 31:
-#line 399 "conf_parser.y"
+  case 31: /* timespec: NUMBER SECONDS timespec_  */
+#line 414 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 2953 "conf_parser.c"
+#line 3358 "conf_parser.c"
     break;
 
-  case 32:
-#line 400 "conf_parser.y"
+  case 32: /* timespec: NUMBER MINUTES timespec_  */
+#line 415 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
-#line 2959 "conf_parser.c"
+#line 3364 "conf_parser.c"
     break;
 
-  case 33:
-#line 401 "conf_parser.y"
+  case 33: /* timespec: NUMBER HOURS timespec_  */
+#line 416 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
-#line 2965 "conf_parser.c"
+#line 3370 "conf_parser.c"
     break;
 
-  case 34:
-#line 402 "conf_parser.y"
+  case 34: /* timespec: NUMBER DAYS timespec_  */
+#line 417 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
-#line 2971 "conf_parser.c"
+#line 3376 "conf_parser.c"
     break;
 
-  case 35:
-#line 403 "conf_parser.y"
+  case 35: /* timespec: NUMBER WEEKS timespec_  */
+#line 418 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
-#line 2977 "conf_parser.c"
+#line 3382 "conf_parser.c"
     break;
 
-  case 36:
-#line 404 "conf_parser.y"
+  case 36: /* timespec: NUMBER MONTHS timespec_  */
+#line 419 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
-#line 2983 "conf_parser.c"
+#line 3388 "conf_parser.c"
     break;
 
-  case 37:
-#line 405 "conf_parser.y"
+  case 37: /* timespec: NUMBER YEARS timespec_  */
+#line 420 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
-#line 2989 "conf_parser.c"
+#line 3394 "conf_parser.c"
     break;
 
-  case 38:
-#line 408 "conf_parser.y"
+  case 38: /* sizespec_: %empty  */
+#line 423 "conf_parser.y"
             { (yyval.number) = 0; }
-#line 2995 "conf_parser.c"
+#line 3400 "conf_parser.c"
     break;
 
-  case 40:
-#line 409 "conf_parser.y"
+  case 40: /* sizespec: NUMBER sizespec_  */
+#line 424 "conf_parser.y"
                              { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 3001 "conf_parser.c"
+#line 3406 "conf_parser.c"
     break;
 
-  case 41:
-#line 410 "conf_parser.y"
+  case 41: /* sizespec: NUMBER BYTES sizespec_  */
+#line 425 "conf_parser.y"
                                    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 3007 "conf_parser.c"
+#line 3412 "conf_parser.c"
     break;
 
-  case 42:
-#line 411 "conf_parser.y"
+  case 42: /* sizespec: NUMBER KBYTES sizespec_  */
+#line 426 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
-#line 3013 "conf_parser.c"
+#line 3418 "conf_parser.c"
     break;
 
-  case 43:
-#line 412 "conf_parser.y"
+  case 43: /* sizespec: NUMBER MBYTES sizespec_  */
+#line 427 "conf_parser.y"
                                     { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
-#line 3019 "conf_parser.c"
+#line 3424 "conf_parser.c"
     break;
 
-  case 50:
-#line 425 "conf_parser.y"
+  case 50: /* modules_module: MODULE '=' QSTRING ';'  */
+#line 440 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     add_conf_module(libio_basename(yylval.string));
 }
-#line 3028 "conf_parser.c"
+#line 3433 "conf_parser.c"
     break;
 
-  case 51:
-#line 431 "conf_parser.y"
+  case 51: /* modules_path: PATH '=' QSTRING ';'  */
+#line 446 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     mod_add_path(yylval.string);
 }
-#line 3037 "conf_parser.c"
+#line 3442 "conf_parser.c"
     break;
 
-  case 72:
-#line 463 "conf_parser.y"
+  case 76: /* serverinfo_tls_certificate_file: TLS_CERTIFICATE_FILE '=' QSTRING ';'  */
+#line 482 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3045,11 +3450,11 @@ yyreduce:
     ConfigServerInfo.tls_certificate_file = xstrdup(yylval.string);
   }
 }
-#line 3049 "conf_parser.c"
+#line 3454 "conf_parser.c"
     break;
 
-  case 73:
-#line 472 "conf_parser.y"
+  case 77: /* serverinfo_rsa_private_key_file: RSA_PRIVATE_KEY_FILE '=' QSTRING ';'  */
+#line 491 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3057,11 +3462,11 @@ yyreduce:
     ConfigServerInfo.rsa_private_key_file = xstrdup(yylval.string);
   }
 }
-#line 3061 "conf_parser.c"
+#line 3466 "conf_parser.c"
     break;
 
-  case 74:
-#line 481 "conf_parser.y"
+  case 78: /* serverinfo_tls_dh_param_file: TLS_DH_PARAM_FILE '=' QSTRING ';'  */
+#line 500 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3069,11 +3474,11 @@ yyreduce:
     ConfigServerInfo.tls_dh_param_file = xstrdup(yylval.string);
   }
 }
-#line 3073 "conf_parser.c"
+#line 3478 "conf_parser.c"
     break;
 
-  case 75:
-#line 490 "conf_parser.y"
+  case 79: /* serverinfo_tls_cipher_list: TLS_CIPHER_LIST '=' QSTRING ';'  */
+#line 509 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3081,11 +3486,11 @@ yyreduce:
     ConfigServerInfo.tls_cipher_list = xstrdup(yylval.string);
   }
 }
-#line 3085 "conf_parser.c"
+#line 3490 "conf_parser.c"
     break;
 
-  case 76:
-#line 499 "conf_parser.y"
+  case 80: /* serverinfo_tls_cipher_suites: TLS_CIPHER_SUITES '=' QSTRING ';'  */
+#line 518 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3093,11 +3498,11 @@ yyreduce:
     ConfigServerInfo.tls_cipher_suites = xstrdup(yylval.string);
   }
 }
-#line 3097 "conf_parser.c"
+#line 3502 "conf_parser.c"
     break;
 
-  case 77:
-#line 508 "conf_parser.y"
+  case 81: /* serverinfo_tls_message_digest_algorithm: TLS_MESSAGE_DIGEST_ALGORITHM '=' QSTRING ';'  */
+#line 527 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3105,11 +3510,11 @@ yyreduce:
     ConfigServerInfo.tls_message_digest_algorithm = xstrdup(yylval.string);
   }
 }
-#line 3109 "conf_parser.c"
+#line 3514 "conf_parser.c"
     break;
 
-  case 78:
-#line 517 "conf_parser.y"
+  case 82: /* serverinfo_tls_supported_groups: TLS_SUPPORTED_GROUPS '=' QSTRING ';'  */
+#line 536 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3117,11 +3522,11 @@ yyreduce:
     ConfigServerInfo.tls_supported_groups = xstrdup(yylval.string);
   }
 }
-#line 3121 "conf_parser.c"
+#line 3526 "conf_parser.c"
     break;
 
-  case 79:
-#line 526 "conf_parser.y"
+  case 83: /* serverinfo_name: NAME '=' QSTRING ';'  */
+#line 545 "conf_parser.y"
 {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && ConfigServerInfo.name == NULL)
@@ -3135,11 +3540,11 @@ yyreduce:
     }
   }
 }
-#line 3139 "conf_parser.c"
+#line 3544 "conf_parser.c"
     break;
 
-  case 80:
-#line 541 "conf_parser.y"
+  case 84: /* serverinfo_sid: IRCD_SID '=' QSTRING ';'  */
+#line 560 "conf_parser.y"
 {
   /* This isn't rehashable */
   if (conf_parser_ctx.pass == 2 && ConfigServerInfo.sid == NULL)
@@ -3153,11 +3558,11 @@ yyreduce:
     }
   }
 }
-#line 3157 "conf_parser.c"
+#line 3562 "conf_parser.c"
     break;
 
-  case 81:
-#line 556 "conf_parser.y"
+  case 85: /* serverinfo_description: DESCRIPTION '=' QSTRING ';'  */
+#line 575 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3166,11 +3571,11 @@ yyreduce:
     strlcpy(me.info, ConfigServerInfo.description, sizeof(me.info));
   }
 }
-#line 3170 "conf_parser.c"
+#line 3575 "conf_parser.c"
     break;
 
-  case 82:
-#line 566 "conf_parser.y"
+  case 86: /* serverinfo_network_name: NETWORK_NAME '=' QSTRING ';'  */
+#line 585 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3183,11 +3588,11 @@ yyreduce:
     ConfigServerInfo.network_name = xstrdup(yylval.string);
   }
 }
-#line 3187 "conf_parser.c"
+#line 3592 "conf_parser.c"
     break;
 
-  case 83:
-#line 580 "conf_parser.y"
+  case 87: /* serverinfo_network_description: NETWORK_DESCRIPTION '=' QSTRING ';'  */
+#line 599 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3195,11 +3600,11 @@ yyreduce:
   xfree(ConfigServerInfo.network_description);
   ConfigServerInfo.network_description = xstrdup(yylval.string);
 }
-#line 3199 "conf_parser.c"
+#line 3604 "conf_parser.c"
     break;
 
-  case 84:
-#line 589 "conf_parser.y"
+  case 88: /* serverinfo_default_max_clients: DEFAULT_MAX_CLIENTS '=' NUMBER ';'  */
+#line 608 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3221,11 +3626,11 @@ yyreduce:
   else
     ConfigServerInfo.default_max_clients = (yyvsp[-1].number);
 }
-#line 3225 "conf_parser.c"
+#line 3630 "conf_parser.c"
     break;
 
-  case 85:
-#line 612 "conf_parser.y"
+  case 89: /* serverinfo_max_nick_length: MAX_NICK_LENGTH '=' NUMBER ';'  */
+#line 631 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3247,11 +3652,11 @@ yyreduce:
   else
     ConfigServerInfo.max_nick_length = (yyvsp[-1].number);
 }
-#line 3251 "conf_parser.c"
+#line 3656 "conf_parser.c"
     break;
 
-  case 86:
-#line 635 "conf_parser.y"
+  case 90: /* serverinfo_max_topic_length: MAX_TOPIC_LENGTH '=' NUMBER ';'  */
+#line 654 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3273,20 +3678,59 @@ yyreduce:
   else
     ConfigServerInfo.max_topic_length = (yyvsp[-1].number);
 }
-#line 3277 "conf_parser.c"
+#line 3682 "conf_parser.c"
     break;
 
-  case 87:
-#line 658 "conf_parser.y"
+  case 91: /* serverinfo_hub: HUB '=' TBOOL ';'  */
+#line 677 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerInfo.hub = yylval.number;
 }
-#line 3286 "conf_parser.c"
+#line 3691 "conf_parser.c"
+    break;
+
+  case 92: /* serverinfo_tls_handshake_threads: TLS_HANDSHAKE_THREADS '=' NUMBER ';'  */
+#line 683 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_handshake_threads = (yyvsp[-1].number);
+}
+#line 3700 "conf_parser.c"
+    break;
+
+  case 93: /* serverinfo_tls_kernel_offload: TLS_KERNEL_OFFLOAD '=' TBOOL ';'  */
+#line 689 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_kernel_offload = yylval.number;
+}
+#line 3709 "conf_parser.c"
     break;
 
-  case 95:
-#line 676 "conf_parser.y"
+  case 94: /* serverinfo_tls_session_cache_size: TLS_SESSION_CACHE_SIZE '=' NUMBER ';'  */
+#line 695 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_session_cache_size = (yyvsp[-1].number);
+}
+#line 3718 "conf_parser.c"
+    break;
+
+  case 95: /* serverinfo_tls_ticket_key_file: TLS_TICKET_KEY_FILE '=' QSTRING ';'  */
+#line 701 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigServerInfo.tls_ticket_key_file);
+    ConfigServerInfo.tls_ticket_key_file = xstrdup(yylval.string);
+  }
+}
+#line 3730 "conf_parser.c"
+    break;
+
+  case 103: /* admin_name: NAME '=' QSTRING ';'  */
+#line 722 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3294,11 +3738,11 @@ yyreduce:
   xfree(ConfigAdminInfo.name);
   ConfigAdminInfo.name = xstrdup(yylval.string);
 }
-#line 3298 "conf_parser.c"
+#line 3742 "conf_parser.c"
     break;
 
-  case 96:
-#line 685 "conf_parser.y"
+  case 104: /* admin_email: EMAIL '=' QSTRING ';'  */
+#line 731 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3306,11 +3750,11 @@ yyreduce:
   xfree(ConfigAdminInfo.email);
   ConfigAdminInfo.email = xstrdup(yylval.string);
 }
-#line 3310 "conf_parser.c"
+#line 3754 "conf_parser.c"
     break;
 
-  case 97:
-#line 694 "conf_parser.y"
+  case 105: /* admin_description: DESCRIPTION '=' QSTRING ';'  */
+#line 740 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3318,20 +3762,20 @@ yyreduce:
   xfree(ConfigAdminInfo.description);
   ConfigAdminInfo.description = xstrdup(yylval.string);
 }
-#line 3322 "conf_parser.c"
+#line 3766 "conf_parser.c"
     break;
 
-  case 98:
-#line 707 "conf_parser.y"
+  case 106: /* $@1: %empty  */
+#line 753 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3331 "conf_parser.c"
+#line 3775 "conf_parser.c"
     break;
 
-  case 99:
-#line 711 "conf_parser.y"
+  case 107: /* motd_entry: MOTD $@1 '{' motd_items '}' ';'  */
+#line 757 "conf_parser.y"
 {
   dlink_node *node;
 
@@ -3344,38 +3788,38 @@ yyreduce:
   DLINK_FOREACH(node, block_state.mask.list.head)
     motd_add(node->data, block_state.file.buf);
 }
-#line 3348 "conf_parser.c"
+#line 3792 "conf_parser.c"
     break;
 
-  case 105:
-#line 728 "conf_parser.y"
+  case 113: /* motd_mask: MASK '=' QSTRING ';'  */
+#line 774 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3357 "conf_parser.c"
+#line 3801 "conf_parser.c"
     break;
 
-  case 106:
-#line 734 "conf_parser.y"
+  case 114: /* motd_file: T_FILE '=' QSTRING ';'  */
+#line 780 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3366 "conf_parser.c"
+#line 3810 "conf_parser.c"
     break;
 
-  case 107:
-#line 744 "conf_parser.y"
+  case 115: /* $@2: %empty  */
+#line 790 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3375 "conf_parser.c"
+#line 3819 "conf_parser.c"
     break;
 
-  case 108:
-#line 748 "conf_parser.y"
+  case 116: /* pseudo_entry: T_PSEUDO $@2 '{' pseudo_items '}' ';'  */
+#line 794 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3389,38 +3833,38 @@ yyreduce:
   pseudo_register(block_state.name.buf, block_state.nick.buf, block_state.host.buf,
                   block_state.prepend.buf, block_state.command.buf);
 }
-#line 3393 "conf_parser.c"
+#line 3837 "conf_parser.c"
     break;
 
-  case 116:
-#line 766 "conf_parser.y"
+  case 124: /* pseudo_command: T_COMMAND '=' QSTRING ';'  */
+#line 812 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.command.buf, yylval.string, sizeof(block_state.command.buf));
 }
-#line 3402 "conf_parser.c"
+#line 3846 "conf_parser.c"
     break;
 
-  case 117:
-#line 772 "conf_parser.y"
+  case 125: /* pseudo_name: NAME '=' QSTRING ';'  */
+#line 818 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3411 "conf_parser.c"
+#line 3855 "conf_parser.c"
     break;
 
-  case 118:
-#line 778 "conf_parser.y"
+  case 126: /* pseudo_prepend: T_PREPEND '=' QSTRING ';'  */
+#line 824 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.prepend.buf, yylval.string, sizeof(block_state.prepend.buf));
 }
-#line 3420 "conf_parser.c"
+#line 3864 "conf_parser.c"
     break;
 
-  case 119:
-#line 784 "conf_parser.y"
+  case 127: /* pseudo_target: T_TARGET '=' QSTRING ';'  */
+#line 830 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -3437,29 +3881,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 3441 "conf_parser.c"
+#line 3885 "conf_parser.c"
     break;
 
-  case 126:
-#line 812 "conf_parser.y"
+  case 134: /* logging_use_logging: USE_LOGGING '=' TBOOL ';'  */
+#line 858 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigLog.use_logging = yylval.number;
 }
-#line 3450 "conf_parser.c"
+#line 3894 "conf_parser.c"
     break;
 
-  case 127:
-#line 818 "conf_parser.y"
+  case 135: /* $@3: %empty  */
+#line 864 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 3459 "conf_parser.c"
+#line 3903 "conf_parser.c"
     break;
 
-  case 128:
-#line 822 "conf_parser.y"
+  case 136: /* logging_file_entry: $@3 T_FILE '{' logging_file_items '}' ';'  */
+#line 868 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3468,119 +3912,128 @@ yyreduce:
     log_set_file(block_state.type.value, block_state.size.value,
                  block_state.file.buf);
 }
-#line 3472 "conf_parser.c"
+#line 3916 "conf_parser.c"
     break;
 
-  case 135:
-#line 838 "conf_parser.y"
+  case 143: /* logging_file_name: NAME '=' QSTRING ';'  */
+#line 884 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
 
   strlcpy(block_state.file.buf, yylval.string, sizeof(block_state.file.buf));
 }
-#line 3483 "conf_parser.c"
+#line 3927 "conf_parser.c"
     break;
 
-  case 136:
-#line 846 "conf_parser.y"
+  case 144: /* logging_file_size: T_SIZE '=' sizespec ';'  */
+#line 892 "conf_parser.y"
 {
   block_state.size.value = (yyvsp[-1].number);
 }
-#line 3491 "conf_parser.c"
+#line 3935 "conf_parser.c"
     break;
 
-  case 137:
-#line 849 "conf_parser.y"
+  case 145: /* logging_file_size: T_SIZE '=' T_UNLIMITED ';'  */
+#line 895 "conf_parser.y"
 {
   block_state.size.value = 0;
 }
-#line 3499 "conf_parser.c"
+#line 3943 "conf_parser.c"
     break;
 
-  case 138:
-#line 854 "conf_parser.y"
+  case 146: /* $@4: %empty  */
+#line 900 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = 0;
 }
-#line 3508 "conf_parser.c"
+#line 3952 "conf_parser.c"
     break;
 
-  case 142:
-#line 861 "conf_parser.y"
+  case 150: /* logging_file_type_item: USER  */
+#line 907 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_USER;
 }
-#line 3517 "conf_parser.c"
+#line 3961 "conf_parser.c"
     break;
 
-  case 143:
-#line 865 "conf_parser.y"
+  case 151: /* logging_file_type_item: OPERATOR  */
+#line 911 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_OPER;
 }
-#line 3526 "conf_parser.c"
+#line 3970 "conf_parser.c"
     break;
 
-  case 144:
-#line 869 "conf_parser.y"
+  case 152: /* logging_file_type_item: XLINE  */
+#line 915 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_XLINE;
 }
-#line 3535 "conf_parser.c"
+#line 3979 "conf_parser.c"
     break;
 
-  case 145:
-#line 873 "conf_parser.y"
+  case 153: /* logging_file_type_item: RESV  */
+#line 919 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_RESV;
 }
-#line 3544 "conf_parser.c"
+#line 3988 "conf_parser.c"
     break;
 
-  case 146:
-#line 877 "conf_parser.y"
+  case 154: /* logging_file_type_item: T_DLINE  */
+#line 923 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DLINE;
 }
-#line 3553 "conf_parser.c"
+#line 3997 "conf_parser.c"
     break;
 
-  case 147:
-#line 881 "conf_parser.y"
+  case 155: /* logging_file_type_item: KLINE  */
+#line 927 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KLINE;
 }
-#line 3562 "conf_parser.c"
+#line 4006 "conf_parser.c"
     break;
 
-  case 148:
-#line 885 "conf_parser.y"
+  case 156: /* logging_file_type_item: KILL  */
+#line 931 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_KILL;
 }
-#line 3571 "conf_parser.c"
+#line 4015 "conf_parser.c"
     break;
 
-  case 149:
-#line 889 "conf_parser.y"
+  case 157: /* logging_file_type_item: T_DEBUG  */
+#line 935 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DEBUG;
 }
-#line 3580 "conf_parser.c"
+#line 4024 "conf_parser.c"
     break;
 
-  case 150:
-#line 899 "conf_parser.y"
+  case 158: /* logging_file_type_item: T_METRICS  */
+#line 939 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.type.value = LOG_TYPE_METRICS;
+}
+#line 4033 "conf_parser.c"
+    break;
+
+  case 159: /* $@5: %empty  */
+#line 949 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3588,11 +4041,11 @@ yyreduce:
   reset_block_state();
   block_state.flags.value |= CONF_FLAGS_ENCRYPTED;
 }
-#line 3592 "conf_parser.c"
+#line 4045 "conf_parser.c"
     break;
 
-  case 151:
-#line 906 "conf_parser.y"
+  case 160: /* oper_entry: OPERATOR $@5 '{' oper_items '}' ';'  */
+#line 956 "conf_parser.y"
 {
   dlink_node *node;
 
@@ -3647,47 +4100,47 @@ yyreduce:
     conf_add_class_to_conf(conf, block_state.class.buf);
   }
 }
-#line 3651 "conf_parser.c"
+#line 4104 "conf_parser.c"
     break;
 
-  case 165:
-#line 975 "conf_parser.y"
+  case 174: /* oper_name: NAME '=' QSTRING ';'  */
+#line 1025 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 3660 "conf_parser.c"
+#line 4113 "conf_parser.c"
     break;
 
-  case 166:
-#line 981 "conf_parser.y"
+  case 175: /* oper_user: USER '=' QSTRING ';'  */
+#line 1031 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 3669 "conf_parser.c"
+#line 4122 "conf_parser.c"
     break;
 
-  case 167:
-#line 987 "conf_parser.y"
+  case 176: /* oper_password: PASSWORD '=' QSTRING ';'  */
+#line 1037 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 3678 "conf_parser.c"
+#line 4131 "conf_parser.c"
     break;
 
-  case 168:
-#line 993 "conf_parser.y"
+  case 177: /* oper_whois: WHOIS '=' QSTRING ';'  */
+#line 1043 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.whois.buf, yylval.string, sizeof(block_state.whois.buf));
 }
-#line 3687 "conf_parser.c"
+#line 4140 "conf_parser.c"
     break;
 
-  case 169:
-#line 999 "conf_parser.y"
+  case 178: /* oper_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 1049 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3697,20 +4150,20 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
 }
-#line 3701 "conf_parser.c"
+#line 4154 "conf_parser.c"
     break;
 
-  case 170:
-#line 1010 "conf_parser.y"
+  case 179: /* oper_tls_certificate_fingerprint: TLS_CERTIFICATE_FINGERPRINT '=' QSTRING ';'  */
+#line 1060 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 3710 "conf_parser.c"
+#line 4163 "conf_parser.c"
     break;
 
-  case 171:
-#line 1016 "conf_parser.y"
+  case 180: /* oper_tls_connection_required: TLS_CONNECTION_REQUIRED '=' TBOOL ';'  */
+#line 1066 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -3720,497 +4173,497 @@ yyreduce:
   else
     block_state.flags.value &= ~CONF_FLAGS_TLS;
 }
-#line 3724 "conf_parser.c"
+#line 4177 "conf_parser.c"
     break;
 
-  case 172:
-#line 1027 "conf_parser.y"
+  case 181: /* oper_class: CLASS '=' QSTRING ';'  */
+#line 1077 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 3733 "conf_parser.c"
+#line 4186 "conf_parser.c"
     break;
 
-  case 173:
-#line 1033 "conf_parser.y"
+  case 182: /* $@6: %empty  */
+#line 1083 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value = 0;
 }
-#line 3742 "conf_parser.c"
+#line 4195 "conf_parser.c"
     break;
 
-  case 177:
-#line 1040 "conf_parser.y"
+  case 186: /* oper_umodes_item: BOT  */
+#line 1090 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_BOT;
 }
-#line 3751 "conf_parser.c"
+#line 4204 "conf_parser.c"
     break;
 
-  case 178:
-#line 1044 "conf_parser.y"
+  case 187: /* oper_umodes_item: T_CCONN  */
+#line 1094 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CCONN;
 }
-#line 3760 "conf_parser.c"
+#line 4213 "conf_parser.c"
     break;
 
-  case 179:
-#line 1048 "conf_parser.y"
+  case 188: /* oper_umodes_item: T_DEAF  */
+#line 1098 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEAF;
 }
-#line 3769 "conf_parser.c"
+#line 4222 "conf_parser.c"
     break;
 
-  case 180:
-#line 1052 "conf_parser.y"
+  case 189: /* oper_umodes_item: T_DEBUG  */
+#line 1102 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_DEBUG;
 }
-#line 3778 "conf_parser.c"
+#line 4231 "conf_parser.c"
     break;
 
-  case 181:
-#line 1056 "conf_parser.y"
+  case 190: /* oper_umodes_item: T_FLOOD  */
+#line 1106 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FLOOD;
 }
-#line 3787 "conf_parser.c"
+#line 4240 "conf_parser.c"
     break;
 
-  case 182:
-#line 1060 "conf_parser.y"
+  case 191: /* oper_umodes_item: HIDDEN  */
+#line 1110 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDDEN;
 }
-#line 3796 "conf_parser.c"
+#line 4249 "conf_parser.c"
     break;
 
-  case 183:
-#line 1064 "conf_parser.y"
+  case 192: /* oper_umodes_item: HIDE_CHANS  */
+#line 1114 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDECHANS;
 }
-#line 3805 "conf_parser.c"
+#line 4258 "conf_parser.c"
     break;
 
-  case 184:
-#line 1068 "conf_parser.y"
+  case 193: /* oper_umodes_item: HIDE_IDLE  */
+#line 1118 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_HIDEIDLE;
 }
-#line 3814 "conf_parser.c"
+#line 4267 "conf_parser.c"
     break;
 
-  case 185:
-#line 1072 "conf_parser.y"
+  case 194: /* oper_umodes_item: T_SKILL  */
+#line 1122 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SKILL;
 }
-#line 3823 "conf_parser.c"
+#line 4276 "conf_parser.c"
     break;
 
-  case 186:
-#line 1076 "conf_parser.y"
+  case 195: /* oper_umodes_item: T_NCHANGE  */
+#line 1126 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_NCHANGE;
 }
-#line 3832 "conf_parser.c"
+#line 4285 "conf_parser.c"
     break;
 
-  case 187:
-#line 1080 "conf_parser.y"
+  case 196: /* oper_umodes_item: T_REJ  */
+#line 1130 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REJ;
 }
-#line 3841 "conf_parser.c"
+#line 4294 "conf_parser.c"
     break;
 
-  case 188:
-#line 1084 "conf_parser.y"
+  case 197: /* oper_umodes_item: T_SPY  */
+#line 1134 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SPY;
 }
-#line 3850 "conf_parser.c"
+#line 4303 "conf_parser.c"
     break;
 
-  case 189:
-#line 1088 "conf_parser.y"
+  case 198: /* oper_umodes_item: T_EXTERNAL  */
+#line 1138 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXTERNAL;
 }
-#line 3859 "conf_parser.c"
+#line 4312 "conf_parser.c"
     break;
 
-  case 190:
-#line 1092 "conf_parser.y"
+  case 199: /* oper_umodes_item: T_SERVNOTICE  */
+#line 1142 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SERVNOTICE;
 }
-#line 3868 "conf_parser.c"
+#line 4321 "conf_parser.c"
     break;
 
-  case 191:
-#line 1096 "conf_parser.y"
+  case 200: /* oper_umodes_item: T_INVISIBLE  */
+#line 1146 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_INVISIBLE;
 }
-#line 3877 "conf_parser.c"
+#line 4330 "conf_parser.c"
     break;
 
-  case 192:
-#line 1100 "conf_parser.y"
+  case 201: /* oper_umodes_item: T_WALLOP  */
+#line 1150 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_WALLOP;
 }
-#line 3886 "conf_parser.c"
+#line 4339 "conf_parser.c"
     break;
 
-  case 193:
-#line 1104 "conf_parser.y"
+  case 202: /* oper_umodes_item: T_SOFTCALLERID  */
+#line 1154 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_SOFTCALLERID;
 }
-#line 3895 "conf_parser.c"
+#line 4348 "conf_parser.c"
     break;
 
-  case 194:
-#line 1108 "conf_parser.y"
+  case 203: /* oper_umodes_item: T_CALLERID  */
+#line 1158 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_CALLERID;
 }
-#line 3904 "conf_parser.c"
+#line 4357 "conf_parser.c"
     break;
 
-  case 195:
-#line 1112 "conf_parser.y"
+  case 204: /* oper_umodes_item: T_LOCOPS  */
+#line 1162 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_LOCOPS;
 }
-#line 3913 "conf_parser.c"
+#line 4366 "conf_parser.c"
     break;
 
-  case 196:
-#line 1116 "conf_parser.y"
+  case 205: /* oper_umodes_item: T_NONONREG  */
+#line 1166 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_REGONLY;
 }
-#line 3922 "conf_parser.c"
+#line 4375 "conf_parser.c"
     break;
 
-  case 197:
-#line 1120 "conf_parser.y"
+  case 206: /* oper_umodes_item: T_FARCONNECT  */
+#line 1170 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_FARCONNECT;
 }
-#line 3931 "conf_parser.c"
+#line 4384 "conf_parser.c"
     break;
 
-  case 198:
-#line 1124 "conf_parser.y"
+  case 207: /* oper_umodes_item: EXPIRATION  */
+#line 1174 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.modes.value |= UMODE_EXPIRATION;
 }
-#line 3940 "conf_parser.c"
+#line 4393 "conf_parser.c"
     break;
 
-  case 199:
-#line 1130 "conf_parser.y"
+  case 208: /* $@7: %empty  */
+#line 1180 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = 0;
 }
-#line 3949 "conf_parser.c"
+#line 4402 "conf_parser.c"
     break;
 
-  case 203:
-#line 1137 "conf_parser.y"
+  case 212: /* oper_flags_item: KILL ':' REMOTE  */
+#line 1187 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL_REMOTE;
 }
-#line 3958 "conf_parser.c"
+#line 4411 "conf_parser.c"
     break;
 
-  case 204:
-#line 1141 "conf_parser.y"
+  case 213: /* oper_flags_item: KILL  */
+#line 1191 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KILL;
 }
-#line 3967 "conf_parser.c"
+#line 4420 "conf_parser.c"
     break;
 
-  case 205:
-#line 1145 "conf_parser.y"
+  case 214: /* oper_flags_item: CONNECT ':' REMOTE  */
+#line 1195 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT_REMOTE;
 }
-#line 3976 "conf_parser.c"
+#line 4429 "conf_parser.c"
     break;
 
-  case 206:
-#line 1149 "conf_parser.y"
+  case 215: /* oper_flags_item: CONNECT  */
+#line 1199 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CONNECT;
 }
-#line 3985 "conf_parser.c"
+#line 4438 "conf_parser.c"
     break;
 
-  case 207:
-#line 1153 "conf_parser.y"
+  case 216: /* oper_flags_item: SQUIT ':' REMOTE  */
+#line 1203 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT_REMOTE;
 }
-#line 3994 "conf_parser.c"
+#line 4447 "conf_parser.c"
     break;
 
-  case 208:
-#line 1157 "conf_parser.y"
+  case 217: /* oper_flags_item: SQUIT  */
+#line 1207 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SQUIT;
 }
-#line 4003 "conf_parser.c"
+#line 4456 "conf_parser.c"
     break;
 
-  case 209:
-#line 1161 "conf_parser.y"
+  case 218: /* oper_flags_item: KLINE  */
+#line 1211 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_KLINE;
 }
-#line 4012 "conf_parser.c"
+#line 4465 "conf_parser.c"
     break;
 
-  case 210:
-#line 1165 "conf_parser.y"
+  case 219: /* oper_flags_item: UNKLINE  */
+#line 1215 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNKLINE;
 }
-#line 4021 "conf_parser.c"
+#line 4474 "conf_parser.c"
     break;
 
-  case 211:
-#line 1169 "conf_parser.y"
+  case 220: /* oper_flags_item: T_DLINE  */
+#line 1219 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DLINE;
 }
-#line 4030 "conf_parser.c"
+#line 4483 "conf_parser.c"
     break;
 
-  case 212:
-#line 1173 "conf_parser.y"
+  case 221: /* oper_flags_item: T_UNDLINE  */
+#line 1223 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNDLINE;
 }
-#line 4039 "conf_parser.c"
+#line 4492 "conf_parser.c"
     break;
 
-  case 213:
-#line 1177 "conf_parser.y"
+  case 222: /* oper_flags_item: XLINE  */
+#line 1227 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_XLINE;
 }
-#line 4048 "conf_parser.c"
+#line 4501 "conf_parser.c"
     break;
 
-  case 214:
-#line 1181 "conf_parser.y"
+  case 223: /* oper_flags_item: T_UNXLINE  */
+#line 1231 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNXLINE;
 }
-#line 4057 "conf_parser.c"
+#line 4510 "conf_parser.c"
     break;
 
-  case 215:
-#line 1185 "conf_parser.y"
+  case 224: /* oper_flags_item: DIE  */
+#line 1235 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_DIE;
 }
-#line 4066 "conf_parser.c"
+#line 4519 "conf_parser.c"
     break;
 
-  case 216:
-#line 1189 "conf_parser.y"
+  case 225: /* oper_flags_item: T_RESTART  */
+#line 1239 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESTART;
 }
-#line 4075 "conf_parser.c"
+#line 4528 "conf_parser.c"
     break;
 
-  case 217:
-#line 1193 "conf_parser.y"
+  case 226: /* oper_flags_item: REHASH ':' REMOTE  */
+#line 1243 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH_REMOTE;
 }
-#line 4084 "conf_parser.c"
+#line 4537 "conf_parser.c"
     break;
 
-  case 218:
-#line 1197 "conf_parser.y"
+  case 227: /* oper_flags_item: REHASH  */
+#line 1247 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REHASH;
 }
-#line 4093 "conf_parser.c"
+#line 4546 "conf_parser.c"
     break;
 
-  case 219:
-#line 1201 "conf_parser.y"
+  case 228: /* oper_flags_item: ADMIN  */
+#line 1251 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_ADMIN;
 }
-#line 4102 "conf_parser.c"
+#line 4555 "conf_parser.c"
     break;
 
-  case 220:
-#line 1205 "conf_parser.y"
+  case 229: /* oper_flags_item: T_GLOBOPS  */
+#line 1255 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_GLOBOPS;
 }
-#line 4111 "conf_parser.c"
+#line 4564 "conf_parser.c"
     break;
 
-  case 221:
-#line 1209 "conf_parser.y"
+  case 230: /* oper_flags_item: T_WALLOPS  */
+#line 1259 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_WALLOPS;
 }
-#line 4120 "conf_parser.c"
+#line 4573 "conf_parser.c"
     break;
 
-  case 222:
-#line 1213 "conf_parser.y"
+  case 231: /* oper_flags_item: T_LOCOPS  */
+#line 1263 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_LOCOPS;
 }
-#line 4129 "conf_parser.c"
+#line 4582 "conf_parser.c"
     break;
 
-  case 223:
-#line 1217 "conf_parser.y"
+  case 232: /* oper_flags_item: REMOTEBAN  */
+#line 1267 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_REMOTEBAN;
 }
-#line 4138 "conf_parser.c"
+#line 4591 "conf_parser.c"
     break;
 
-  case 224:
-#line 1221 "conf_parser.y"
+  case 233: /* oper_flags_item: T_SET  */
+#line 1271 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_SET;
 }
-#line 4147 "conf_parser.c"
+#line 4600 "conf_parser.c"
     break;
 
-  case 225:
-#line 1225 "conf_parser.y"
+  case 234: /* oper_flags_item: MODULE  */
+#line 1275 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_MODULE;
 }
-#line 4156 "conf_parser.c"
+#line 4609 "conf_parser.c"
     break;
 
-  case 226:
-#line 1229 "conf_parser.y"
+  case 235: /* oper_flags_item: T_OPME  */
+#line 1279 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_OPME;
 }
-#line 4165 "conf_parser.c"
+#line 4618 "conf_parser.c"
     break;
 
-  case 227:
-#line 1233 "conf_parser.y"
+  case 236: /* oper_flags_item: NICK ':' RESV  */
+#line 1283 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_NICK_RESV;
 }
-#line 4174 "conf_parser.c"
+#line 4627 "conf_parser.c"
     break;
 
-  case 228:
-#line 1237 "conf_parser.y"
+  case 237: /* oper_flags_item: JOIN ':' RESV  */
+#line 1287 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_JOIN_RESV;
 }
-#line 4183 "conf_parser.c"
+#line 4636 "conf_parser.c"
     break;
 
-  case 229:
-#line 1241 "conf_parser.y"
+  case 238: /* oper_flags_item: RESV  */
+#line 1291 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_RESV;
 }
-#line 4192 "conf_parser.c"
+#line 4645 "conf_parser.c"
     break;
 
-  case 230:
-#line 1245 "conf_parser.y"
+  case 239: /* oper_flags_item: T_UNRESV  */
+#line 1295 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_UNRESV;
 }
-#line 4201 "conf_parser.c"
+#line 4654 "conf_parser.c"
     break;
 
-  case 231:
-#line 1249 "conf_parser.y"
+  case 240: /* oper_flags_item: CLOSE  */
+#line 1299 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value |= OPER_FLAG_CLOSE;
 }
-#line 4210 "conf_parser.c"
+#line 4663 "conf_parser.c"
     break;
 
-  case 232:
-#line 1259 "conf_parser.y"
+  case 241: /* $@8: %empty  */
+#line 1309 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4221,12 +4674,14 @@ yyreduce:
   block_state.con_freq.value  = DEFAULT_CONNECTFREQUENCY;
   block_state.max_sendq.value = DEFAULT_SENDQ;
   block_state.max_recvq.value = DEFAULT_RECVQ;
+  block_state.flood_burst.value = DEFAULT_FLOOD_BURST;
+  block_state.flood_rate.value = DEFAULT_FLOOD_RATE;
 }
-#line 4226 "conf_parser.c"
+#line 4681 "conf_parser.c"
     break;
 
-  case 233:
-#line 1270 "conf_parser.y"
+  case 242: /* class_entry: CLASS $@8 '{' class_items '}' ';'  */
+#line 1322 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4248,6 +4703,8 @@ yyreduce:
   class->max_total = block_state.max_total.value;
   class->max_sendq = block_state.max_sendq.value;
   class->max_recvq = block_state.max_recvq.value;
+  class->flood_burst = block_state.flood_burst.value;
+  class->flood_rate = block_state.flood_rate.value;
   class->max_channels = block_state.max_channels.value;
 
   if (block_state.min_idle.value > block_state.max_idle.value)
@@ -4270,120 +4727,140 @@ yyreduce:
   if (diff)
     class_ip_limit_rebuild(class);
 }
-#line 4274 "conf_parser.c"
+#line 4731 "conf_parser.c"
     break;
 
-  case 252:
-#line 1333 "conf_parser.y"
+  case 263: /* class_name: NAME '=' QSTRING ';'  */
+#line 1389 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4283 "conf_parser.c"
+#line 4740 "conf_parser.c"
     break;
 
-  case 253:
-#line 1339 "conf_parser.y"
+  case 264: /* class_ping_time: PING_TIME '=' timespec ';'  */
+#line 1395 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.ping_freq.value = (yyvsp[-1].number);
 }
-#line 4292 "conf_parser.c"
+#line 4749 "conf_parser.c"
     break;
 
-  case 254:
-#line 1345 "conf_parser.y"
+  case 265: /* class_number_per_ip_local: NUMBER_PER_IP_LOCAL '=' NUMBER ';'  */
+#line 1401 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_local.value = (yyvsp[-1].number);
 }
-#line 4301 "conf_parser.c"
+#line 4758 "conf_parser.c"
     break;
 
-  case 255:
-#line 1351 "conf_parser.y"
+  case 266: /* class_number_per_ip_global: NUMBER_PER_IP_GLOBAL '=' NUMBER ';'  */
+#line 1407 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.max_perip_global.value = (yyvsp[-1].number);
 }
-#line 4310 "conf_parser.c"
+#line 4767 "conf_parser.c"
     break;
 
-  case 256:
-#line 1357 "conf_parser.y"
+  case 267: /* class_connectfreq: CONNECTFREQ '=' timespec ';'  */
+#line 1413 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.con_freq.value = (yyvsp[-1].number);
 }
-#line 4319 "conf_parser.c"
+#line 4776 "conf_parser.c"
     break;
 
-  case 257:
-#line 1363 "conf_parser.y"
+  case 268: /* class_max_channels: MAX_CHANNELS '=' NUMBER ';'  */
+#line 1419 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.max_channels.value = (yyvsp[-1].number);
 }
-#line 4328 "conf_parser.c"
+#line 4785 "conf_parser.c"
     break;
 
-  case 258:
-#line 1369 "conf_parser.y"
+  case 269: /* class_max_number: MAX_NUMBER '=' NUMBER ';'  */
+#line 1425 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.max_total.value = (yyvsp[-1].number);
 }
-#line 4337 "conf_parser.c"
+#line 4794 "conf_parser.c"
     break;
 
-  case 259:
-#line 1375 "conf_parser.y"
+  case 270: /* class_sendq: SENDQ '=' sizespec ';'  */
+#line 1431 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.max_sendq.value = (yyvsp[-1].number);
 }
-#line 4346 "conf_parser.c"
+#line 4803 "conf_parser.c"
     break;
 
-  case 260:
-#line 1381 "conf_parser.y"
+  case 271: /* class_recvq: T_RECVQ '=' sizespec ';'  */
+#line 1437 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     if ((yyvsp[-1].number) >= CLIENT_FLOOD_MIN && (yyvsp[-1].number) <= CLIENT_FLOOD_MAX)
       block_state.max_recvq.value = (yyvsp[-1].number);
 }
-#line 4356 "conf_parser.c"
+#line 4813 "conf_parser.c"
     break;
 
-  case 261:
-#line 1388 "conf_parser.y"
+  case 272: /* class_flood_burst: FLOOD_BURST '=' NUMBER ';'  */
+#line 1444 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 1)
+    if ((yyvsp[-1].number) > 0)
+      block_state.flood_burst.value = (yyvsp[-1].number);
+}
+#line 4823 "conf_parser.c"
+    break;
+
+  case 273: /* class_flood_rate: FLOOD_RATE '=' NUMBER ';'  */
+#line 1451 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 1)
+    if ((yyvsp[-1].number) > 0)
+      block_state.flood_rate.value = (yyvsp[-1].number);
+}
+#line 4833 "conf_parser.c"
+    break;
+
+  case 274: /* class_cidr_bitlen_ipv4: CIDR_BITLEN_IPV4 '=' NUMBER ';'  */
+#line 1458 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv4.value = (yyvsp[-1].number) > 32 ? 32 : (yyvsp[-1].number);
 }
-#line 4365 "conf_parser.c"
+#line 4842 "conf_parser.c"
     break;
 
-  case 262:
-#line 1394 "conf_parser.y"
+  case 275: /* class_cidr_bitlen_ipv6: CIDR_BITLEN_IPV6 '=' NUMBER ';'  */
+#line 1464 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.cidr_bitlen_ipv6.value = (yyvsp[-1].number) > 128 ? 128 : (yyvsp[-1].number);
 }
-#line 4374 "conf_parser.c"
+#line 4851 "conf_parser.c"
     break;
 
-  case 263:
-#line 1400 "conf_parser.y"
+  case 276: /* class_number_per_cidr: NUMBER_PER_CIDR '=' NUMBER ';'  */
+#line 1470 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.number_per_cidr.value = (yyvsp[-1].number);
 }
-#line 4383 "conf_parser.c"
+#line 4860 "conf_parser.c"
     break;
 
-  case 264:
-#line 1406 "conf_parser.y"
+  case 277: /* class_min_idle: MIN_IDLE '=' timespec ';'  */
+#line 1476 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4391,11 +4868,11 @@ yyreduce:
   block_state.min_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4395 "conf_parser.c"
+#line 4872 "conf_parser.c"
     break;
 
-  case 265:
-#line 1415 "conf_parser.y"
+  case 278: /* class_max_idle: MAX_IDLE '=' timespec ';'  */
+#line 1485 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 1)
     break;
@@ -4403,106 +4880,124 @@ yyreduce:
   block_state.max_idle.value = (yyvsp[-1].number);
   block_state.flags.value |= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4407 "conf_parser.c"
+#line 4884 "conf_parser.c"
     break;
 
-  case 266:
-#line 1424 "conf_parser.y"
+  case 279: /* $@9: %empty  */
+#line 1494 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value &= CLASS_FLAGS_FAKE_IDLE;
 }
-#line 4416 "conf_parser.c"
+#line 4893 "conf_parser.c"
     break;
 
-  case 270:
-#line 1431 "conf_parser.y"
+  case 283: /* class_flags_item: RANDOM_IDLE  */
+#line 1501 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_RANDOM_IDLE;
 }
-#line 4425 "conf_parser.c"
+#line 4902 "conf_parser.c"
     break;
 
-  case 271:
-#line 1435 "conf_parser.y"
+  case 284: /* class_flags_item: HIDE_IDLE_FROM_OPERS  */
+#line 1505 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 1)
     block_state.flags.value |= CLASS_FLAGS_HIDE_IDLE_FROM_OPERS;
 }
-#line 4434 "conf_parser.c"
+#line 4911 "conf_parser.c"
     break;
 
-  case 272:
-#line 1445 "conf_parser.y"
+  case 285: /* $@10: %empty  */
+#line 1515 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4443 "conf_parser.c"
+#line 4920 "conf_parser.c"
     break;
 
-  case 274:
-#line 1451 "conf_parser.y"
+  case 287: /* $@11: %empty  */
+#line 1521 "conf_parser.y"
 {
   block_state.flags.value = 0;
 }
-#line 4451 "conf_parser.c"
+#line 4928 "conf_parser.c"
     break;
 
-  case 278:
-#line 1457 "conf_parser.y"
+  case 291: /* listen_flags_item: T_TLS  */
+#line 1527 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_TLS;
 }
-#line 4460 "conf_parser.c"
+#line 4937 "conf_parser.c"
     break;
 
-  case 279:
-#line 1461 "conf_parser.y"
+  case 292: /* listen_flags_item: HIDDEN  */
+#line 1531 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= LISTENER_HIDDEN;
 }
-#line 4469 "conf_parser.c"
+#line 4946 "conf_parser.c"
     break;
 
-  case 280:
-#line 1465 "conf_parser.y"
+  case 293: /* listen_flags_item: T_SERVER  */
+#line 1535 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_SERVER;
 }
-#line 4478 "conf_parser.c"
+#line 4955 "conf_parser.c"
     break;
 
-  case 281:
-#line 1469 "conf_parser.y"
+  case 294: /* listen_flags_item: CLIENT  */
+#line 1539 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_CLIENT;
 }
-#line 4487 "conf_parser.c"
+#line 4964 "conf_parser.c"
     break;
 
-  case 282:
-#line 1473 "conf_parser.y"
+  case 295: /* listen_flags_item: DEFER  */
+#line 1543 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_DEFER;
 }
-#line 4496 "conf_parser.c"
+#line 4973 "conf_parser.c"
+    break;
+
+  case 296: /* listen_flags_item: REUSEPORT  */
+#line 1547 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+   block_state.flags.value |= LISTENER_REUSEPORT;
+}
+#line 4982 "conf_parser.c"
+    break;
+
+  case 297: /* listen_flags_item: T_METRICS  */
+#line 1551 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+   block_state.flags.value |= LISTENER_METRICS;
+}
+#line 4991 "conf_parser.c"
     break;
 
-  case 290:
-#line 1481 "conf_parser.y"
+  case 305: /* $@12: %empty  */
+#line 1559 "conf_parser.y"
                                  { block_state.flags.value = 0; }
-#line 4502 "conf_parser.c"
+#line 4997 "conf_parser.c"
     break;
 
-  case 294:
-#line 1486 "conf_parser.y"
+  case 309: /* port_item: NUMBER  */
+#line 1564 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4516,11 +5011,11 @@ yyreduce:
     listener_add((yyvsp[0].number), block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4520 "conf_parser.c"
+#line 5015 "conf_parser.c"
     break;
 
-  case 295:
-#line 1499 "conf_parser.y"
+  case 310: /* port_item: NUMBER TWODOTS NUMBER  */
+#line 1577 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4536,38 +5031,38 @@ yyreduce:
       listener_add(i, block_state.addr.buf, block_state.flags.value);
   }
 }
-#line 4540 "conf_parser.c"
+#line 5035 "conf_parser.c"
     break;
 
-  case 296:
-#line 1516 "conf_parser.y"
+  case 311: /* listen_address: IP '=' QSTRING ';'  */
+#line 1594 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4549 "conf_parser.c"
+#line 5044 "conf_parser.c"
     break;
 
-  case 297:
-#line 1522 "conf_parser.y"
+  case 312: /* listen_host: HOST '=' QSTRING ';'  */
+#line 1600 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 4558 "conf_parser.c"
+#line 5053 "conf_parser.c"
     break;
 
-  case 298:
-#line 1532 "conf_parser.y"
+  case 313: /* $@13: %empty  */
+#line 1610 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 4567 "conf_parser.c"
+#line 5062 "conf_parser.c"
     break;
 
-  case 299:
-#line 1536 "conf_parser.y"
+  case 314: /* auth_entry: IRCD_AUTH $@13 '{' auth_items '}' ';'  */
+#line 1614 "conf_parser.y"
 {
   dlink_node *node;
 
@@ -4609,38 +5104,38 @@ yyreduce:
     add_conf_by_address(CONF_CLIENT, conf);
   }
 }
-#line 4613 "conf_parser.c"
+#line 5108 "conf_parser.c"
     break;
 
-  case 311:
-#line 1590 "conf_parser.y"
+  case 326: /* auth_user: USER '=' QSTRING ';'  */
+#line 1668 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4622 "conf_parser.c"
+#line 5117 "conf_parser.c"
     break;
 
-  case 312:
-#line 1596 "conf_parser.y"
+  case 327: /* auth_passwd: PASSWORD '=' QSTRING ';'  */
+#line 1674 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4631 "conf_parser.c"
+#line 5126 "conf_parser.c"
     break;
 
-  case 313:
-#line 1602 "conf_parser.y"
+  case 328: /* auth_class: CLASS '=' QSTRING ';'  */
+#line 1680 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 4640 "conf_parser.c"
+#line 5135 "conf_parser.c"
     break;
 
-  case 314:
-#line 1608 "conf_parser.y"
+  case 329: /* auth_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 1686 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4650,101 +5145,101 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 4654 "conf_parser.c"
+#line 5149 "conf_parser.c"
     break;
 
-  case 315:
-#line 1619 "conf_parser.y"
+  case 330: /* $@14: %empty  */
+#line 1697 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value &= (CONF_FLAGS_ENCRYPTED | CONF_FLAGS_SPOOF_IP);
 }
-#line 4663 "conf_parser.c"
+#line 5158 "conf_parser.c"
     break;
 
-  case 319:
-#line 1626 "conf_parser.y"
+  case 334: /* auth_flags_item: EXCEED_LIMIT  */
+#line 1704 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NOLIMIT;
 }
-#line 4672 "conf_parser.c"
+#line 5167 "conf_parser.c"
     break;
 
-  case 320:
-#line 1630 "conf_parser.y"
+  case 335: /* auth_flags_item: KLINE_EXEMPT  */
+#line 1708 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTKLINE;
 }
-#line 4681 "conf_parser.c"
+#line 5176 "conf_parser.c"
     break;
 
-  case 321:
-#line 1634 "conf_parser.y"
+  case 336: /* auth_flags_item: XLINE_EXEMPT  */
+#line 1712 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTXLINE;
 }
-#line 4690 "conf_parser.c"
+#line 5185 "conf_parser.c"
     break;
 
-  case 322:
-#line 1638 "conf_parser.y"
+  case 337: /* auth_flags_item: NEED_IDENT  */
+#line 1716 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_IDENTD;
 }
-#line 4699 "conf_parser.c"
+#line 5194 "conf_parser.c"
     break;
 
-  case 323:
-#line 1642 "conf_parser.y"
+  case 338: /* auth_flags_item: CAN_FLOOD  */
+#line 1720 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_CAN_FLOOD;
 }
-#line 4708 "conf_parser.c"
+#line 5203 "conf_parser.c"
     break;
 
-  case 324:
-#line 1646 "conf_parser.y"
+  case 339: /* auth_flags_item: NO_TILDE  */
+#line 1724 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NO_TILDE;
 }
-#line 4717 "conf_parser.c"
+#line 5212 "conf_parser.c"
     break;
 
-  case 325:
-#line 1650 "conf_parser.y"
+  case 340: /* auth_flags_item: RESV_EXEMPT  */
+#line 1728 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_EXEMPTRESV;
 }
-#line 4726 "conf_parser.c"
+#line 5221 "conf_parser.c"
     break;
 
-  case 326:
-#line 1654 "conf_parser.y"
+  case 341: /* auth_flags_item: T_WEBIRC  */
+#line 1732 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_WEBIRC;
 }
-#line 4735 "conf_parser.c"
+#line 5230 "conf_parser.c"
     break;
 
-  case 327:
-#line 1658 "conf_parser.y"
+  case 342: /* auth_flags_item: NEED_PASSWORD  */
+#line 1736 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_NEED_PASSWORD;
 }
-#line 4744 "conf_parser.c"
+#line 5239 "conf_parser.c"
     break;
 
-  case 328:
-#line 1664 "conf_parser.y"
+  case 343: /* auth_spoof: SPOOF '=' QSTRING ';'  */
+#line 1742 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4757,11 +5252,11 @@ yyreduce:
   else
     ilog(LOG_TYPE_IRCD, "Spoof either is too long or contains invalid characters. Ignoring it.");
 }
-#line 4761 "conf_parser.c"
+#line 5256 "conf_parser.c"
     break;
 
-  case 329:
-#line 1678 "conf_parser.y"
+  case 344: /* auth_redir_serv: REDIRSERV '=' QSTRING ';'  */
+#line 1756 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4769,11 +5264,11 @@ yyreduce:
   strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
   block_state.flags.value |= CONF_FLAGS_REDIR;
 }
-#line 4773 "conf_parser.c"
+#line 5268 "conf_parser.c"
     break;
 
-  case 330:
-#line 1687 "conf_parser.y"
+  case 345: /* auth_redir_port: REDIRPORT '=' NUMBER ';'  */
+#line 1765 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4781,11 +5276,11 @@ yyreduce:
   block_state.flags.value |= CONF_FLAGS_REDIR;
   block_state.port.value = (yyvsp[-1].number);
 }
-#line 4785 "conf_parser.c"
+#line 5280 "conf_parser.c"
     break;
 
-  case 331:
-#line 1700 "conf_parser.y"
+  case 346: /* $@15: %empty  */
+#line 1778 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4793,49 +5288,49 @@ yyreduce:
   reset_block_state();
   strlcpy(block_state.rpass.buf, CONF_NOREASON, sizeof(block_state.rpass.buf));
 }
-#line 4797 "conf_parser.c"
+#line 5292 "conf_parser.c"
     break;
 
-  case 332:
-#line 1707 "conf_parser.y"
+  case 347: /* resv_entry: RESV $@15 '{' resv_items '}' ';'  */
+#line 1785 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
 
   resv_make(block_state.name.buf, block_state.rpass.buf, &block_state.mask.list);
 }
-#line 4808 "conf_parser.c"
+#line 5303 "conf_parser.c"
     break;
 
-  case 339:
-#line 1718 "conf_parser.y"
+  case 354: /* resv_mask: MASK '=' QSTRING ';'  */
+#line 1796 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4817 "conf_parser.c"
+#line 5312 "conf_parser.c"
     break;
 
-  case 340:
-#line 1724 "conf_parser.y"
+  case 355: /* resv_reason: REASON '=' QSTRING ';'  */
+#line 1802 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 4826 "conf_parser.c"
+#line 5321 "conf_parser.c"
     break;
 
-  case 341:
-#line 1730 "conf_parser.y"
+  case 356: /* resv_exempt: EXEMPT '=' QSTRING ';'  */
+#line 1808 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.mask.list);
 }
-#line 4835 "conf_parser.c"
+#line 5330 "conf_parser.c"
     break;
 
-  case 347:
-#line 1745 "conf_parser.y"
+  case 362: /* service_name: NAME '=' QSTRING ';'  */
+#line 1823 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4846,11 +5341,11 @@ yyreduce:
     service->name = xstrdup(yylval.string);
   }
 }
-#line 4850 "conf_parser.c"
+#line 5345 "conf_parser.c"
     break;
 
-  case 348:
-#line 1761 "conf_parser.y"
+  case 363: /* $@16: %empty  */
+#line 1839 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4862,11 +5357,11 @@ yyreduce:
   strlcpy(block_state.host.buf, "*", sizeof(block_state.host.buf));
   block_state.flags.value = SHARED_ALL;
 }
-#line 4866 "conf_parser.c"
+#line 5361 "conf_parser.c"
     break;
 
-  case 349:
-#line 1772 "conf_parser.y"
+  case 364: /* shared_entry: T_SHARED $@16 '{' shared_items '}' ';'  */
+#line 1850 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -4877,20 +5372,20 @@ yyreduce:
   shared->user = xstrdup(block_state.user.buf);
   shared->host = xstrdup(block_state.host.buf);
 }
-#line 4881 "conf_parser.c"
+#line 5376 "conf_parser.c"
     break;
 
-  case 356:
-#line 1787 "conf_parser.y"
+  case 371: /* shared_name: NAME '=' QSTRING ';'  */
+#line 1865 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 4890 "conf_parser.c"
+#line 5385 "conf_parser.c"
     break;
 
-  case 357:
-#line 1793 "conf_parser.y"
+  case 372: /* shared_user: USER '=' QSTRING ';'  */
+#line 1871 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -4908,110 +5403,110 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 4912 "conf_parser.c"
+#line 5407 "conf_parser.c"
     break;
 
-  case 358:
-#line 1812 "conf_parser.y"
+  case 373: /* $@17: %empty  */
+#line 1890 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 4921 "conf_parser.c"
+#line 5416 "conf_parser.c"
     break;
 
-  case 362:
-#line 1819 "conf_parser.y"
+  case 377: /* shared_type_item: KLINE  */
+#line 1897 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_KLINE;
 }
-#line 4930 "conf_parser.c"
+#line 5425 "conf_parser.c"
     break;
 
-  case 363:
-#line 1823 "conf_parser.y"
+  case 378: /* shared_type_item: UNKLINE  */
+#line 1901 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNKLINE;
 }
-#line 4939 "conf_parser.c"
+#line 5434 "conf_parser.c"
     break;
 
-  case 364:
-#line 1827 "conf_parser.y"
+  case 379: /* shared_type_item: T_DLINE  */
+#line 1905 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_DLINE;
 }
-#line 4948 "conf_parser.c"
+#line 5443 "conf_parser.c"
     break;
 
-  case 365:
-#line 1831 "conf_parser.y"
+  case 380: /* shared_type_item: T_UNDLINE  */
+#line 1909 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNDLINE;
 }
-#line 4957 "conf_parser.c"
+#line 5452 "conf_parser.c"
     break;
 
-  case 366:
-#line 1835 "conf_parser.y"
+  case 381: /* shared_type_item: XLINE  */
+#line 1913 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_XLINE;
 }
-#line 4966 "conf_parser.c"
+#line 5461 "conf_parser.c"
     break;
 
-  case 367:
-#line 1839 "conf_parser.y"
+  case 382: /* shared_type_item: T_UNXLINE  */
+#line 1917 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNXLINE;
 }
-#line 4975 "conf_parser.c"
+#line 5470 "conf_parser.c"
     break;
 
-  case 368:
-#line 1843 "conf_parser.y"
+  case 383: /* shared_type_item: RESV  */
+#line 1921 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_RESV;
 }
-#line 4984 "conf_parser.c"
+#line 5479 "conf_parser.c"
     break;
 
-  case 369:
-#line 1847 "conf_parser.y"
+  case 384: /* shared_type_item: T_UNRESV  */
+#line 1925 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_UNRESV;
 }
-#line 4993 "conf_parser.c"
+#line 5488 "conf_parser.c"
     break;
 
-  case 370:
-#line 1851 "conf_parser.y"
+  case 385: /* shared_type_item: T_LOCOPS  */
+#line 1929 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= SHARED_LOCOPS;
 }
-#line 5002 "conf_parser.c"
+#line 5497 "conf_parser.c"
     break;
 
-  case 371:
-#line 1855 "conf_parser.y"
+  case 386: /* shared_type_item: T_ALL  */
+#line 1933 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = SHARED_ALL;
 }
-#line 5011 "conf_parser.c"
+#line 5506 "conf_parser.c"
     break;
 
-  case 372:
-#line 1865 "conf_parser.y"
+  case 387: /* $@18: %empty  */
+#line 1943 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5021,11 +5516,11 @@ yyreduce:
   strlcpy(block_state.name.buf, "*", sizeof(block_state.name.buf));
   block_state.flags.value = CLUSTER_ALL;
 }
-#line 5025 "conf_parser.c"
+#line 5520 "conf_parser.c"
     break;
 
-  case 373:
-#line 1874 "conf_parser.y"
+  case 388: /* cluster_entry: T_CLUSTER $@18 '{' cluster_items '}' ';'  */
+#line 1952 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5034,119 +5529,119 @@ yyreduce:
   cluster->type = block_state.flags.value;
   cluster->server = xstrdup(block_state.name.buf);
 }
-#line 5038 "conf_parser.c"
+#line 5533 "conf_parser.c"
     break;
 
-  case 379:
-#line 1887 "conf_parser.y"
+  case 394: /* cluster_name: NAME '=' QSTRING ';'  */
+#line 1965 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5047 "conf_parser.c"
+#line 5542 "conf_parser.c"
     break;
 
-  case 380:
-#line 1893 "conf_parser.y"
+  case 395: /* $@19: %empty  */
+#line 1971 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = 0;
 }
-#line 5056 "conf_parser.c"
+#line 5551 "conf_parser.c"
     break;
 
-  case 384:
-#line 1900 "conf_parser.y"
+  case 399: /* cluster_type_item: KLINE  */
+#line 1978 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_KLINE;
 }
-#line 5065 "conf_parser.c"
+#line 5560 "conf_parser.c"
     break;
 
-  case 385:
-#line 1904 "conf_parser.y"
+  case 400: /* cluster_type_item: UNKLINE  */
+#line 1982 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNKLINE;
 }
-#line 5074 "conf_parser.c"
+#line 5569 "conf_parser.c"
     break;
 
-  case 386:
-#line 1908 "conf_parser.y"
+  case 401: /* cluster_type_item: T_DLINE  */
+#line 1986 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_DLINE;
 }
-#line 5083 "conf_parser.c"
+#line 5578 "conf_parser.c"
     break;
 
-  case 387:
-#line 1912 "conf_parser.y"
+  case 402: /* cluster_type_item: T_UNDLINE  */
+#line 1990 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNDLINE;
 }
-#line 5092 "conf_parser.c"
+#line 5587 "conf_parser.c"
     break;
 
-  case 388:
-#line 1916 "conf_parser.y"
+  case 403: /* cluster_type_item: XLINE  */
+#line 1994 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_XLINE;
 }
-#line 5101 "conf_parser.c"
+#line 5596 "conf_parser.c"
     break;
 
-  case 389:
-#line 1920 "conf_parser.y"
+  case 404: /* cluster_type_item: T_UNXLINE  */
+#line 1998 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNXLINE;
 }
-#line 5110 "conf_parser.c"
+#line 5605 "conf_parser.c"
     break;
 
-  case 390:
-#line 1924 "conf_parser.y"
+  case 405: /* cluster_type_item: RESV  */
+#line 2002 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_RESV;
 }
-#line 5119 "conf_parser.c"
+#line 5614 "conf_parser.c"
     break;
 
-  case 391:
-#line 1928 "conf_parser.y"
+  case 406: /* cluster_type_item: T_UNRESV  */
+#line 2006 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_UNRESV;
 }
-#line 5128 "conf_parser.c"
+#line 5623 "conf_parser.c"
     break;
 
-  case 392:
-#line 1932 "conf_parser.y"
+  case 407: /* cluster_type_item: T_LOCOPS  */
+#line 2010 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CLUSTER_LOCOPS;
 }
-#line 5137 "conf_parser.c"
+#line 5632 "conf_parser.c"
     break;
 
-  case 393:
-#line 1936 "conf_parser.y"
+  case 408: /* cluster_type_item: T_ALL  */
+#line 2014 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value = CLUSTER_ALL;
 }
-#line 5146 "conf_parser.c"
+#line 5641 "conf_parser.c"
     break;
 
-  case 394:
-#line 1946 "conf_parser.y"
+  case 409: /* $@20: %empty  */
+#line 2024 "conf_parser.y"
 {
 
   if (conf_parser_ctx.pass != 2)
@@ -5157,11 +5652,11 @@ yyreduce:
   block_state.port.value = PORTNUM;
   block_state.timeout.value = CONNECTTIMEOUT;
 }
-#line 5161 "conf_parser.c"
+#line 5656 "conf_parser.c"
     break;
 
-  case 395:
-#line 1956 "conf_parser.y"
+  case 410: /* connect_entry: CONNECT $@20 '{' connect_items '}' ';'  */
+#line 2034 "conf_parser.y"
 {
   struct addrinfo hints, *res;
 
@@ -5228,47 +5723,47 @@ yyreduce:
   conf_add_class_to_conf(conf, block_state.class.buf);
   conf_dns_lookup(conf);
 }
-#line 5232 "conf_parser.c"
+#line 5727 "conf_parser.c"
     break;
 
-  case 414:
-#line 2042 "conf_parser.y"
+  case 429: /* connect_name: NAME '=' QSTRING ';'  */
+#line 2120 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5241 "conf_parser.c"
+#line 5736 "conf_parser.c"
     break;
 
-  case 415:
-#line 2048 "conf_parser.y"
+  case 430: /* connect_host: HOST '=' QSTRING ';'  */
+#line 2126 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.host.buf, yylval.string, sizeof(block_state.host.buf));
 }
-#line 5250 "conf_parser.c"
+#line 5745 "conf_parser.c"
     break;
 
-  case 416:
-#line 2054 "conf_parser.y"
+  case 431: /* connect_timeout: TIMEOUT '=' timespec ';'  */
+#line 2132 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.timeout.value = (yyvsp[-1].number);
 }
-#line 5259 "conf_parser.c"
+#line 5754 "conf_parser.c"
     break;
 
-  case 417:
-#line 2060 "conf_parser.y"
+  case 432: /* connect_bind: T_BIND '=' QSTRING ';'  */
+#line 2138 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.bind.buf, yylval.string, sizeof(block_state.bind.buf));
 }
-#line 5268 "conf_parser.c"
+#line 5763 "conf_parser.c"
     break;
 
-  case 418:
-#line 2066 "conf_parser.y"
+  case 433: /* connect_send_password: SEND_PASSWORD '=' QSTRING ';'  */
+#line 2144 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5280,11 +5775,11 @@ yyreduce:
   else
     strlcpy(block_state.spass.buf, yylval.string, sizeof(block_state.spass.buf));
 }
-#line 5284 "conf_parser.c"
+#line 5779 "conf_parser.c"
     break;
 
-  case 419:
-#line 2079 "conf_parser.y"
+  case 434: /* connect_accept_password: ACCEPT_PASSWORD '=' QSTRING ';'  */
+#line 2157 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5296,73 +5791,82 @@ yyreduce:
   else
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5300 "conf_parser.c"
+#line 5795 "conf_parser.c"
     break;
 
-  case 420:
-#line 2092 "conf_parser.y"
+  case 435: /* connect_tls_certificate_fingerprint: TLS_CERTIFICATE_FINGERPRINT '=' QSTRING ';'  */
+#line 2170 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.cert.buf, yylval.string, sizeof(block_state.cert.buf));
 }
-#line 5309 "conf_parser.c"
+#line 5804 "conf_parser.c"
     break;
 
-  case 421:
-#line 2098 "conf_parser.y"
+  case 436: /* connect_port: PORT '=' NUMBER ';'  */
+#line 2176 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.port.value = (yyvsp[-1].number);
 }
-#line 5318 "conf_parser.c"
+#line 5813 "conf_parser.c"
     break;
 
-  case 422:
-#line 2104 "conf_parser.y"
+  case 437: /* connect_aftype: AFTYPE '=' T_IPV4 ';'  */
+#line 2182 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET;
 }
-#line 5327 "conf_parser.c"
+#line 5822 "conf_parser.c"
     break;
 
-  case 423:
-#line 2108 "conf_parser.y"
+  case 438: /* connect_aftype: AFTYPE '=' T_IPV6 ';'  */
+#line 2186 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.aftype.value = AF_INET6;
 }
-#line 5336 "conf_parser.c"
+#line 5831 "conf_parser.c"
     break;
 
-  case 424:
-#line 2114 "conf_parser.y"
+  case 439: /* $@21: %empty  */
+#line 2192 "conf_parser.y"
 {
   block_state.flags.value &= CONF_FLAGS_ENCRYPTED;
 }
-#line 5344 "conf_parser.c"
+#line 5839 "conf_parser.c"
     break;
 
-  case 428:
-#line 2120 "conf_parser.y"
+  case 443: /* connect_flags_item: AUTOCONN  */
+#line 2198 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_ALLOW_AUTO_CONN;
 }
-#line 5353 "conf_parser.c"
+#line 5848 "conf_parser.c"
     break;
 
-  case 429:
-#line 2124 "conf_parser.y"
+  case 444: /* connect_flags_item: T_TLS  */
+#line 2202 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_TLS;
 }
-#line 5362 "conf_parser.c"
+#line 5857 "conf_parser.c"
     break;
 
-  case 430:
-#line 2130 "conf_parser.y"
+  case 445: /* connect_flags_item: T_COMPRESSED  */
+#line 2206 "conf_parser.y"
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_COMPRESSED;
+}
+#line 5866 "conf_parser.c"
+    break;
+
+  case 446: /* connect_encrypted: ENCRYPTED '=' TBOOL ';'  */
+#line 2212 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5372,38 +5876,38 @@ yyreduce:
       block_state.flags.value &= ~CONF_FLAGS_ENCRYPTED;
   }
 }
-#line 5376 "conf_parser.c"
+#line 5880 "conf_parser.c"
     break;
 
-  case 431:
-#line 2141 "conf_parser.y"
+  case 447: /* connect_hub_mask: HUB_MASK '=' QSTRING ';'  */
+#line 2223 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.hub.list);
 }
-#line 5385 "conf_parser.c"
+#line 5889 "conf_parser.c"
     break;
 
-  case 432:
-#line 2147 "conf_parser.y"
+  case 448: /* connect_leaf_mask: LEAF_MASK '=' QSTRING ';'  */
+#line 2229 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     dlinkAdd(xstrdup(yylval.string), make_dlink_node(), &block_state.leaf.list);
 }
-#line 5394 "conf_parser.c"
+#line 5898 "conf_parser.c"
     break;
 
-  case 433:
-#line 2153 "conf_parser.y"
+  case 449: /* connect_class: CLASS '=' QSTRING ';'  */
+#line 2235 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.class.buf, yylval.string, sizeof(block_state.class.buf));
 }
-#line 5403 "conf_parser.c"
+#line 5907 "conf_parser.c"
     break;
 
-  case 434:
-#line 2159 "conf_parser.y"
+  case 450: /* connect_tls_cipher_list: TLS_CIPHER_LIST '=' QSTRING ';'  */
+#line 2241 "conf_parser.y"
 {
 #ifdef HAVE_TLS
   if (conf_parser_ctx.pass == 2)
@@ -5413,20 +5917,20 @@ yyreduce:
     conf_error_report("Ignoring connect::tls_cipher_list -- no TLS support");
 #endif
 }
-#line 5417 "conf_parser.c"
+#line 5921 "conf_parser.c"
     break;
 
-  case 435:
-#line 2174 "conf_parser.y"
+  case 451: /* $@22: %empty  */
+#line 2256 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5426 "conf_parser.c"
+#line 5930 "conf_parser.c"
     break;
 
-  case 436:
-#line 2178 "conf_parser.y"
+  case 452: /* kill_entry: KILL $@22 '{' kill_items '}' ';'  */
+#line 2260 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5445,11 +5949,11 @@ yyreduce:
     conf->reason = xstrdup(CONF_NOREASON);
   add_conf_by_address(CONF_KLINE, conf);
 }
-#line 5449 "conf_parser.c"
+#line 5953 "conf_parser.c"
     break;
 
-  case 442:
-#line 2201 "conf_parser.y"
+  case 458: /* kill_user: USER '=' QSTRING ';'  */
+#line 2283 "conf_parser.y"
 {
 
   if (conf_parser_ctx.pass == 2)
@@ -5468,29 +5972,29 @@ yyreduce:
     split_nuh(&nuh);
   }
 }
-#line 5472 "conf_parser.c"
+#line 5976 "conf_parser.c"
     break;
 
-  case 443:
-#line 2221 "conf_parser.y"
+  case 459: /* kill_reason: REASON '=' QSTRING ';'  */
+#line 2303 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5481 "conf_parser.c"
+#line 5985 "conf_parser.c"
     break;
 
-  case 444:
-#line 2231 "conf_parser.y"
+  case 460: /* $@23: %empty  */
+#line 2313 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5490 "conf_parser.c"
+#line 5994 "conf_parser.c"
     break;
 
-  case 445:
-#line 2235 "conf_parser.y"
+  case 461: /* deny_entry: DENY $@23 '{' deny_items '}' ';'  */
+#line 2317 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5510,29 +6014,29 @@ yyreduce:
     add_conf_by_address(CONF_DLINE, conf);
   }
 }
-#line 5514 "conf_parser.c"
+#line 6018 "conf_parser.c"
     break;
 
-  case 451:
-#line 2259 "conf_parser.y"
+  case 467: /* deny_ip: IP '=' QSTRING ';'  */
+#line 2341 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.addr.buf, yylval.string, sizeof(block_state.addr.buf));
 }
-#line 5523 "conf_parser.c"
+#line 6027 "conf_parser.c"
     break;
 
-  case 452:
-#line 2265 "conf_parser.y"
+  case 468: /* deny_reason: REASON '=' QSTRING ';'  */
+#line 2347 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5532 "conf_parser.c"
+#line 6036 "conf_parser.c"
     break;
 
-  case 458:
-#line 2280 "conf_parser.y"
+  case 474: /* exempt_ip: IP '=' QSTRING ';'  */
+#line 2362 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -5545,20 +6049,20 @@ yyreduce:
     }
   }
 }
-#line 5549 "conf_parser.c"
+#line 6053 "conf_parser.c"
     break;
 
-  case 459:
-#line 2297 "conf_parser.y"
+  case 475: /* $@24: %empty  */
+#line 2379 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     reset_block_state();
 }
-#line 5558 "conf_parser.c"
+#line 6062 "conf_parser.c"
     break;
 
-  case 460:
-#line 2301 "conf_parser.y"
+  case 476: /* gecos_entry: GECOS $@24 '{' gecos_items '}' ';'  */
+#line 2383 "conf_parser.y"
 {
   if (conf_parser_ctx.pass != 2)
     break;
@@ -5566,862 +6070,893 @@ yyreduce:
   if (!block_state.name.buf[0])
     break;
 
-  struct GecosItem *gecos = gecos_make();
-  gecos->mask = xstrdup(block_state.name.buf);
+  struct GecosItem *gecos = gecos_make(block_state.name.buf);
 
   if (block_state.rpass.buf[0])
     gecos->reason = xstrdup(block_state.rpass.buf);
   else
     gecos->reason = xstrdup(CONF_NOREASON);
 }
-#line 5578 "conf_parser.c"
+#line 6081 "conf_parser.c"
     break;
 
-  case 466:
-#line 2321 "conf_parser.y"
+  case 482: /* gecos_name: NAME '=' QSTRING ';'  */
+#line 2402 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.name.buf, yylval.string, sizeof(block_state.name.buf));
 }
-#line 5587 "conf_parser.c"
+#line 6090 "conf_parser.c"
     break;
 
-  case 467:
-#line 2327 "conf_parser.y"
+  case 483: /* gecos_reason: REASON '=' QSTRING ';'  */
+#line 2408 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     strlcpy(block_state.rpass.buf, yylval.string, sizeof(block_state.rpass.buf));
 }
-#line 5596 "conf_parser.c"
+#line 6099 "conf_parser.c"
     break;
 
-  case 517:
-#line 2388 "conf_parser.y"
+  case 537: /* general_away_count: AWAY_COUNT '=' NUMBER ';'  */
+#line 2473 "conf_parser.y"
 {
   ConfigGeneral.away_count = (yyvsp[-1].number);
 }
-#line 5604 "conf_parser.c"
+#line 6107 "conf_parser.c"
     break;
 
-  case 518:
-#line 2393 "conf_parser.y"
+  case 538: /* general_away_time: AWAY_TIME '=' timespec ';'  */
+#line 2478 "conf_parser.y"
 {
   ConfigGeneral.away_time = (yyvsp[-1].number);
 }
-#line 5612 "conf_parser.c"
+#line 6115 "conf_parser.c"
     break;
 
-  case 519:
-#line 2398 "conf_parser.y"
+  case 539: /* general_max_monitor: MAX_MONITOR '=' NUMBER ';'  */
+#line 2483 "conf_parser.y"
 {
   ConfigGeneral.max_monitor = (yyvsp[-1].number);
 }
-#line 5620 "conf_parser.c"
+#line 6123 "conf_parser.c"
     break;
 
-  case 520:
-#line 2403 "conf_parser.y"
+  case 540: /* general_whowas_history_length: WHOWAS_HISTORY_LENGTH '=' NUMBER ';'  */
+#line 2488 "conf_parser.y"
 {
   ConfigGeneral.whowas_history_length = (yyvsp[-1].number);
 }
-#line 5628 "conf_parser.c"
+#line 6131 "conf_parser.c"
     break;
 
-  case 521:
-#line 2408 "conf_parser.y"
+  case 541: /* general_cycle_on_host_change: CYCLE_ON_HOST_CHANGE '=' TBOOL ';'  */
+#line 2493 "conf_parser.y"
 {
   ConfigGeneral.cycle_on_host_change = yylval.number;
 }
-#line 5636 "conf_parser.c"
+#line 6139 "conf_parser.c"
     break;
 
-  case 522:
-#line 2413 "conf_parser.y"
+  case 542: /* general_dline_min_cidr: DLINE_MIN_CIDR '=' NUMBER ';'  */
+#line 2498 "conf_parser.y"
 {
   ConfigGeneral.dline_min_cidr = (yyvsp[-1].number);
 }
-#line 5644 "conf_parser.c"
+#line 6147 "conf_parser.c"
     break;
 
-  case 523:
-#line 2418 "conf_parser.y"
+  case 543: /* general_dline_min_cidr6: DLINE_MIN_CIDR6 '=' NUMBER ';'  */
+#line 2503 "conf_parser.y"
 {
   ConfigGeneral.dline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5652 "conf_parser.c"
+#line 6155 "conf_parser.c"
     break;
 
-  case 524:
-#line 2423 "conf_parser.y"
+  case 544: /* general_kline_min_cidr: KLINE_MIN_CIDR '=' NUMBER ';'  */
+#line 2508 "conf_parser.y"
 {
   ConfigGeneral.kline_min_cidr = (yyvsp[-1].number);
 }
-#line 5660 "conf_parser.c"
+#line 6163 "conf_parser.c"
     break;
 
-  case 525:
-#line 2428 "conf_parser.y"
+  case 545: /* general_kline_min_cidr6: KLINE_MIN_CIDR6 '=' NUMBER ';'  */
+#line 2513 "conf_parser.y"
 {
   ConfigGeneral.kline_min_cidr6 = (yyvsp[-1].number);
 }
-#line 5668 "conf_parser.c"
+#line 6171 "conf_parser.c"
     break;
 
-  case 526:
-#line 2433 "conf_parser.y"
+  case 546: /* general_kill_chase_time_limit: KILL_CHASE_TIME_LIMIT '=' timespec ';'  */
+#line 2518 "conf_parser.y"
 {
   ConfigGeneral.kill_chase_time_limit = (yyvsp[-1].number);
 }
-#line 5676 "conf_parser.c"
+#line 6179 "conf_parser.c"
     break;
 
-  case 527:
-#line 2438 "conf_parser.y"
+  case 547: /* general_failed_oper_notice: FAILED_OPER_NOTICE '=' TBOOL ';'  */
+#line 2523 "conf_parser.y"
 {
   ConfigGeneral.failed_oper_notice = yylval.number;
 }
-#line 5684 "conf_parser.c"
+#line 6187 "conf_parser.c"
     break;
 
-  case 528:
-#line 2443 "conf_parser.y"
+  case 548: /* general_anti_nick_flood: ANTI_NICK_FLOOD '=' TBOOL ';'  */
+#line 2528 "conf_parser.y"
 {
   ConfigGeneral.anti_nick_flood = yylval.number;
 }
-#line 5692 "conf_parser.c"
+#line 6195 "conf_parser.c"
     break;
 
-  case 529:
-#line 2448 "conf_parser.y"
+  case 549: /* general_max_nick_time: MAX_NICK_TIME '=' timespec ';'  */
+#line 2533 "conf_parser.y"
 {
   ConfigGeneral.max_nick_time = (yyvsp[-1].number);
 }
-#line 5700 "conf_parser.c"
+#line 6203 "conf_parser.c"
     break;
 
-  case 530:
-#line 2453 "conf_parser.y"
+  case 550: /* general_max_nick_changes: MAX_NICK_CHANGES '=' NUMBER ';'  */
+#line 2538 "conf_parser.y"
 {
   ConfigGeneral.max_nick_changes = (yyvsp[-1].number);
 }
-#line 5708 "conf_parser.c"
+#line 6211 "conf_parser.c"
     break;
 
-  case 531:
-#line 2458 "conf_parser.y"
+  case 551: /* general_max_accept: MAX_ACCEPT '=' NUMBER ';'  */
+#line 2543 "conf_parser.y"
 {
   ConfigGeneral.max_accept = (yyvsp[-1].number);
 }
-#line 5716 "conf_parser.c"
+#line 6219 "conf_parser.c"
     break;
 
-  case 532:
-#line 2463 "conf_parser.y"
+  case 552: /* general_anti_spam_exit_message_time: ANTI_SPAM_EXIT_MESSAGE_TIME '=' timespec ';'  */
+#line 2548 "conf_parser.y"
 {
   ConfigGeneral.anti_spam_exit_message_time = (yyvsp[-1].number);
 }
-#line 5724 "conf_parser.c"
+#line 6227 "conf_parser.c"
     break;
 
-  case 533:
-#line 2468 "conf_parser.y"
+  case 553: /* general_ts_warn_delta: TS_WARN_DELTA '=' timespec ';'  */
+#line 2553 "conf_parser.y"
 {
   ConfigGeneral.ts_warn_delta = (yyvsp[-1].number);
 }
-#line 5732 "conf_parser.c"
+#line 6235 "conf_parser.c"
     break;
 
-  case 534:
-#line 2473 "conf_parser.y"
+  case 554: /* general_ts_max_delta: TS_MAX_DELTA '=' timespec ';'  */
+#line 2558 "conf_parser.y"
 {
   ConfigGeneral.ts_max_delta = (yyvsp[-1].number);
 }
-#line 5740 "conf_parser.c"
+#line 6243 "conf_parser.c"
     break;
 
-  case 535:
-#line 2478 "conf_parser.y"
+  case 555: /* general_invisible_on_connect: INVISIBLE_ON_CONNECT '=' TBOOL ';'  */
+#line 2563 "conf_parser.y"
 {
   ConfigGeneral.invisible_on_connect = yylval.number;
 }
-#line 5748 "conf_parser.c"
+#line 6251 "conf_parser.c"
     break;
 
-  case 536:
-#line 2483 "conf_parser.y"
+  case 556: /* general_warn_no_connect_block: WARN_NO_CONNECT_BLOCK '=' TBOOL ';'  */
+#line 2568 "conf_parser.y"
 {
   ConfigGeneral.warn_no_connect_block = yylval.number;
 }
-#line 5756 "conf_parser.c"
+#line 6259 "conf_parser.c"
     break;
 
-  case 537:
-#line 2488 "conf_parser.y"
+  case 557: /* general_stats_e_disabled: STATS_E_DISABLED '=' TBOOL ';'  */
+#line 2573 "conf_parser.y"
 {
   ConfigGeneral.stats_e_disabled = yylval.number;
 }
-#line 5764 "conf_parser.c"
+#line 6267 "conf_parser.c"
     break;
 
-  case 538:
-#line 2493 "conf_parser.y"
+  case 558: /* general_stats_m_oper_only: STATS_M_OPER_ONLY '=' TBOOL ';'  */
+#line 2578 "conf_parser.y"
 {
   ConfigGeneral.stats_m_oper_only = yylval.number;
 }
-#line 5772 "conf_parser.c"
+#line 6275 "conf_parser.c"
     break;
 
-  case 539:
-#line 2498 "conf_parser.y"
+  case 559: /* general_stats_o_oper_only: STATS_O_OPER_ONLY '=' TBOOL ';'  */
+#line 2583 "conf_parser.y"
 {
   ConfigGeneral.stats_o_oper_only = yylval.number;
 }
-#line 5780 "conf_parser.c"
+#line 6283 "conf_parser.c"
     break;
 
-  case 540:
-#line 2503 "conf_parser.y"
+  case 560: /* general_stats_P_oper_only: STATS_P_OPER_ONLY '=' TBOOL ';'  */
+#line 2588 "conf_parser.y"
 {
   ConfigGeneral.stats_P_oper_only = yylval.number;
 }
-#line 5788 "conf_parser.c"
+#line 6291 "conf_parser.c"
     break;
 
-  case 541:
-#line 2508 "conf_parser.y"
+  case 561: /* general_stats_u_oper_only: STATS_U_OPER_ONLY '=' TBOOL ';'  */
+#line 2593 "conf_parser.y"
 {
   ConfigGeneral.stats_u_oper_only = yylval.number;
 }
-#line 5796 "conf_parser.c"
+#line 6299 "conf_parser.c"
     break;
 
-  case 542:
-#line 2513 "conf_parser.y"
+  case 562: /* general_stats_k_oper_only: STATS_K_OPER_ONLY '=' TBOOL ';'  */
+#line 2598 "conf_parser.y"
 {
   ConfigGeneral.stats_k_oper_only = yylval.number;
 }
-#line 5804 "conf_parser.c"
+#line 6307 "conf_parser.c"
     break;
 
-  case 543:
-#line 2518 "conf_parser.y"
+  case 563: /* general_stats_i_oper_only: STATS_I_OPER_ONLY '=' TBOOL ';'  */
+#line 2603 "conf_parser.y"
 {
   ConfigGeneral.stats_i_oper_only = yylval.number;
 }
-#line 5812 "conf_parser.c"
+#line 6315 "conf_parser.c"
     break;
 
-  case 544:
-#line 2523 "conf_parser.y"
+  case 564: /* general_pace_wait: PACE_WAIT '=' timespec ';'  */
+#line 2608 "conf_parser.y"
 {
   ConfigGeneral.pace_wait = (yyvsp[-1].number);
 }
-#line 5820 "conf_parser.c"
+#line 6323 "conf_parser.c"
     break;
 
-  case 545:
-#line 2528 "conf_parser.y"
+  case 565: /* general_caller_id_wait: CALLER_ID_WAIT '=' timespec ';'  */
+#line 2613 "conf_parser.y"
 {
   ConfigGeneral.caller_id_wait = (yyvsp[-1].number);
 }
-#line 5828 "conf_parser.c"
+#line 6331 "conf_parser.c"
     break;
 
-  case 546:
-#line 2533 "conf_parser.y"
+  case 566: /* general_opers_bypass_callerid: OPERS_BYPASS_CALLERID '=' TBOOL ';'  */
+#line 2618 "conf_parser.y"
 {
   ConfigGeneral.opers_bypass_callerid = yylval.number;
 }
-#line 5836 "conf_parser.c"
+#line 6339 "conf_parser.c"
     break;
 
-  case 547:
-#line 2538 "conf_parser.y"
+  case 567: /* general_pace_wait_simple: PACE_WAIT_SIMPLE '=' timespec ';'  */
+#line 2623 "conf_parser.y"
 {
   ConfigGeneral.pace_wait_simple = (yyvsp[-1].number);
 }
-#line 5844 "conf_parser.c"
+#line 6347 "conf_parser.c"
     break;
 
-  case 548:
-#line 2543 "conf_parser.y"
+  case 568: /* general_short_motd: SHORT_MOTD '=' TBOOL ';'  */
+#line 2628 "conf_parser.y"
 {
   ConfigGeneral.short_motd = yylval.number;
 }
-#line 5852 "conf_parser.c"
+#line 6355 "conf_parser.c"
     break;
 
-  case 549:
-#line 2548 "conf_parser.y"
+  case 569: /* general_no_oper_flood: NO_OPER_FLOOD '=' TBOOL ';'  */
+#line 2633 "conf_parser.y"
 {
   ConfigGeneral.no_oper_flood = yylval.number;
 }
-#line 5860 "conf_parser.c"
+#line 6363 "conf_parser.c"
     break;
 
-  case 550:
-#line 2553 "conf_parser.y"
+  case 570: /* general_dots_in_ident: DOTS_IN_IDENT '=' NUMBER ';'  */
+#line 2638 "conf_parser.y"
 {
   ConfigGeneral.dots_in_ident = (yyvsp[-1].number);
 }
-#line 5868 "conf_parser.c"
+#line 6371 "conf_parser.c"
     break;
 
-  case 551:
-#line 2558 "conf_parser.y"
+  case 571: /* general_max_targets: MAX_TARGETS '=' NUMBER ';'  */
+#line 2643 "conf_parser.y"
 {
   ConfigGeneral.max_targets = (yyvsp[-1].number);
 }
-#line 5876 "conf_parser.c"
+#line 6379 "conf_parser.c"
     break;
 
-  case 552:
-#line 2563 "conf_parser.y"
+  case 572: /* general_ping_cookie: PING_COOKIE '=' TBOOL ';'  */
+#line 2648 "conf_parser.y"
 {
   ConfigGeneral.ping_cookie = yylval.number;
 }
-#line 5884 "conf_parser.c"
+#line 6387 "conf_parser.c"
     break;
 
-  case 553:
-#line 2568 "conf_parser.y"
+  case 573: /* general_disable_auth: DISABLE_AUTH '=' TBOOL ';'  */
+#line 2653 "conf_parser.y"
 {
   ConfigGeneral.disable_auth = yylval.number;
 }
-#line 5892 "conf_parser.c"
+#line 6395 "conf_parser.c"
     break;
 
-  case 554:
-#line 2573 "conf_parser.y"
+  case 574: /* general_auth_timeout: AUTH_TIMEOUT '=' timespec ';'  */
+#line 2658 "conf_parser.y"
+{
+  ConfigGeneral.auth_timeout = (yyvsp[-1].number);
+}
+#line 6403 "conf_parser.c"
+    break;
+
+  case 575: /* general_ident_timeout: IDENT_TIMEOUT '=' timespec ';'  */
+#line 2663 "conf_parser.y"
+{
+  ConfigGeneral.ident_timeout = (yyvsp[-1].number);
+}
+#line 6411 "conf_parser.c"
+    break;
+
+  case 576: /* general_ident_cache_time: IDENT_CACHE_TIME '=' timespec ';'  */
+#line 2668 "conf_parser.y"
+{
+  ConfigGeneral.ident_cache_time = (yyvsp[-1].number);
+}
+#line 6419 "conf_parser.c"
+    break;
+
+  case 577: /* general_ident_max_pending: IDENT_MAX_PENDING '=' NUMBER ';'  */
+#line 2673 "conf_parser.y"
+{
+  ConfigGeneral.ident_max_pending = (yyvsp[-1].number);
+}
+#line 6427 "conf_parser.c"
+    break;
+
+  case 578: /* general_throttle_count: THROTTLE_COUNT '=' NUMBER ';'  */
+#line 2678 "conf_parser.y"
 {
   ConfigGeneral.throttle_count = (yyvsp[-1].number);
 }
-#line 5900 "conf_parser.c"
+#line 6435 "conf_parser.c"
     break;
 
-  case 555:
-#line 2578 "conf_parser.y"
+  case 579: /* general_throttle_time: THROTTLE_TIME '=' timespec ';'  */
+#line 2683 "conf_parser.y"
 {
   ConfigGeneral.throttle_time = (yyvsp[-1].number);
 }
-#line 5908 "conf_parser.c"
+#line 6443 "conf_parser.c"
     break;
 
-  case 556:
-#line 2583 "conf_parser.y"
+  case 580: /* $@25: %empty  */
+#line 2688 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes = 0;
 }
-#line 5916 "conf_parser.c"
+#line 6451 "conf_parser.c"
     break;
 
-  case 560:
-#line 2589 "conf_parser.y"
+  case 584: /* umode_oitem: BOT  */
+#line 2694 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_BOT;
 }
-#line 5924 "conf_parser.c"
+#line 6459 "conf_parser.c"
     break;
 
-  case 561:
-#line 2592 "conf_parser.y"
+  case 585: /* umode_oitem: T_CCONN  */
+#line 2697 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_CCONN;
 }
-#line 5932 "conf_parser.c"
+#line 6467 "conf_parser.c"
     break;
 
-  case 562:
-#line 2595 "conf_parser.y"
+  case 586: /* umode_oitem: T_DEAF  */
+#line 2700 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_DEAF;
 }
-#line 5940 "conf_parser.c"
+#line 6475 "conf_parser.c"
     break;
 
-  case 563:
-#line 2598 "conf_parser.y"
+  case 587: /* umode_oitem: T_DEBUG  */
+#line 2703 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_DEBUG;
 }
-#line 5948 "conf_parser.c"
+#line 6483 "conf_parser.c"
     break;
 
-  case 564:
-#line 2601 "conf_parser.y"
+  case 588: /* umode_oitem: T_FLOOD  */
+#line 2706 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_FLOOD;
 }
-#line 5956 "conf_parser.c"
+#line 6491 "conf_parser.c"
     break;
 
-  case 565:
-#line 2604 "conf_parser.y"
+  case 589: /* umode_oitem: HIDDEN  */
+#line 2709 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_HIDDEN;
 }
-#line 5964 "conf_parser.c"
+#line 6499 "conf_parser.c"
     break;
 
-  case 566:
-#line 2607 "conf_parser.y"
+  case 590: /* umode_oitem: HIDE_CHANS  */
+#line 2712 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_HIDECHANS;
 }
-#line 5972 "conf_parser.c"
+#line 6507 "conf_parser.c"
     break;
 
-  case 567:
-#line 2610 "conf_parser.y"
+  case 591: /* umode_oitem: HIDE_IDLE  */
+#line 2715 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_HIDEIDLE;
 }
-#line 5980 "conf_parser.c"
+#line 6515 "conf_parser.c"
     break;
 
-  case 568:
-#line 2613 "conf_parser.y"
+  case 592: /* umode_oitem: T_SKILL  */
+#line 2718 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_SKILL;
 }
-#line 5988 "conf_parser.c"
+#line 6523 "conf_parser.c"
     break;
 
-  case 569:
-#line 2616 "conf_parser.y"
+  case 593: /* umode_oitem: T_NCHANGE  */
+#line 2721 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_NCHANGE;
 }
-#line 5996 "conf_parser.c"
+#line 6531 "conf_parser.c"
     break;
 
-  case 570:
-#line 2619 "conf_parser.y"
+  case 594: /* umode_oitem: T_REJ  */
+#line 2724 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_REJ;
 }
-#line 6004 "conf_parser.c"
+#line 6539 "conf_parser.c"
     break;
 
-  case 571:
-#line 2622 "conf_parser.y"
+  case 595: /* umode_oitem: T_SPY  */
+#line 2727 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_SPY;
 }
-#line 6012 "conf_parser.c"
+#line 6547 "conf_parser.c"
     break;
 
-  case 572:
-#line 2625 "conf_parser.y"
+  case 596: /* umode_oitem: T_EXTERNAL  */
+#line 2730 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_EXTERNAL;
 }
-#line 6020 "conf_parser.c"
+#line 6555 "conf_parser.c"
     break;
 
-  case 573:
-#line 2628 "conf_parser.y"
+  case 597: /* umode_oitem: T_SERVNOTICE  */
+#line 2733 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_SERVNOTICE;
 }
-#line 6028 "conf_parser.c"
+#line 6563 "conf_parser.c"
     break;
 
-  case 574:
-#line 2631 "conf_parser.y"
+  case 598: /* umode_oitem: T_INVISIBLE  */
+#line 2736 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_INVISIBLE;
 }
-#line 6036 "conf_parser.c"
+#line 6571 "conf_parser.c"
     break;
 
-  case 575:
-#line 2634 "conf_parser.y"
+  case 599: /* umode_oitem: T_WALLOP  */
+#line 2739 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_WALLOP;
 }
-#line 6044 "conf_parser.c"
+#line 6579 "conf_parser.c"
     break;
 
-  case 576:
-#line 2637 "conf_parser.y"
+  case 600: /* umode_oitem: T_SOFTCALLERID  */
+#line 2742 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6052 "conf_parser.c"
+#line 6587 "conf_parser.c"
     break;
 
-  case 577:
-#line 2640 "conf_parser.y"
+  case 601: /* umode_oitem: T_CALLERID  */
+#line 2745 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_CALLERID;
 }
-#line 6060 "conf_parser.c"
+#line 6595 "conf_parser.c"
     break;
 
-  case 578:
-#line 2643 "conf_parser.y"
+  case 602: /* umode_oitem: T_LOCOPS  */
+#line 2748 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_LOCOPS;
 }
-#line 6068 "conf_parser.c"
+#line 6603 "conf_parser.c"
     break;
 
-  case 579:
-#line 2646 "conf_parser.y"
+  case 603: /* umode_oitem: T_NONONREG  */
+#line 2751 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_REGONLY;
 }
-#line 6076 "conf_parser.c"
+#line 6611 "conf_parser.c"
     break;
 
-  case 580:
-#line 2649 "conf_parser.y"
+  case 604: /* umode_oitem: T_FARCONNECT  */
+#line 2754 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_FARCONNECT;
 }
-#line 6084 "conf_parser.c"
+#line 6619 "conf_parser.c"
     break;
 
-  case 581:
-#line 2652 "conf_parser.y"
+  case 605: /* umode_oitem: EXPIRATION  */
+#line 2757 "conf_parser.y"
 {
   ConfigGeneral.oper_umodes |= UMODE_EXPIRATION;
 }
-#line 6092 "conf_parser.c"
+#line 6627 "conf_parser.c"
     break;
 
-  case 582:
-#line 2657 "conf_parser.y"
+  case 606: /* $@26: %empty  */
+#line 2762 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes = 0;
 }
-#line 6100 "conf_parser.c"
+#line 6635 "conf_parser.c"
     break;
 
-  case 586:
-#line 2663 "conf_parser.y"
+  case 610: /* umode_item: BOT  */
+#line 2768 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_BOT;
 }
-#line 6108 "conf_parser.c"
+#line 6643 "conf_parser.c"
     break;
 
-  case 587:
-#line 2666 "conf_parser.y"
+  case 611: /* umode_item: T_CCONN  */
+#line 2771 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_CCONN;
 }
-#line 6116 "conf_parser.c"
+#line 6651 "conf_parser.c"
     break;
 
-  case 588:
-#line 2669 "conf_parser.y"
+  case 612: /* umode_item: T_DEAF  */
+#line 2774 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_DEAF;
 }
-#line 6124 "conf_parser.c"
+#line 6659 "conf_parser.c"
     break;
 
-  case 589:
-#line 2672 "conf_parser.y"
+  case 613: /* umode_item: T_DEBUG  */
+#line 2777 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_DEBUG;
 }
-#line 6132 "conf_parser.c"
+#line 6667 "conf_parser.c"
     break;
 
-  case 590:
-#line 2675 "conf_parser.y"
+  case 614: /* umode_item: T_FLOOD  */
+#line 2780 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_FLOOD;
 }
-#line 6140 "conf_parser.c"
+#line 6675 "conf_parser.c"
     break;
 
-  case 591:
-#line 2678 "conf_parser.y"
+  case 615: /* umode_item: T_SKILL  */
+#line 2783 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_SKILL;
 }
-#line 6148 "conf_parser.c"
+#line 6683 "conf_parser.c"
     break;
 
-  case 592:
-#line 2681 "conf_parser.y"
+  case 616: /* umode_item: HIDDEN  */
+#line 2786 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_HIDDEN;
 }
-#line 6156 "conf_parser.c"
+#line 6691 "conf_parser.c"
     break;
 
-  case 593:
-#line 2684 "conf_parser.y"
+  case 617: /* umode_item: T_NCHANGE  */
+#line 2789 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_NCHANGE;
 }
-#line 6164 "conf_parser.c"
+#line 6699 "conf_parser.c"
     break;
 
-  case 594:
-#line 2687 "conf_parser.y"
+  case 618: /* umode_item: T_REJ  */
+#line 2792 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_REJ;
 }
-#line 6172 "conf_parser.c"
+#line 6707 "conf_parser.c"
     break;
 
-  case 595:
-#line 2690 "conf_parser.y"
+  case 619: /* umode_item: T_SPY  */
+#line 2795 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_SPY;
 }
-#line 6180 "conf_parser.c"
+#line 6715 "conf_parser.c"
     break;
 
-  case 596:
-#line 2693 "conf_parser.y"
+  case 620: /* umode_item: T_EXTERNAL  */
+#line 2798 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_EXTERNAL;
 }
-#line 6188 "conf_parser.c"
+#line 6723 "conf_parser.c"
     break;
 
-  case 597:
-#line 2696 "conf_parser.y"
+  case 621: /* umode_item: T_SERVNOTICE  */
+#line 2801 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_SERVNOTICE;
 }
-#line 6196 "conf_parser.c"
+#line 6731 "conf_parser.c"
     break;
 
-  case 598:
-#line 2699 "conf_parser.y"
+  case 622: /* umode_item: T_INVISIBLE  */
+#line 2804 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_INVISIBLE;
 }
-#line 6204 "conf_parser.c"
+#line 6739 "conf_parser.c"
     break;
 
-  case 599:
-#line 2702 "conf_parser.y"
+  case 623: /* umode_item: T_WALLOP  */
+#line 2807 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_WALLOP;
 }
-#line 6212 "conf_parser.c"
+#line 6747 "conf_parser.c"
     break;
 
-  case 600:
-#line 2705 "conf_parser.y"
+  case 624: /* umode_item: T_SOFTCALLERID  */
+#line 2810 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_SOFTCALLERID;
 }
-#line 6220 "conf_parser.c"
+#line 6755 "conf_parser.c"
     break;
 
-  case 601:
-#line 2708 "conf_parser.y"
+  case 625: /* umode_item: T_CALLERID  */
+#line 2813 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_CALLERID;
 }
-#line 6228 "conf_parser.c"
+#line 6763 "conf_parser.c"
     break;
 
-  case 602:
-#line 2711 "conf_parser.y"
+  case 626: /* umode_item: T_LOCOPS  */
+#line 2816 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_LOCOPS;
 }
-#line 6236 "conf_parser.c"
+#line 6771 "conf_parser.c"
     break;
 
-  case 603:
-#line 2714 "conf_parser.y"
+  case 627: /* umode_item: T_NONONREG  */
+#line 2819 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_REGONLY;
 }
-#line 6244 "conf_parser.c"
+#line 6779 "conf_parser.c"
     break;
 
-  case 604:
-#line 2717 "conf_parser.y"
+  case 628: /* umode_item: T_FARCONNECT  */
+#line 2822 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_FARCONNECT;
 }
-#line 6252 "conf_parser.c"
+#line 6787 "conf_parser.c"
     break;
 
-  case 605:
-#line 2720 "conf_parser.y"
+  case 629: /* umode_item: EXPIRATION  */
+#line 2825 "conf_parser.y"
 {
   ConfigGeneral.oper_only_umodes |= UMODE_EXPIRATION;
 }
-#line 6260 "conf_parser.c"
+#line 6795 "conf_parser.c"
     break;
 
-  case 606:
-#line 2725 "conf_parser.y"
+  case 630: /* general_min_nonwildcard: MIN_NONWILDCARD '=' NUMBER ';'  */
+#line 2830 "conf_parser.y"
 {
   ConfigGeneral.min_nonwildcard = (yyvsp[-1].number);
 }
-#line 6268 "conf_parser.c"
+#line 6803 "conf_parser.c"
     break;
 
-  case 607:
-#line 2730 "conf_parser.y"
+  case 631: /* general_min_nonwildcard_simple: MIN_NONWILDCARD_SIMPLE '=' NUMBER ';'  */
+#line 2835 "conf_parser.y"
 {
   ConfigGeneral.min_nonwildcard_simple = (yyvsp[-1].number);
 }
-#line 6276 "conf_parser.c"
+#line 6811 "conf_parser.c"
     break;
 
-  case 608:
-#line 2735 "conf_parser.y"
+  case 632: /* general_default_floodcount: DEFAULT_FLOODCOUNT '=' NUMBER ';'  */
+#line 2840 "conf_parser.y"
 {
   ConfigGeneral.default_floodcount = (yyvsp[-1].number);
 }
-#line 6284 "conf_parser.c"
+#line 6819 "conf_parser.c"
     break;
 
-  case 609:
-#line 2740 "conf_parser.y"
+  case 633: /* general_default_floodtime: DEFAULT_FLOODTIME '=' timespec ';'  */
+#line 2845 "conf_parser.y"
 {
   ConfigGeneral.default_floodtime = (yyvsp[-1].number);
 }
-#line 6292 "conf_parser.c"
+#line 6827 "conf_parser.c"
     break;
 
-  case 629:
-#line 2769 "conf_parser.y"
+  case 653: /* channel_enable_extbans: ENABLE_EXTBANS '=' TBOOL ';'  */
+#line 2874 "conf_parser.y"
 {
   ConfigChannel.enable_extbans = yylval.number;
 }
-#line 6300 "conf_parser.c"
+#line 6835 "conf_parser.c"
     break;
 
-  case 630:
-#line 2774 "conf_parser.y"
+  case 654: /* channel_disable_fake_channels: DISABLE_FAKE_CHANNELS '=' TBOOL ';'  */
+#line 2879 "conf_parser.y"
 {
   ConfigChannel.disable_fake_channels = yylval.number;
 }
-#line 6308 "conf_parser.c"
+#line 6843 "conf_parser.c"
     break;
 
-  case 631:
-#line 2779 "conf_parser.y"
+  case 655: /* channel_invite_client_count: INVITE_CLIENT_COUNT '=' NUMBER ';'  */
+#line 2884 "conf_parser.y"
 {
   ConfigChannel.invite_client_count = (yyvsp[-1].number);
 }
-#line 6316 "conf_parser.c"
+#line 6851 "conf_parser.c"
     break;
 
-  case 632:
-#line 2784 "conf_parser.y"
+  case 656: /* channel_invite_client_time: INVITE_CLIENT_TIME '=' timespec ';'  */
+#line 2889 "conf_parser.y"
 {
   ConfigChannel.invite_client_time = (yyvsp[-1].number);
 }
-#line 6324 "conf_parser.c"
+#line 6859 "conf_parser.c"
     break;
 
-  case 633:
-#line 2789 "conf_parser.y"
+  case 657: /* channel_invite_delay_channel: INVITE_DELAY_CHANNEL '=' timespec ';'  */
+#line 2894 "conf_parser.y"
 {
   ConfigChannel.invite_delay_channel = (yyvsp[-1].number);
 }
-#line 6332 "conf_parser.c"
+#line 6867 "conf_parser.c"
     break;
 
-  case 634:
-#line 2794 "conf_parser.y"
+  case 658: /* channel_invite_expire_time: INVITE_EXPIRE_TIME '=' timespec ';'  */
+#line 2899 "conf_parser.y"
 {
   ConfigChannel.invite_expire_time = (yyvsp[-1].number);
 }
-#line 6340 "conf_parser.c"
+#line 6875 "conf_parser.c"
     break;
 
-  case 635:
-#line 2799 "conf_parser.y"
+  case 659: /* channel_knock_client_count: KNOCK_CLIENT_COUNT '=' NUMBER ';'  */
+#line 2904 "conf_parser.y"
 {
   ConfigChannel.knock_client_count = (yyvsp[-1].number);
 }
-#line 6348 "conf_parser.c"
+#line 6883 "conf_parser.c"
     break;
 
-  case 636:
-#line 2804 "conf_parser.y"
+  case 660: /* channel_knock_client_time: KNOCK_CLIENT_TIME '=' timespec ';'  */
+#line 2909 "conf_parser.y"
 {
   ConfigChannel.knock_client_time = (yyvsp[-1].number);
 }
-#line 6356 "conf_parser.c"
+#line 6891 "conf_parser.c"
     break;
 
-  case 637:
-#line 2809 "conf_parser.y"
+  case 661: /* channel_knock_delay_channel: KNOCK_DELAY_CHANNEL '=' timespec ';'  */
+#line 2914 "conf_parser.y"
 {
   ConfigChannel.knock_delay_channel = (yyvsp[-1].number);
 }
-#line 6364 "conf_parser.c"
+#line 6899 "conf_parser.c"
     break;
 
-  case 638:
-#line 2814 "conf_parser.y"
+  case 662: /* channel_max_channels: MAX_CHANNELS '=' NUMBER ';'  */
+#line 2919 "conf_parser.y"
 {
   ConfigChannel.max_channels = (yyvsp[-1].number);
 }
-#line 6372 "conf_parser.c"
+#line 6907 "conf_parser.c"
     break;
 
-  case 639:
-#line 2819 "conf_parser.y"
+  case 663: /* channel_max_invites: MAX_INVITES '=' NUMBER ';'  */
+#line 2924 "conf_parser.y"
 {
   ConfigChannel.max_invites = (yyvsp[-1].number);
 }
-#line 6380 "conf_parser.c"
+#line 6915 "conf_parser.c"
     break;
 
-  case 640:
-#line 2824 "conf_parser.y"
+  case 664: /* channel_max_bans: MAX_BANS '=' NUMBER ';'  */
+#line 2929 "conf_parser.y"
 {
   ConfigChannel.max_bans = (yyvsp[-1].number);
 }
-#line 6388 "conf_parser.c"
+#line 6923 "conf_parser.c"
     break;
 
-  case 641:
-#line 2829 "conf_parser.y"
+  case 665: /* channel_max_bans_large: MAX_BANS_LARGE '=' NUMBER ';'  */
+#line 2934 "conf_parser.y"
 {
   ConfigChannel.max_bans_large = (yyvsp[-1].number);
 }
-#line 6396 "conf_parser.c"
+#line 6931 "conf_parser.c"
     break;
 
-  case 642:
-#line 2834 "conf_parser.y"
+  case 666: /* channel_default_join_flood_count: DEFAULT_JOIN_FLOOD_COUNT '=' NUMBER ';'  */
+#line 2939 "conf_parser.y"
 {
   ConfigChannel.default_join_flood_count = yylval.number;
 }
-#line 6404 "conf_parser.c"
+#line 6939 "conf_parser.c"
     break;
 
-  case 643:
-#line 2839 "conf_parser.y"
+  case 667: /* channel_default_join_flood_time: DEFAULT_JOIN_FLOOD_TIME '=' timespec ';'  */
+#line 2944 "conf_parser.y"
 {
   ConfigChannel.default_join_flood_time = (yyvsp[-1].number);
 }
-#line 6412 "conf_parser.c"
+#line 6947 "conf_parser.c"
     break;
 
-  case 657:
-#line 2862 "conf_parser.y"
+  case 681: /* serverhide_flatten_links: FLATTEN_LINKS '=' TBOOL ';'  */
+#line 2967 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.flatten_links = yylval.number;
 }
-#line 6421 "conf_parser.c"
+#line 6956 "conf_parser.c"
     break;
 
-  case 658:
-#line 2868 "conf_parser.y"
+  case 682: /* serverhide_flatten_links_delay: FLATTEN_LINKS_DELAY '=' timespec ';'  */
+#line 2973 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6436,11 +6971,11 @@ yyreduce:
     ConfigServerHide.flatten_links_delay = (yyvsp[-1].number);
   }
 }
-#line 6440 "conf_parser.c"
+#line 6975 "conf_parser.c"
     break;
 
-  case 659:
-#line 2884 "conf_parser.y"
+  case 683: /* serverhide_flatten_links_file: FLATTEN_LINKS_FILE '=' QSTRING ';'  */
+#line 2989 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6448,38 +6983,38 @@ yyreduce:
     ConfigServerHide.flatten_links_file = xstrdup(yylval.string);
   }
 }
-#line 6452 "conf_parser.c"
+#line 6987 "conf_parser.c"
     break;
 
-  case 660:
-#line 2893 "conf_parser.y"
+  case 684: /* serverhide_disable_remote_commands: DISABLE_REMOTE_COMMANDS '=' TBOOL ';'  */
+#line 2998 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.disable_remote_commands = yylval.number;
 }
-#line 6461 "conf_parser.c"
+#line 6996 "conf_parser.c"
     break;
 
-  case 661:
-#line 2899 "conf_parser.y"
+  case 685: /* serverhide_hide_servers: HIDE_SERVERS '=' TBOOL ';'  */
+#line 3004 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_servers = yylval.number;
 }
-#line 6470 "conf_parser.c"
+#line 7005 "conf_parser.c"
     break;
 
-  case 662:
-#line 2905 "conf_parser.y"
+  case 686: /* serverhide_hide_services: HIDE_SERVICES '=' TBOOL ';'  */
+#line 3010 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_services = yylval.number;
 }
-#line 6479 "conf_parser.c"
+#line 7014 "conf_parser.c"
     break;
 
-  case 663:
-#line 2911 "conf_parser.y"
+  case 687: /* serverhide_hidden_name: HIDDEN_NAME '=' QSTRING ';'  */
+#line 3016 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
   {
@@ -6487,29 +7022,29 @@ yyreduce:
     ConfigServerHide.hidden_name = xstrdup(yylval.string);
   }
 }
-#line 6491 "conf_parser.c"
+#line 7026 "conf_parser.c"
     break;
 
-  case 664:
-#line 2920 "conf_parser.y"
+  case 688: /* serverhide_hidden: HIDDEN '=' TBOOL ';'  */
+#line 3025 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hidden = yylval.number;
 }
-#line 6500 "conf_parser.c"
+#line 7035 "conf_parser.c"
     break;
 
-  case 665:
-#line 2926 "conf_parser.y"
+  case 689: /* serverhide_hide_server_ips: HIDE_SERVER_IPS '=' TBOOL ';'  */
+#line 3031 "conf_parser.y"
 {
   if (conf_parser_ctx.pass == 2)
     ConfigServerHide.hide_server_ips = yylval.number;
 }
-#line 6509 "conf_parser.c"
+#line 7044 "conf_parser.c"
     break;
 
 
-#line 6513 "conf_parser.c"
+#line 7048 "conf_parser.c"
 
       default: break;
     }
@@ -6524,11 +7059,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
@@ -6552,50 +7086,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -6628,6 +7126,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -6644,13 +7143,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -6664,7 +7164,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -6676,7 +7176,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6687,7 +7187,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -6695,24 +7195,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -6728,16 +7226,14 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
+
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,8 +31,9 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 #ifndef YY_YY_CONF_PARSER_H_INCLUDED
 # define YY_YY_CONF_PARSER_H_INCLUDED
@@ -44,483 +45,518 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ACCEPT_PASSWORD = 258,
-    ADMIN = 259,
-    AFTYPE = 260,
-    ANTI_NICK_FLOOD = 261,
-    ANTI_SPAM_EXIT_MESSAGE_TIME = 262,
-    AUTOCONN = 263,
-    AWAY_COUNT = 264,
-    AWAY_TIME = 265,
-    BOT = 266,
-    BYTES = 267,
-    KBYTES = 268,
-    MBYTES = 269,
-    CALLER_ID_WAIT = 270,
-    CAN_FLOOD = 271,
-    CHANNEL = 272,
-    CIDR_BITLEN_IPV4 = 273,
-    CIDR_BITLEN_IPV6 = 274,
-    CLASS = 275,
-    CLIENT = 276,
-    CLOSE = 277,
-    CONNECT = 278,
-    CONNECTFREQ = 279,
-    CYCLE_ON_HOST_CHANGE = 280,
-    DEFAULT_FLOODCOUNT = 281,
-    DEFAULT_FLOODTIME = 282,
-    DEFAULT_JOIN_FLOOD_COUNT = 283,
-    DEFAULT_JOIN_FLOOD_TIME = 284,
-    DEFAULT_MAX_CLIENTS = 285,
-    DEFER = 286,
-    DENY = 287,
-    DESCRIPTION = 288,
-    DIE = 289,
-    DISABLE_AUTH = 290,
-    DISABLE_FAKE_CHANNELS = 291,
-    DISABLE_REMOTE_COMMANDS = 292,
-    DLINE_MIN_CIDR = 293,
-    DLINE_MIN_CIDR6 = 294,
-    DOTS_IN_IDENT = 295,
-    EMAIL = 296,
-    ENABLE_EXTBANS = 297,
-    ENCRYPTED = 298,
-    EXCEED_LIMIT = 299,
-    EXEMPT = 300,
-    EXPIRATION = 301,
-    FAILED_OPER_NOTICE = 302,
-    FLATTEN_LINKS = 303,
-    FLATTEN_LINKS_DELAY = 304,
-    FLATTEN_LINKS_FILE = 305,
-    GECOS = 306,
-    GENERAL = 307,
-    HIDDEN = 308,
-    HIDDEN_NAME = 309,
-    HIDE_CHANS = 310,
-    HIDE_IDLE = 311,
-    HIDE_IDLE_FROM_OPERS = 312,
-    HIDE_SERVER_IPS = 313,
-    HIDE_SERVERS = 314,
-    HIDE_SERVICES = 315,
-    HOST = 316,
-    HUB = 317,
-    HUB_MASK = 318,
-    INVISIBLE_ON_CONNECT = 319,
-    INVITE_CLIENT_COUNT = 320,
-    INVITE_CLIENT_TIME = 321,
-    INVITE_DELAY_CHANNEL = 322,
-    INVITE_EXPIRE_TIME = 323,
-    IP = 324,
-    IRCD_AUTH = 325,
-    IRCD_FLAGS = 326,
-    IRCD_SID = 327,
-    JOIN = 328,
-    KILL = 329,
-    KILL_CHASE_TIME_LIMIT = 330,
-    KLINE = 331,
-    KLINE_EXEMPT = 332,
-    KLINE_MIN_CIDR = 333,
-    KLINE_MIN_CIDR6 = 334,
-    KNOCK_CLIENT_COUNT = 335,
-    KNOCK_CLIENT_TIME = 336,
-    KNOCK_DELAY_CHANNEL = 337,
-    LEAF_MASK = 338,
-    LISTEN = 339,
-    MASK = 340,
-    MAX_ACCEPT = 341,
-    MAX_BANS = 342,
-    MAX_BANS_LARGE = 343,
-    MAX_CHANNELS = 344,
-    MAX_IDLE = 345,
-    MAX_INVITES = 346,
-    MAX_MONITOR = 347,
-    MAX_NICK_CHANGES = 348,
-    MAX_NICK_LENGTH = 349,
-    MAX_NICK_TIME = 350,
-    MAX_NUMBER = 351,
-    MAX_TARGETS = 352,
-    MAX_TOPIC_LENGTH = 353,
-    MIN_IDLE = 354,
-    MIN_NONWILDCARD = 355,
-    MIN_NONWILDCARD_SIMPLE = 356,
-    MODULE = 357,
-    MODULES = 358,
-    MOTD = 359,
-    NAME = 360,
-    NEED_IDENT = 361,
-    NEED_PASSWORD = 362,
-    NETWORK_DESCRIPTION = 363,
-    NETWORK_NAME = 364,
-    NICK = 365,
-    NO_OPER_FLOOD = 366,
-    NO_TILDE = 367,
-    NUMBER_PER_CIDR = 368,
-    NUMBER_PER_IP_GLOBAL = 369,
-    NUMBER_PER_IP_LOCAL = 370,
-    OPER_ONLY_UMODES = 371,
-    OPER_UMODES = 372,
-    OPERATOR = 373,
-    OPERS_BYPASS_CALLERID = 374,
-    PACE_WAIT = 375,
-    PACE_WAIT_SIMPLE = 376,
-    PASSWORD = 377,
-    PATH = 378,
-    PING_COOKIE = 379,
-    PING_TIME = 380,
-    PORT = 381,
-    RANDOM_IDLE = 382,
-    REASON = 383,
-    REDIRPORT = 384,
-    REDIRSERV = 385,
-    REHASH = 386,
-    REMOTE = 387,
-    REMOTEBAN = 388,
-    RESV = 389,
-    RESV_EXEMPT = 390,
-    RSA_PRIVATE_KEY_FILE = 391,
-    SECONDS = 392,
-    MINUTES = 393,
-    HOURS = 394,
-    DAYS = 395,
-    WEEKS = 396,
-    MONTHS = 397,
-    YEARS = 398,
-    SEND_PASSWORD = 399,
-    SENDQ = 400,
-    SERVERHIDE = 401,
-    SERVERINFO = 402,
-    SHORT_MOTD = 403,
-    SPOOF = 404,
-    SQUIT = 405,
-    STATS_E_DISABLED = 406,
-    STATS_I_OPER_ONLY = 407,
-    STATS_K_OPER_ONLY = 408,
-    STATS_M_OPER_ONLY = 409,
-    STATS_O_OPER_ONLY = 410,
-    STATS_P_OPER_ONLY = 411,
-    STATS_U_OPER_ONLY = 412,
-    T_ALL = 413,
-    T_BIND = 414,
-    T_CALLERID = 415,
-    T_CCONN = 416,
-    T_COMMAND = 417,
-    T_CLUSTER = 418,
-    T_DEAF = 419,
-    T_DEBUG = 420,
-    T_DLINE = 421,
-    T_EXTERNAL = 422,
-    T_FARCONNECT = 423,
-    T_FILE = 424,
-    T_FLOOD = 425,
-    T_GLOBOPS = 426,
-    T_INVISIBLE = 427,
-    T_IPV4 = 428,
-    T_IPV6 = 429,
-    T_LOCOPS = 430,
-    T_LOG = 431,
-    T_NCHANGE = 432,
-    T_NONONREG = 433,
-    T_OPME = 434,
-    T_PREPEND = 435,
-    T_PSEUDO = 436,
-    T_RECVQ = 437,
-    T_REJ = 438,
-    T_RESTART = 439,
-    T_SERVER = 440,
-    T_SERVICE = 441,
-    T_SERVNOTICE = 442,
-    T_SET = 443,
-    T_SHARED = 444,
-    T_SIZE = 445,
-    T_SKILL = 446,
-    T_SOFTCALLERID = 447,
-    T_SPY = 448,
-    T_TARGET = 449,
-    T_TLS = 450,
-    T_UMODES = 451,
-    T_UNDLINE = 452,
-    T_UNLIMITED = 453,
-    T_UNRESV = 454,
-    T_UNXLINE = 455,
-    T_WALLOP = 456,
-    T_WALLOPS = 457,
-    T_WEBIRC = 458,
-    TBOOL = 459,
-    THROTTLE_COUNT = 460,
-    THROTTLE_TIME = 461,
-    TIMEOUT = 462,
-    TLS_CERTIFICATE_FILE = 463,
-    TLS_CERTIFICATE_FINGERPRINT = 464,
-    TLS_CIPHER_LIST = 465,
-    TLS_CIPHER_SUITES = 466,
-    TLS_CONNECTION_REQUIRED = 467,
-    TLS_DH_PARAM_FILE = 468,
-    TLS_MESSAGE_DIGEST_ALGORITHM = 469,
-    TLS_SUPPORTED_GROUPS = 470,
-    TS_MAX_DELTA = 471,
-    TS_WARN_DELTA = 472,
-    TWODOTS = 473,
-    TYPE = 474,
-    UNKLINE = 475,
-    USE_LOGGING = 476,
-    USER = 477,
-    VHOST = 478,
-    VHOST6 = 479,
-    WARN_NO_CONNECT_BLOCK = 480,
-    WHOIS = 481,
-    WHOWAS_HISTORY_LENGTH = 482,
-    XLINE = 483,
-    XLINE_EXEMPT = 484,
-    QSTRING = 485,
-    NUMBER = 486
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ACCEPT_PASSWORD = 258,         /* ACCEPT_PASSWORD  */
+    ADMIN = 259,                   /* ADMIN  */
+    AFTYPE = 260,                  /* AFTYPE  */
+    ANTI_NICK_FLOOD = 261,         /* ANTI_NICK_FLOOD  */
+    ANTI_SPAM_EXIT_MESSAGE_TIME = 262, /* ANTI_SPAM_EXIT_MESSAGE_TIME  */
+    AUTH_TIMEOUT = 263,            /* AUTH_TIMEOUT  */
+    AUTOCONN = 264,                /* AUTOCONN  */
+    AWAY_COUNT = 265,              /* AWAY_COUNT  */
+    AWAY_TIME = 266,               /* AWAY_TIME  */
+    BOT = 267,                     /* BOT  */
+    BYTES = 268,                   /* BYTES  */
+    KBYTES = 269,                  /* KBYTES  */
+    MBYTES = 270,                  /* MBYTES  */
+    CALLER_ID_WAIT = 271,          /* CALLER_ID_WAIT  */
+    CAN_FLOOD = 272,               /* CAN_FLOOD  */
+    CHANNEL = 273,                 /* CHANNEL  */
+    CIDR_BITLEN_IPV4 = 274,        /* CIDR_BITLEN_IPV4  */
+    CIDR_BITLEN_IPV6 = 275,        /* CIDR_BITLEN_IPV6  */
+    CLASS = 276,                   /* CLASS  */
+    CLIENT = 277,                  /* CLIENT  */
+    CLOSE = 278,                   /* CLOSE  */
+    CONNECT = 279,                 /* CONNECT  */
+    CONNECTFREQ = 280,             /* CONNECTFREQ  */
+    CYCLE_ON_HOST_CHANGE = 281,    /* CYCLE_ON_HOST_CHANGE  */
+    DEFAULT_FLOODCOUNT = 282,      /* DEFAULT_FLOODCOUNT  */
+    DEFAULT_FLOODTIME = 283,       /* DEFAULT_FLOODTIME  */
+    DEFAULT_JOIN_FLOOD_COUNT = 284, /* DEFAULT_JOIN_FLOOD_COUNT  */
+    DEFAULT_JOIN_FLOOD_TIME = 285, /* DEFAULT_JOIN_FLOOD_TIME  */
+    DEFAULT_MAX_CLIENTS = 286,     /* DEFAULT_MAX_CLIENTS  */
+    DEFER = 287,                   /* DEFER  */
+    DENY = 288,                    /* DENY  */
+    DESCRIPTION = 289,             /* DESCRIPTION  */
+    DIE = 290,                     /* DIE  */
+    DISABLE_AUTH = 291,            /* DISABLE_AUTH  */
+    DISABLE_FAKE_CHANNELS = 292,   /* DISABLE_FAKE_CHANNELS  */
+    DISABLE_REMOTE_COMMANDS = 293, /* DISABLE_REMOTE_COMMANDS  */
+    DLINE_MIN_CIDR = 294,          /* DLINE_MIN_CIDR  */
+    DLINE_MIN_CIDR6 = 295,         /* DLINE_MIN_CIDR6  */
+    DOTS_IN_IDENT = 296,           /* DOTS_IN_IDENT  */
+    EMAIL = 297,                   /* EMAIL  */
+    ENABLE_EXTBANS = 298,          /* ENABLE_EXTBANS  */
+    ENCRYPTED = 299,               /* ENCRYPTED  */
+    EXCEED_LIMIT = 300,            /* EXCEED_LIMIT  */
+    EXEMPT = 301,                  /* EXEMPT  */
+    EXPIRATION = 302,              /* EXPIRATION  */
+    FAILED_OPER_NOTICE = 303,      /* FAILED_OPER_NOTICE  */
+    FLATTEN_LINKS = 304,           /* FLATTEN_LINKS  */
+    FLATTEN_LINKS_DELAY = 305,     /* FLATTEN_LINKS_DELAY  */
+    FLATTEN_LINKS_FILE = 306,      /* FLATTEN_LINKS_FILE  */
+    FLOOD_BURST = 307,             /* FLOOD_BURST  */
+    FLOOD_RATE = 308,              /* FLOOD_RATE  */
+    GECOS = 309,                   /* GECOS  */
+    GENERAL = 310,                 /* GENERAL  */
+    HIDDEN = 311,                  /* HIDDEN  */
+    HIDDEN_NAME = 312,             /* HIDDEN_NAME  */
+    HIDE_CHANS = 313,              /* HIDE_CHANS  */
+    HIDE_IDLE = 314,               /* HIDE_IDLE  */
+    HIDE_IDLE_FROM_OPERS = 315,    /* HIDE_IDLE_FROM_OPERS  */
+    HIDE_SERVER_IPS = 316,         /* HIDE_SERVER_IPS  */
+    HIDE_SERVERS = 317,            /* HIDE_SERVERS  */
+    HIDE_SERVICES = 318,           /* HIDE_SERVICES  */
+    HOST = 319,                    /* HOST  */
+    HUB = 320,                     /* HUB  */
+    HUB_MASK = 321,                /* HUB_MASK  */
+    IDENT_CACHE_TIME = 322,        /* IDENT_CACHE_TIME  */
+    IDENT_MAX_PENDING = 323,       /* IDENT_MAX_PENDING  */
+    IDENT_TIMEOUT = 324,           /* IDENT_TIMEOUT  */
+    INVISIBLE_ON_CONNECT = 325,    /* INVISIBLE_ON_CONNECT  */
+    INVITE_CLIENT_COUNT = 326,     /* INVITE_CLIENT_COUNT  */
+    INVITE_CLIENT_TIME = 327,      /* INVITE_CLIENT_TIME  */
+    INVITE_DELAY_CHANNEL = 328,    /* INVITE_DELAY_CHANNEL  */
+    INVITE_EXPIRE_TIME = 329,      /* INVITE_EXPIRE_TIME  */
+    IP = 330,                      /* IP  */
+    IRCD_AUTH = 331,               /* IRCD_AUTH  */
+    IRCD_FLAGS = 332,              /* IRCD_FLAGS  */
+    IRCD_SID = 333,                /* IRCD_SID  */
+    JOIN = 334,                    /* JOIN  */
+    KILL = 335,                    /* KILL  */
+    KILL_CHASE_TIME_LIMIT = 336,   /* KILL_CHASE_TIME_LIMIT  */
+    KLINE = 337,                   /* KLINE  */
+    KLINE_EXEMPT = 338,            /* KLINE_EXEMPT  */
+    KLINE_MIN_CIDR = 339,          /* KLINE_MIN_CIDR  */
+    KLINE_MIN_CIDR6 = 340,         /* KLINE_MIN_CIDR6  */
+    KNOCK_CLIENT_COUNT = 341,      /* KNOCK_CLIENT_COUNT  */
+    KNOCK_CLIENT_TIME = 342,       /* KNOCK_CLIENT_TIME  */
+    KNOCK_DELAY_CHANNEL = 343,     /* KNOCK_DELAY_CHANNEL  */
+    LEAF_MASK = 344,               /* LEAF_MASK  */
+    LISTEN = 345,                  /* LISTEN  */
+    MASK = 346,                    /* MASK  */
+    MAX_ACCEPT = 347,              /* MAX_ACCEPT  */
+    MAX_BANS = 348,                /* MAX_BANS  */
+    MAX_BANS_LARGE = 349,          /* MAX_BANS_LARGE  */
+    MAX_CHANNELS = 350,            /* MAX_CHANNELS  */
+    MAX_IDLE = 351,                /* MAX_IDLE  */
+    MAX_INVITES = 352,             /* MAX_INVITES  */
+    MAX_MONITOR = 353,             /* MAX_MONITOR  */
+    MAX_NICK_CHANGES = 354,        /* MAX_NICK_CHANGES  */
+    MAX_NICK_LENGTH = 355,         /* MAX_NICK_LENGTH  */
+    MAX_NICK_TIME = 356,           /* MAX_NICK_TIME  */
+    MAX_NUMBER = 357,              /* MAX_NUMBER  */
+    MAX_TARGETS = 358,             /* MAX_TARGETS  */
+    MAX_TOPIC_LENGTH = 359,        /* MAX_TOPIC_LENGTH  */
+    MIN_IDLE = 360,                /* MIN_IDLE  */
+    MIN_NONWILDCARD = 361,         /* MIN_NONWILDCARD  */
+    MIN_NONWILDCARD_SIMPLE = 362,  /* MIN_NONWILDCARD_SIMPLE  */
+    MODULE = 363,                  /* MODULE  */
+    MODULES = 364,                 /* MODULES  */
+    MOTD = 365,                    /* MOTD  */
+    NAME = 366,                    /* NAME  */
+    NEED_IDENT = 367,              /* NEED_IDENT  */
+    NEED_PASSWORD = 368,           /* NEED_PASSWORD  */
+    NETWORK_DESCRIPTION = 369,     /* NETWORK_DESCRIPTION  */
+    NETWORK_NAME = 370,            /* NETWORK_NAME  */
+    NICK = 371,                    /* NICK  */
+    NO_OPER_FLOOD = 372,           /* NO_OPER_FLOOD  */
+    NO_TILDE = 373,                /* NO_TILDE  */
+    NUMBER_PER_CIDR = 374,         /* NUMBER_PER_CIDR  */
+    NUMBER_PER_IP_GLOBAL = 375,    /* NUMBER_PER_IP_GLOBAL  */
+    NUMBER_PER_IP_LOCAL = 376,     /* NUMBER_PER_IP_LOCAL  */
+    OPER_ONLY_UMODES = 377,        /* OPER_ONLY_UMODES  */
+    OPER_UMODES = 378,             /* OPER_UMODES  */
+    OPERATOR = 379,                /* OPERATOR  */
+    OPERS_BYPASS_CALLERID = 380,   /* OPERS_BYPASS_CALLERID  */
+    PACE_WAIT = 381,               /* PACE_WAIT  */
+    PACE_WAIT_SIMPLE = 382,        /* PACE_WAIT_SIMPLE  */
+    PASSWORD = 383,                /* PASSWORD  */
+    PATH = 384,                    /* PATH  */
+    PING_COOKIE = 385,             /* PING_COOKIE  */
+    PING_TIME = 386,               /* PING_TIME  */
+    PORT = 387,                    /* PORT  */
+    RANDOM_IDLE = 388,             /* RANDOM_IDLE  */
+    REASON = 389,                  /* REASON  */
+    REDIRPORT = 390,               /* REDIRPORT  */
+    REDIRSERV = 391,               /* REDIRSERV  */
+    REHASH = 392,                  /* REHASH  */
+    REMOTE = 393,                  /* REMOTE  */
+    REMOTEBAN = 394,               /* REMOTEBAN  */
+    RESV = 395,                    /* RESV  */
+    RESV_EXEMPT = 396,             /* RESV_EXEMPT  */
+    REUSEPORT = 397,               /* REUSEPORT  */
+    RSA_PRIVATE_KEY_FILE = 398,    /* RSA_PRIVATE_KEY_FILE  */
+    SECONDS = 399,                 /* SECONDS  */
+    MINUTES = 400,                 /* MINUTES  */
+    HOURS = 401,                   /* HOURS  */
+    DAYS = 402,                    /* DAYS  */
+    WEEKS = 403,                   /* WEEKS  */
+    MONTHS = 404,                  /* MONTHS  */
+    YEARS = 405,                   /* YEARS  */
+    SEND_PASSWORD = 406,           /* SEND_PASSWORD  */
+    SENDQ = 407,                   /* SENDQ  */
+    SERVERHIDE = 408,              /* SERVERHIDE  */
+    SERVERINFO = 409,              /* SERVERINFO  */
+    SHORT_MOTD = 410,              /* SHORT_MOTD  */
+    SPOOF = 411,                   /* SPOOF  */
+    SQUIT = 412,                   /* SQUIT  */
+    STATS_E_DISABLED = 413,        /* STATS_E_DISABLED  */
+    STATS_I_OPER_ONLY = 414,       /* STATS_I_OPER_ONLY  */
+    STATS_K_OPER_ONLY = 415,       /* STATS_K_OPER_ONLY  */
+    STATS_M_OPER_ONLY = 416,       /* STATS_M_OPER_ONLY  */
+    STATS_O_OPER_ONLY = 417,       /* STATS_O_OPER_ONLY  */
+    STATS_P_OPER_ONLY = 418,       /* STATS_P_OPER_ONLY  */
+    STATS_U_OPER_ONLY = 419,       /* STATS_U_OPER_ONLY  */
+    T_ALL = 420,                   /* T_ALL  */
+    T_BIND = 421,                  /* T_BIND  */
+    T_CALLERID = 422,              /* T_CALLERID  */
+    T_CCONN = 423,                 /* T_CCONN  */
+    T_COMMAND = 424,               /* T_COMMAND  */
+    T_CLUSTER = 425,               /* T_CLUSTER  */
+    T_COMPRESSED = 426,            /* T_COMPRESSED  */
+    T_DEAF = 427,                  /* T_DEAF  */
+    T_DEBUG = 428,                 /* T_DEBUG  */
+    T_DLINE = 429,                 /* T_DLINE  */
+    T_EXTERNAL = 430,              /* T_EXTERNAL  */
+    T_FARCONNECT = 431,            /* T_FARCONNECT  */
+    T_FILE = 432,                  /* T_FILE  */
+    T_FLOOD = 433,                 /* T_FLOOD  */
+    T_GLOBOPS = 434,               /* T_GLOBOPS  */
+    T_INVISIBLE = 435,             /* T_INVISIBLE  */
+    T_IPV4 = 436,                  /* T_IPV4  */
+    T_IPV6 = 437,                  /* T_IPV6  */
+    T_LOCOPS = 438,                /* T_LOCOPS  */
+    T_LOG = 439,                   /* T_LOG  */
+    T_METRICS = 440,               /* T_METRICS  */
+    T_NCHANGE = 441,               /* T_NCHANGE  */
+    T_NONONREG = 442,              /* T_NONONREG  */
+    T_OPME = 443,                  /* T_OPME  */
+    T_PREPEND = 444,               /* T_PREPEND  */
+    T_PSEUDO = 445,                /* T_PSEUDO  */
+    T_RECVQ = 446,                 /* T_RECVQ  */
+    T_REJ = 447,                   /* T_REJ  */
+    T_RESTART = 448,               /* T_RESTART  */
+    T_SERVER = 449,                /* T_SERVER  */
+    T_SERVICE = 450,               /* T_SERVICE  */
+    T_SERVNOTICE = 451,            /* T_SERVNOTICE  */
+    T_SET = 452,                   /* T_SET  */
+    T_SHARED = 453,                /* T_SHARED  */
+    T_SIZE = 454,                  /* T_SIZE  */
+    T_SKILL = 455,                 /* T_SKILL  */
+    T_SOFTCALLERID = 456,          /* T_SOFTCALLERID  */
+    T_SPY = 457,                   /* T_SPY  */
+    T_TARGET = 458,                /* T_TARGET  */
+    T_TLS = 459,                   /* T_TLS  */
+    T_UMODES = 460,                /* T_UMODES  */
+    T_UNDLINE = 461,               /* T_UNDLINE  */
+    T_UNLIMITED = 462,             /* T_UNLIMITED  */
+    T_UNRESV = 463,                /* T_UNRESV  */
+    T_UNXLINE = 464,               /* T_UNXLINE  */
+    T_WALLOP = 465,                /* T_WALLOP  */
+    T_WALLOPS = 466,               /* T_WALLOPS  */
+    T_WEBIRC = 467,                /* T_WEBIRC  */
+    TBOOL = 468,                   /* TBOOL  */
+    THROTTLE_COUNT = 469,          /* THROTTLE_COUNT  */
+    THROTTLE_TIME = 470,           /* THROTTLE_TIME  */
+    TIMEOUT = 471,                 /* TIMEOUT  */
+    TLS_CERTIFICATE_FILE = 472,    /* TLS_CERTIFICATE_FILE  */
+    TLS_CERTIFICATE_FINGERPRINT = 473, /* TLS_CERTIFICATE_FINGERPRINT  */
+    TLS_CIPHER_LIST = 474,         /* TLS_CIPHER_LIST  */
+    TLS_CIPHER_SUITES = 475,       /* TLS_CIPHER_SUITES  */
+    TLS_CONNECTION_REQUIRED = 476, /* TLS_CONNECTION_REQUIRED  */
+    TLS_DH_PARAM_FILE = 477,       /* TLS_DH_PARAM_FILE  */
+    TLS_HANDSHAKE_THREADS = 478,   /* TLS_HANDSHAKE_THREADS  */
+    TLS_KERNEL_OFFLOAD = 479,      /* TLS_KERNEL_OFFLOAD  */
+    TLS_MESSAGE_DIGEST_ALGORITHM = 480, /* TLS_MESSAGE_DIGEST_ALGORITHM  */
+    TLS_SESSION_CACHE_SIZE = 481,  /* TLS_SESSION_CACHE_SIZE  */
+    TLS_SUPPORTED_GROUPS = 482,    /* TLS_SUPPORTED_GROUPS  */
+    TLS_TICKET_KEY_FILE = 483,     /* TLS_TICKET_KEY_FILE  */
+    TS_MAX_DELTA = 484,            /* TS_MAX_DELTA  */
+    TS_WARN_DELTA = 485,           /* TS_WARN_DELTA  */
+    TWODOTS = 486,                 /* TWODOTS  */
+    TYPE = 487,                    /* TYPE  */
+    UNKLINE = 488,                 /* UNKLINE  */
+    USE_LOGGING = 489,             /* USE_LOGGING  */
+    USER = 490,                    /* USER  */
+    VHOST = 491,                   /* VHOST  */
+    VHOST6 = 492,                  /* VHOST6  */
+    WARN_NO_CONNECT_BLOCK = 493,   /* WARN_NO_CONNECT_BLOCK  */
+    WHOIS = 494,                   /* WHOIS  */
+    WHOWAS_HISTORY_LENGTH = 495,   /* WHOWAS_HISTORY_LENGTH  */
+    XLINE = 496,                   /* XLINE  */
+    XLINE_EXEMPT = 497,            /* XLINE_EXEMPT  */
+    QSTRING = 498,                 /* QSTRING  */
+    NUMBER = 499                   /* NUMBER  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ACCEPT_PASSWORD 258
 #define ADMIN 259
 #define AFTYPE 260
 #define ANTI_NICK_FLOOD 261
 #define ANTI_SPAM_EXIT_MESSAGE_TIME 262
-#define AUTOCONN 263
-#define AWAY_COUNT 264
-#define AWAY_TIME 265
-#define BOT 266
-#define BYTES 267
-#define KBYTES 268
-#define MBYTES 269
-#define CALLER_ID_WAIT 270
-#define CAN_FLOOD 271
-#define CHANNEL 272
-#define CIDR_BITLEN_IPV4 273
-#define CIDR_BITLEN_IPV6 274
-#define CLASS 275
-#define CLIENT 276
-#define CLOSE 277
-#define CONNECT 278
-#define CONNECTFREQ 279
-#define CYCLE_ON_HOST_CHANGE 280
-#define DEFAULT_FLOODCOUNT 281
-#define DEFAULT_FLOODTIME 282
-#define DEFAULT_JOIN_FLOOD_COUNT 283
-#define DEFAULT_JOIN_FLOOD_TIME 284
-#define DEFAULT_MAX_CLIENTS 285
-#define DEFER 286
-#define DENY 287
-#define DESCRIPTION 288
-#define DIE 289
-#define DISABLE_AUTH 290
-#define DISABLE_FAKE_CHANNELS 291
-#define DISABLE_REMOTE_COMMANDS 292
-#define DLINE_MIN_CIDR 293
-#define DLINE_MIN_CIDR6 294
-#define DOTS_IN_IDENT 295
-#define EMAIL 296
-#define ENABLE_EXTBANS 297
-#define ENCRYPTED 298
-#define EXCEED_LIMIT 299
-#define EXEMPT 300
-#define EXPIRATION 301
-#define FAILED_OPER_NOTICE 302
-#define FLATTEN_LINKS 303
-#define FLATTEN_LINKS_DELAY 304
-#define FLATTEN_LINKS_FILE 305
-#define GECOS 306
-#define GENERAL 307
-#define HIDDEN 308
-#define HIDDEN_NAME 309
-#define HIDE_CHANS 310
-#define HIDE_IDLE 311
-#define HIDE_IDLE_FROM_OPERS 312
-#define HIDE_SERVER_IPS 313
-#define HIDE_SERVERS 314
-#define HIDE_SERVICES 315
-#define HOST 316
-#define HUB 317
-#define HUB_MASK 318
-#define INVISIBLE_ON_CONNECT 319
-#define INVITE_CLIENT_COUNT 320
-#define INVITE_CLIENT_TIME 321
-#define INVITE_DELAY_CHANNEL 322
-#define INVITE_EXPIRE_TIME 323
-#define IP 324
-#define IRCD_AUTH 325
-#define IRCD_FLAGS 326
-#define IRCD_SID 327
-#define JOIN 328
-#define KILL 329
-#define KILL_CHASE_TIME_LIMIT 330
-#define KLINE 331
-#define KLINE_EXEMPT 332
-#define KLINE_MIN_CIDR 333
-#define KLINE_MIN_CIDR6 334
-#define KNOCK_CLIENT_COUNT 335
-#define KNOCK_CLIENT_TIME 336
-#define KNOCK_DELAY_CHANNEL 337
-#define LEAF_MASK 338
-#define LISTEN 339
-#define MASK 340
-#define MAX_ACCEPT 341
-#define MAX_BANS 342
-#define MAX_BANS_LARGE 343
-#define MAX_CHANNELS 344
-#define MAX_IDLE 345
-#define MAX_INVITES 346
-#define MAX_MONITOR 347
-#define MAX_NICK_CHANGES 348
-#define MAX_NICK_LENGTH 349
-#define MAX_NICK_TIME 350
-#define MAX_NUMBER 351
-#define MAX_TARGETS 352
-#define MAX_TOPIC_LENGTH 353
-#define MIN_IDLE 354
-#define MIN_NONWILDCARD 355
-#define MIN_NONWILDCARD_SIMPLE 356
-#define MODULE 357
-#define MODULES 358
-#define MOTD 359
-#define NAME 360
-#define NEED_IDENT 361
-#define NEED_PASSWORD 362
-#define NETWORK_DESCRIPTION 363
-#define NETWORK_NAME 364
-#define NICK 365
-#define NO_OPER_FLOOD 366
-#define NO_TILDE 367
-#define NUMBER_PER_CIDR 368
-#define NUMBER_PER_IP_GLOBAL 369
-#define NUMBER_PER_IP_LOCAL 370
-#define OPER_ONLY_UMODES 371
-#define OPER_UMODES 372
-#define OPERATOR 373
-#define OPERS_BYPASS_CALLERID 374
-#define PACE_WAIT 375
-#define PACE_WAIT_SIMPLE 376
-#define PASSWORD 377
-#define PATH 378
-#define PING_COOKIE 379
-#define PING_TIME 380
-#define PORT 381
-#define RANDOM_IDLE 382
-#define REASON 383
-#define REDIRPORT 384
-#define REDIRSERV 385
-#define REHASH 386
-#define REMOTE 387
-#define REMOTEBAN 388
-#define RESV 389
-#define RESV_EXEMPT 390
-#define RSA_PRIVATE_KEY_FILE 391
-#define SECONDS 392
-#define MINUTES 393
-#define HOURS 394
-#define DAYS 395
-#define WEEKS 396
-#define MONTHS 397
-#define YEARS 398
-#define SEND_PASSWORD 399
-#define SENDQ 400
-#define SERVERHIDE 401
-#define SERVERINFO 402
-#define SHORT_MOTD 403
-#define SPOOF 404
-#define SQUIT 405
-#define STATS_E_DISABLED 406
-#define STATS_I_OPER_ONLY 407
-#define STATS_K_OPER_ONLY 408
-#define STATS_M_OPER_ONLY 409
-#define STATS_O_OPER_ONLY 410
-#define STATS_P_OPER_ONLY 411
-#define STATS_U_OPER_ONLY 412
-#define T_ALL 413
-#define T_BIND 414
-#define T_CALLERID 415
-#define T_CCONN 416
-#define T_COMMAND 417
-#define T_CLUSTER 418
-#define T_DEAF 419
-#define T_DEBUG 420
-#define T_DLINE 421
-#define T_EXTERNAL 422
-#define T_FARCONNECT 423
-#define T_FILE 424
-#define T_FLOOD 425
-#define T_GLOBOPS 426
-#define T_INVISIBLE 427
-#define T_IPV4 428
-#define T_IPV6 429
-#define T_LOCOPS 430
-#define T_LOG 431
-#define T_NCHANGE 432
-#define T_NONONREG 433
-#define T_OPME 434
-#define T_PREPEND 435
-#define T_PSEUDO 436
-#define T_RECVQ 437
-#define T_REJ 438
-#define T_RESTART 439
-#define T_SERVER 440
-#define T_SERVICE 441
-#define T_SERVNOTICE 442
-#define T_SET 443
-#define T_SHARED 444
-#define T_SIZE 445
-#define T_SKILL 446
-#define T_SOFTCALLERID 447
-#define T_SPY 448
-#define T_TARGET 449
-#define T_TLS 450
-#define T_UMODES 451
-#define T_UNDLINE 452
-#define T_UNLIMITED 453
-#define T_UNRESV 454
-#define T_UNXLINE 455
-#define T_WALLOP 456
-#define T_WALLOPS 457
-#define T_WEBIRC 458
-#define TBOOL 459
-#define THROTTLE_COUNT 460
-#define THROTTLE_TIME 461
-#define TIMEOUT 462
-#define TLS_CERTIFICATE_FILE 463
-#define TLS_CERTIFICATE_FINGERPRINT 464
-#define TLS_CIPHER_LIST 465
-#define TLS_CIPHER_SUITES 466
-#define TLS_CONNECTION_REQUIRED 467
-#define TLS_DH_PARAM_FILE 468
-#define TLS_MESSAGE_DIGEST_ALGORITHM 469
-#define TLS_SUPPORTED_GROUPS 470
-#define TS_MAX_DELTA 471
-#define TS_WARN_DELTA 472
-#define TWODOTS 473
-#define TYPE 474
-#define UNKLINE 475
-#define USE_LOGGING 476
-#define USER 477
-#define VHOST 478
-#define VHOST6 479
-#define WARN_NO_CONNECT_BLOCK 480
-#define WHOIS 481
-#define WHOWAS_HISTORY_LENGTH 482
-#define XLINE 483
-#define XLINE_EXEMPT 484
-#define QSTRING 485
-#define NUMBER 486
+#define AUTH_TIMEOUT 263
+#define AUTOCONN 264
+#define AWAY_COUNT 265
+#define AWAY_TIME 266
+#define BOT 267
+#define BYTES 268
+#define KBYTES 269
+#define MBYTES 270
+#define CALLER_ID_WAIT 271
+#define CAN_FLOOD 272
+#define CHANNEL 273
+#define CIDR_BITLEN_IPV4 274
+#define CIDR_BITLEN_IPV6 275
+#define CLASS 276
+#define CLIENT 277
+#define CLOSE 278
+#define CONNECT 279
+#define CONNECTFREQ 280
+#define CYCLE_ON_HOST_CHANGE 281
+#define DEFAULT_FLOODCOUNT 282
+#define DEFAULT_FLOODTIME 283
+#define DEFAULT_JOIN_FLOOD_COUNT 284
+#define DEFAULT_JOIN_FLOOD_TIME 285
+#define DEFAULT_MAX_CLIENTS 286
+#define DEFER 287
+#define DENY 288
+#define DESCRIPTION 289
+#define DIE 290
+#define DISABLE_AUTH 291
+#define DISABLE_FAKE_CHANNELS 292
+#define DISABLE_REMOTE_COMMANDS 293
+#define DLINE_MIN_CIDR 294
+#define DLINE_MIN_CIDR6 295
+#define DOTS_IN_IDENT 296
+#define EMAIL 297
+#define ENABLE_EXTBANS 298
+#define ENCRYPTED 299
+#define EXCEED_LIMIT 300
+#define EXEMPT 301
+#define EXPIRATION 302
+#define FAILED_OPER_NOTICE 303
+#define FLATTEN_LINKS 304
+#define FLATTEN_LINKS_DELAY 305
+#define FLATTEN_LINKS_FILE 306
+#define FLOOD_BURST 307
+#define FLOOD_RATE 308
+#define GECOS 309
+#define GENERAL 310
+#define HIDDEN 311
+#define HIDDEN_NAME 312
+#define HIDE_CHANS 313
+#define HIDE_IDLE 314
+#define HIDE_IDLE_FROM_OPERS 315
+#define HIDE_SERVER_IPS 316
+#define HIDE_SERVERS 317
+#define HIDE_SERVICES 318
+#define HOST 319
+#define HUB 320
+#define HUB_MASK 321
+#define IDENT_CACHE_TIME 322
+#define IDENT_MAX_PENDING 323
+#define IDENT_TIMEOUT 324
+#define INVISIBLE_ON_CONNECT 325
+#define INVITE_CLIENT_COUNT 326
+#define INVITE_CLIENT_TIME 327
+#define INVITE_DELAY_CHANNEL 328
+#define INVITE_EXPIRE_TIME 329
+#define IP 330
+#define IRCD_AUTH 331
+#define IRCD_FLAGS 332
+#define IRCD_SID 333
+#define JOIN 334
+#define KILL 335
+#define KILL_CHASE_TIME_LIMIT 336
+#define KLINE 337
+#define KLINE_EXEMPT 338
+#define KLINE_MIN_CIDR 339
+#define KLINE_MIN_CIDR6 340
+#define KNOCK_CLIENT_COUNT 341
+#define KNOCK_CLIENT_TIME 342
+#define KNOCK_DELAY_CHANNEL 343
+#define LEAF_MASK 344
+#define LISTEN 345
+#define MASK 346
+#define MAX_ACCEPT 347
+#define MAX_BANS 348
+#define MAX_BANS_LARGE 349
+#define MAX_CHANNELS 350
+#define MAX_IDLE 351
+#define MAX_INVITES 352
+#define MAX_MONITOR 353
+#define MAX_NICK_CHANGES 354
+#define MAX_NICK_LENGTH 355
+#define MAX_NICK_TIME 356
+#define MAX_NUMBER 357
+#define MAX_TARGETS 358
+#define MAX_TOPIC_LENGTH 359
+#define MIN_IDLE 360
+#define MIN_NONWILDCARD 361
+#define MIN_NONWILDCARD_SIMPLE 362
+#define MODULE 363
+#define MODULES 364
+#define MOTD 365
+#define NAME 366
+#define NEED_IDENT 367
+#define NEED_PASSWORD 368
+#define NETWORK_DESCRIPTION 369
+#define NETWORK_NAME 370
+#define NICK 371
+#define NO_OPER_FLOOD 372
+#define NO_TILDE 373
+#define NUMBER_PER_CIDR 374
+#define NUMBER_PER_IP_GLOBAL 375
+#define NUMBER_PER_IP_LOCAL 376
+#define OPER_ONLY_UMODES 377
+#define OPER_UMODES 378
+#define OPERATOR 379
+#define OPERS_BYPASS_CALLERID 380
+#define PACE_WAIT 381
+#define PACE_WAIT_SIMPLE 382
+#define PASSWORD 383
+#define PATH 384
+#define PING_COOKIE 385
+#define PING_TIME 386
+#define PORT 387
+#define RANDOM_IDLE 388
+#define REASON 389
+#define REDIRPORT 390
+#define REDIRSERV 391
+#define REHASH 392
+#define REMOTE 393
+#define REMOTEBAN 394
+#define RESV 395
+#define RESV_EXEMPT 396
+#define REUSEPORT 397
+#define RSA_PRIVATE_KEY_FILE 398
+#define SECONDS 399
+#define MINUTES 400
+#define HOURS 401
+#define DAYS 402
+#define WEEKS 403
+#define MONTHS 404
+#define YEARS 405
+#define SEND_PASSWORD 406
+#define SENDQ 407
+#define SERVERHIDE 408
+#define SERVERINFO 409
+#define SHORT_MOTD 410
+#define SPOOF 411
+#define SQUIT 412
+#define STATS_E_DISABLED 413
+#define STATS_I_OPER_ONLY 414
+#define STATS_K_OPER_ONLY 415
+#define STATS_M_OPER_ONLY 416
+#define STATS_O_OPER_ONLY 417
+#define STATS_P_OPER_ONLY 418
+#define STATS_U_OPER_ONLY 419
+#define T_ALL 420
+#define T_BIND 421
+#define T_CALLERID 422
+#define T_CCONN 423
+#define T_COMMAND 424
+#define T_CLUSTER 425
+#define T_COMPRESSED 426
+#define T_DEAF 427
+#define T_DEBUG 428
+#define T_DLINE 429
+#define T_EXTERNAL 430
+#define T_FARCONNECT 431
+#define T_FILE 432
+#define T_FLOOD 433
+#define T_GLOBOPS 434
+#define T_INVISIBLE 435
+#define T_IPV4 436
+#define T_IPV6 437
+#define T_LOCOPS 438
+#define T_LOG 439
+#define T_METRICS 440
+#define T_NCHANGE 441
+#define T_NONONREG 442
+#define T_OPME 443
+#define T_PREPEND 444
+#define T_PSEUDO 445
+#define T_RECVQ 446
+#define T_REJ 447
+#define T_RESTART 448
+#define T_SERVER 449
+#define T_SERVICE 450
+#define T_SERVNOTICE 451
+#define T_SET 452
+#define T_SHARED 453
+#define T_SIZE 454
+#define T_SKILL 455
+#define T_SOFTCALLERID 456
+#define T_SPY 457
+#define T_TARGET 458
+#define T_TLS 459
+#define T_UMODES 460
+#define T_UNDLINE 461
+#define T_UNLIMITED 462
+#define T_UNRESV 463
+#define T_UNXLINE 464
+#define T_WALLOP 465
+#define T_WALLOPS 466
+#define T_WEBIRC 467
+#define TBOOL 468
+#define THROTTLE_COUNT 469
+#define THROTTLE_TIME 470
+#define TIMEOUT 471
+#define TLS_CERTIFICATE_FILE 472
+#define TLS_CERTIFICATE_FINGERPRINT 473
+#define TLS_CIPHER_LIST 474
+#define TLS_CIPHER_SUITES 475
+#define TLS_CONNECTION_REQUIRED 476
+#define TLS_DH_PARAM_FILE 477
+#define TLS_HANDSHAKE_THREADS 478
+#define TLS_KERNEL_OFFLOAD 479
+#define TLS_MESSAGE_DIGEST_ALGORITHM 480
+#define TLS_SESSION_CACHE_SIZE 481
+#define TLS_SUPPORTED_GROUPS 482
+#define TLS_TICKET_KEY_FILE 483
+#define TS_MAX_DELTA 484
+#define TS_WARN_DELTA 485
+#define TWODOTS 486
+#define TYPE 487
+#define UNKLINE 488
+#define USE_LOGGING 489
+#define USER 490
+#define VHOST 491
+#define VHOST6 492
+#define WARN_NO_CONNECT_BLOCK 493
+#define WHOIS 494
+#define WHOWAS_HISTORY_LENGTH 495
+#define XLINE 496
+#define XLINE_EXEMPT 497
+#define QSTRING 498
+#define NUMBER 499
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 133 "conf_parser.y"
+#line 135 "conf_parser.y"
 
   int number;
   char *string;
 
-#line 524 "conf_parser.h"
+#line 560 "conf_parser.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -531,6 +567,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONF_PARSER_H_INCLUDED  */
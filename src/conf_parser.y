@@ -102,6 +102,8 @@ static struct
     max_total,
     max_sendq,
     max_recvq,
+    flood_burst,
+    flood_rate,
     max_channels,
     cidr_bitlen_ipv4,
     cidr_bitlen_ipv6,
@@ -140,6 +142,7 @@ reset_block_state(void)
 %token  AFTYPE
 %token  ANTI_NICK_FLOOD
 %token  ANTI_SPAM_EXIT_MESSAGE_TIME
+%token  AUTH_TIMEOUT
 %token  AUTOCONN
 %token  AWAY_COUNT
 %token  AWAY_TIME
@@ -181,6 +184,8 @@ reset_block_state(void)
 %token  FLATTEN_LINKS
 %token  FLATTEN_LINKS_DELAY
 %token  FLATTEN_LINKS_FILE
+%token  FLOOD_BURST
+%token  FLOOD_RATE
 %token  GECOS
 %token  GENERAL
 %token  HIDDEN
@@ -194,6 +199,9 @@ reset_block_state(void)
 %token  HOST
 %token  HUB
 %token  HUB_MASK
+%token  IDENT_CACHE_TIME
+%token  IDENT_MAX_PENDING
+%token  IDENT_TIMEOUT
 %token  INVISIBLE_ON_CONNECT
 %token  INVITE_CLIENT_COUNT
 %token  INVITE_CLIENT_TIME
@@ -266,6 +274,7 @@ reset_block_state(void)
 %token  REMOTEBAN
 %token  RESV
 %token  RESV_EXEMPT
+%token  REUSEPORT
 %token  RSA_PRIVATE_KEY_FILE
 %token  SECONDS MINUTES HOURS DAYS WEEKS MONTHS YEARS
 %token  SEND_PASSWORD
@@ -288,6 +297,7 @@ reset_block_state(void)
 %token  T_CCONN
 %token  T_COMMAND
 %token  T_CLUSTER
+%token  T_COMPRESSED
 %token  T_DEAF
 %token  T_DEBUG
 %token  T_DLINE
@@ -301,6 +311,7 @@ reset_block_state(void)
 %token  T_IPV6
 %token  T_LOCOPS
 %token  T_LOG
+%token  T_METRICS
 %token  T_NCHANGE
 %token  T_NONONREG
 %token  T_OPME
@@ -338,8 +349,12 @@ reset_block_state(void)
 %token  TLS_CIPHER_SUITES
 %token  TLS_CONNECTION_REQUIRED
 %token  TLS_DH_PARAM_FILE
+%token  TLS_HANDSHAKE_THREADS
+%token  TLS_KERNEL_OFFLOAD
 %token  TLS_MESSAGE_DIGEST_ALGORITHM
+%token  TLS_SESSION_CACHE_SIZE
 %token  TLS_SUPPORTED_GROUPS
+%token  TLS_TICKET_KEY_FILE
 %token  TS_MAX_DELTA
 %token  TS_WARN_DELTA
 %token  TWODOTS
@@ -456,6 +471,10 @@ serverinfo_item:        serverinfo_name |
                         serverinfo_tls_cipher_list |
                         serverinfo_tls_cipher_suites |
                         serverinfo_tls_message_digest_algorithm |
+                        serverinfo_tls_handshake_threads |
+                        serverinfo_tls_kernel_offload |
+                        serverinfo_tls_session_cache_size |
+                        serverinfo_tls_ticket_key_file |
                         error ';' ;
 
 
@@ -660,6 +679,33 @@ serverinfo_hub: HUB '=' TBOOL ';'
     ConfigServerInfo.hub = yylval.number;
 };
 
+serverinfo_tls_handshake_threads: TLS_HANDSHAKE_THREADS '=' NUMBER ';'
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_handshake_threads = $3;
+};
+
+serverinfo_tls_kernel_offload: TLS_KERNEL_OFFLOAD '=' TBOOL ';'
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_kernel_offload = yylval.number;
+};
+
+serverinfo_tls_session_cache_size: TLS_SESSION_CACHE_SIZE '=' NUMBER ';'
+{
+  if (conf_parser_ctx.pass == 2)
+    ConfigServerInfo.tls_session_cache_size = $3;
+};
+
+serverinfo_tls_ticket_key_file: TLS_TICKET_KEY_FILE '=' QSTRING ';'
+{
+  if (conf_parser_ctx.pass == 2)
+  {
+    xfree(ConfigServerInfo.tls_ticket_key_file);
+    ConfigServerInfo.tls_ticket_key_file = xstrdup(yylval.string);
+  }
+};
+
 
 /***************************************************************************
  * admin {} section
@@ -889,6 +935,10 @@ logging_file_type_item:  USER
 {
   if (conf_parser_ctx.pass == 2)
     block_state.type.value = LOG_TYPE_DEBUG;
+} | T_METRICS
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.type.value = LOG_TYPE_METRICS;
 };
 
 
@@ -1266,6 +1316,8 @@ class_entry: CLASS
   block_state.con_freq.value  = DEFAULT_CONNECTFREQUENCY;
   block_state.max_sendq.value = DEFAULT_SENDQ;
   block_state.max_recvq.value = DEFAULT_RECVQ;
+  block_state.flood_burst.value = DEFAULT_FLOOD_BURST;
+  block_state.flood_rate.value = DEFAULT_FLOOD_RATE;
 } '{' class_items '}' ';'
 {
   if (conf_parser_ctx.pass != 1)
@@ -1288,6 +1340,8 @@ class_entry: CLASS
   class->max_total = block_state.max_total.value;
   class->max_sendq = block_state.max_sendq.value;
   class->max_recvq = block_state.max_recvq.value;
+  class->flood_burst = block_state.flood_burst.value;
+  class->flood_rate = block_state.flood_rate.value;
   class->max_channels = block_state.max_channels.value;
 
   if (block_state.min_idle.value > block_state.max_idle.value)
@@ -1324,6 +1378,8 @@ class_item:     class_name |
                 class_max_number |
                 class_sendq |
                 class_recvq |
+                class_flood_burst |
+                class_flood_rate |
                 class_min_idle |
                 class_max_idle |
                 class_flags |
@@ -1384,6 +1440,20 @@ class_recvq: T_RECVQ '=' sizespec ';'
       block_state.max_recvq.value = $3;
 };
 
+class_flood_burst: FLOOD_BURST '=' NUMBER ';'
+{
+  if (conf_parser_ctx.pass == 1)
+    if ($3 > 0)
+      block_state.flood_burst.value = $3;
+};
+
+class_flood_rate: FLOOD_RATE '=' NUMBER ';'
+{
+  if (conf_parser_ctx.pass == 1)
+    if ($3 > 0)
+      block_state.flood_rate.value = $3;
+};
+
 class_cidr_bitlen_ipv4: CIDR_BITLEN_IPV4 '=' NUMBER ';'
 {
   if (conf_parser_ctx.pass == 1)
@@ -1473,6 +1543,14 @@ listen_flags_item: T_TLS
 {
   if (conf_parser_ctx.pass == 2)
    block_state.flags.value |= LISTENER_DEFER;
+} | REUSEPORT
+{
+  if (conf_parser_ctx.pass == 2)
+   block_state.flags.value |= LISTENER_REUSEPORT;
+} | T_METRICS
+{
+  if (conf_parser_ctx.pass == 2)
+   block_state.flags.value |= LISTENER_METRICS;
 };
 
 listen_items:   listen_items listen_item | listen_item;
@@ -2124,6 +2202,10 @@ connect_flags_item: AUTOCONN
 {
   if (conf_parser_ctx.pass == 2)
     block_state.flags.value |= CONF_FLAGS_TLS;
+} | T_COMPRESSED
+{
+  if (conf_parser_ctx.pass == 2)
+    block_state.flags.value |= CONF_FLAGS_COMPRESSED;
 };
 
 connect_encrypted: ENCRYPTED '=' TBOOL ';'
@@ -2305,8 +2387,7 @@ gecos_entry: GECOS
   if (!block_state.name.buf[0])
     break;
 
-  struct GecosItem *gecos = gecos_make();
-  gecos->mask = xstrdup(block_state.name.buf);
+  struct GecosItem *gecos = gecos_make(block_state.name.buf);
 
   if (block_state.rpass.buf[0])
     gecos->reason = xstrdup(block_state.rpass.buf);
@@ -2374,6 +2455,10 @@ general_item:       general_away_count |
                     general_throttle_time |
                     general_ping_cookie |
                     general_disable_auth |
+                    general_auth_timeout |
+                    general_ident_timeout |
+                    general_ident_cache_time |
+                    general_ident_max_pending |
                     general_dline_min_cidr |
                     general_dline_min_cidr6 |
                     general_kline_min_cidr |
@@ -2569,6 +2654,26 @@ general_disable_auth: DISABLE_AUTH '=' TBOOL ';'
   ConfigGeneral.disable_auth = yylval.number;
 };
 
+general_auth_timeout: AUTH_TIMEOUT '=' timespec ';'
+{
+  ConfigGeneral.auth_timeout = $3;
+};
+
+general_ident_timeout: IDENT_TIMEOUT '=' timespec ';'
+{
+  ConfigGeneral.ident_timeout = $3;
+};
+
+general_ident_cache_time: IDENT_CACHE_TIME '=' timespec ';'
+{
+  ConfigGeneral.ident_cache_time = $3;
+};
+
+general_ident_max_pending: IDENT_MAX_PENDING '=' NUMBER ';'
+{
+  ConfigGeneral.ident_max_pending = $3;
+};
+
 general_throttle_count: THROTTLE_COUNT '=' NUMBER ';'
 {
   ConfigGeneral.throttle_count = $3;
@@ -36,11 +36,26 @@
 #include "conf.h"
 #include "conf_resv.h"
 #include "hostmask.h"
+#include "hash.h"
 
 
 static dlink_list resv_chan_list;
 static dlink_list resv_nick_list;
 
+/*
+ * Besides being on one of the lists above, each RESV is indexed for
+ * resv_match(): those with a plain name are hashed by it, and those with
+ * wildcards go on one of the lists below. A name can thus be checked
+ * with a hash lookup and a walk of the usually short wildcard list.
+ */
+static struct ResvItem *resv_hash[HASHSIZE];
+static dlink_list resv_chan_wild;
+static dlink_list resv_nick_wild;
+
+/*! Bumped whenever a RESV is added or removed, so that verdicts cached
+ *  by the caller of resv_match() can be checked for being current */
+uintmax_t resv_generation = 1;
+
 
 const dlink_list *
 resv_chan_get_list(void)
@@ -72,6 +87,20 @@ resv_delete(struct ResvItem *resv, bool expired)
     xfree(exempt);
   }
 
+  conf_expire_del(&resv->expire_queue);
+
+  if (resv->wild == true)
+    dlinkDelete(&resv->wild_node, resv->list == &resv_chan_list ? &resv_chan_wild : &resv_nick_wild);
+  else
+  {
+    struct ResvItem **prev = &resv_hash[strhash(resv->mask)];
+
+    while (*prev != resv)
+      prev = &(*prev)->hnext;
+    *prev = resv->hnext;
+  }
+
+  ++resv_generation;
   dlinkDelete(&resv->node, resv->list);
   xfree(resv->mask);
   xfree(resv->reason);
@@ -102,6 +131,22 @@ resv_make(const char *mask, const char *reason, const dlink_list *elist)
   resv->reason = xstrndup(reason, IRCD_MIN(strlen(reason), REASONLEN));
   dlinkAdd(resv, &resv->node, resv->list);
 
+  /* A backslash makes match() compare the next character case sensitively */
+  if (strpbrk(resv->mask, "*?\\"))
+  {
+    resv->wild = true;
+    dlinkAdd(resv, &resv->wild_node, list == &resv_chan_list ? &resv_chan_wild : &resv_nick_wild);
+  }
+  else
+  {
+    const unsigned int hashv = strhash(resv->mask);
+
+    resv->hnext = resv_hash[hashv];
+    resv_hash[hashv] = resv;
+  }
+
+  ++resv_generation;
+
   if (elist)
   {
     dlink_node *node;
@@ -140,7 +185,7 @@ resv_make(const char *mask, const char *reason, const dlink_list *elist)
 struct ResvItem *
 resv_find(const char *name, int (*compare)(const char *, const char *))
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
   dlink_list *list;
 
   if (IsChanPrefix(*name))
@@ -148,14 +193,36 @@ resv_find(const char *name, int (*compare)(const char *, const char *))
   else
     list = &resv_nick_list;
 
-  DLINK_FOREACH_SAFE(node, node_next, list->head)
+  DLINK_FOREACH(node, list->head)
+  {
+    struct ResvItem *resv = node->data;
+
+    if (compare(resv->mask, name) == 0)
+      return resv;
+  }
+
+  return NULL;
+}
+
+/*! \brief Finds a RESV that matches a nick or channel name
+ * \param name Nick or channel name
+ * \return Pointer to the RESV, or NULL if there is none. RESVs for the
+ *         exact name take precedence over those with wildcards.
+ */
+struct ResvItem *
+resv_match(const char *name)
+{
+  dlink_node *node;
+
+  for (struct ResvItem *resv = resv_hash[strhash(name)]; resv; resv = resv->hnext)
+    if (irccmp(resv->mask, name) == 0)
+      return resv;
+
+  DLINK_FOREACH(node, IsChanPrefix(*name) ? resv_chan_wild.head : resv_nick_wild.head)
   {
     struct ResvItem *resv = node->data;
 
-    if (resv->expire &&
-        (resv->expire <= event_base->time.sec_real))
-      resv_delete(resv, true);
-    else if (compare(resv->mask, name) == 0)
+    if (match(resv->mask, name) == 0)
       return resv;
   }
 
@@ -213,22 +280,22 @@ resv_clear(void)
   }
 }
 
-void
-resv_expire(void)
+static void
+resv_expire(void *data)
 {
-  dlink_list *tab[] = { &resv_chan_list, &resv_nick_list, NULL };
-
-  for (dlink_list **list = tab; *list; ++list)
-  {
-    dlink_node *node, *node_next;
+  resv_delete(data, true);
+}
 
-    DLINK_FOREACH_SAFE(node, node_next, (*list)->head)
-    {
-      struct ResvItem *resv = node->data;
+/*! \brief Makes a RESV temporary
+ * \param resv   Pointer to RESV
+ * \param expire Real time the RESV expires
+ */
+void
+resv_set_expire(struct ResvItem *resv, uintmax_t expire)
+{
+  conf_expire_del(&resv->expire_queue);
+  resv->expire = expire;
 
-      if (resv->expire &&
-          (resv->expire <= event_base->time.sec_real))
-        resv_delete(resv, true);
-    }
-  }
+  if (expire)
+    conf_expire_add(&resv->expire_queue, expire, resv_expire, resv);
 }
@@ -29,6 +29,8 @@
 #include "dbuf.h"
 #include "memory.h"
 
+unsigned int dbuf_block_count;  /**< Blocks currently allocated */
+
 
 struct dbuf_block *
 dbuf_alloc(void)
@@ -36,6 +38,7 @@ dbuf_alloc(void)
   struct dbuf_block *block = xcalloc(sizeof(*block));
 
   ++block->refs;
+  ++dbuf_block_count;
   return block;
 }
 
@@ -43,7 +46,10 @@ void
 dbuf_ref_free(struct dbuf_block *block)
 {
   if (--block->refs <= 0)
+  {
+    --dbuf_block_count;
     xfree(block);
+  }
 }
 
 void
@@ -135,3 +141,28 @@ dbuf_put(struct dbuf_queue *queue, const char *buf, size_t sz)
     buf += avail;
   }
 }
+
+size_t
+dbuf_copy(const struct dbuf_queue *queue, char *buf, size_t sz)
+{
+  size_t pos = queue->pos, copied = 0;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, queue->blocks.head)
+  {
+    const struct dbuf_block *block = node->data;
+    size_t avail = block->size - pos;
+
+    if (copied == sz)
+      break;
+
+    if (avail > sz - copied)
+      avail = sz - copied;
+
+    memcpy(buf + copied, block->data + pos, avail);
+    copied += avail;
+    pos = 0;
+  }
+
+  return copied;
+}
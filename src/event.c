@@ -134,7 +134,10 @@ event_time_set(void)
 #else
   if (clock_gettime(CLOCK_MONOTONIC, &newtime) == 0)
 #endif
+  {
     event_base->time.sec_monotonic = newtime.tv_sec;
+    event_base->time.msec_monotonic = newtime.tv_sec * UINTMAX_C(1000) + newtime.tv_nsec / 1000000;
+  }
   else
     exit(EXIT_FAILURE);
 }
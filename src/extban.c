@@ -23,6 +23,10 @@
 /*! \file extban.c
  * \brief Implements extended channel bans.
  * \version $Id$
+ *
+ * Besides extban_list, registered extbans are indexed by character and
+ * by the bit their flag occupies, so that parsing a ban mask and
+ * matching a ban against a client look their extban up directly.
  */
 
 #include "stdinc.h"
@@ -35,6 +39,8 @@
 
 
 static dlink_list extban_list;
+static struct Extban *extban_by_char[256];
+static struct Extban *extban_by_bit[32];  /**< Indexed by the position of Extban::flag */
 static unsigned int matching_mask, acting_mask;
 
 
@@ -51,10 +57,24 @@ extban_find_mask(void)
     used |= extban->flag;
   }
 
-  for (i = 1; (i < EXTBAN_MASK) && (used & i); i <<= 1)
+  for (i = 1; (i & EXTBAN_MASK) && (used & i); i <<= 1)
     ;
 
-  return i;
+  return i & EXTBAN_MASK;
+}
+
+static unsigned int
+extban_flag_bit(unsigned int flag)
+{
+  unsigned int bit = 0;
+
+  while ((flag & 1) == 0)
+  {
+    flag >>= 1;
+    ++bit;
+  }
+
+  return bit;
 }
 
 void
@@ -87,6 +107,8 @@ extban_add(struct Extban *extban)
 
   extban->flag = mask;
   dlinkAdd(extban, &extban->node, &extban_list);
+  extban_by_char[extban->character] = extban;
+  extban_by_bit[extban_flag_bit(mask)] = extban;
 
   if (extban->type & EXTBAN_MATCHING)
     matching_mask |= mask;
@@ -101,6 +123,8 @@ extban_del(struct Extban *extban)
     return;
 
   dlinkDelete(&extban->node, &extban_list);
+  extban_by_char[extban->character] = NULL;
+  extban_by_bit[extban_flag_bit(extban->flag)] = NULL;
 
   matching_mask &= ~extban->flag;
   acting_mask &= ~extban->flag;
@@ -109,33 +133,20 @@ extban_del(struct Extban *extban)
 struct Extban *
 extban_find(unsigned char c)
 {
-  dlink_node *node;
-
-  DLINK_FOREACH(node, extban_list.head)
-  {
-    struct Extban *extban = node->data;
-
-    if (extban->character == c)
-      return extban;
-  }
-
-  return NULL;
+  return extban_by_char[c];
 }
 
+/*! \brief Finds the extban a flag belongs to
+ * \param flag Flag of a single extban
+ * \return Pointer to the extban, or NULL if there is none or flag has more than one bit set
+ */
 struct Extban *
 extban_find_flag(unsigned int flag)
 {
-  dlink_node *node;
-
-  DLINK_FOREACH(node, extban_list.head)
-  {
-    struct Extban *extban = node->data;
-
-    if (extban->flag == flag)
-      return extban;
-  }
+  if (flag == 0 || (flag & (flag - 1)))
+    return NULL;
 
-  return NULL;
+  return extban_by_bit[extban_flag_bit(flag)];
 }
 
 enum extban_type
@@ -39,11 +39,9 @@ extban_nick_can_change(struct Channel *channel, struct Client *client,
 {
   assert(member);
 
-  /* Search for matching joinban */
-  if (find_bmask(client, channel, &channel->banlist, &extban_nick) == true)
-    /* Clients who match +e n: override +b n: */
-    if (find_bmask(client, channel, &channel->exceptlist, &extban_nick) == false)
-      return ERR_BANNEDFROMCHAN;
+  /* Search for matching nickban; clients who match +e n: override +b n: */
+  if (ban_verdict(client, channel, extban_nick.flag, NULL))
+    return ERR_BANNEDFROMCHAN;
 
   return 0;
 }
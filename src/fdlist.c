@@ -30,6 +30,7 @@
 #include "s_bsd.h"   /* comm_setselect */
 #include "memory.h"
 #include "misc.h"
+#include "tls_pool.h"
 
 
 fde_t *fd_table;
@@ -115,12 +116,18 @@ fd_close(fde_t *F)
   if (F->flags.is_socket == true)
     comm_setselect(F, COMM_SELECT_WRITE | COMM_SELECT_READ, NULL, NULL, 0);
 
-  if (tls_isusing(&F->tls))
-    tls_free(&F->tls);
-
   xfree(F->desc);
-  /* Unlike squid, we're actually closing the FD here! -- adrian */
-  close(F->fd);
+
+  if (F->tls_job)
+    tls_pool_orphan(F);  /* The worker thread's job closes the fd once it's done */
+  else
+  {
+    if (tls_isusing(&F->tls))
+      tls_free(&F->tls);
+
+    /* Unlike squid, we're actually closing the FD here! -- adrian */
+    close(F->fd);
+  }
   F->flags.open = false;  /* Must set F->flags.open == false before fdlist_update_highest_fd() */
 
   fdlist_update_highest_fd(F->fd, false);
@@ -22,12 +22,21 @@
 /*! \file hash.c
  * \brief Hash table management.
  * \version $Id$
+ *
+ * SIDs and UIDs are looked up by the integer id_decode() turns them
+ * into, which is stored in Client::idnum. Decoding an ID takes a single
+ * pass over its nine characters and needs neither strhash() nor any
+ * string comparison. Clients carrying our own SID are kept in
+ * localIdTable, indexed directly by the lower bits of their UID counter.
+ * uid_get() skips counters whose slot is taken, so a local client is
+ * always found in a single step. Everyone else sits in idTable.
  */
 
 #include "stdinc.h"
 #include "list.h"
 #include "conf.h"
 #include "channel.h"
+#include "channel_index.h"
 #include "channel_mode.h"
 #include "client.h"
 #include "hash.h"
@@ -50,6 +59,10 @@ static struct Client *idTable[HASHSIZE];
 static struct Client *clientTable[HASHSIZE];
 static struct Channel *channelTable[HASHSIZE];
 
+static struct Client **localIdTable;  /**< Clients with our own SID, see above */
+static unsigned int localIdTableSize;  /**< Always a power of two */
+static unsigned int localIdTableCount;
+
 
 /*
  * New hash function based on the Fowler/Noll/Vo (FNV) algorithm from
@@ -130,10 +143,78 @@ hash_add_channel(struct Channel *channel)
   channelTable[hashv] = channel;
 }
 
+static unsigned int
+id_hash(uint64_t id)
+{
+  return (id * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - FNV1_32_BITS);
+}
+
+static bool
+id_is_local(uint64_t id)
+{
+  return (id & ID_SERVER) != ID_SERVER && (id >> 32) == (me.idnum >> 32);
+}
+
+/* local_id_table_grow()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - doubles the size of localIdTable. Clients that had
+ *                distinct slots keep having distinct slots, as the
+ *                bits their slot was picked by still differ.
+ */
+static void
+local_id_table_grow(void)
+{
+  const unsigned int size = localIdTableSize ? localIdTableSize * 2 : 1024;
+  struct Client **table = xcalloc(sizeof(*table) * size);
+
+  for (unsigned int i = 0; i < localIdTableSize; ++i)
+    if (localIdTable[i])
+      table[localIdTable[i]->idnum & (size - 1)] = localIdTable[i];
+
+  xfree(localIdTable);
+  localIdTable = table;
+  localIdTableSize = size;
+}
+
+static struct Client *
+id_table_find(uint64_t id)
+{
+  for (struct Client *client = idTable[id_hash(id)]; client; client = client->idhnext)
+    if (client->idnum == id)
+      return client;
+
+  return NULL;
+}
+
+/* hash_add_id()
+ *
+ * inputs       - pointer to client
+ * output       - NONE
+ * side effects - Adds a client's ID to localIdTable or idTable, and
+ *                stores its decoded form in client->idnum
+ */
 void
 hash_add_id(struct Client *client)
 {
-  const unsigned int hashv = strhash(client->id);
+  client->idnum = id_decode(client->id);
+
+  if (id_is_local(client->idnum))
+  {
+    if (localIdTableCount * 2 >= localIdTableSize)
+      local_id_table_grow();
+
+    struct Client **slot = &localIdTable[client->idnum & (localIdTableSize - 1)];
+    if (*slot == NULL)
+    {
+      *slot = client;
+      ++localIdTableCount;
+      return;
+    }
+  }
+
+  const unsigned int hashv = id_hash(client->idnum);
 
   client->idhnext = idTable[hashv];
   idTable[hashv] = client;
@@ -143,12 +224,23 @@ hash_add_id(struct Client *client)
  *
  * inputs       - pointer to client
  * output       - NONE
- * side effects - Removes an ID from the hash linked list
+ * side effects - Removes an ID from localIdTable or the hash linked list
  */
 void
 hash_del_id(struct Client *client)
 {
-  const unsigned int hashv = strhash(client->id);
+  if (id_is_local(client->idnum))
+  {
+    struct Client **slot = &localIdTable[client->idnum & (localIdTableSize - 1)];
+    if (*slot == client)
+    {
+      *slot = NULL;
+      --localIdTableCount;
+      return;
+    }
+  }
+
+  const unsigned int hashv = id_hash(client->idnum);
   struct Client *tmp = idTable[hashv];
 
   if (tmp)
@@ -170,6 +262,36 @@ hash_del_id(struct Client *client)
   }
 }
 
+/* hash_id_available()
+ *
+ * inputs       - decoded UID carrying our own SID
+ * output       - true if the UID is unused and its slot in
+ *                localIdTable is free
+ * side effects - NONE
+ */
+bool
+hash_id_available(uint64_t id)
+{
+  if (localIdTableSize && localIdTable[id & (localIdTableSize - 1)])
+    return false;
+
+  return id_table_find(id) == NULL;
+}
+
+/* hash_id_local_stats()
+ *
+ * inputs       - pointers to where to store the number of entries
+ *                and slots of localIdTable
+ * output       - NONE
+ * side effects - NONE
+ */
+void
+hash_id_local_stats(unsigned int *count, unsigned int *size)
+{
+  *count = localIdTableCount;
+  *size = localIdTableSize;
+}
+
 /* hash_del_client()
  *
  * inputs       - pointer to client
@@ -272,29 +394,19 @@ hash_find_client(const char *name)
 struct Client *
 hash_find_id(const char *name)
 {
-  const unsigned int hashv = strhash(name);
-  struct Client *client;
+  const uint64_t id = id_decode(name);
 
-  if ((client = idTable[hashv]))
-  {
-    if (strcmp(name, client->id))
-    {
-      struct Client *prev;
+  if (id == 0)
+    return NULL;
 
-      while (prev = client, (client = client->idhnext))
-      {
-        if (strcmp(name, client->id) == 0)
-        {
-          prev->idhnext = client->idhnext;
-          client->idhnext = idTable[hashv];
-          idTable[hashv] = client;
-          break;
-        }
-      }
-    }
+  if (localIdTableSize && id_is_local(id))
+  {
+    struct Client *client = localIdTable[id & (localIdTableSize - 1)];
+    if (client && client->idnum == id)
+      return client;
   }
 
-  return client;
+  return id_table_find(id);
 }
 
 struct Client *
@@ -488,10 +600,10 @@ list_allow_channel(const char *name, const struct ListTask *lt)
  * inputs       - client pointer to return result to
  *              - pointer to channel to list
  *              - pointer to ListTask structure
- * output	- none
+ * output	- true if the channel has been listed
  * side effects -
  */
-static void
+static bool
 list_one_channel(struct Client *client, struct Channel *channel)
 {
   const struct ListTask *const lt = client->connection->list_task;
@@ -502,7 +614,7 @@ list_one_channel(struct Client *client, struct Channel *channel)
 
   if (SecretChannel(channel) &&
       !(HasUMode(client, UMODE_ADMIN) || (member = member_find_link(client, channel))))
-    return;
+    return false;
 
   if (dlink_list_length(&channel->members) < lt->users_min ||
       dlink_list_length(&channel->members) > lt->users_max ||
@@ -512,13 +624,13 @@ list_one_channel(struct Client *client, struct Channel *channel)
       (unsigned int)channel->topic_time < lt->topicts_min ||
       (channel->topic_time ? (unsigned int)channel->topic_time : UINT_MAX) >
       lt->topicts_max)
-    return;
+    return false;
 
   if (lt->topic[0] && match(lt->topic, channel->topic))
-    return;
+    return false;
 
   if (list_allow_channel(channel->name, lt) == false)
-    return;
+    return false;
 
   channel_modes(channel, client, member, modebuf, parabuf);
 
@@ -530,6 +642,45 @@ list_one_channel(struct Client *client, struct Channel *channel)
   sendto_one_numeric(client, &me, RPL_LIST, channel->name,
                      dlink_list_length(&channel->members),
                      listbuf, channel->topic);
+  return true;
+}
+
+/* list_walk_index()
+ *
+ * inputs       - pointer to client requesting list
+ * output       - true if done, false if there is more to list once
+ *                the client's sendq has drained
+ * side effects - lists channels in the order of the index chosen for
+ *                the list task, starting at the key stored in it
+ */
+static bool
+list_walk_index(struct Client *client)
+{
+  struct ListTask *const lt = client->connection->list_task;
+  const size_t prefix_len = strlen(lt->prefix);
+  struct ChannelIndexNode *node = channel_index_seek(lt->index, lt->index_users, lt->index_name, false);
+
+  for (; node; node = node->next[0])
+  {
+    if (lt->index == CHANNEL_INDEX_USERS && node->users < lt->users_min)
+      break;  /* Only smaller channels from here on */
+
+    if (lt->index == CHANNEL_INDEX_NAME && ircncmp(node->channel->name, lt->prefix, prefix_len))
+      break;  /* Past the last name with our prefix */
+
+    if (exceeding_sendq(client) == true)
+    {
+      lt->index_users = node->users;
+      strlcpy(lt->index_name, node->channel->name, sizeof(lt->index_name));
+      return false;  /* Still more to do */
+    }
+
+    if (list_one_channel(client, node->channel) == true)
+      if (--lt->top_max == 0)
+        break;
+  }
+
+  return true;
 }
 
 /* safe_list_channels()
@@ -549,7 +700,12 @@ safe_list_channels(struct Client *client, bool only_unmasked_channels)
   struct ListTask *const lt = client->connection->list_task;
   struct Channel *channel;
 
-  if (only_unmasked_channels == false)
+  if (only_unmasked_channels == false && lt->index != CHANNEL_INDEX_LAST)
+  {
+    if (list_walk_index(client) == false)
+      return;  /* Still more to do */
+  }
+  else if (only_unmasked_channels == false)
   {
     for (unsigned int i = lt->hash_index; i < HASHSIZE; ++i)
     {
@@ -22,6 +22,15 @@
 /*! \file hostmask.c
  * \brief Code to efficiently find IP & hostmask based configs.
  * \version $Id$
+ *
+ * A rehash doesn't throw away the address records that came from
+ * ircd.conf. address_conf_mark_stale() merely marks them; while the new
+ * configuration is parsed, add_conf_by_address() takes over a stale
+ * record identical to the one being added instead of linking a new
+ * one, and address_conf_sweep_stale() finally removes the records that
+ * haven't been taken over. With a large number of auth {} and exempt {}
+ * blocks most of them stay in place, and the caller learns whether any
+ * bans may now apply to clients they didn't apply to before.
  */
 
 #include "stdinc.h"
@@ -47,6 +56,10 @@
 /* Hashtable stuff...now external as it's used in m_stats.c */
 dlink_list atable[ATABLE_SIZE];
 
+static unsigned int address_precedence = UINT_MAX;  /**< Precedence of the next record added */
+static unsigned int address_stale_count;  /**< Records marked by address_conf_mark_stale() */
+static unsigned int address_added;  /**< Types of records added since, as (1 << type) bits */
+
 /* The mask parser/type determination code... */
 
 /* int try_parse_v6_netmask(const char *, struct irc_ssaddr *, int *);
@@ -309,6 +322,34 @@ address_compare(const void *p1, const void *p2, bool exact, bool port, int bits)
   return false;
 }
 
+/* address_format()
+ *
+ * inputs       - address to format
+ *              - buffer and its size
+ * output       - NONE
+ * side effects - buf holds the same string getnameinfo(NI_NUMERICHOST)
+ *                would have produced
+ */
+void
+address_format(const struct irc_ssaddr *addr, char *buf, size_t size)
+{
+  char tmp[INET6_ADDRSTRLEN];
+
+  if (addr->ss.ss_family == AF_INET)
+    address_ntop(AF_INET, &((const struct sockaddr_in *)addr)->sin_addr, tmp);
+  else if (addr->ss.ss_family == AF_INET6 && ((const struct sockaddr_in6 *)addr)->sin6_scope_id == 0)
+    address_ntop(AF_INET6, &((const struct sockaddr_in6 *)addr)->sin6_addr, tmp);
+  else
+  {
+    /* Scoped addresses are rare enough to leave the "%scope" suffix to the C library */
+    if (getnameinfo((const struct sockaddr *)addr, addr->ss_len, buf, size, NULL, 0, NI_NUMERICHOST))
+      strlcpy(buf, "", size);
+    return;
+  }
+
+  strlcpy(buf, tmp, size);
+}
+
 /* The address matching stuff... */
 /* int match_ipv6(struct irc_ssaddr *, struct irc_ssaddr *, int)
  * Input: An IP address, an IP mask, the number of bits in the mask.
@@ -604,9 +645,107 @@ find_dline_conf(const struct irc_ssaddr *addr)
   return find_conf_by_address(NULL, addr, CONF_DLINE, NULL, NULL, 1);
 }
 
+static void
+hostmask_send_expiration(const struct AddressRec *const arec)
+{
+  char ban_type = '?';
+
+  switch (arec->type)
+  {
+    case CONF_KLINE:
+      ban_type = 'K';
+      break;
+    case CONF_DLINE:
+      ban_type = 'D';
+      break;
+    default: break;
+  }
+
+  sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE,
+                       "Temporary %c-line for [%s@%s] expired", ban_type,
+                       (arec->conf->user) ? arec->conf->user : "*",
+                       (arec->conf->host) ? arec->conf->host : "*");
+}
+
+/* hostmask_expire()
+ *
+ * inputs       - pointer to the address record of a temporary K/D-line
+ * output       - NONE
+ * side effects - the K/D-line has expired and is removed
+ */
+static void
+hostmask_expire(void *data)
+{
+  struct AddressRec *arec = data;
+
+  hostmask_send_expiration(arec);
+
+  dlinkDelete(&arec->node, arec->list);
+  conf_free(arec->conf);
+  xfree(arec);
+}
+
+static bool
+address_string_equal(const char *s1, const char *s2)
+{
+  if (s1 == NULL || s2 == NULL)
+    return s1 == s2;
+  return strcmp(s1, s2) == 0;
+}
+
+/* address_conf_revive()
+ *
+ * inputs       - pointer to record that is about to be added
+ * output       - pointer to a stale record in the same bucket whose
+ *                conf is identical, or NULL if there is none
+ * side effects - the record returned is no longer stale
+ */
+static struct AddressRec *
+address_conf_revive(const struct AddressRec *arec)
+{
+  const struct MaskItem *const conf = arec->conf;
+  dlink_node *node;
+
+  DLINK_FOREACH(node, arec->list->head)
+  {
+    struct AddressRec *old = node->data;
+
+    if (old->stale == false || old->type != arec->type || old->masktype != arec->masktype)
+      continue;
+
+    /* Rule out most records before looking at their conf */
+    if (arec->masktype == HM_HOST)
+    {
+      if (strcmp(old->Mask.hostname, arec->Mask.hostname))
+        continue;
+    }
+    else if (old->Mask.ipa.bits != arec->Mask.ipa.bits ||
+             address_compare(&old->Mask.ipa.addr, &arec->Mask.ipa.addr, true, false, 0) == false)
+      continue;
+
+    const struct MaskItem *const oldconf = old->conf;
+    if (oldconf->flags == conf->flags && oldconf->port == conf->port &&
+        oldconf->class == conf->class &&
+        address_string_equal(oldconf->user, conf->user) &&
+        address_string_equal(oldconf->host, conf->host) &&
+        address_string_equal(oldconf->passwd, conf->passwd) &&
+        address_string_equal(oldconf->name, conf->name) &&
+        address_string_equal(oldconf->reason, conf->reason))
+    {
+      old->stale = false;
+      --address_stale_count;
+      return old;
+    }
+  }
+
+  return NULL;
+}
+
 /* void add_conf_by_address(int, struct MaskItem *aconf)
  * Input:
- * Output: None
+ * Output: The record conf has been added with. During a rehash, this may
+ *         be an identical record left from the previous configuration,
+ *         in which case conf has been freed.
  * Side-effects: Adds this entry to the hash table.
  */
 struct AddressRec *
@@ -614,7 +753,6 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
 {
   const char *const hostname = conf->host;
   const char *const username = conf->user;
-  static unsigned int prec_value = UINT_MAX;
   int bits = 0;
 
   assert(type && !EmptyString(hostname));
@@ -624,7 +762,7 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
   arec->Mask.ipa.bits = bits;
   arec->username = username;
   arec->conf = conf;
-  arec->precedence = prec_value--;
+  arec->precedence = address_precedence--;
   arec->type = type;
 
   switch (arec->masktype)
@@ -632,19 +770,39 @@ add_conf_by_address(const unsigned int type, struct MaskItem *conf)
     case HM_IPV4:
       /* We have to do this, since we do not re-hash for every bit -A1kmm. */
       bits -= bits % 8;
-      dlinkAdd(arec, &arec->node, &atable[hash_ipv4(&arec->Mask.ipa.addr, bits)]);
+      arec->list = &atable[hash_ipv4(&arec->Mask.ipa.addr, bits)];
       break;
     case HM_IPV6:
       /* We have to do this, since we do not re-hash for every bit -A1kmm. */
       bits -= bits % 16;
-      dlinkAdd(arec, &arec->node, &atable[hash_ipv6(&arec->Mask.ipa.addr, bits)]);
+      arec->list = &atable[hash_ipv6(&arec->Mask.ipa.addr, bits)];
       break;
     default: /* HM_HOST */
       arec->Mask.hostname = hostname;
-      dlinkAdd(arec, &arec->node, &atable[get_mask_hash(hostname)]);
+      arec->list = &atable[get_mask_hash(hostname)];
       break;
   }
 
+  if (address_stale_count && !IsConfDatabase(conf))
+  {
+    struct AddressRec *old = address_conf_revive(arec);
+
+    if (old)
+    {
+      /* Keep the order of the new configuration file */
+      old->precedence = arec->precedence;
+      xfree(arec);
+      conf_free(conf);
+      return old;
+    }
+  }
+
+  address_added |= 1U << type;
+  dlinkAdd(arec, &arec->node, arec->list);
+
+  if ((type == CONF_KLINE || type == CONF_DLINE) && conf->until)
+    conf_expire_add(&arec->expire, conf->until, hostmask_expire, arec);
+
   return arec;
 }
 
@@ -686,6 +844,7 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
     if (arec->conf == conf)
     {
       dlinkDelete(&arec->node, &atable[hv]);
+      conf_expire_del(&arec->expire);
 
       if (conf->ref_count == 0)
         conf_free(conf);
@@ -696,88 +855,82 @@ delete_one_address_conf(const char *address, struct MaskItem *conf)
   }
 }
 
-/* void clear_out_address_conf(void)
- * Input: None
- * Output: None
- * Side effects: Clears out all address records in the hash table,
- *               frees them, and frees the MaskItems if nothing references
- *               them, otherwise sets them as illegal.
+/* address_conf_mark_stale()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - marks all address records that came from ircd.conf as
+ *                stale, to be taken over by add_conf_by_address() or
+ *                removed by address_conf_sweep_stale()
  */
 void
-clear_out_address_conf(void)
+address_conf_mark_stale(void)
 {
-  dlink_node *node, *node_next;
+  dlink_node *node;
+
+  address_stale_count = 0;
+  address_added = 0;
 
   for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
   {
-    DLINK_FOREACH_SAFE(node, node_next, atable[i].head)
+    DLINK_FOREACH(node, atable[i].head)
     {
       struct AddressRec *arec = node->data;
 
       /*
-       * Destroy the ircd.conf items and keep those that are in the databases
+       * Only the ircd.conf items are replaced; keep those that are in the databases
        */
       if (IsConfDatabase(arec->conf))
         continue;
 
-      dlinkDelete(&arec->node, &atable[i]);
-      arec->conf->active = false;
-
-      if (arec->conf->ref_count == 0)
-        conf_free(arec->conf);
-      xfree(arec);
+      arec->stale = true;
+      ++address_stale_count;
     }
   }
 }
 
-static void
-hostmask_send_expiration(const struct AddressRec *const arec)
-{
-  char ban_type = '?';
-
-  switch (arec->type)
-  {
-    case CONF_KLINE:
-      ban_type = 'K';
-      break;
-    case CONF_DLINE:
-      ban_type = 'D';
-      break;
-    default: break;
-  }
-
-  sendto_realops_flags(UMODE_EXPIRATION, L_ALL, SEND_NOTICE,
-                       "Temporary %c-line for [%s@%s] expired", ban_type,
-                       (arec->conf->user) ? arec->conf->user : "*",
-                       (arec->conf->host) ? arec->conf->host : "*");
-}
-
-void
-hostmask_expire_temporary(void)
+/* address_conf_sweep_stale()
+ *
+ * inputs       - NONE
+ * output       - (1 << type) bits of the K- and D-line types that may
+ *                match clients they didn't match before
+ * side effects - Removes the address records that are still stale,
+ *                frees them, and frees the MaskItems if nothing
+ *                references them, otherwise sets them as illegal.
+ */
+unsigned int
+address_conf_sweep_stale(void)
 {
+  unsigned int removed = 0, changed = 0;
   dlink_node *node, *node_next;
 
-  for (unsigned int i = 0; i < ATABLE_SIZE; ++i)
+  for (unsigned int i = 0; i < ATABLE_SIZE && address_stale_count; ++i)
   {
     DLINK_FOREACH_SAFE(node, node_next, atable[i].head)
     {
       struct AddressRec *arec = node->data;
 
-      if (arec->conf->until == 0 || arec->conf->until > event_base->time.sec_real)
+      if (arec->stale == false)
         continue;
 
-      switch (arec->type)
-      {
-        case CONF_KLINE:
-        case CONF_DLINE:
-          hostmask_send_expiration(arec);
-
-          dlinkDelete(&arec->node, &atable[i]);
-          conf_free(arec->conf);
-          xfree(arec);
-          break;
-        default: break;
-      }
+      removed |= 1U << arec->type;
+      --address_stale_count;
+
+      dlinkDelete(&arec->node, &atable[i]);
+      conf_expire_del(&arec->expire);
+      arec->conf->active = false;
+
+      if (arec->conf->ref_count == 0)
+        conf_free(arec->conf);
+      xfree(arec);
     }
   }
+
+  assert(address_stale_count == 0);
+
+  changed = address_added & ((1U << CONF_KLINE) | (1U << CONF_DLINE));
+  if (removed & (1U << CONF_EXEMPT))
+    changed |= 1U << CONF_DLINE;  /* D-lines may no longer be overruled */
+
+  return changed;
 }
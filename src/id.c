@@ -28,39 +28,81 @@
 #include "id.h"
 #include "irc_string.h"
 #include "client.h"
+#include "hash.h"
+
+/* UID counter digits in ascending order; see id_decode() */
+static const char id_digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+static const uint64_t id_counter_limit = UINT64_C(2176782336);  /* 36^IRC_MAXUID */
 
 static char new_uid[TOTALSIDUID + 1];  /* Allow for \0 */
+static uint64_t uid_sid;  /**< Our own SID as decoded by id_decode() */
+static uint64_t uid_counter;  /**< The part of new_uid after our SID, decoded */
 
-bool
-valid_sid(const char *sid)
+
+static int
+id_digit_value(unsigned char c)
 {
-  if (strlen(sid) != IRC_MAXSID)
-    return false;
+  if (c >= 'A' && c <= 'Z')
+    return c - 'A';
+  if (c >= '0' && c <= '9')
+    return c - '0' + 26;
+  return -1;
+}
 
-  if (!IsDigit(*sid))
-    return false;
+/*! \brief Decodes a SID or UID into an integer
+ * \param id SID or UID to decode
+ * \return 0 if id is neither a valid SID nor a valid UID. Otherwise the
+ *         SID in base 36 in the upper 32 bits and either the rest of a
+ *         UID in base 36, or ID_SERVER for a SID, in the lower 32 bits.
+ *
+ * Digits count 'A' to 'Z', then '0' to '9', which is the order uid_get()
+ * hands out UIDs in.
+ */
+uint64_t
+id_decode(const char *id)
+{
+  uint64_t sid = 0, counter = 0;
+  unsigned int i = 0;
 
-  for (unsigned int i = 1; i < IRC_MAXSID; ++i)
-    if (!IsUpper(*(sid + i)) && !IsDigit(*(sid + i)))
-      return false;
+  if (!IsDigit(*id))
+    return 0;
 
-  return true;
+  for (; i < IRC_MAXSID; ++i)
+  {
+    const int value = id_digit_value(id[i]);
+    if (value < 0)
+      return 0;
+    sid = sid * 36 + value;
+  }
+
+  if (id[i] == '\0')
+    return sid << 32 | ID_SERVER;
+
+  for (; i < TOTALSIDUID; ++i)
+  {
+    const int value = id_digit_value(id[i]);
+    if (value < 0)
+      return 0;
+    counter = counter * 36 + value;
+  }
+
+  if (id[i] != '\0')
+    return 0;
+
+  return sid << 32 | counter;
 }
 
 bool
-valid_uid(const char *uid)
+valid_sid(const char *sid)
 {
-  if (strlen(uid) != TOTALSIDUID)
-    return false;
-
-  if (!IsDigit(*uid))
-    return false;
-
-  for (unsigned int i = 1; i < TOTALSIDUID; ++i)
-    if (!IsUpper(*(uid + i)) && !IsDigit(*(uid + i)))
-      return false;
+  return (id_decode(sid) & ID_SERVER) == ID_SERVER;
+}
 
-  return true;
+bool
+valid_uid(const char *uid)
+{
+  const uint64_t id = id_decode(uid);
+  return id && (id & ID_SERVER) != ID_SERVER;
 }
 
 /*
@@ -76,44 +118,33 @@ void
 init_uid(void)
 {
   snprintf(new_uid, sizeof(new_uid), "%s999999", me.id);
-}
-
-/*
- * add_one_to_uid
- *
- * inputs       - index number into new_uid
- * output       - NONE
- * side effects - new_uid is incremented by one
- *                note this is a recursive function
- */
-static void
-add_one_to_uid(unsigned int i)
-{
-  if (i < IRC_MAXSID)
-    return;
-
-  if (new_uid[i] == 'Z')
-    new_uid[i] = '0';
-  else if (new_uid[i] == '9')
-  {
-    new_uid[i] = 'A';
-    add_one_to_uid(i - 1);
-  }
-  else
-    ++new_uid[i];
+  uid_sid = id_decode(me.id) & ~(uint64_t)ID_SERVER;
+  uid_counter = id_counter_limit - 1;
 }
 
 /*
  * uid_get
  *
- * inputs       - struct Client *
+ * inputs       - NONE
  * output       - new UID is returned to caller
- * side effects - new_uid is incremented by one.
+ * side effects - new_uid is advanced to the next UID that is neither
+ *                in use nor conflicts with one in hash.c's table of
+ *                our own clients. The table is kept at most half full,
+ *                so this takes a step or two only.
  */
 const char *
 uid_get(void)
 {
-  add_one_to_uid(TOTALSIDUID - 1);  /* Index from 0 */
+  do
+  {
+    if (++uid_counter == id_counter_limit)
+      uid_counter = 0;
+  } while (hash_id_available(uid_sid | uid_counter) == false);
+
+  uint64_t counter = uid_counter;
+  for (unsigned int i = TOTALSIDUID; i-- > IRC_MAXSID; counter /= 36)
+    new_uid[i] = id_digits[counter % 36];
+
   return new_uid;
 }
 
@@ -81,7 +81,8 @@ ipcache_record_delete(patricia_node_t *pnode)
   struct ip_entry *iptr = PATRICIA_DATA_GET(pnode, struct ip_entry);
 
   if (iptr->count_local == 0 && iptr->count_remote == 0 &&
-      (event_base->time.sec_monotonic - iptr->last_attempt) >= ConfigGeneral.throttle_time)
+      (event_base->time.sec_monotonic - iptr->last_attempt) >= ConfigGeneral.throttle_time &&
+      iptr->ident_fail_until <= event_base->time.sec_monotonic)
   {
     patricia_remove(iptr->trie_pointer, pnode);
 
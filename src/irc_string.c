@@ -221,3 +221,129 @@ strlcpy(char *dst, const char *src, size_t dsize)
   return src - osrc - 1;  /* count does not include NUL */
 }
 #endif
+
+/* address_ntop4()
+ *
+ * inputs       - pointer to 4 byte address in network byte order
+ *              - buffer of at least INET_ADDRSTRLEN bytes
+ * output       - pointer to the terminating '\0' written to buf
+ * side effects - NONE
+ */
+static char *
+address_ntop4(const unsigned char *src, char *p)
+{
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    const unsigned int octet = src[i];
+
+    if (i)
+      *p++ = '.';
+    if (octet >= 100)
+      *p++ = '0' + octet / 100;
+    if (octet >= 10)
+      *p++ = '0' + octet / 10 % 10;
+    *p++ = '0' + octet % 10;
+  }
+
+  *p = '\0';
+  return p;
+}
+
+/* address_ntop6()
+ *
+ * inputs       - pointer to 16 byte address in network byte order
+ *              - buffer of at least INET6_ADDRSTRLEN bytes
+ * output       - pointer to the terminating '\0' written to buf
+ * side effects - NONE
+ *
+ * Follows the rules of the BIND/glibc inet_ntop(): the first of the
+ * longest runs of at least two zero words is shortened to "::", and
+ * "::a.b.c.d" and "::ffff:a.b.c.d" addresses end in dotted quad form.
+ */
+static char *
+address_ntop6(const unsigned char *src, char *p)
+{
+  static const char hex[] = "0123456789abcdef";
+  unsigned int words[8];
+  int best_base = -1, best_len = 0, cur_base = -1, cur_len = 0;
+
+  for (int i = 0; i < 8; ++i)
+  {
+    words[i] = (src[i * 2] << 8) | src[i * 2 + 1];
+
+    if (words[i])
+    {
+      cur_base = -1;
+      continue;
+    }
+
+    if (cur_base == -1)
+    {
+      cur_base = i;
+      cur_len = 0;
+    }
+
+    if (++cur_len > best_len)
+    {
+      best_base = cur_base;
+      best_len = cur_len;
+    }
+  }
+
+  if (best_len < 2)
+    best_base = -1;
+
+  for (int i = 0; i < 8; ++i)
+  {
+    if (best_base != -1 && i >= best_base && i < best_base + best_len)
+    {
+      if (i == best_base)
+        *p++ = ':';
+      continue;
+    }
+
+    if (i)
+      *p++ = ':';
+
+    if (i == 6 && best_base == 0 && (best_len == 6 || (best_len == 5 && words[5] == 0xffff)))
+      return address_ntop4(src + 12, p);
+
+    const unsigned int word = words[i];
+    if (word >= 0x1000)
+      *p++ = hex[word >> 12];
+    if (word >= 0x100)
+      *p++ = hex[(word >> 8) & 0xf];
+    if (word >= 0x10)
+      *p++ = hex[(word >> 4) & 0xf];
+    *p++ = hex[word & 0xf];
+  }
+
+  if (best_base != -1 && best_base + best_len == 8)
+    *p++ = ':';
+
+  *p = '\0';
+  return p;
+}
+
+/* address_ntop()
+ *
+ * inputs       - AF_INET or AF_INET6
+ *              - pointer to address in network byte order
+ *              - buffer of at least INET6_ADDRSTRLEN bytes
+ * output       - length of the string written to buf, 0 if the
+ *                address family is unknown
+ * side effects - NONE
+ *
+ * Same output as inet_ntop(), without going through the C library.
+ */
+size_t
+address_ntop(int family, const void *src, char *buf)
+{
+  if (family == AF_INET)
+    return address_ntop4(src, buf) - buf;
+  if (family == AF_INET6)
+    return address_ntop6(src, buf) - buf;
+
+  buf[0] = '\0';
+  return 0;
+}
@@ -31,6 +31,7 @@
 #include "channel.h"
 #include "channel_mode.h"
 #include "client.h"
+#include "client_index.h"
 #include "event.h"
 #include "fdlist.h"
 #include "hash.h"
@@ -38,6 +39,7 @@
 #include "irc_string.h"
 #include "ircd_signal.h"
 #include "motd.h"
+#include "monitor.h"
 #include "conf.h"
 #include "hostmask.h"
 #include "parse.h"
@@ -47,6 +49,8 @@
 #include "s_bsd.h"
 #include "log.h"
 #include "server.h"
+#include "server_burst.h"
+#include "server_zip.h"
 #include "server_capab.h"
 #include "send.h"
 #include "modules.h"
@@ -57,6 +61,7 @@
 #include "isupport.h"
 #include "patchlevel.h"
 #include "extban.h"
+#include "loop_stats.h"
 
 
 struct SetOptions GlobalSetOptions;  /* /quote set variables */
@@ -146,12 +151,33 @@ io_loop(void)
         safe_list_channels(node->data, false);
     }
 
+    if (bursting_server_list.head)
+    {
+      dlink_node *node = NULL, *node_next = NULL;
+      DLINK_FOREACH_SAFE(node, node_next, bursting_server_list.head)
+        server_burst_continue(node->data);
+    }
+
     /* Run pending events */
     event_run();
 
+    /* Send out the mode changes this iteration has queued */
+    channel_mode_flush();
+
+    /* Send out the RPL_MONONLINE replies this iteration has queued */
+    monitor_flush();
+
+    /* Write out what this iteration has produced for compressed server links */
+    server_zip_flush();
+    loop_stats_stage(LOOP_STAGE_EVENTS);
+
     comm_select();
+    loop_stats_stage(LOOP_STAGE_IO);
+
     exit_aborted_clients();
     free_exited_clients();
+    loop_stats_stage(LOOP_STAGE_EXIT);
+    loop_stats_iteration();
 
     /* Check to see whether we have to rehash the configuration. */
     if (dorehash == true)
@@ -409,6 +435,7 @@ main(int argc, char *argv[])
   isupport_init();
   ipcache_init();
   client_init();
+  client_index_init();
   class_init();
   resolver_init();      /* Needs to be setup before the io loop */
   modules_init();
@@ -490,6 +517,7 @@ main(int argc, char *argv[])
   }
 
   ilog(LOG_TYPE_IRCD, "Server ready. Running version: %s", PATCHLEVEL);
+  loop_stats_init();
   io_loop();
 
   return 0;
@@ -25,17 +25,21 @@
  */
 
 #include "stdinc.h"
+#include <sys/un.h>
 #include "list.h"
 #include "listener.h"
 #include "client.h"
+#include "event.h"
 #include "fdlist.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "ircd_defs.h"
 #include "s_bsd.h"
 #include "conf.h"
+#include "hostmask.h"
 #include "send.h"
 #include "memory.h"
+#include "metrics.h"
 
 #define TOOFAST_WARNING "ERROR :Your host is trying to (re)connect too fast -- throttled.\r\n"
 #define DLINE_WARNING "ERROR :You have been D-lined.\r\n"
@@ -96,6 +100,38 @@ listener_count_memory(unsigned int *count, size_t *bytes)
   (*bytes) = *count * sizeof(struct Listener);
 }
 
+/*! \brief Returns the number of connections a listener has accepted
+ *         during the last full second
+ * \param listener Pointer to listener
+ */
+unsigned int
+listener_accept_rate(const struct Listener *listener)
+{
+  if (listener->rate_time + 1 == event_base->time.sec_monotonic)
+    return listener->rate_count;
+  if (listener->rate_time == event_base->time.sec_monotonic)
+    return listener->rate_last;
+  return 0;
+}
+
+static void
+listener_count_accept(struct Listener *listener)
+{
+  if (listener->rate_time != event_base->time.sec_monotonic)
+  {
+    if (listener->rate_time + 1 == event_base->time.sec_monotonic)
+      listener->rate_last = listener->rate_count;
+    else
+      listener->rate_last = 0;
+
+    listener->rate_time = event_base->time.sec_monotonic;
+    listener->rate_count = 0;
+  }
+
+  ++listener->rate_count;
+  ++listener->accepted;
+}
+
 static void
 listener_accept_connection(fde_t *F, void *data)
 {
@@ -103,12 +139,12 @@ listener_accept_connection(fde_t *F, void *data)
   struct irc_ssaddr addr;
   int fd;
   int pe;
+  unsigned int budget = LISTENER_ACCEPT_BUDGET;
   struct Listener *const listener = data;
 
   assert(listener);
-  assert(listener->fd == F);
-  assert(listener->fd);
-  assert(listener->fd->flags.open);
+  assert(listener->fd_count);
+  assert(F->flags.open);
 
   /* There may be many reasons for error return, but
    * in otherwise correctly working environment the
@@ -119,8 +155,12 @@ listener_accept_connection(fde_t *F, void *data)
    * Thus no specific errors are tested at this
    * point, just assume that connections cannot
    * be accepted until some old is closed first.
+   *
+   * Anything left over after LISTENER_ACCEPT_BUDGET connections waits
+   * for the next event loop iteration, so that a connection flood
+   * doesn't hold up everyone who is already connected.
    */
-  while ((fd = comm_accept(listener->fd, &addr)) != -1)
+  while (budget-- && (fd = comm_accept(F, &addr)) != -1)
   {
     /*
      * check for connection limit
@@ -128,6 +168,7 @@ listener_accept_connection(fde_t *F, void *data)
     if (number_fd > hard_fdlimit - 10)
     {
       ++ServerStats.is_ref;
+      ++listener->dropped;
       sendto_realops_flags_ratelimited(&rate, "All connections in use. (%s)",
                                        listener_get_name(listener));
 
@@ -138,6 +179,13 @@ listener_accept_connection(fde_t *F, void *data)
       break;    /* jump out and re-register a new io request */
     }
 
+    if (listener->flags & LISTENER_METRICS)
+    {
+      listener_count_accept(listener);
+      metrics_accept(fd);
+      continue;
+    }
+
     /*
      * Do an initial check we aren't connecting too fast or with too many
      * from this IP...
@@ -145,6 +193,7 @@ listener_accept_connection(fde_t *F, void *data)
     if ((pe = conf_connect_allowed(&addr)))
     {
       ++ServerStats.is_ref;
+      ++listener->dropped;
 
       if (!(listener->flags & LISTENER_TLS))
       {
@@ -164,19 +213,20 @@ listener_accept_connection(fde_t *F, void *data)
     }
 
     ++ServerStats.is_ac;
+    listener_count_accept(listener);
     add_connection(listener, &addr, fd);
   }
 
   /* Re-register a new IO request for the next accept .. */
-  comm_setselect(listener->fd, COMM_SELECT_READ, listener_accept_connection,
+  comm_setselect(F, COMM_SELECT_READ, listener_accept_connection,
                  listener, 0);
 }
 
 
 /*
- * inetport - create a listener socket in the AF_INET or AF_INET6 domain,
- * bind it to the port given in 'port' and listen to it
- * returns true (1) if successful false (0) on error.
+ * inetport - create listener sockets in the AF_INET or AF_INET6 domain,
+ * bind them to the port given in 'port' and listen to them
+ * returns true (1) if at least one is listening, false (0) on error.
  *
  * If the operating system has a define for SOMAXCONN, use it, otherwise
  * use HYBRID_SOMAXCONN
@@ -186,14 +236,18 @@ listener_accept_connection(fde_t *F, void *data)
 #define HYBRID_SOMAXCONN SOMAXCONN
 #endif
 
-static bool
-inetport(struct Listener *listener)
+/* listener_socket()
+ *
+ * inputs       - pointer to listener
+ *              - whether the socket is to join a SO_REUSEPORT group
+ * output       - listening socket, or -1 on error
+ * side effects - NONE
+ */
+static int
+listener_socket(struct Listener *listener, bool reuseport)
 {
   socklen_t opt = 1;
 
-  getnameinfo((const struct sockaddr *)&listener->addr, listener->addr.ss_len, listener->name,
-              sizeof(listener->name), NULL, 0, NI_NUMERICHOST);
-
   /*
    * At first, open a new socket
    */
@@ -202,17 +256,28 @@ inetport(struct Listener *listener)
   {
     report_error(L_ALL, "opening listener socket %s:%s",
                  listener_get_name(listener), errno);
-    return false;
+    return -1;
   }
 
-  if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
+  if (listener->addr.ss.ss_family != AF_UNIX &&
+      setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
   {
     report_error(L_ALL, "setting SO_REUSEADDR for listener %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return false;
+    return -1;
   }
 
+#ifdef SO_REUSEPORT
+  if (reuseport == true && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)))
+  {
+    report_error(L_ALL, "setting SO_REUSEPORT for listener %s:%s",
+                 listener_get_name(listener), errno);
+    close(fd);
+    return -1;
+  }
+#endif
+
   /*
    * Bind a port to listen for new connections if port is non-null,
    * else assume it is already open and try get something from it.
@@ -222,15 +287,19 @@ inetport(struct Listener *listener)
     report_error(L_ALL, "binding listener socket %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return false;
+    return -1;
   }
 
+  /* Whoever may scrape metrics has to be in our group */
+  if (listener->addr.ss.ss_family == AF_UNIX)
+    chmod(((const struct sockaddr_un *)&listener->addr)->sun_path, 0660);
+
   if (listen(fd, HYBRID_SOMAXCONN))
   {
     report_error(L_ALL, "listen failed for %s:%s",
                  listener_get_name(listener), errno);
     close(fd);
-    return false;
+    return -1;
   }
 
 #ifdef TCP_DEFER_ACCEPT
@@ -252,12 +321,49 @@ inetport(struct Listener *listener)
   }
 #endif
 
-  listener->fd = fd_open(fd, true, "Listener socket");
+  return fd;
+}
+
+static bool
+inetport(struct Listener *listener)
+{
+  unsigned int queues = 1;
+
+  if (listener->addr.ss.ss_family == AF_UNIX)
+  {
+    const char *const path = ((const struct sockaddr_un *)&listener->addr)->sun_path;
+
+    /* A socket left behind by a previous run would make bind() fail */
+    unlink(path);
+    strlcpy(listener->name, path, sizeof(listener->name));
+  }
+  else
+    address_format(&listener->addr, listener->name, sizeof(listener->name));
+
+  /*
+   * With SO_REUSEPORT, the kernel spreads incoming connections over
+   * several sockets bound to the same port, each with an accept queue
+   * of its own. Every one of them gets its own accept budget.
+   */
+#ifdef SO_REUSEPORT
+  if (listener_has_flag(listener, LISTENER_REUSEPORT) && listener->addr.ss.ss_family != AF_UNIX)
+    queues = LISTENER_QUEUES_MAX;
+#endif
+
+  for (unsigned int i = 0; i < queues; ++i)
+  {
+    int fd = listener_socket(listener, queues > 1);
+    if (fd == -1)
+      break;
+
+    listener->fd[listener->fd_count++] = fd_open(fd, true, "Listener socket");
+  }
 
   /* Listen completion events are READ events .. */
+  for (unsigned int i = 0; i < listener->fd_count; ++i)
+    listener_accept_connection(listener->fd[i], listener);
 
-  listener_accept_connection(listener->fd, listener);
-  return true;
+  return listener->fd_count > 0;
 }
 
 static struct Listener *
@@ -275,9 +381,9 @@ listener_find(int port, struct irc_ssaddr *addr)
         (!memcmp(addr, &listener->addr, sizeof(*addr))))
     {
       /* Try to return an open listener, otherwise reuse a closed one */
-      if (listener->fd)
+      if (listener->fd_count)
       {
-        assert(listener->fd->flags.open);
+        assert(listener->fd[0]->flags.open);
         last_closed = listener;
       }
       else
@@ -294,14 +400,18 @@ listener_find(int port, struct irc_ssaddr *addr)
 static void
 listener_close(struct Listener *listener)
 {
-  if (listener->fd)
+  for (unsigned int i = 0; i < listener->fd_count; ++i)
   {
-    assert(listener->fd->flags.open);
+    assert(listener->fd[i]->flags.open);
 
-    fd_close(listener->fd);
-    listener->fd = NULL;
+    fd_close(listener->fd[i]);
+    listener->fd[i] = NULL;
   }
 
+  if (listener->fd_count && listener->addr.ss.ss_family == AF_UNIX)
+    unlink(((const struct sockaddr_un *)&listener->addr)->sun_path);
+
+  listener->fd_count = 0;
   listener->active = false;
 
   if (listener->ref_count)
@@ -332,6 +442,48 @@ listener_release(struct Listener *listener)
     listener_close(listener);
 }
 
+/* listener_add_unix()
+ *
+ * inputs       - path of the UNIX domain socket
+ *              - listener flags
+ * output       - NONE
+ * side effects - opens a listener on path, unless one is open already
+ */
+static void
+listener_add_unix(const char *path, unsigned int flags)
+{
+  struct irc_ssaddr addr;
+  struct sockaddr_un *const sun = (struct sockaddr_un *)&addr;
+  struct Listener *listener;
+
+  if (EmptyString(path) || strlen(path) >= sizeof(sun->sun_path))
+    return;
+
+  memset(&addr, 0, sizeof(addr));
+  sun->sun_family = AF_UNIX;
+  strlcpy(sun->sun_path, path, sizeof(sun->sun_path));
+  addr.ss_len = sizeof(*sun);
+
+  if ((listener = listener_find(0, &addr)))
+  {
+    listener->flags = flags;
+
+    if (listener->fd_count)
+      return;
+  }
+  else
+  {
+    listener = listener_make(0, &addr);
+    dlinkAdd(listener, &listener->node, &listener_list);
+    listener->flags = flags;
+  }
+
+  if (inetport(listener) == true)
+    listener->active = true;
+  else
+    listener_close(listener);
+}
+
 /*
  * listener_add- create a new listener
  * port - the port number to listen on
@@ -348,6 +500,16 @@ listener_add(int port, const char *vhost_ip, unsigned int flags)
   static short int pass = 0; /* if ipv6 and no address specified we need to
 				have two listeners; one for each protocol. */
 
+  /*
+   * Metrics listeners take a socket path in place of the address,
+   * and have no use for the port
+   */
+  if (flags & LISTENER_METRICS)
+  {
+    listener_add_unix(vhost_ip, flags);
+    return;
+  }
+
   /*
    * if no or invalid port in conf line, don't bother
    */
@@ -410,9 +572,9 @@ listener_add(int port, const char *vhost_ip, unsigned int flags)
   {
     listener->flags = flags;
 
-    if (listener->fd)
+    if (listener->fd_count)
     {
-      assert(listener->fd->flags.open);
+      assert(listener->fd[0]->flags.open);
       return;
     }
   }
@@ -0,0 +1,318 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file loop_stats.c
+ * \brief Event loop health metrics.
+ * \version $Id$
+ *
+ * io_loop() marks the end of each part of an iteration, and comm_select()
+ * reports the number of ready file descriptors as soon as it is done
+ * waiting for them. The time an iteration spends outside of the wait is
+ * what delays the handling of a descriptor that has just become ready,
+ * so that is the figure to watch for loop lag. Besides cumulative totals,
+ * a number of per-iteration and per-message figures are kept as
+ * histograms with power of two buckets: bucket 0 counts zeroes, bucket n
+ * values from 2^(n-1) up to 2^n - 1, and the last bucket all larger ones.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "dbuf.h"
+#include "event.h"
+#include "ircd.h"
+#include "log.h"
+#include "loop_stats.h"
+#include "numeric.h"
+#include "send.h"
+
+enum { LOOP_HISTOGRAM_BUCKETS = 24 };
+enum { LOOP_STATS_LOG_INTERVAL = 60 };  /**< Seconds between metrics log entries */
+
+/** Figures kept as histograms */
+enum
+{
+  LOOP_METRIC_BUSY,      /**< Iteration time spent outside of the wait; microseconds */
+  LOOP_METRIC_READY,     /**< File descriptors ready per wait */
+  LOOP_METRIC_BYTES,     /**< Bytes sent per iteration */
+  LOOP_METRIC_MESSAGES,  /**< Messages queued per iteration */
+  LOOP_METRIC_SYSCALLS,  /**< Waits, reads and writes per iteration */
+  LOOP_METRIC_FANOUT,    /**< Recipients per channel message */
+  LOOP_METRIC_LAST
+};
+
+static const char *const loop_metric_names[LOOP_METRIC_LAST] =
+{
+  [LOOP_METRIC_BUSY] = "busy_us",
+  [LOOP_METRIC_READY] = "ready_fds",
+  [LOOP_METRIC_BYTES] = "bytes_sent",
+  [LOOP_METRIC_MESSAGES] = "messages_sent",
+  [LOOP_METRIC_SYSCALLS] = "syscalls",
+  [LOOP_METRIC_FANOUT] = "fanout"
+};
+
+static const char *const loop_stage_names[LOOP_STAGE_LAST] =
+{
+  [LOOP_STAGE_EVENTS] = "events",
+  [LOOP_STAGE_WAIT] = "wait",
+  [LOOP_STAGE_IO] = "io",
+  [LOOP_STAGE_EXIT] = "exit"
+};
+
+/*! \brief LoopStats structure */
+struct LoopStats
+{
+  uintmax_t iterations;
+  uintmax_t stage_time[LOOP_STAGE_LAST];  /**< Nanoseconds */
+  uintmax_t busy_max;  /**< Longest iteration, not counting the wait; nanoseconds */
+  uintmax_t histogram[LOOP_METRIC_LAST][LOOP_HISTOGRAM_BUCKETS];
+};
+
+uintmax_t loop_syscalls;  /**< Waits, reads and writes so far */
+
+static struct LoopStats loop_stats;
+static struct LoopStats loop_stats_logged;  /**< Copy taken when the metrics log was last written */
+static uintmax_t loop_mark;  /**< When the last stage ended; nanoseconds */
+static uintmax_t loop_iteration_start;
+static uintmax_t loop_iteration_wait;
+static uintmax_t loop_bytes;  /**< Counters as of the start of the iteration */
+static uintmax_t loop_messages;
+static uintmax_t loop_syscalls_start;
+
+
+static uintmax_t
+loop_clock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void
+loop_histogram_add(uintmax_t *histogram, uintmax_t value)
+{
+  unsigned int bucket = 0;
+
+  for (; value && bucket < LOOP_HISTOGRAM_BUCKETS - 1; value >>= 1)
+    ++bucket;
+
+  ++histogram[bucket];
+}
+
+/*! \brief Accounts the time since the previous stage ended to a stage
+ * \param stage LOOP_STAGE_*
+ */
+void
+loop_stats_stage(unsigned int stage)
+{
+  const uintmax_t now = loop_clock();
+
+  assert(stage < LOOP_STAGE_LAST);
+
+  loop_stats.stage_time[stage] += now - loop_mark;
+
+  if (stage == LOOP_STAGE_WAIT)
+    loop_iteration_wait += now - loop_mark;
+
+  loop_mark = now;
+}
+
+/*! \brief Called by comm_select() right after waiting for file descriptors
+ * \param num Number of ready file descriptors, or -1 on error
+ */
+void
+loop_stats_ready(int num)
+{
+  loop_stats_stage(LOOP_STAGE_WAIT);
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_READY], num > 0 ? num : 0);
+  ++loop_syscalls;
+}
+
+/*! \brief Called by io_loop() at the end of every iteration
+ */
+void
+loop_stats_iteration(void)
+{
+  const uintmax_t busy = loop_mark - loop_iteration_start - loop_iteration_wait;
+
+  ++loop_stats.iterations;
+
+  if (loop_stats.busy_max < busy)
+    loop_stats.busy_max = busy;
+
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_BUSY], busy / 1000);
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_BYTES], me.connection->send.bytes - loop_bytes);
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_MESSAGES], me.connection->send.messages - loop_messages);
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_SYSCALLS], loop_syscalls - loop_syscalls_start);
+
+  loop_iteration_start = loop_mark;
+  loop_iteration_wait = 0;
+  loop_bytes = me.connection->send.bytes;
+  loop_messages = me.connection->send.messages;
+  loop_syscalls_start = loop_syscalls;
+}
+
+/*! \brief Records the number of connections a channel message went out to
+ * \param count Number of local clients and servers sent to
+ */
+void
+loop_stats_fanout(unsigned int count)
+{
+  loop_histogram_add(loop_stats.histogram[LOOP_METRIC_FANOUT], count);
+}
+
+/*! \brief Returns the number of iterations so far
+ * \param stage_time Array of LOOP_STAGE_LAST entries to receive the
+ *                   time spent in each stage, in nanoseconds
+ */
+uintmax_t
+loop_stats_get(uintmax_t *stage_time)
+{
+  for (unsigned int i = 0; i < LOOP_STAGE_LAST; ++i)
+    stage_time[i] = loop_stats.stage_time[i];
+
+  return loop_stats.iterations;
+}
+
+/* loop_histogram_format()
+ *
+ * inputs       - histogram
+ *              - histogram to subtract, or NULL
+ *              - buffer to write to and its size
+ * output       - buf
+ * side effects - bucket counts are written to buf separated by commas,
+ *                leaving out trailing empty buckets
+ */
+static const char *
+loop_histogram_format(const uintmax_t *histogram, const uintmax_t *base, char *buf, size_t size)
+{
+  unsigned int last = 0;
+  size_t len = 0;
+
+  for (unsigned int i = 0; i < LOOP_HISTOGRAM_BUCKETS; ++i)
+    if (histogram[i] - (base ? base[i] : 0))
+      last = i;
+
+  for (unsigned int i = 0; i <= last && len < size; ++i)
+    len += snprintf(buf + len, size - len, "%s%ju", i ? "," : "",
+                    histogram[i] - (base ? base[i] : 0));
+
+  return buf;
+}
+
+static void
+loop_sendq_histogram(uintmax_t *histogram)
+{
+  const dlink_list *lists[] = { &local_client_list, &local_server_list, &unknown_list };
+
+  for (unsigned int i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i)
+  {
+    dlink_node *node;
+
+    DLINK_FOREACH(node, lists[i]->head)
+    {
+      const struct Client *client = node->data;
+      loop_histogram_add(histogram, dbuf_length(&client->connection->buf_sendq));
+    }
+  }
+}
+
+/*! \brief Sends the event loop metrics to a client; used by STATS r
+ * \param source_p Client to report to
+ */
+void
+loop_stats_report(struct Client *source_p)
+{
+  char buf[IRCD_BUFSIZE];
+  uintmax_t sendq[LOOP_HISTOGRAM_BUCKETS] = { 0 };
+
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "r :iterations=%ju busy_max_us=%ju events_us=%ju wait_us=%ju io_us=%ju exit_us=%ju",
+                     loop_stats.iterations, loop_stats.busy_max / 1000,
+                     loop_stats.stage_time[LOOP_STAGE_EVENTS] / 1000,
+                     loop_stats.stage_time[LOOP_STAGE_WAIT] / 1000,
+                     loop_stats.stage_time[LOOP_STAGE_IO] / 1000,
+                     loop_stats.stage_time[LOOP_STAGE_EXIT] / 1000);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "r :hist buckets are 0, 1, 2-3, 4-7, ... up to %u and more",
+                     1U << (LOOP_HISTOGRAM_BUCKETS - 2));
+
+  for (unsigned int i = 0; i < LOOP_METRIC_LAST; ++i)
+    sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "r :%s hist=%s", loop_metric_names[i],
+                       loop_histogram_format(loop_stats.histogram[i], NULL, buf, sizeof(buf)));
+
+  loop_sendq_histogram(sendq);
+  sendto_one_numeric(source_p, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "r :sendq_bytes hist=%s",
+                     loop_histogram_format(sendq, NULL, buf, sizeof(buf)));
+}
+
+/* loop_stats_log()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - writes the figures for the time since the last call to
+ *                the metrics log, plus the current sendq distribution
+ */
+static void
+loop_stats_log(void *unused)
+{
+  const struct LoopStats *const now = &loop_stats, *const then = &loop_stats_logged;
+  char buf[LOG_BUFSIZE / 2];
+  uintmax_t sendq[LOOP_HISTOGRAM_BUCKETS] = { 0 };
+
+  ilog(LOG_TYPE_METRICS, "loop interval=%u iterations=%ju %s_us=%ju %s_us=%ju %s_us=%ju %s_us=%ju",
+       LOOP_STATS_LOG_INTERVAL, now->iterations - then->iterations,
+       loop_stage_names[LOOP_STAGE_EVENTS],
+       (now->stage_time[LOOP_STAGE_EVENTS] - then->stage_time[LOOP_STAGE_EVENTS]) / 1000,
+       loop_stage_names[LOOP_STAGE_WAIT],
+       (now->stage_time[LOOP_STAGE_WAIT] - then->stage_time[LOOP_STAGE_WAIT]) / 1000,
+       loop_stage_names[LOOP_STAGE_IO],
+       (now->stage_time[LOOP_STAGE_IO] - then->stage_time[LOOP_STAGE_IO]) / 1000,
+       loop_stage_names[LOOP_STAGE_EXIT],
+       (now->stage_time[LOOP_STAGE_EXIT] - then->stage_time[LOOP_STAGE_EXIT]) / 1000);
+
+  for (unsigned int i = 0; i < LOOP_METRIC_LAST; ++i)
+    ilog(LOG_TYPE_METRICS, "loop %s hist=%s", loop_metric_names[i],
+         loop_histogram_format(now->histogram[i], then->histogram[i], buf, sizeof(buf)));
+
+  loop_sendq_histogram(sendq);
+  ilog(LOG_TYPE_METRICS, "loop sendq_bytes hist=%s",
+       loop_histogram_format(sendq, NULL, buf, sizeof(buf)));
+
+  loop_stats_logged = loop_stats;
+}
+
+void
+loop_stats_init(void)
+{
+  static struct event event_loop_stats_log =
+  {
+    .name = "loop_stats_log",
+    .handler = loop_stats_log,
+    .when = LOOP_STATS_LOG_INTERVAL
+  };
+
+  loop_mark = loop_iteration_start = loop_clock();
+  event_add(&event_loop_stats_log, NULL);
+}
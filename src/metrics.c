@@ -0,0 +1,423 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+
+/*! \file metrics.c
+ * \brief Prometheus text format metrics exporter.
+ * \version $Id$
+ *
+ * Connections to a listen {} socket with the metrics flag are not IRC
+ * clients. They get one HTTP response holding a snapshot of the server
+ * statistics in the Prometheus text exposition format and are then closed,
+ * so `curl --unix-socket <path> http://localhost/metrics` is all it takes
+ * to look at them. Every figure comes from a counter that is kept up to
+ * date as things happen, or from a list whose length is stored along
+ * with it; a scrape never walks the client or channel lists.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "channel.h"
+#include "conf_class.h"
+#include "dbuf.h"
+#include "event.h"
+#include "fdlist.h"
+#include "ipcache.h"
+#include "irc_string.h"
+#include "ircd.h"
+#include "listener.h"
+#include "loop_stats.h"
+#include "memory.h"
+#include "metrics.h"
+#include "s_bsd.h"
+#include "whowas.h"
+
+
+/*! \brief MetricsBuffer structure */
+struct MetricsBuffer
+{
+  char *data;
+  size_t length;
+  size_t size;
+};
+
+/*! \brief MetricsConnection structure */
+struct MetricsConnection
+{
+  fde_t *F;
+  char request[METRICS_REQUEST_MAX];
+  size_t request_length;
+  struct MetricsBuffer response;
+  size_t sent;  /**< Bytes of response written so far */
+};
+
+
+static void
+metrics_printf(struct MetricsBuffer *buf, const char *format, ...)
+{
+  va_list args;
+
+  while (true)
+  {
+    const size_t avail = buf->size - buf->length;
+
+    va_start(args, format);
+    int len = vsnprintf(buf->data + buf->length, avail, format, args);
+    va_end(args);
+
+    if (len < 0)
+      return;
+
+    if ((size_t)len < avail)
+    {
+      buf->length += len;
+      return;
+    }
+
+    buf->size = buf->size * 2 + len;
+    buf->data = xrealloc(buf->data, buf->size);
+  }
+}
+
+/* metrics_family()
+ *
+ * inputs       - buffer to append to
+ *              - metric name, without the ircd_ prefix
+ *              - metric type; "counter" or "gauge"
+ *              - description
+ * output       - NONE
+ * side effects - the HELP and TYPE lines of a metric are appended to buf
+ */
+static void
+metrics_family(struct MetricsBuffer *buf, const char *name, const char *type, const char *help)
+{
+  metrics_printf(buf, "# HELP ircd_%s %s\n# TYPE ircd_%s %s\n", name, help, name, type);
+}
+
+static void
+metrics_value(struct MetricsBuffer *buf, const char *name, uintmax_t value)
+{
+  metrics_printf(buf, "ircd_%s %ju\n", name, value);
+}
+
+static void
+metrics_label_value(struct MetricsBuffer *buf, const char *name, const char *label,
+                    const char *label_value, uintmax_t value)
+{
+  metrics_printf(buf, "ircd_%s{%s=\"", name, label);
+
+  /* Label values are quoted strings; escape the few characters that need it */
+  for (const char *p = label_value; *p; ++p)
+  {
+    if (*p == '\\' || *p == '"')
+      metrics_printf(buf, "\\%c", *p);
+    else if (*p == '\n')
+      metrics_printf(buf, "\\n");
+    else
+      metrics_printf(buf, "%c", *p);
+  }
+
+  metrics_printf(buf, "\"} %ju\n", value);
+}
+
+static void
+metrics_simple(struct MetricsBuffer *buf, const char *name, const char *type,
+               const char *help, uintmax_t value)
+{
+  metrics_family(buf, name, type, help);
+  metrics_value(buf, name, value);
+}
+
+/* metrics_build()
+ *
+ * inputs       - buffer to append to
+ * output       - NONE
+ * side effects - a complete metrics snapshot is appended to buf
+ */
+static void
+metrics_build(struct MetricsBuffer *buf)
+{
+  static const char *const stage_names[LOOP_STAGE_LAST] =
+  {
+    [LOOP_STAGE_EVENTS] = "events",
+    [LOOP_STAGE_WAIT] = "wait",
+    [LOOP_STAGE_IO] = "io",
+    [LOOP_STAGE_EXIT] = "exit"
+  };
+  uintmax_t stage_time[LOOP_STAGE_LAST];
+  unsigned int count;
+  size_t bytes;
+  dlink_node *node;
+
+  metrics_simple(buf, "uptime_seconds", "gauge", "Time since the server was started.",
+                 event_base->time.sec_monotonic - me.connection->created_monotonic);
+
+  metrics_family(buf, "clients", "gauge", "Registered clients.");
+  metrics_label_value(buf, "clients", "scope", "local", dlink_list_length(&local_client_list));
+  metrics_label_value(buf, "clients", "scope", "global", dlink_list_length(&global_client_list));
+
+  metrics_family(buf, "servers", "gauge", "Servers, not counting this one.");
+  metrics_label_value(buf, "servers", "scope", "local", dlink_list_length(&local_server_list));
+  metrics_label_value(buf, "servers", "scope", "global", dlink_list_length(&global_server_list) - 1);
+
+  metrics_simple(buf, "unregistered_connections", "gauge",
+                 "Local connections that have not registered yet.",
+                 dlink_list_length(&unknown_list));
+  metrics_simple(buf, "operators", "gauge", "Operators on the network.", Count.oper);
+  metrics_simple(buf, "invisible_clients", "gauge", "Clients with user mode +i on the network.",
+                 Count.invisi);
+
+  metrics_family(buf, "clients_max", "gauge", "Highest number of clients seen.");
+  metrics_label_value(buf, "clients_max", "scope", "local", Count.max_loc);
+  metrics_label_value(buf, "clients_max", "scope", "global", Count.max_tot);
+
+  metrics_simple(buf, "channels", "gauge", "Channels on the network.",
+                 dlink_list_length(channel_get_list()));
+
+  metrics_simple(buf, "file_descriptors", "gauge", "Open file descriptors.", number_fd);
+  metrics_simple(buf, "file_descriptors_max", "gauge", "File descriptor limit.", hard_fdlimit);
+
+  metrics_family(buf, "connections_total", "counter", "Connections that have been closed.");
+  metrics_label_value(buf, "connections_total", "type", "client", ServerStats.is_cl);
+  metrics_label_value(buf, "connections_total", "type", "server", ServerStats.is_sv);
+  metrics_label_value(buf, "connections_total", "type", "unknown", ServerStats.is_ni);
+
+  metrics_simple(buf, "accepted_connections_total", "counter",
+                 "Connections accepted.", ServerStats.is_ac);
+  metrics_simple(buf, "refused_connections_total", "counter",
+                 "Connections refused right after they were accepted.", ServerStats.is_ref);
+
+  metrics_simple(buf, "sent_bytes_total", "counter", "Bytes sent.", me.connection->send.bytes);
+  metrics_simple(buf, "received_bytes_total", "counter", "Bytes received.", me.connection->recv.bytes);
+  metrics_simple(buf, "sent_messages_total", "counter", "Protocol messages sent.",
+                 me.connection->send.messages);
+  metrics_simple(buf, "received_messages_total", "counter", "Protocol messages received.",
+                 me.connection->recv.messages);
+
+  metrics_family(buf, "bad_messages_total", "counter", "Messages dropped as invalid.");
+  metrics_label_value(buf, "bad_messages_total", "reason", "unknown_command", ServerStats.is_unco);
+  metrics_label_value(buf, "bad_messages_total", "reason", "wrong_direction", ServerStats.is_wrdi);
+  metrics_label_value(buf, "bad_messages_total", "reason", "unknown_prefix", ServerStats.is_unpf);
+  metrics_label_value(buf, "bad_messages_total", "reason", "empty", ServerStats.is_empt);
+  metrics_simple(buf, "numeric_messages_total", "counter", "Numeric replies received from servers.",
+                 ServerStats.is_num);
+  metrics_simple(buf, "collision_kills_total", "counter", "Kills generated by nick collisions.",
+                 ServerStats.is_kill);
+
+  metrics_family(buf, "auth_requests_total", "counter", "Ident lookups by outcome.");
+  metrics_label_value(buf, "auth_requests_total", "result", "success", ServerStats.is_asuc);
+  metrics_label_value(buf, "auth_requests_total", "result", "failure", ServerStats.is_abad);
+  metrics_label_value(buf, "auth_requests_total", "result", "timeout", ServerStats.is_atmo);
+  metrics_label_value(buf, "auth_requests_total", "result", "refused", ServerStats.is_aref);
+  metrics_label_value(buf, "auth_requests_total", "result", "cached", ServerStats.is_acch);
+  metrics_label_value(buf, "auth_requests_total", "result", "limited", ServerStats.is_alim);
+
+  metrics_simple(buf, "tls_handshakes_total", "counter", "Completed TLS handshakes.",
+                 ServerStats.is_tls);
+  metrics_simple(buf, "tls_resumed_handshakes_total", "counter",
+                 "TLS handshakes that resumed a session.", ServerStats.is_tlsr);
+
+  metrics_family(buf, "class_connections", "gauge", "Connections in each connection class.");
+  DLINK_FOREACH(node, class_get_list()->head)
+  {
+    const struct ClassItem *class = node->data;
+    metrics_label_value(buf, "class_connections", "class", class->name, class->ref_count);
+  }
+
+  metrics_family(buf, "class_connections_max", "gauge", "Connection limit of each connection class.");
+  DLINK_FOREACH(node, class_get_list()->head)
+  {
+    const struct ClassItem *class = node->data;
+    metrics_label_value(buf, "class_connections_max", "class", class->name, class->max_total);
+  }
+
+  ipcache_get_stats(&count, &bytes);
+  metrics_simple(buf, "ipcache_entries", "gauge", "IP addresses in the connection throttle cache.", count);
+  metrics_simple(buf, "ipcache_bytes", "gauge", "Memory used by the IP address cache.", bytes);
+
+  whowas_count_memory(&count, &bytes);
+  metrics_simple(buf, "whowas_entries", "gauge", "WHOWAS history entries.", count);
+  metrics_simple(buf, "whowas_bytes", "gauge", "Memory used by the WHOWAS history.", bytes);
+
+  metrics_simple(buf, "client_bytes", "gauge", "Memory used by client structures.",
+                 (dlink_list_length(&global_client_list) + dlink_list_length(&global_server_list) +
+                  dlink_list_length(&unknown_list)) * sizeof(struct Client));
+  metrics_simple(buf, "channel_bytes", "gauge", "Memory used by channel structures.",
+                 dlink_list_length(channel_get_list()) * sizeof(struct Channel));
+  metrics_simple(buf, "dbuf_blocks", "gauge", "Send and receive queue blocks allocated.",
+                 dbuf_block_count);
+  metrics_simple(buf, "dbuf_bytes", "gauge", "Memory used by send and receive queue blocks.",
+                 dbuf_block_count * sizeof(struct dbuf_block));
+
+  metrics_simple(buf, "loop_iterations_total", "counter", "Event loop iterations.",
+                 loop_stats_get(stage_time));
+
+  metrics_family(buf, "loop_microseconds_total", "counter", "Event loop time by stage.");
+  for (unsigned int i = 0; i < LOOP_STAGE_LAST; ++i)
+    metrics_label_value(buf, "loop_microseconds_total", "stage", stage_names[i], stage_time[i] / 1000);
+}
+
+static void
+metrics_close(struct MetricsConnection *conn)
+{
+  fd_close(conn->F);
+  xfree(conn->response.data);
+  xfree(conn);
+}
+
+static void
+metrics_timeout(fde_t *F, void *data)
+{
+  metrics_close(data);
+}
+
+/* metrics_write()
+ *
+ * inputs       - connection's fd
+ *              - pointer to connection
+ * output       - NONE
+ * side effects - writes as much of the response as the socket takes,
+ *                closing the connection once all of it is out
+ */
+static void
+metrics_write(fde_t *F, void *data)
+{
+  struct MetricsConnection *conn = data;
+
+  while (conn->sent < conn->response.length)
+  {
+    ssize_t ret = send(F->fd, conn->response.data + conn->sent,
+                       conn->response.length - conn->sent, 0);
+    if (ret <= 0)
+    {
+      if (ret < 0 && comm_ignore_errno(errno) == true)
+        comm_setselect(F, COMM_SELECT_WRITE, metrics_write, conn, 0);
+      else
+        metrics_close(conn);
+      return;
+    }
+
+    conn->sent += ret;
+  }
+
+  metrics_close(conn);
+}
+
+/* metrics_respond()
+ *
+ * inputs       - pointer to connection
+ * output       - NONE
+ * side effects - builds the response to the request that has been read,
+ *                and starts writing it
+ */
+static void
+metrics_respond(struct MetricsConnection *conn)
+{
+  struct MetricsBuffer body = { .size = 8192 };
+  const char *status = "200 OK";
+
+  body.data = xcalloc(body.size);
+
+  if (strncmp(conn->request, "GET ", 4))
+  {
+    status = "405 Method Not Allowed";
+    metrics_printf(&body, "Only GET is supported\n");
+  }
+  else
+    metrics_build(&body);
+
+  conn->response.size = body.length + 256;
+  conn->response.data = xcalloc(conn->response.size);
+  metrics_printf(&conn->response,
+                 "HTTP/1.0 %s\r\n"
+                 "Content-Type: text/plain; version=0.0.4\r\n"
+                 "Content-Length: %zu\r\n"
+                 "Connection: close\r\n\r\n", status, body.length);
+
+  memcpy(conn->response.data + conn->response.length, body.data, body.length);
+  conn->response.length += body.length;
+  xfree(body.data);
+
+  metrics_write(conn->F, conn);
+}
+
+/* metrics_read()
+ *
+ * inputs       - connection's fd
+ *              - pointer to connection
+ * output       - NONE
+ * side effects - reads the request header; responds once it is complete
+ */
+static void
+metrics_read(fde_t *F, void *data)
+{
+  struct MetricsConnection *conn = data;
+
+  while (true)
+  {
+    const size_t avail = sizeof(conn->request) - conn->request_length - 1;
+
+    if (avail == 0)
+    {
+      metrics_close(conn);  /* Nobody sends that much just to GET /metrics */
+      return;
+    }
+
+    ssize_t ret = recv(F->fd, conn->request + conn->request_length, avail, 0);
+    if (ret < 0)
+    {
+      if (comm_ignore_errno(errno) == true)
+        comm_setselect(F, COMM_SELECT_READ, metrics_read, conn, 0);
+      else
+        metrics_close(conn);
+      return;
+    }
+
+    if (ret == 0)
+    {
+      metrics_close(conn);
+      return;
+    }
+
+    conn->request_length += ret;
+    conn->request[conn->request_length] = '\0';
+
+    if (strstr(conn->request, "\r\n\r\n") || strstr(conn->request, "\n\n"))
+    {
+      metrics_respond(conn);
+      return;
+    }
+  }
+}
+
+/*! \brief Takes over a connection accepted on a metrics listener
+ * \param fd File descriptor of the new connection
+ */
+void
+metrics_accept(int fd)
+{
+  struct MetricsConnection *conn = xcalloc(sizeof(*conn));
+
+  conn->F = fd_open(fd, true, "Metrics connection");
+  comm_settimeout(conn->F, METRICS_TIMEOUT, metrics_timeout, conn);
+  metrics_read(conn->F, conn);
+}
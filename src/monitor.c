@@ -37,59 +37,179 @@
 #include "monitor.h"
 
 
-static dlink_list monitor_hash[HASHSIZE];
+enum { MONITOR_FILTER_BITS = 16 };  /**< 2^16 one byte counters */
+
+/*! \brief MonitorBatch structure */
+struct MonitorBatch
+{
+  dlink_node node;  /**< Link to monitor_batch_list */
+  struct Client *client;
+  size_t len;
+  char buf[IRCD_BUFSIZE];  /**< Comma separated nick!user@host list */
+};
+
+static struct Monitor *monitor_hash[HASHSIZE];
+static uint8_t monitor_filter[1 << MONITOR_FILTER_BITS];
+static dlink_list monitor_batch_list;
+static unsigned int monitor_count;
+static size_t monitor_vector_bytes;
 
 
 /*
  * Rough figure of the datastructures for monitor:
  *
- * MONITOR HASH       client1
- *   |                  |- nick1
- * nick1-|- client1     |- nick2
- *   |   |- client2               client3
- *   |   |- client3   client2       |- nick1
- *   |                  |- nick1
- * nick2-|- client2     |- nick2
- *       |- client1
+ * MONITOR HASH     subscribers[]          client1->monitors
+ *   |                |                      |
+ * nick1 -------- [0] sub(nick1, client1) ---+
+ *   |            [1] sub(nick1, client2) -- client2->monitors
+ *   |                                         |
+ * nick2 -------- [0] sub(nick2, client2) -----+
+ *
+ * Every name nobody monitors yet is kept out of the hash probe by a
+ * counting bloom filter: two one byte counters per name, found from
+ * the upper and lower half of its 32 bit hash value. A counter that
+ * has reached 255 sticks there, which can only cause false positives.
  */
 
-/*! \brief Counts up memory used by monitor list headers
+/*! \brief Case-insensitive 32 bit FNV-1a hash of a nick name */
+static uint32_t
+monitor_hash_name(const char *name)
+{
+  uint32_t hval = 0x811c9dc5;
+
+  for (const unsigned char *p = (const unsigned char *)name; *p; ++p)
+  {
+    hval ^= ToLower(*p);
+    hval *= 0x01000193;
+  }
+
+  return hval;
+}
+
+static void
+monitor_filter_add(uint32_t hval)
+{
+  uint8_t *const a = &monitor_filter[hval & ((1 << MONITOR_FILTER_BITS) - 1)];
+  uint8_t *const b = &monitor_filter[hval >> (32 - MONITOR_FILTER_BITS)];
+
+  if (*a < UINT8_MAX)
+    ++*a;
+  if (*b < UINT8_MAX)
+    ++*b;
+}
+
+static void
+monitor_filter_del(uint32_t hval)
+{
+  uint8_t *const a = &monitor_filter[hval & ((1 << MONITOR_FILTER_BITS) - 1)];
+  uint8_t *const b = &monitor_filter[hval >> (32 - MONITOR_FILTER_BITS)];
+
+  if (*a < UINT8_MAX)
+    --*a;
+  if (*b < UINT8_MAX)
+    --*b;
+}
+
+static bool
+monitor_filter_test(uint32_t hval)
+{
+  return monitor_filter[hval & ((1 << MONITOR_FILTER_BITS) - 1)] &&
+         monitor_filter[hval >> (32 - MONITOR_FILTER_BITS)];
+}
+
+/*! \brief Counts up memory used by monitor list headers,
+ *         including their subscriber vectors
  */
 void
 monitor_count_memory(unsigned int *const count, size_t *const bytes)
 {
-  for (unsigned int i = 0; i < HASHSIZE; ++i)
-  {
-    dlink_node *node;
-    (*count) += dlink_list_length(&monitor_hash[i]);
-
-    DLINK_FOREACH(node, monitor_hash[i].head)
-    {
-      const struct Monitor *const monitor = node->data;
-      (*bytes) += strlen(monitor->name) + 1;  /* +1 for '\0' */
-    }
-  }
+  (*count) += monitor_count;
+  (*bytes) += monitor_count * sizeof(struct Monitor) + monitor_vector_bytes;
+}
 
-  (*bytes) += *count * sizeof(struct Monitor);
+/*! \brief Counts up memory used by RPL_MONONLINE batches that are
+ *         waiting for the end of the event loop iteration
+ */
+void
+monitor_batch_count_memory(unsigned int *const count, size_t *const bytes)
+{
+  (*count) += dlink_list_length(&monitor_batch_list);
+  (*bytes) += dlink_list_length(&monitor_batch_list) * sizeof(struct MonitorBatch);
 }
 
 /*! \brief Looks up the monitor table for a given name
- * \param name Nick name to look up
+ * \param name  Nick name to look up
+ * \param hval  Hash value of name as returned by monitor_hash_name()
  */
 static struct Monitor *
-monitor_find_hash(const char *name)
+monitor_find_hash(const char *name, uint32_t hval)
 {
-  dlink_node *node;
+  for (struct Monitor *monitor = monitor_hash[hval % HASHSIZE]; monitor; monitor = monitor->hnext)
+    if (monitor->hash_value == hval && irccmp(monitor->name, name) == 0)
+      return monitor;
+
+  return NULL;
+}
+
+/*! \brief Sends out the RPL_MONONLINE a client has pending, if any
+ * \param client Pointer to Client struct
+ */
+static void
+monitor_batch_send(struct Client *client)
+{
+  struct MonitorBatch *batch = client->connection->monitor_batch;
 
-  DLINK_FOREACH(node, monitor_hash[strhash(name)].head)
+  if (batch == NULL)
+    return;
+
+  sendto_one_numeric(client, &me, RPL_MONONLINE, batch->buf);
+
+  dlinkDelete(&batch->node, &monitor_batch_list);
+  client->connection->monitor_batch = NULL;
+  xfree(batch);
+}
+
+/*! \brief Queues a RPL_MONONLINE for a subscriber. Signons that happen
+ *         within the same event loop iteration, such as the ones caused
+ *         by a netjoin, share as few lines as possible.
+ * \param client Pointer to subscriber
+ * \param mask   nick!user@host of the client that has signed on
+ */
+static void
+monitor_batch_add(struct Client *client, const char *mask)
+{
+  struct MonitorBatch *batch = client->connection->monitor_batch;
+  /* :me.name 730 client->name :nick!user@host,...\r\n */
+  /* 1       23456            78                  9 10 */
+  const size_t len = strlen(me.name) + strlen(client->name) + 10;
+  const size_t masklen = strlen(mask) + 1;  /* +1 for comma */
+
+  if (batch && batch->len + masklen + len > sizeof(batch->buf))
   {
-    struct Monitor *monitor = node->data;
+    monitor_batch_send(client);
+    batch = NULL;
+  }
 
-    if (irccmp(monitor->name, name) == 0)
-      return monitor;
+  if (batch == NULL)
+  {
+    batch = xcalloc(sizeof(*batch));
+    batch->client = client;
+    dlinkAdd(batch, &batch->node, &monitor_batch_list);
+    client->connection->monitor_batch = batch;
   }
 
-  return NULL;
+  batch->len += snprintf(batch->buf + batch->len, sizeof(batch->buf) - batch->len,
+                         "%s%s", batch->len ? "," : "", mask);
+}
+
+/*! \brief Sends out all RPL_MONONLINE queued during this event
+ *         loop iteration
+ */
+void
+monitor_flush(void)
+{
+  while (monitor_batch_list.head)
+    monitor_batch_send(((struct MonitorBatch *)monitor_batch_list.head->data)->client);
 }
 
 /*! \brief Notifies all clients that have client's name on
@@ -100,20 +220,23 @@ void
 monitor_signon(const struct Client *client)
 {
   char buf[NICKLEN + USERLEN + HOSTLEN + 3];  /* +3 for !, @, \0 */
-  dlink_node *node;
 
   assert(IsClient(client));
 
-  struct Monitor *monitor = monitor_find_hash(client->name);
+  const uint32_t hval = monitor_hash_name(client->name);
+  if (monitor_filter_test(hval) == false)
+    return;  /* This name isn't on monitor */
+
+  const struct Monitor *monitor = monitor_find_hash(client->name, hval);
   if (monitor == NULL)
     return;  /* This name isn't on monitor */
 
   snprintf(buf, sizeof(buf), "%s!%s@%s", client->name,
            client->username, client->host);
 
-  /* Send notifies out to everybody on the list in header */
-  DLINK_FOREACH(node, monitor->monitored_by.head)
-    sendto_one_numeric(node->data, &me, RPL_MONONLINE, buf);
+  /* Queue notifies for everybody on the list in header */
+  for (unsigned int i = 0; i < monitor->subscribers_count; ++i)
+    monitor_batch_add(monitor->subscribers[i]->client, buf);
 }
 
 /*! \brief Notifies all clients that have client's name on
@@ -123,17 +246,25 @@ monitor_signon(const struct Client *client)
 void
 monitor_signoff(const struct Client *client)
 {
-  dlink_node *node;
-
   assert(IsClient(client));
 
-  struct Monitor *monitor = monitor_find_hash(client->name);
+  const uint32_t hval = monitor_hash_name(client->name);
+  if (monitor_filter_test(hval) == false)
+    return;  /* This name isn't on monitor */
+
+  const struct Monitor *monitor = monitor_find_hash(client->name, hval);
   if (monitor == NULL)
     return;  /* This name isn't on monitor */
 
   /* Send notifies out to everybody on the list in header */
-  DLINK_FOREACH(node, monitor->monitored_by.head)
-    sendto_one_numeric(node->data, &me, RPL_MONOFFLINE, client->name);
+  for (unsigned int i = 0; i < monitor->subscribers_count; ++i)
+  {
+    struct Client *target_p = monitor->subscribers[i]->client;
+
+    /* A signon queued earlier must not arrive after this */
+    monitor_batch_send(target_p);
+    sendto_one_numeric(target_p, &me, RPL_MONOFFLINE, client->name);
+  }
 }
 
 /*! \brief Unlinks a Monitor struct from its associated hash table
@@ -143,15 +274,67 @@ monitor_signoff(const struct Client *client)
 static void
 monitor_free(struct Monitor *monitor)
 {
-  assert(monitor->monitored_by.head == NULL);
-  assert(dlinkFind(&monitor_hash[monitor->hash_value], monitor));
+  struct Monitor **prev = &monitor_hash[monitor->hash_value % HASHSIZE];
+
+  assert(monitor->subscribers_count == 0);
+
+  while (*prev != monitor)
+    prev = &(*prev)->hnext;
+  *prev = monitor->hnext;
 
-  dlinkDelete(&monitor->node, &monitor_hash[monitor->hash_value]);
+  monitor_filter_del(monitor->hash_value);
+  monitor_vector_bytes -= monitor->subscribers_size * sizeof(monitor->subscribers[0]);
+  --monitor_count;
 
-  xfree(monitor->name);
+  xfree(monitor->subscribers);
   xfree(monitor);
 }
 
+/*! \brief Removes a subscription from both the client's and the
+ *         name's list, and frees the name if nobody monitors it anymore
+ * \param sub Pointer to subscription
+ */
+static void
+monitor_unsubscribe(struct MonitorSubscription *sub)
+{
+  struct Monitor *const monitor = sub->monitor;
+
+  assert(monitor->subscribers[sub->index] == sub);
+
+  /* Move the last subscriber into the gap */
+  monitor->subscribers[sub->index] = monitor->subscribers[--monitor->subscribers_count];
+  monitor->subscribers[sub->index]->index = sub->index;
+
+  dlinkDelete(&sub->node, &sub->client->connection->monitors);
+  xfree(sub);
+
+  /* In case this header is now empty of notices, remove it */
+  if (monitor->subscribers_count == 0)
+    monitor_free(monitor);
+}
+
+/*! \brief Finds the subscription of a client to a name
+ * \param monitor Pointer to monitored name
+ * \param client  Pointer to Client struct
+ * \return Pointer to subscription, or NULL if there is none
+ */
+static struct MonitorSubscription *
+monitor_find_subscription(const struct Monitor *monitor, const struct Client *client)
+{
+  dlink_node *node;
+
+  /* Monitor lists are short by design; names may have many subscribers */
+  DLINK_FOREACH(node, client->connection->monitors.head)
+  {
+    struct MonitorSubscription *sub = node->data;
+
+    if (sub->monitor == monitor)
+      return sub;
+  }
+
+  return NULL;
+}
+
 /*! \brief Adds a monitor entry to client's monitor list if it doesn't exist
  * \param name   Nick name to add
  * \param client Pointer to Client struct
@@ -160,33 +343,41 @@ monitor_free(struct Monitor *monitor)
 bool
 monitor_add_to_hash_table(const char *name, struct Client *client)
 {
-  dlink_node *node = NULL;
+  const uint32_t hval = monitor_hash_name(name);
 
   /* If found NULL (no header for this name), make one... */
-  struct Monitor *monitor = monitor_find_hash(name);
+  struct Monitor *monitor = monitor_find_hash(name, hval);
   if (monitor == NULL)
   {
     monitor = xcalloc(sizeof(*monitor));
-    monitor->name = xstrdup(name);
-    monitor->hash_value = strhash(monitor->name);
+    strlcpy(monitor->name, name, sizeof(monitor->name));
+    monitor->hash_value = hval;
+    monitor->hnext = monitor_hash[hval % HASHSIZE];
+    monitor_hash[hval % HASHSIZE] = monitor;
 
-    dlinkAdd(monitor, &monitor->node, &monitor_hash[monitor->hash_value]);
-  }
-  else
-  {
-    /* Is this client already on the monitor-list? */
-    node = dlinkFind(&monitor->monitored_by, client);
+    monitor_filter_add(hval);
+    ++monitor_count;
   }
+  else if (monitor_find_subscription(monitor, client))
+    return false;  /* This client is already on the monitor-list */
 
-  if (node == NULL)
+  if (monitor->subscribers_count == monitor->subscribers_size)
   {
-    /* No it isn't, so add it in the bucket and client adding it */
-    dlinkAdd(client, make_dlink_node(), &monitor->monitored_by);
-    dlinkAdd(monitor, make_dlink_node(), &client->connection->monitors);
-    return true;
+    const unsigned int size = monitor->subscribers_size ? monitor->subscribers_size * 2 : 4;
+
+    monitor->subscribers = xrealloc(monitor->subscribers, size * sizeof(monitor->subscribers[0]));
+    monitor_vector_bytes += (size - monitor->subscribers_size) * sizeof(monitor->subscribers[0]);
+    monitor->subscribers_size = size;
   }
 
-  return false;
+  struct MonitorSubscription *sub = xcalloc(sizeof(*sub));
+  sub->monitor = monitor;
+  sub->client = client;
+  sub->index = monitor->subscribers_count++;
+  monitor->subscribers[sub->index] = sub;
+
+  dlinkAdd(sub, &sub->node, &client->connection->monitors);
+  return true;
 }
 
 /*! \brief Removes a single entry from client's monitor list
@@ -196,23 +387,15 @@ monitor_add_to_hash_table(const char *name, struct Client *client)
 void
 monitor_del_from_hash_table(const char *name, struct Client *client)
 {
-  struct Monitor *monitor = monitor_find_hash(name);
+  const struct Monitor *monitor = monitor_find_hash(name, monitor_hash_name(name));
   if (monitor == NULL)
     return;  /* No header found for that name. i.e. it's not being monitored */
 
-  dlink_node *node = dlinkFindDelete(&monitor->monitored_by, client);
-  if (node == NULL)
+  struct MonitorSubscription *sub = monitor_find_subscription(monitor, client);
+  if (sub == NULL)
     return;  /* This name isn't being monitored by client */
 
-  free_dlink_node(node);
-
-  node = dlinkFindDelete(&client->connection->monitors, monitor);
-  if (node)
-    free_dlink_node(node);
-
-  /* In case this header is now empty of notices, remove it */
-  if (monitor->monitored_by.head == NULL)
-    monitor_free(monitor);
+  monitor_unsubscribe(sub);
 }
 
 /*! \brief Removes all entries from client's monitor list
@@ -222,26 +405,18 @@ monitor_del_from_hash_table(const char *name, struct Client *client)
 void
 monitor_clear_list(struct Client *client)
 {
-  dlink_node *node, *node_next;
+  struct MonitorBatch *batch = client->connection->monitor_batch;
 
-  DLINK_FOREACH_SAFE(node, node_next, client->connection->monitors.head)
+  if (batch)
   {
-    struct Monitor *monitor = node->data;
-
-    assert(dlinkFind(&monitor->monitored_by, client));
-
-    dlink_node *temp = dlinkFindDelete(&monitor->monitored_by, client);
-    if (temp)
-      free_dlink_node(temp);
-
-    /* If this leaves a header without notifies, remove it. */
-    if (monitor->monitored_by.head == NULL)
-      monitor_free(monitor);
-
-    dlinkDelete(node, &client->connection->monitors);
-    free_dlink_node(node);
+    dlinkDelete(&batch->node, &monitor_batch_list);
+    client->connection->monitor_batch = NULL;
+    xfree(batch);
   }
 
+  while (client->connection->monitors.head)
+    monitor_unsubscribe(client->connection->monitors.head->data);
+
   assert(client->connection->monitors.head == NULL);
   assert(client->connection->monitors.tail == NULL);
 }
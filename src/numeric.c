@@ -122,6 +122,7 @@ static const char *const replies[] =
   /* 351 */  [RPL_VERSION] = "%s. %s :%s",
   /* 352 */  [RPL_WHOREPLY] = "%s %s %s %s %s %s :%u %s",
   /* 353 */  [RPL_NAMREPLY] = "%s %s :%s",
+  /* 354 */  [RPL_WHOSPCRPL] = "%s",
   /* 362 */  [RPL_CLOSING] = "%s :Closed. Status = %u",
   /* 363 */  [RPL_CLOSEEND] = "%u: Connections closed",
   /* 364 */  [RPL_LINKS] = "%s %s :%u %s",
@@ -155,6 +156,7 @@ static const char *const replies[] =
   /* 412 */  [ERR_NOTEXTTOSEND] = ":No text to send",
   /* 413 */  [ERR_NOTOPLEVEL] = "%s :No top-level domain specified",
   /* 414 */  [ERR_WILDTOPLEVEL] = "%s :Wildcard in top-level domain",
+  /* 416 */  [ERR_QUERYTOOLONG] = "%s :Too many lines in the output for your send queue, restrict your query",
   /* 421 */  [ERR_UNKNOWNCOMMAND] = "%s :Unknown command",
   /* 422 */  [ERR_NOMOTD] = ":MOTD File is missing",
   /* 429 */  [ERR_TOOMANYAWAY] = ":Too many aways - Flood protection activated",
@@ -38,6 +38,9 @@
 #include "memory.h"
 #include "send.h"
 #include "misc.h"
+#include "server_zip.h"
+#include "loop_stats.h"
+#include "token_bucket.h"
 
 
 enum { READBUF_SIZE = 16384 };
@@ -130,6 +133,35 @@ out:
   return IRCD_MIN(line_bytes, IRCD_BUFSIZE - 2);
 }
 
+static void parse_client_queued(struct Client *);
+
+/* flood_resume()
+ *
+ * inputs       - file descriptor of a client
+ *              - pointer to the client
+ * output       - NONE
+ * side effects - parses lines that have been held back by flood control
+ */
+static void
+flood_resume(fde_t *F, void *data)
+{
+  parse_client_queued(data);
+}
+
+/* flood_wait()
+ *
+ * inputs       - pointer to client
+ *              - milliseconds until more of its lines may be parsed
+ * output       - NONE
+ * side effects - arranges for flood_resume() to be called once they may
+ */
+static void
+flood_wait(struct Client *client, uintmax_t msec)
+{
+  /* Flush timeouts are checked once a second, and only have whole seconds */
+  comm_setflush(client->connection->fd, IRCD_MAX((msec + 999) / 1000, 1), flood_resume, client);
+}
+
 /*
  * parse_client_queued - parse client queued messages
  */
@@ -147,7 +179,11 @@ parse_client_queued(struct Client *client)
 
       /* Rate unknown clients at MAX_FLOOD per loop */
       if (i >= MAX_FLOOD)
+      {
+        if (dbuf_length(&client->connection->buf_recvq))
+          flood_wait(client, 0);
         return;
+      }
 
       size_t dolen = extract_one_line(&client->connection->buf_recvq, readBuf);
       if (dolen == 0)
@@ -181,6 +217,8 @@ parse_client_queued(struct Client *client)
   }
   else if (IsClient(client))
   {
+    const struct ClassItem *const class = class_get_ptr(&client->connection->confs);
+    unsigned int burst = class->flood_burst, rate = class->flood_rate;
     bool checkflood = true;
 
     if (ConfigGeneral.no_oper_flood && HasUMode(client, UMODE_OPER))
@@ -189,39 +227,50 @@ parse_client_queued(struct Client *client)
       checkflood = false;
 
     /*
-     * Handle flood protection here - if we exceed our flood limit on messages
-     * in this loop, we simply drop out of the loop prematurely.
-     *   -- adrian
+     * Until the grace period ends, a client may send FLOOD_GRACE_FACTOR
+     * times as many lines as later on, so it can join its channels
+     * without being slowed down.
      */
+    if (!IsFloodDone(client))
+    {
+      burst *= FLOOD_GRACE_FACTOR;
+      rate *= FLOOD_GRACE_FACTOR;
+    }
+
+    const uintmax_t interval = 1000 / rate;
+
     while (true)
     {
       if (IsDefunct(client))
         return;
 
       /*
-       * This flood protection works as follows:
-       *
-       * A client is given allow_read lines to send to the server.  Every
-       * time a line is parsed, sent_parsed is increased.  sent_parsed
-       * is decreased by 1 every time flood_recalc is called.
-       *
-       * Thus a client can 'burst' allow_read lines to the server, any
-       * excess lines will be parsed one per flood_recalc() call.
-       *
-       * Therefore a client will be penalised more if they keep flooding,
-       * as sent_parsed will always hover around the allow_read limit
-       * and no 'bursts' will be permitted.
+       * Every line parsed takes a token from flood_bucket, which holds
+       * up to burst tokens and gains rate tokens per second. Lines that
+       * arrive while it is empty are left in the receive queue until
+       * it has gained another token, and the client is dropped once
+       * they fill up its recvq.
        */
       if (checkflood == true)
-        if (client->connection->sent_parsed >= (IsFloodDone(client) ? MAX_FLOOD : MAX_FLOOD_BURST))
+      {
+        const uintmax_t wait = token_bucket_wait(&client->connection->flood_bucket, burst, interval);
+
+        if (wait)
+        {
+          if (dbuf_length(&client->connection->buf_recvq))
+            flood_wait(client, wait);
           return;
+        }
+      }
 
       size_t dolen = extract_one_line(&client->connection->buf_recvq, readBuf);
       if (dolen == 0)
         return;
 
+      if (checkflood == true)
+        token_bucket_take(&client->connection->flood_bucket, burst, interval);
+
       client_dopacket(client, readBuf, dolen);
-      ++client->connection->sent_parsed;
     }
   }
 }
@@ -239,43 +288,10 @@ flood_endgrace(struct Client *client)
   AddFlag(client, FLAGS_FLOODDONE);
 
   /*
-   * sent_parsed could be way over MAX_FLOOD but under MAX_FLOOD_BURST,
-   * so reset it.
+   * The bucket may be anywhere between empty and full as far as the
+   * grace period limits go, so start afresh.
    */
-  client->connection->sent_parsed = 0;
-}
-
-/*
- * flood_recalc
- *
- * recalculate the number of allowed flood lines. this should be called
- * once a second on any given client. We then attempt to flush some data.
- */
-void
-flood_recalc(fde_t *F, void *data)
-{
-  struct Client *const client = data;
-
-  /*
-   * Allow a bursting client their allocation per second, allow
-   * a client who is flooding an extra 2 per second
-   */
-  if (IsFloodDone(client))
-    client->connection->sent_parsed -= 2;
-  else
-    client->connection->sent_parsed = 0;
-
-  if (client->connection->sent_parsed < 0)
-    client->connection->sent_parsed = 0;
-
-  parse_client_queued(client);
-
-  /* And now, try flushing .. */
-  if (!IsDead(client))
-  {
-    /* and finally, reset the flood check */
-    comm_setflush(F, 1, flood_recalc, client);
-  }
+  token_bucket_fill(&client->connection->flood_bucket);
 }
 
 /*
@@ -313,6 +329,8 @@ read_packet(fde_t *F, void *data)
     else
       length = recv(F->fd, readBuf, sizeof(readBuf), 0);
 
+    ++loop_syscalls;
+
     if (length <= 0)
     {
       /*
@@ -326,7 +344,16 @@ read_packet(fde_t *F, void *data)
       return;
     }
 
-    dbuf_put(&client->connection->buf_recvq, readBuf, length);
+    if (client->connection->zip)
+    {
+      if (server_zip_inflate(client, readBuf, length) == false)
+      {
+        exit_client(client, "Corrupt compressed data");
+        return;
+      }
+    }
+    else
+      dbuf_put(&client->connection->buf_recvq, readBuf, length);
 
     client->connection->last_ping = event_base->time.sec_monotonic;
     client->connection->last_data = event_base->time.sec_monotonic;
@@ -37,64 +37,42 @@
 #include "send.h"
 #include "conf.h"
 #include "memory.h"
+#include "misc.h"
 #include "user.h"
 #include "server.h"
 #include "packet.h"
 
 
 /*
- * (based on orabidoo's parser code)
+ * Commands are kept in msg_table, sorted by name for report_messages(),
+ * and looked up through msg_hash, an open addressing hash table that is
+ * rebuilt whenever a command is added or removed. Loading modules is
+ * rare; looking up a command happens for every message received.
  *
- * This has always just been a trie. Look at volume III of Knuth ACP
- *
- *
- * ok, you start out with an array of pointers, each one corresponds
- * to a letter at the current position in the command being examined.
- *
- * so roughly you have this for matching 'trie' or 'tie'
- *
- * 't' points -> [MessageTree *] 'r' -> [MessageTree *] -> 'i'
- *   -> [MessageTree *] -> [MessageTree *] -> 'e' and matches
- *
- *                               'i' -> [MessageTree *] -> 'e' and matches
- *
- * BUGS (Limitations!)
- *
- * I designed this trie to parse ircd commands. Hence it currently
- * casefolds. This is trivial to fix by increasing MAXPTRLEN.
- * This trie also "folds" '{' etc. down. This means, the input to this
- * trie must be alpha tokens only. This again, is a limitation that
- * can be overcome by increasing MAXPTRLEN to include upper/lower case
- * at the expense of more memory. At the extreme end, you could make
- * MAXPTRLEN 128.
- *
- * This is also not a patricia trie. On short ircd tokens, this is
- * not likely going to matter.
- *
- * Diane Bruce (Dianora), June 6 2003
- */
-
-/*
- * Must be a power of 2, and larger than 26 [a-z]|[A-Z]. It's used to allocate
- * the set of pointers at each node of the tree.
- * There are MAXPTRLEN pointers at each node. Obviously, there have to be more
- * pointers than ASCII letters. 32 is a nice number since there is then no need
- * to shift 'A'/'a' to base 0 index, at the expense of a few never used
- * pointers.
- * For a small parser like this, this is a good compromise and does
- * make it somewhat faster. - Dianora
+ * A command name is keyed on its length and its first two and last
+ * characters, folded to upper case and packed into 32 bits. That's
+ * enough to tell nearly all commands apart without looking any further,
+ * so a lookup usually costs one pass over the name to find its length,
+ * one multiplication and one slot of msg_hash; for two or three
+ * character tokens such as UID, EOB and CAP the key is the whole name.
+ * Numerics never get here; parse() handles them before looking up a
+ * command.
  */
-enum { MAXPTRLEN = 32 };
+enum { MSG_HASH_SIZE_MIN = 64 };  /**< Must be a power of 2 */
 
-
-static struct MessageTree
+/*! \brief MessageHashSlot structure */
+struct MessageHashSlot
 {
-  int links; /* Count of all pointers (including msg) at this node
-              * used as reference count for deletion of _this_ node.
-              */
-  struct Message *msg;
-  struct MessageTree *pointers[MAXPTRLEN];
-} msg_tree;
+  uint32_t key;  /**< msg_hash_key() of msg->cmd */
+  struct Message *msg;  /**< NULL if the slot is free */
+};
+
+static struct Message **msg_table;  /**< All commands, sorted by name */
+static unsigned int msg_table_count;
+static unsigned int msg_table_size;
+static struct MessageHashSlot *msg_hash;  /**< At least half of the slots are free */
+static unsigned int msg_hash_size;
+static unsigned int msg_hash_shift;  /**< 32 - log2(msg_hash_size) */
 
 
 /* remove_unknown()
@@ -205,6 +183,51 @@ parse_handle_numeric(unsigned int numeric, struct Client *source, int parc, char
   }
 }
 
+static uintmax_t
+parse_clock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* parse_profile_command()
+ *
+ * inputs       - pointer to message block
+ *              - pointer to handler to call
+ *              - pointer to client message is from
+ *              - count of number of args
+ *              - pointer to argv[] array
+ * output       - NONE
+ * side effects - calls the handler and adds its run time and the number
+ *                of bytes it queued for sending to the message profile.
+ *                Commands that hand on to other commands, such as ENCAP,
+ *                include the cost of those.
+ */
+static void
+parse_profile_command(struct Message *message, const struct MessageHandler *handler,
+                      struct Client *source, unsigned int i, char *para[])
+{
+  const uintmax_t sendq_bytes = send_sendq_bytes;
+  const uintmax_t started = parse_clock();
+
+  handler->handler(source, i, para);
+
+  const uintmax_t elapsed = parse_clock() - started;
+  struct MessageProfile *const profile = &message->profile;
+  unsigned int bucket = 0;
+
+  while (bucket < MESSAGE_HISTOGRAM_BUCKETS - 1 && elapsed / 1000 >= (1U << bucket))
+    ++bucket;
+
+  ++profile->histogram[bucket];
+  ++profile->calls;
+  profile->time += elapsed;
+  profile->time_max = IRCD_MAX(profile->time_max, elapsed);
+  profile->sendq_bytes += send_sendq_bytes - sendq_bytes;
+}
+
 /* handle_command()
  *
  * inputs       - pointer to message block
@@ -233,8 +256,10 @@ parse_handle_command(struct Message *message, struct Client *source,
       ((i < handler->args_min) ||
        (handler->empty_last_arg != true && EmptyString(para[handler->args_min - 1]))))
     sendto_one_numeric(source, &me, ERR_NEEDMOREPARAMS, message->cmd);
-  else
+  else if (GlobalSetOptions.profiling == false)
     handler->handler(source, i, para);
+  else
+    parse_profile_command(message, handler, source, i, para);
 }
 
 /*
@@ -428,126 +453,99 @@ parse(struct Client *client, char *pbuffer, char *bufend)
     parse_handle_numeric(numeric, from, parc, para);
 }
 
-/* add_msg_element()
- *
- * inputs	- pointer to MessageTree
- *		- pointer to Message to add for given command
- *		- pointer to current portion of command being added
- * output	- NONE
- * side effects	- recursively build the Message Tree ;-)
- */
-/*
- * How this works.
+/* msg_hash_key()
  *
- * The code first checks to see if its reached the end of the command
- * If so, that struct MessageTree has a msg pointer updated and the links
- * count incremented, since a msg pointer is a reference.
- * Then the code descends recursively, building the trie.
- * If a pointer index inside the struct MessageTree is NULL a new
- * child struct MessageTree has to be allocated.
- * The links (reference count) is incremented as they are created
- * in the parent.
+ * inputs	- command name, which must not be empty
+ *		- length of the name, which must be below 256
+ * output	- key of name
+ * side effects	- none
  */
-static void
-add_msg_element(struct MessageTree *mtree_p, struct Message *msg_p,
-                const char *cmd)
+static inline uint32_t
+msg_hash_key(const char *cmd, size_t len)
 {
-  if (*cmd == '\0')
-  {
-    mtree_p->msg = msg_p;
-    mtree_p->links++;  /* Have msg pointer, so up ref count */
-  }
-  else
-  {
-    /*
-     * *cmd & (MAXPTRLEN-1)
-     * convert the char pointed to at *cmd from ASCII to an integer
-     * between 0 and MAXPTRLEN.
-     * Thus 'A' -> 0x1 'B' -> 0x2 'c' -> 0x3 etc.
-     */
-    struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
-    if (ntree_p == NULL)
-    {
-      ntree_p = xcalloc(sizeof(*ntree_p));
-      mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = ntree_p;
-
-      mtree_p->links++;  /* Have new pointer, so up ref count */
-    }
+  return len << 24 | ToUpper(cmd[0]) << 16 | ToUpper(cmd[1]) << 8 | ToUpper(cmd[len - 1]);
+}
 
-    add_msg_element(ntree_p, msg_p, cmd + 1);
-  }
+static inline unsigned int
+msg_hash_slot(uint32_t key)
+{
+  return (key * 0x9e3779b1U) >> msg_hash_shift;
 }
 
-/* del_msg_element()
+/* msg_hash_rebuild()
  *
- * inputs	- Pointer to MessageTree to delete from
- *		- pointer to command name to delete
+ * inputs	- NONE
  * output	- NONE
- * side effects	- recursively deletes a token from the Message Tree ;-)
- */
-/*
- * How this works.
- *
- * Well, first off, the code recursively descends into the trie
- * until it finds the terminating letter of the command being removed.
- * Once it has done that, it marks the msg pointer as NULL then
- * reduces the reference count on that allocated struct MessageTree
- * since a command counts as a reference.
- *
- * Then it pops up the recurse stack. As it comes back up the recurse
- * The code checks to see if the child now has no pointers or msg
- * i.e. the links count has gone to zero. If it's no longer used, the
- * child struct MessageTree can be deleted. The parent reference
- * to this child is then removed and the parents link count goes down.
- * Thus, we continue to go back up removing all unused MessageTree(s)
+ * side effects	- msg_hash is reallocated and filled in from msg_table
  */
 static void
-del_msg_element(struct MessageTree *mtree_p, const char *cmd)
+msg_hash_rebuild(void)
 {
-  /*
-   * In case this is called for a nonexistent command
-   * check that there is a msg pointer here, else links-- goes -ve
-   * -db
-   */
-  if (*cmd == '\0' && mtree_p->msg)
+  unsigned int size = MSG_HASH_SIZE_MIN, shift = 32 - 6;
+
+  while (size < msg_table_count * 2)
   {
-    mtree_p->msg = NULL;
-    mtree_p->links--;
+    size *= 2;
+    --shift;
   }
-  else
+
+  xfree(msg_hash);
+  msg_hash = xcalloc(size * sizeof(*msg_hash));
+  msg_hash_size = size;
+  msg_hash_shift = shift;
+
+  for (unsigned int i = 0; i < msg_table_count; ++i)
   {
-    struct MessageTree *ntree_p = mtree_p->pointers[*cmd & (MAXPTRLEN - 1)];
-    if (ntree_p)
-    {
-      del_msg_element(ntree_p, cmd + 1);
+    struct Message *const msg = msg_table[i];
+    const uint32_t key = msg_hash_key(msg->cmd, strlen(msg->cmd));
+    unsigned int slot = msg_hash_slot(key);
 
-      if (ntree_p->links == 0)
-      {
-        mtree_p->pointers[*cmd & (MAXPTRLEN - 1)] = NULL;
-        mtree_p->links--;
-        xfree(ntree_p);
-      }
-    }
+    while (msg_hash[slot].msg)
+      slot = (slot + 1) & (msg_hash_size - 1);
+
+    msg_hash[slot].key = key;
+    msg_hash[slot].msg = msg;
   }
 }
 
-/* msg_tree_parse()
+/* msg_hash_find()
  *
  * inputs	- Pointer to command to find
- *		- Pointer to MessageTree root
  * output	- Find given command returning Message * if found NULL if not
  * side effects	- none
  */
 static struct Message *
-msg_tree_parse(const char *cmd)
+msg_hash_find(const char *cmd)
 {
-  struct MessageTree *mtree = &msg_tree;
+  size_t len = 0;
 
   assert(!EmptyString(cmd));
 
-  while (IsAlpha(*cmd) && (mtree = mtree->pointers[*cmd & (MAXPTRLEN - 1)]))
-    if (*++cmd == '\0')
-      return mtree->msg;
+  /* Command names are letters only */
+  while (IsAlpha(cmd[len]))
+    ++len;
+
+  if (cmd[len] != '\0' || len > UINT8_MAX || msg_hash == NULL)
+    return NULL;
+
+  const uint32_t key = msg_hash_key(cmd, len);
+
+  for (unsigned int slot = msg_hash_slot(key); msg_hash[slot].msg;
+       slot = (slot + 1) & (msg_hash_size - 1))
+  {
+    if (msg_hash[slot].key != key)
+      continue;
+
+    /* The key covers the length and the first two and last characters */
+    struct Message *const msg = msg_hash[slot].msg;
+    size_t i = 2;
+
+    while (i < len - 1 && ToUpper(msg->cmd[i]) == ToUpper(cmd[i]))
+      ++i;
+
+    if (i >= len - 1)
+      return msg;
+  }
 
   return NULL;
 }
@@ -561,12 +559,29 @@ msg_tree_parse(const char *cmd)
 void
 mod_add_cmd(struct Message *msg)
 {
+  unsigned int pos = 0;
+
   assert(msg);
   assert(msg->cmd);
 
   /* Command already added? */
-  if (msg_tree_parse(msg->cmd) == NULL)
-    add_msg_element(&msg_tree, msg, msg->cmd);
+  if (msg_hash_find(msg->cmd))
+    return;
+
+  if (msg_table_count == msg_table_size)
+  {
+    msg_table_size = msg_table_size ? msg_table_size * 2 : MSG_HASH_SIZE_MIN;
+    msg_table = xrealloc(msg_table, msg_table_size * sizeof(*msg_table));
+  }
+
+  while (pos < msg_table_count && strcasecmp(msg_table[pos]->cmd, msg->cmd) < 0)
+    ++pos;
+
+  memmove(&msg_table[pos + 1], &msg_table[pos], (msg_table_count - pos) * sizeof(*msg_table));
+  msg_table[pos] = msg;
+  ++msg_table_count;
+
+  msg_hash_rebuild();
 }
 
 /* mod_del_cmd()
@@ -581,8 +596,21 @@ mod_del_cmd(struct Message *msg)
   assert(msg);
   assert(msg->cmd);
 
-  if (msg_tree_parse(msg->cmd))
-    del_msg_element(&msg_tree, msg->cmd);
+  const struct Message *const found = msg_hash_find(msg->cmd);
+  if (found == NULL)
+    return;
+
+  for (unsigned int pos = 0; pos < msg_table_count; ++pos)
+  {
+    if (msg_table[pos] == found)
+    {
+      memmove(&msg_table[pos], &msg_table[pos + 1], (msg_table_count - pos - 1) * sizeof(*msg_table));
+      --msg_table_count;
+      break;
+    }
+  }
+
+  msg_hash_rebuild();
 }
 
 /* find_command()
@@ -594,39 +622,81 @@ mod_del_cmd(struct Message *msg)
 struct Message *
 find_command(const char *cmd)
 {
-  return msg_tree_parse(cmd);
+  return msg_hash_find(cmd);
 }
 
-static void
-recurse_report_messages(struct Client *source, const struct MessageTree *mtree)
+/* report_messages()
+ *
+ * inputs	- pointer to client to report to
+ * output	- NONE
+ * side effects	- client is shown list of commands
+ */
+void
+report_messages(struct Client *source)
 {
-  if (mtree->msg)
+  for (unsigned int i = 0; i < msg_table_count; ++i)
+  {
+    const struct Message *const msg = msg_table[i];
+
     sendto_one_numeric(source, &me, RPL_STATSCOMMANDS,
-                       mtree->msg->cmd,
-                       mtree->msg->count,
-                       mtree->msg->bytes,
-                       mtree->msg->rcount,
-                       mtree->msg->ecount);
-
-  for (unsigned int i = 0; i < MAXPTRLEN; ++i)
-    if (mtree->pointers[i])
-      recurse_report_messages(source, mtree->pointers[i]);
+                       msg->cmd,
+                       msg->count,
+                       msg->bytes,
+                       msg->rcount,
+                       msg->ecount);
+  }
 }
 
-/* report_messages()
+/* report_messages_profile()
  *
  * inputs	- pointer to client to report to
  * output	- NONE
- * side effects	- client is shown list of commands
+ * side effects	- client is shown the handler profile of every command that
+ *		  has been used since profiling was turned on, one line per
+ *		  command in key=value form. hist= lists the number of calls
+ *		  that took less than 1, 2, 4, ... microseconds, the last
+ *		  field counting all longer ones.
  */
 void
-report_messages(struct Client *source)
+report_messages_profile(struct Client *source)
 {
-  const struct MessageTree *const mtree = &msg_tree;
+  sendto_one_numeric(source, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                     "M :profiling=%s buckets=%u",
+                     GlobalSetOptions.profiling == true ? "on" : "off",
+                     MESSAGE_HISTOGRAM_BUCKETS);
+
+  for (unsigned int i = 0; i < msg_table_count; ++i)
+  {
+    const struct Message *const msg = msg_table[i];
+
+    if (msg->profile.calls == 0)
+      continue;
+
+    char buf[IRCD_BUFSIZE];
+    size_t len = 0;
+
+    for (unsigned int j = 0; j < MESSAGE_HISTOGRAM_BUCKETS; ++j)
+      len += snprintf(buf + len, sizeof(buf) - len, "%s%u", j ? "," : "",
+                      msg->profile.histogram[j]);
+
+    sendto_one_numeric(source, &me, RPL_STATSDEBUG | SND_EXPLICIT,
+                       "M :%s calls=%ju time_us=%ju max_us=%ju sendq=%ju hist=%s",
+                       msg->cmd, msg->profile.calls, msg->profile.time / 1000,
+                       msg->profile.time_max / 1000, msg->profile.sendq_bytes, buf);
+  }
+}
 
-  for (unsigned int i = 0; i < MAXPTRLEN; ++i)
-    if (mtree->pointers[i])
-      recurse_report_messages(source, mtree->pointers[i]);
+/* parse_profile_reset()
+ *
+ * inputs	- NONE
+ * output	- NONE
+ * side effects	- clears the handler profile of every command
+ */
+void
+parse_profile_reset(void)
+{
+  for (unsigned int i = 0; i < msg_table_count; ++i)
+    memset(&msg_table[i]->profile, 0, sizeof(msg_table[i]->profile));
 }
 
 /* m_not_oper()
@@ -34,6 +34,7 @@
  */
 
 #include <assert.h> /* assert */
+#include <stdbool.h> /* bool */
 #include <stddef.h> /* NULL */
 #include <stdio.h> /* sprintf, fprintf, stderr */
 #include <stdlib.h> /* free, atol, calloc */
@@ -44,6 +45,7 @@
 #include <arpa/inet.h> /* BSD, Linux, Solaris: for inet_addr */
 
 #include "patricia.h"
+#include "irc_string.h"
 #include "memory.h"
 
 /* { from prefix.c */
@@ -87,10 +89,10 @@ patricia_prefix_toa(const prefix_t *prefix, int with_len)
   assert((prefix->family == AF_INET  && prefix->bitlen <=  32) ||
          (prefix->family == AF_INET6 && prefix->bitlen <= 128));
 
-  inet_ntop(prefix->family, &prefix->add.sin6, buf, INET6_ADDRSTRLEN);
+  size_t len = address_ntop(prefix->family, &prefix->add.sin6, buf);
 
   if (with_len)
-    sprintf(buf + strlen(buf), "/%d", prefix->bitlen);
+    sprintf(buf + len, "/%d", prefix->bitlen);
   return buf;
 }
 
@@ -78,9 +78,13 @@ static void res_readreply(fde_t *, void *);
 #define RDLENGTH_SIZE     (size_t)2
 #define ANSWER_FIXED_SIZE (TYPE_SIZE + CLASS_SIZE + TTL_SIZE + RDLENGTH_SIZE)
 
+enum { RES_HASHSIZE = 4096 };  /**< Buckets in request_id_hash and request_ctx_hash */
+
 struct reslist
 {
   dlink_node node;                           /**< Doubly linked list node. */
+  dlink_node id_node;                        /**< Link to request_id_hash, once sent */
+  dlink_node ctx_node;                       /**< Link to request_ctx_hash */
   unsigned int id;                           /**< Request ID (from request header). */
   char type;                                 /**< Current request type. */
   char retries;                              /**< Retry counter */
@@ -97,6 +101,21 @@ struct reslist
 static fde_t *ResolverFileDescriptor;
 static dlink_list request_list;
 
+/*
+ * Lookups by request ID and by callback context happen for every reply,
+ * every query sent and every client that goes away before its lookup is
+ * done. During a connection flood, thousands of requests may be pending,
+ * so neither can afford to walk request_list.
+ */
+static dlink_list request_id_hash[RES_HASHSIZE];
+static dlink_list request_ctx_hash[RES_HASHSIZE];
+
+static dlink_list *
+request_ctx_bucket(const void *ctx)
+{
+  return &request_ctx_hash[((uintptr_t)ctx >> 4) & (RES_HASHSIZE - 1)];
+}
+
 
 /*
  * rem_request - remove a request from the list.
@@ -107,6 +126,11 @@ static void
 rem_request(struct reslist *request)
 {
   dlinkDelete(&request->node, &request_list);
+  dlinkDelete(&request->ctx_node, request_ctx_bucket(request->callback_ctx));
+
+  if (request->sends)
+    dlinkDelete(&request->id_node, &request_id_hash[request->id & (RES_HASHSIZE - 1)]);
+
   xfree(request);
 }
 
@@ -125,6 +149,7 @@ make_request(dns_callback_fnc callback, void *ctx)
   request->callback_ctx = ctx;
 
   dlinkAdd(request, &request->node, &request_list);
+  dlinkAdd(request, &request->ctx_node, request_ctx_bucket(ctx));
   return request;
 }
 
@@ -195,7 +220,7 @@ delete_resolver_queries(const void *vptr)
 {
   dlink_node *node, *node_next;
 
-  DLINK_FOREACH_SAFE(node, node_next, request_list.head)
+  DLINK_FOREACH_SAFE(node, node_next, request_ctx_bucket(vptr)->head)
   {
     struct reslist *request = node->data;
 
@@ -235,7 +260,7 @@ find_id(unsigned int id)
 {
   dlink_node *node;
 
-  DLINK_FOREACH(node, request_list.head)
+  DLINK_FOREACH(node, request_id_hash[id & (RES_HASHSIZE - 1)].head)
   {
     struct reslist *request = node->data;
 
@@ -271,7 +296,11 @@ query_name(const char *name, int query_class, int type, struct reslist *request)
       header->id = (header->id + genrand_int32()) & 0xFFFF;
     while (find_id(header->id));
 
+    if (request->sends)
+      dlinkDelete(&request->id_node, &request_id_hash[request->id & (RES_HASHSIZE - 1)]);
+
     request->id = header->id;
+    dlinkAdd(request, &request->id_node, &request_id_hash[request->id & (RES_HASHSIZE - 1)]);
     ++request->sends;
 
     send_res_msg(buf, request_len, request->sends);
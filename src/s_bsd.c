@@ -24,6 +24,7 @@
  * \version $Id$
  */
 
+#define _GNU_SOURCE  /* accept4() */
 #include "stdinc.h"
 #include <netinet/in_systm.h>
 #include <netinet/ip.h>
@@ -42,11 +43,13 @@
 #include "res.h"
 #include "restart.h"
 #include "conf.h"
+#include "hostmask.h"
 #include "log.h"
 #include "server.h"
 #include "send.h"
 #include "memory.h"
 #include "user.h"
+#include "tls_pool.h"
 
 
 static const char *const comm_err_str[] =
@@ -119,13 +122,26 @@ report_error(int level, const char *text, const char *who, int error)
   ilog(LOG_TYPE_IRCD, text, who, strerror(error));
 }
 
+/*
+ * Where the system can create sockets non-blocking and close-on-exec
+ * right away, there is no need for any fcntl() calls afterwards.
+ */
+#if defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+#define COMM_SOCKET_FLAGS (SOCK_NONBLOCK | SOCK_CLOEXEC)
+#define COMM_SOCKET_NONBLOCKING true
+#else
+#define COMM_SOCKET_FLAGS 0
+#define COMM_SOCKET_NONBLOCKING false
+#endif
+
 /*
  * setup_socket()
  *
- * Set the socket non-blocking, and other wonderful bits.
+ * Set the socket non-blocking, unless already done, and other
+ * wonderful bits.
  */
 static void
-setup_socket(int fd)
+setup_socket(int fd, bool nonblocking)
 {
   int opt = 1;
 
@@ -141,15 +157,18 @@ setup_socket(int fd)
   setsockopt(fd, SOL_SOCKET, TCP_QUICKACK, &opt, sizeof(opt));
 #endif
 
-  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  if (nonblocking == false)
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
 }
 
+static void ssl_handshake(fde_t *, void *);
+
 /*
- * ssl_handshake - let OpenSSL initialize the protocol. Register for
- * read/write events if necessary.
+ * ssl_handshake_done - called with the outcome of a handshake step.
+ * Register for read/write events if necessary.
  */
 static void
-ssl_handshake(fde_t *F, void *data)
+ssl_handshake_done(fde_t *F, tls_handshake_status_t ret, const char *errstr, void *data)
 {
   struct Client *client = data;
 
@@ -158,7 +177,6 @@ ssl_handshake(fde_t *F, void *data)
   assert(client->connection->fd);
   assert(client->connection->fd == F);
 
-  tls_handshake_status_t ret = tls_handshake(&F->tls, TLS_ROLE_SERVER, NULL);
   if (ret != TLS_HANDSHAKE_DONE)
   {
     if ((event_base->time.sec_monotonic - client->connection->created_monotonic) > TLS_HANDSHAKE_TIMEOUT)
@@ -182,6 +200,11 @@ ssl_handshake(fde_t *F, void *data)
   }
 
   comm_settimeout(F, 0, NULL, NULL);
+  F->flags.tls_kernel_send = tls_kernel_send(&F->tls);
+
+  ++ServerStats.is_tls;
+  if (tls_session_reused(&F->tls))
+    ++ServerStats.is_tlsr;
 
   if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->tls_certfp) == false)
     ilog(LOG_TYPE_IRCD, "Client %s gave bad TLS client certificate",
@@ -190,6 +213,16 @@ ssl_handshake(fde_t *F, void *data)
   auth_start(client);
 }
 
+/*
+ * ssl_handshake - let OpenSSL initialize the protocol, on a worker
+ * thread if there are any.
+ */
+static void
+ssl_handshake(fde_t *F, void *data)
+{
+  tls_pool_handshake(F, TLS_ROLE_SERVER, ssl_handshake_done, data);
+}
+
 /*
  * add_connection - creates a client which has just connected to us on
  * the given fd. The sockhost field is initialized with the ip# of the host.
@@ -211,9 +244,7 @@ add_connection(struct Listener *listener, struct irc_ssaddr *irn, int fd)
    */
   client->ip = *irn;
 
-  getnameinfo((const struct sockaddr *)&client->ip,
-              client->ip.ss_len, client->sockhost,
-              sizeof(client->sockhost), NULL, 0, NI_NUMERICHOST);
+  address_format(&client->ip, client->sockhost, sizeof(client->sockhost));
 
   if (client->sockhost[0] == ':')
   {
@@ -500,11 +531,11 @@ comm_socket(int family, int sock_type, int proto)
    * limit if/when we get an error, but we can deal with that later.
    * XXX !!! -- adrian
    */
-  int fd = socket(family, sock_type, proto);
+  int fd = socket(family, sock_type | COMM_SOCKET_FLAGS, proto);
   if (fd < 0)
     return -1; /* errno will be passed through, yay.. */
 
-  setup_socket(fd);
+  setup_socket(fd, COMM_SOCKET_NONBLOCKING);
 
   return fd;
 }
@@ -534,13 +565,21 @@ comm_accept(fde_t *F, struct irc_ssaddr *addr)
    * reserved fd limit, but we can deal with that when comm_open()
    * also does it. XXX -- adrian
    */
+#if defined(HAVE_ACCEPT4) && defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+  int fd = accept4(F->fd, (struct sockaddr *)addr, &addrlen, COMM_SOCKET_FLAGS);
+#else
   int fd = accept(F->fd, (struct sockaddr *)addr, &addrlen);
+#endif
   if (fd < 0)
     return -1;
 
   remove_ipv6_mapping(addr);
 
-  setup_socket(fd);
+#if defined(HAVE_ACCEPT4) && defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+  setup_socket(fd, true);
+#else
+  setup_socket(fd, false);
+#endif
 
   /* .. and return */
   return fd;
@@ -41,6 +41,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 static int devpoll_fd;
 
@@ -152,6 +153,7 @@ comm_select(void)
   num = ioctl(devpoll_fd, DP_POLL, &dopoll);
 
   event_time_set();
+  loop_stats_ready(num);
 
   if (num < 0)
   {
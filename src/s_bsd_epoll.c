@@ -31,6 +31,7 @@
 #include "s_bsd.h"
 #include "log.h"
 #include "memory.h"
+#include "loop_stats.h"
 #include <sys/epoll.h>
 
 enum
@@ -151,6 +152,7 @@ comm_select(void)
   assert(num <= epollop->nevents);
 
   event_time_set();
+  loop_stats_ready(num);
 
   if (num < 0)
   {
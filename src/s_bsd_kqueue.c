@@ -31,6 +31,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 enum { KE_LENGTH = 128 };
 
@@ -153,6 +154,7 @@ comm_select(void)
   kqoff = 0;
 
   event_time_set();
+  loop_stats_ready(num);
 
   if (num < 0)
   {
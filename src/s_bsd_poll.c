@@ -33,6 +33,7 @@
 #include "ircd.h"
 #include "s_bsd.h"
 #include "log.h"
+#include "loop_stats.h"
 
 /* I hate linux -- adrian */
 #ifndef POLLRDNORM
@@ -155,6 +156,7 @@ comm_select(void)
   num = poll(pollfds, pollnum, SELECT_DELAY);
 
   event_time_set();
+  loop_stats_ready(num);
 
   if (num < 0)
   {
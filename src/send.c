@@ -28,17 +28,24 @@
 #include "list.h"
 #include "send.h"
 #include "channel.h"
+#include "channel_mode.h"
 #include "client.h"
 #include "dbuf.h"
 #include "irc_string.h"
 #include "ircd.h"
+#include "misc.h"
 #include "s_bsd.h"
+#include "server_burst.h"
 #include "server_capab.h"
+#include "server_zip.h"
 #include "conf_class.h"
 #include "log.h"
+#include "loop_stats.h"
 
 
+uintmax_t send_sendq_bytes;  /**< Bytes queued to any sendq so far */
 static uintmax_t current_serial;
+static char tls_record_buf[16384];  /**< Maximum TLS record plaintext size */
 
 
 /* send_format()
@@ -86,13 +93,19 @@ send_message(struct Client *to, struct dbuf_block *buffer)
   assert(to != &me);
   assert(MyConnect(to));
 
-  if (dbuf_length(&to->connection->buf_sendq) + buffer->size > get_sendq(&to->connection->confs))
+  /* Queued mode changes must not arrive after anything sent later on */
+  channel_mode_flush();
+
+  /* Messages a bursting server can't take yet count against its sendq as well */
+  const size_t held = to->connection->burst_task ? to->connection->burst_task->held_bytes : 0;
+
+  if (dbuf_length(&to->connection->buf_sendq) + held + buffer->size > get_sendq(&to->connection->confs))
   {
     if (IsServer(to))
       sendto_realops_flags(UMODE_SERVNOTICE, L_ALL, SEND_NOTICE,
                            "Max SendQ limit exceeded for %s: %zu > %u",
                            client_get_name(to, HIDE_IP),
-                           (dbuf_length(&to->connection->buf_sendq) + buffer->size),
+                           (dbuf_length(&to->connection->buf_sendq) + held + buffer->size),
                            get_sendq(&to->connection->confs));
 
     if (IsClient(to))
@@ -102,7 +115,11 @@ send_message(struct Client *to, struct dbuf_block *buffer)
     return;
   }
 
+  if (to->connection->burst_task && server_burst_hold(to, buffer))
+    return;
+
   dbuf_add(&to->connection->buf_sendq, buffer);
+  send_sendq_bytes += buffer->size;
 
   /*
    * Update statistics. The following is slightly incorrect because
@@ -112,7 +129,10 @@ send_message(struct Client *to, struct dbuf_block *buffer)
   ++to->connection->send.messages;
   ++me.connection->send.messages;
 
-  send_queued_write(to);
+  if (to->connection->zip)
+    server_zip_defer(to);  /* Compress everything produced in this loop iteration in one go */
+  else
+    send_queued_write(to);
 }
 
 /* send_message_remote()
@@ -156,6 +176,10 @@ sendq_unblocked(fde_t *F, void *data)
 
   DelFlag(client, FLAGS_BLOCKED);
   send_queued_write(client);
+
+  /* Sendq has drained a bit, produce the next part of the burst */
+  if (client->connection->burst_task)
+    server_burst_continue(client);
 }
 
 /*
@@ -176,23 +200,63 @@ send_queued_write(struct Client *to)
   if (IsDead(to) || HasFlag(to, FLAGS_BLOCKED))
     return;  /* no use calling send() now */
 
+  if (to->connection->fd->tls_job)
+    return;  /* A worker thread is still busy with the TLS handshake */
+
   /* Next, lets try to write some data */
-  while (dbuf_length(&to->connection->buf_sendq))
+  while (true)
   {
     bool want_read = false;
-    const struct dbuf_block *first = to->connection->buf_sendq.blocks.head->data;
+    struct dbuf_queue *queue = &to->connection->buf_sendq;
 
-    if (tls_isusing(&to->connection->fd->tls))
+    if (to->connection->zip)
     {
-      retlen = tls_write(&to->connection->fd->tls, first->data + to->connection->buf_sendq.pos,
-                                                   first->size - to->connection->buf_sendq.pos, &want_read);
+      if ((queue = server_zip_queue(to)) == NULL)
+      {
+        dead_link_on_write(to, 0);
+        return;
+      }
+    }
+
+    if (dbuf_length(queue) == 0)
+      break;
+
+    const struct dbuf_block *first = queue->blocks.head->data;
+
+    /* With kernel TLS, plain send() gets the data encrypted as well */
+    if (tls_isusing(&to->connection->fd->tls) && to->connection->fd->flags.tls_kernel_send == false)
+    {
+      /*
+       * Hand the TLS library up to a full record of plaintext at a time
+       * instead of one dbuf block, so a large reply isn't split into lots
+       * of small records. A write that couldn't complete must be retried
+       * with the same length, which all TLS backends insist on.
+       */
+      size_t length = to->connection->tls_write_size;
+      const char *data = first->data + queue->pos;
+
+      if (length == 0)
+        length = IRCD_MIN(dbuf_length(queue), sizeof(tls_record_buf));
+
+      assert(length <= dbuf_length(queue));
+
+      if (length > first->size - queue->pos)
+      {
+        dbuf_copy(queue, tls_record_buf, length);
+        data = tls_record_buf;
+      }
+
+      retlen = tls_write(&to->connection->fd->tls, data, length, &want_read);
+      to->connection->tls_write_size = retlen > 0 ? 0 : length;
 
       if (want_read == true)
         return;  /* Retry later, don't register for write events */
     }
     else
-      retlen = send(to->connection->fd->fd, first->data + to->connection->buf_sendq.pos,
-                                            first->size - to->connection->buf_sendq.pos, 0);
+      retlen = send(to->connection->fd->fd, first->data + queue->pos,
+                                            first->size - queue->pos, 0);
+
+    ++loop_syscalls;
 
     if (retlen <= 0)
     {
@@ -207,11 +271,14 @@ send_queued_write(struct Client *to)
       return;
     }
 
-    dbuf_delete(&to->connection->buf_sendq, retlen);
+    dbuf_delete(queue, retlen);
 
     /* We have some data written .. update counters */
-    to->connection->send.bytes += retlen;
-    me.connection->send.bytes += retlen;
+    if (to->connection->zip == NULL)
+    {
+      to->connection->send.bytes += retlen;
+      me.connection->send.bytes += retlen;
+    }
   }
 }
 
@@ -242,6 +309,19 @@ sendto_one(struct Client *to, const char *pattern, ...)
   dbuf_ref_free(buffer);
 }
 
+/*! \brief Sends a line the caller has put together in a dbuf block
+ * \param to     Client to send to
+ * \param buffer Block holding one complete line, including CR-LF
+ */
+void
+sendto_one_buffer(struct Client *to, struct dbuf_block *buffer)
+{
+  if (IsDead(to->from))
+    return;  /* This socket has already been marked as dead */
+
+  send_message(to->from, buffer);
+}
+
 void
 sendto_one_numeric(struct Client *to, const struct Client *from, enum irc_numerics numeric, ...)
 {
@@ -334,6 +414,8 @@ sendto_channel_butone(struct Client *one, const struct Client *from,
 
   ++current_serial;
 
+  unsigned int count = 0;
+
   DLINK_FOREACH(node, channel->members.head)
   {
     struct ChannelMember *member = node->data;
@@ -357,10 +439,15 @@ sendto_channel_butone(struct Client *one, const struct Client *from,
       send_message(target, buffer_l);
     else if (target->from->connection->serial != current_serial)
       send_message_remote(target->from, from, buffer_r);
+    else
+      continue;
 
     target->from->connection->serial = current_serial;
+    ++count;
   }
 
+  loop_stats_fanout(count);
+
   dbuf_ref_free(buffer_l);
   dbuf_ref_free(buffer_r);
 }
@@ -498,6 +585,7 @@ sendto_channel_local(const struct Client *one, struct Channel *channel, unsigned
   va_list args;
   dlink_node *node;
   struct dbuf_block *buffer = dbuf_alloc();
+  unsigned int count = 0;
 
   va_start(args, pattern);
   send_format(buffer, pattern, args);
@@ -524,8 +612,11 @@ sendto_channel_local(const struct Client *one, struct Channel *channel, unsigned
       continue;
 
     send_message(target, buffer);
+    ++count;
   }
 
+  loop_stats_fanout(count);
+
   dbuf_ref_free(buffer);
 }
 
@@ -35,12 +35,14 @@
 #include "s_bsd.h"
 #include "packet.h"
 #include "conf.h"
+#include "hostmask.h"
 #include "server.h"
 #include "server_capab.h"
 #include "log.h"
 #include "send.h"
 #include "memory.h"
 #include "parse.h"
+#include "tls_pool.h"
 
 
 dlink_list flatten_links;
@@ -405,8 +407,7 @@ server_connect(struct MaskItem *conf, struct Client *by)
     return false;
   }
 
-  getnameinfo((const struct sockaddr *)conf->addr, conf->addr->ss_len,
-              buf, sizeof(buf), NULL, 0, NI_NUMERICHOST);
+  address_format(conf->addr, buf, sizeof(buf));
   ilog(LOG_TYPE_IRCD, "Connect to %s[%s] @%s", conf->name, conf->host, buf);
 
   /* Create a socket for the server connection */
@@ -484,7 +485,7 @@ server_finish_tls_handshake(struct Client *client)
 
   sendto_one(client, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-  sendto_one(client, "CAPAB :%s", capab_get(NULL));
+  sendto_one(client, "CAPAB :%s", capab_get_link(conf));
 
   sendto_one(client, "SERVER %s 1 :%s%s",
              me.name, ConfigServerHide.hidden ? "(H) " : "",
@@ -494,18 +495,18 @@ server_finish_tls_handshake(struct Client *client)
   read_packet(client->connection->fd, client); 
 }
 
+static void server_tls_handshake(fde_t *, void *);
+
 static void
-server_tls_handshake(fde_t *F, void *data)
+server_tls_handshake_done(fde_t *F, tls_handshake_status_t ret, const char *sslerr, void *data)
 {
   struct Client *client = data;
-  const char *sslerr = NULL;
 
   assert(client);
   assert(client->connection);
   assert(client->connection->fd);
   assert(client->connection->fd == F);
 
-  tls_handshake_status_t ret = tls_handshake(&F->tls, TLS_ROLE_CLIENT, &sslerr);
   if (ret != TLS_HANDSHAKE_DONE)
   {
     if ((event_base->time.sec_monotonic - client->connection->created_monotonic) > TLS_HANDSHAKE_TIMEOUT)
@@ -536,6 +537,11 @@ server_tls_handshake(fde_t *F, void *data)
   }
 
   comm_settimeout(F, 0, NULL, NULL);
+  F->flags.tls_kernel_send = tls_kernel_send(&F->tls);
+
+  ++ServerStats.is_tls;
+  if (tls_session_reused(&F->tls))
+    ++ServerStats.is_tlsr;
 
   if (tls_verify_certificate(&F->tls, ConfigServerInfo.message_digest_algorithm, &client->tls_certfp) == false)
     ilog(LOG_TYPE_IRCD, "Server %s gave bad TLS client certificate",
@@ -545,7 +551,13 @@ server_tls_handshake(fde_t *F, void *data)
 }
 
 static void
-server_tls_connect_init(struct Client *client, const struct MaskItem *conf, fde_t *F)
+server_tls_handshake(fde_t *F, void *data)
+{
+  tls_pool_handshake(F, TLS_ROLE_CLIENT, server_tls_handshake_done, data);
+}
+
+static void
+server_tls_connect_init(struct Client *client, struct MaskItem *conf, fde_t *F)
 {
   assert(client);
   assert(client->connection);
@@ -562,6 +574,9 @@ server_tls_connect_init(struct Client *client, const struct MaskItem *conf, fde_
   if (!EmptyString(conf->cipher_list))
     tls_set_ciphers(&F->tls, conf->cipher_list);
 
+  /* Skip the full handshake if the session of our last connect is still good */
+  tls_session_resume(&F->tls, &conf->tls_session);
+
   server_tls_handshake(F, client);
 }
 
@@ -605,8 +620,8 @@ server_connect_callback(fde_t *F, int status, void *data)
 
   /* COMM_OK, so continue the connection procedure */
   /* Get the connect {} block */
-  const struct MaskItem *conf = find_conf_name(&client->connection->confs,
-                                                client->name, CONF_SERVER);
+  struct MaskItem *conf = find_conf_name(&client->connection->confs,
+                                          client->name, CONF_SERVER);
   if (conf == NULL)
   {
     sendto_realops_flags(UMODE_SERVNOTICE, L_ADMIN, SEND_NOTICE,
@@ -629,7 +644,7 @@ server_connect_callback(fde_t *F, int status, void *data)
 
   sendto_one(client, "PASS %s TS %u %s", conf->spasswd, TS_CURRENT, me.id);
 
-  sendto_one(client, "CAPAB :%s", capab_get(NULL));
+  sendto_one(client, "CAPAB :%s", capab_get_link(conf));
 
   sendto_one(client, "SERVER %s 1 :%s%s", me.name,
              ConfigServerHide.hidden ? "(H) " : "", me.info);
@@ -0,0 +1,510 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file server_burst.c
+ * \brief Resumable, sendq-aware server burst.
+ * \version $Id$
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "client_svstag.h"
+#include "channel.h"
+#include "channel_mode.h"
+#include "conf_class.h"
+#include "dbuf.h"
+#include "event.h"
+#include "hash.h"
+#include "irc_string.h"
+#include "ircd.h"
+#include "log.h"
+#include "memory.h"
+#include "send.h"
+#include "server_burst.h"
+#include "server_capab.h"
+#include "user.h"
+
+
+/*
+ * The burst is sent in two phases. First, all clients are introduced by
+ * walking global_client_list from head to tail. Clients are always added
+ * to the head of that list, so every client added while the burst is
+ * in progress is behind the cursor and gets introduced to the new server
+ * by the regular UID propagation. Clients that have not been introduced yet
+ * are exactly those with a global_serial less than or equal to the one the
+ * cursor points to. Anything these clients generate in the meantime would be
+ * answered with a KILL for an unknown prefix, so it is held back and sent
+ * right after the batch of UIDs that introduces them. Held messages count
+ * against the class sendq like queued ones do; those of clients that exit
+ * before being introduced are dropped along with them.
+ *
+ * Held messages keep their order among themselves, but not with respect to
+ * anything else sent in the meantime. A client that has already been
+ * introduced may get its reply to a held message across first, so until
+ * the clients phase is done, the new server may see messages from
+ * different clients in a different order than we did.
+ *
+ * Second, the channel hash table is walked bucket by bucket, just like
+ * safe_list_channels() does. Live JOIN/MODE/TOPIC traffic for channels that
+ * have not been sent yet is harmless: the SJOIN/BMASK/TBURST lines that
+ * follow are merged by the remote side.
+ *
+ * Data is only produced while the link's sendq is below half of its
+ * class sendq, so links no longer need a sendq large enough to hold the
+ * entire network state.
+ */
+dlink_list bursting_server_list;
+
+
+/* server_burst_exceeding()
+ *
+ * inputs       - pointer to server to check
+ * output       - true if we should stop producing burst data for now
+ * side effects - none
+ */
+static bool
+server_burst_exceeding(const struct Client *client_p)
+{
+  if (IsDead(client_p))
+    return true;
+
+  return dbuf_length(&client_p->connection->buf_sendq) > (get_sendq(&client_p->connection->confs) / 2);
+}
+
+/* server_burst_source()
+ *
+ * inputs       - pointer to formatted message
+ * output       - pointer to the client the message's prefix names, or
+ *                NULL if it has no prefix or names no known client
+ */
+static const struct Client *
+server_burst_source(const struct dbuf_block *buffer)
+{
+  char id[IDLEN + 1];
+  size_t len = 0;
+
+  if (buffer->size == 0 || buffer->data[0] != ':')
+    return NULL;
+
+  for (const char *p = buffer->data + 1; p < buffer->data + buffer->size && *p != ' '; ++p)
+  {
+    if (len == IDLEN)
+      return NULL;
+    id[len++] = *p;
+  }
+
+  id[len] = '\0';
+
+  const struct Client *source = hash_find_id(id);
+  if (source && IsClient(source))
+    return source;
+  return NULL;
+}
+
+/* server_burst_release()
+ *
+ * inputs       - pointer to bursting server
+ *              - pointer to its burst task
+ * output       - NONE
+ * side effects - sends the held messages of clients that have been
+ *                introduced by now, in the order they were generated,
+ *                and drops those of clients that have gone away.
+ *                Messages sent while these were held have gone out
+ *                ahead of them.
+ */
+static void
+server_burst_release(struct Client *client_p, struct BurstTask *bt)
+{
+  dlink_node *node, *node_next;
+
+  DLINK_FOREACH_SAFE(node, node_next, bt->held.head)
+  {
+    struct dbuf_block *buffer = node->data;
+    const struct Client *source = server_burst_source(buffer);
+
+    if (source && bt->client_serial && source->global_serial <= bt->client_serial)
+      continue;  /* Not introduced yet */
+
+    dlinkDelete(node, &bt->held);
+    free_dlink_node(node);
+    bt->held_bytes -= buffer->size;
+
+    if (source)
+      sendto_one_buffer(client_p, buffer);
+
+    dbuf_ref_free(buffer);
+  }
+}
+
+/* server_burst_set_client_next()
+ *
+ * inputs       - pointer to burst task
+ *              - pointer to next global_client_list node to be sent
+ * output       - none
+ * side effects - client cursor of the burst task is updated
+ */
+static void
+server_burst_set_client_next(struct BurstTask *bt, dlink_node *node)
+{
+  bt->client_next = node;
+
+  if (node)
+    bt->client_serial = ((const struct Client *)node->data)->global_serial;
+  else
+    bt->client_serial = 0;
+}
+
+/*
+ * send_tb
+ *
+ * inputs       - pointer to Client
+ *              - pointer to channel
+ * output       - NONE
+ * side effects - Called on a server burst when
+ *                server is CAPAB_TBURST capable
+ */
+static void
+server_send_tburst(struct Client *client_p, const struct Channel *channel)
+{
+  /*
+   * We may also send an empty topic here, but only if topic_time isn't 0,
+   * i.e. if we had a topic that got unset.  This is required for syncing
+   * topics properly.
+   *
+   * Imagine the following scenario: Our downlink introduces a channel
+   * to us with a TS that is equal to ours, but the channel topic on
+   * their side got unset while the servers were in splitmode, which means
+   * their 'topic' is newer.  They simply wanted to unset it, so we have to
+   * deal with it in a more sophisticated fashion instead of just resetting
+   * it to their old topic they had before.  Read m_tburst.c:ms_tburst
+   * for further information   -Michael
+   */
+  if (channel->topic_time)
+    sendto_one(client_p, ":%s TBURST %ju %s %ju %s :%s", me.id,
+               channel->creation_time, channel->name,
+               channel->topic_time,
+               channel->topic_info,
+               channel->topic);
+}
+
+/* sendnick_TS()
+ *
+ * inputs       - client (server) to send nick towards
+ *          - client to send nick for
+ * output       - NONE
+ * side effects - NICK message is sent towards given client_p
+ */
+static void
+server_send_client(struct Client *client_p, struct Client *target_p)
+{
+  dlink_node *node;
+  char buf[UMODE_MAX_STR] = "";
+
+  assert(IsClient(target_p));
+
+  send_umode(target_p, false, 0, buf);
+
+  if (buf[0] == '\0')
+  {
+    buf[0] = '+';
+    buf[1] = '\0';
+  }
+
+  /* TBR: compatibility mode */
+  if (IsCapable(client_p, CAPAB_RHOST))
+    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s %s :%s",
+               target_p->servptr->id,
+               target_p->name, target_p->hopcount + 1,
+               target_p->tsinfo,
+               buf, target_p->username, target_p->host, target_p->realhost,
+               target_p->sockhost, target_p->id,
+               target_p->account, target_p->info);
+  else
+    sendto_one(client_p, ":%s UID %s %u %ju %s %s %s %s %s %s :%s",
+               target_p->servptr->id,
+               target_p->name, target_p->hopcount + 1,
+               target_p->tsinfo,
+               buf, target_p->username, target_p->host,
+               target_p->sockhost, target_p->id,
+               target_p->account, target_p->info);
+
+  if (!EmptyString(target_p->tls_certfp))
+    sendto_one(client_p, ":%s CERTFP %s", target_p->id, target_p->tls_certfp);
+
+  if (target_p->away[0])
+    sendto_one(client_p, ":%s AWAY :%s", target_p->id, target_p->away);
+
+
+  DLINK_FOREACH(node, target_p->svstags.head)
+  {
+    const struct ServicesTag *svstag = node->data;
+    char *m = buf;
+
+    for (const struct user_modes *tab = umode_tab; tab->c; ++tab)
+      if (svstag->umodes & tab->flag)
+        *m++ = tab->c;
+    *m = '\0';
+
+    sendto_one(client_p, ":%s SVSTAG %s %ju %u +%s :%s", me.id, target_p->id,
+               target_p->tsinfo, svstag->numeric, buf, svstag->tag);
+  }
+}
+
+/* server_burst_clients()
+ *
+ * inputs       - pointer to server to send burst to
+ * output       - true if all clients have been introduced
+ * side effects - introduces clients until the sendq watermark is hit
+ */
+static bool
+server_burst_clients(struct Client *client_p, struct BurstTask *bt)
+{
+  while (bt->client_next)
+  {
+    if (server_burst_exceeding(client_p) == true)
+    {
+      server_burst_release(client_p, bt);
+      return false;  /* Still more to do */
+    }
+
+    struct Client *target_p = bt->client_next->data;
+
+    /*
+     * Advance the cursor before sending anything, so the lines
+     * prefixed with target_p's ID are not held back by
+     * server_burst_hold().
+     */
+    server_burst_set_client_next(bt, bt->client_next->next);
+
+    if (target_p->from != client_p)
+    {
+      server_send_client(client_p, target_p);
+      ++bt->clients_sent;
+    }
+  }
+
+  server_burst_release(client_p, bt);
+  return true;
+}
+
+/* server_burst_channels()
+ *
+ * inputs       - pointer to server to send burst to
+ * output       - true if all channels have been sent
+ * side effects - sends channel buckets until the sendq watermark is hit
+ */
+static bool
+server_burst_channels(struct Client *client_p, struct BurstTask *bt)
+{
+  for (; bt->hash_index < HASHSIZE; ++bt->hash_index)
+  {
+    if (server_burst_exceeding(client_p) == true)
+      return false;  /* Still more to do */
+
+    for (const struct Channel *channel = hash_get_bucket(HASH_TYPE_CHANNEL, bt->hash_index);
+         channel; channel = channel->hnextch)
+    {
+      if (dlink_list_length(&channel->members) == 0)
+        continue;
+
+      channel_send_modes(client_p, channel);
+
+      if (IsCapable(client_p, CAPAB_TBURST))
+        server_send_tburst(client_p, channel);
+
+      ++bt->channels_sent;
+    }
+  }
+
+  return true;
+}
+
+/* server_burst_finish()
+ *
+ * inputs       - pointer to server the burst has been sent to
+ * output       - NONE
+ * side effects - sends PING and EOBs, and releases the burst task
+ */
+static void
+server_burst_finish(struct Client *client_p)
+{
+  const struct BurstTask *const bt = client_p->connection->burst_task;
+  dlink_node *node;
+
+  /* Always send a PING after connect burst is done */
+  sendto_one(client_p, "PING :%s", me.id);
+
+  if (IsCapable(client_p, CAPAB_EOB))
+  {
+    DLINK_FOREACH_PREV(node, global_server_list.tail)
+    {
+      struct Client *target_p = node->data;
+
+      if (target_p->from == client_p)
+        continue;
+
+      if (IsMe(target_p) || HasFlag(target_p, FLAGS_EOB))
+        sendto_one(client_p, ":%s EOB", target_p->id);
+    }
+  }
+
+  ilog(LOG_TYPE_IRCD, "Burst to %s completed: %u clients, %u channels, %ju KiB in %ju seconds",
+       client_p->name, bt->clients_sent, bt->channels_sent, bt->bytes >> 10,
+       event_base->time.sec_monotonic - bt->started);
+
+  server_burst_free(client_p);
+}
+
+/* server_burst_continue()
+ *
+ * inputs       - pointer to server to send burst to
+ * output       - NONE
+ * side effects - produces as much burst data as the sendq watermark allows
+ */
+void
+server_burst_continue(struct Client *client_p)
+{
+  struct BurstTask *const bt = client_p->connection->burst_task;
+
+  assert(bt);
+
+  if (IsDead(client_p))
+    return;
+
+  /*
+   * Pending mode changes are flushed by the first line sent below, and
+   * must not be taken for coming from a client the cursor has just passed
+   */
+  channel_mode_flush();
+
+  const uintmax_t produced = client_p->connection->send.bytes +
+                             dbuf_length(&client_p->connection->buf_sendq);
+  bool done = server_burst_clients(client_p, bt);
+  if (done == true)
+    done = server_burst_channels(client_p, bt);
+
+  if (IsDead(client_p))
+    return;  /* Sendq has been cleared; the task goes away in exit_client() */
+
+  bt->bytes += client_p->connection->send.bytes +
+               dbuf_length(&client_p->connection->buf_sendq) - produced;
+
+  if (done == true)
+    server_burst_finish(client_p);
+}
+
+/* server_burst_start()
+ *
+ * inputs       - pointer to server to send burst to
+ * output       - NONE
+ * side effects - a burst task is set up and the first batch is produced
+ */
+void
+server_burst_start(struct Client *client_p)
+{
+  assert(client_p->connection->burst_task == NULL);
+
+  struct BurstTask *bt = xcalloc(sizeof(*bt));
+  bt->clients_total = dlink_list_length(&global_client_list);
+  bt->started = event_base->time.sec_monotonic;
+  server_burst_set_client_next(bt, global_client_list.head);
+
+  client_p->connection->burst_task = bt;
+  dlinkAdd(client_p, &bt->node, &bursting_server_list);
+
+  server_burst_continue(client_p);
+}
+
+/* server_burst_free()
+ *
+ * inputs       - pointer to server
+ * output       - NONE
+ * side effects - burst task is unlinked and freed
+ */
+void
+server_burst_free(struct Client *client_p)
+{
+  struct BurstTask *const bt = client_p->connection->burst_task;
+
+  dlinkDelete(&bt->node, &bursting_server_list);
+
+  while (bt->held.head)
+  {
+    dlink_node *node = bt->held.head;
+
+    dbuf_ref_free(node->data);
+    dlinkDelete(node, &bt->held);
+    free_dlink_node(node);
+  }
+
+  xfree(bt);
+  client_p->connection->burst_task = NULL;
+}
+
+/* server_burst_client_exit()
+ *
+ * inputs       - pointer to client about to be removed from global_client_list
+ * output       - NONE
+ * side effects - moves client cursors pointing at the client one step ahead
+ */
+void
+server_burst_client_exit(const struct Client *client)
+{
+  dlink_node *node;
+
+  DLINK_FOREACH(node, bursting_server_list.head)
+  {
+    const struct Client *client_p = node->data;
+    struct BurstTask *const bt = client_p->connection->burst_task;
+
+    if (bt->client_next == &client->node)
+      server_burst_set_client_next(bt, client->node.next);
+  }
+}
+
+/* server_burst_hold()
+ *
+ * inputs       - pointer to bursting server
+ *              - pointer to formatted message
+ * output       - true if the message has been held back
+ * side effects - messages originating from clients that have not yet
+ *                been introduced to the server are queued until they
+ *                are, as they would be answered with a KILL for an
+ *                unknown prefix
+ */
+bool
+server_burst_hold(struct Client *client_p, struct dbuf_block *buffer)
+{
+  struct BurstTask *const bt = client_p->connection->burst_task;
+
+  if (bt->client_serial == 0)
+    return false;
+
+  const struct Client *source = server_burst_source(buffer);
+  if (source == NULL || source->global_serial > bt->client_serial)
+    return false;
+
+  ++buffer->refs;
+  dlinkAddTail(buffer, make_dlink_node(), &bt->held);
+  bt->held_bytes += buffer->size;
+  return true;
+}
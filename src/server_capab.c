@@ -27,6 +27,7 @@
 #include "stdinc.h"
 #include "list.h"
 #include "client.h"
+#include "conf.h"
 #include "irc_string.h"
 #include "ircd_defs.h"
 #include "server_capab.h"
@@ -47,6 +48,9 @@ capab_init(void)
   capab_add("EOB", CAPAB_EOB);
   capab_add("CLUSTER", CAPAB_CLUSTER);
   capab_add("RHOST", CAPAB_RHOST);
+#ifdef HAVE_LIBZ
+  capab_add("ZIP", CAPAB_ZIP);
+#endif
 }
 
 /* capab_add()
@@ -137,11 +141,37 @@ capab_get(const void *ptr)
     if (ptr && !IsCapable(((const struct Client *)ptr), cap->cap))
       continue;
 
-    strlcat(buf, cap->name, sizeof(buf));
+    /* ZIP is only offered on links that ask for it; see capab_get_link() */
+    if (ptr == NULL && cap->cap == CAPAB_ZIP)
+      continue;
 
-    if (node->next)
+    if (buf[0])
       strlcat(buf, " ", sizeof(buf));
+
+    strlcat(buf, cap->name, sizeof(buf));
   }
 
   return buf;
 }
+
+/*
+ * capab_get_link() - capabilities to offer on a server link
+ *
+ * inputs       - pointer to the connect{} block of the link
+ * output       - pointer to static string
+ * side effects - like capab_get(NULL), but also offers ZIP if the
+ *                connect{} block asks for a compressed link
+ */
+const char *
+capab_get_link(const void *ptr)
+{
+  static char buf[IRCD_BUFSIZE] = "";
+  const struct MaskItem *const conf = ptr;
+
+  strlcpy(buf, capab_get(NULL), sizeof(buf));
+
+  if (IsConfCompressed(conf) && capab_find("ZIP"))
+    strlcat(buf, " ZIP", sizeof(buf));
+
+  return buf;
+}
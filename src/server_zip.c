@@ -0,0 +1,401 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file server_zip.c
+ * \brief Compressed server links.
+ * \version $Id$
+ *
+ * Once both ends have offered ZIP in their CAPAB line, everything following
+ * the SVINFO line is a single deflate stream in either direction. SVINFO is
+ * sent exactly once, right after the handshake, so it marks the switch in
+ * the byte stream no matter what else went over the link before. Compression
+ * sits between the sendq and the socket (or TLS session): the sendq keeps
+ * holding plain text, so sendq limits and the burst watermark work as before,
+ * and send_queued_write() compresses one batch at a time into a small queue
+ * of its own, ending each batch with a sync flush. Writes to a compressed
+ * link are deferred to the end of the event loop iteration so that all
+ * messages generated in one iteration end up in a single batch.
+ */
+
+#include "stdinc.h"
+#include "list.h"
+#include "client.h"
+#include "dbuf.h"
+#include "ircd.h"
+#include "log.h"
+#include "memory.h"
+#include "send.h"
+#include "server_burst.h"
+#include "server_zip.h"
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+
+enum { ZIP_BATCH_SIZE = 16384 };  /**< Plain text compressed per write batch */
+
+/*! \brief ZipState structure */
+struct ZipState
+{
+  dlink_node node;  /**< Linked into zip_pending_list while a write is deferred */
+  bool pending;
+  bool inflating;  /**< Set once our peer's compressed stream has started */
+  z_stream out;
+  z_stream in;
+  struct dbuf_queue buf_zipq;  /**< Compressed data not yet written */
+  struct ZipStats stats;
+};
+
+static dlink_list zip_pending_list;
+static char zip_buf[IRCD_BUFSIZE * 8];
+
+
+static uintmax_t
+zip_clock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uintmax_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* zip_inflate()
+ *
+ * inputs       - pointer to compression state
+ *              - compressed data and its length
+ *              - queue to append the decompressed data to
+ * output       - false if the stream is corrupt, otherwise true
+ */
+static bool
+zip_inflate(struct ZipState *zip, const char *data, size_t length, struct dbuf_queue *queue)
+{
+  zip->in.next_in = (Bytef *)(uintptr_t)data;  /* zlib doesn't write to it */
+  zip->in.avail_in = length;
+  zip->stats.in_zip += length;
+
+  do
+  {
+    zip->in.next_out = (Bytef *)zip_buf;
+    zip->in.avail_out = sizeof(zip_buf);
+
+    int ret = inflate(&zip->in, Z_SYNC_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR)
+      return false;
+
+    size_t produced = sizeof(zip_buf) - zip->in.avail_out;
+    dbuf_put(queue, zip_buf, produced);
+    zip->stats.in_raw += produced;
+  } while (zip->in.avail_in || zip->in.avail_out == 0);
+
+  return true;
+}
+#endif
+
+/* server_zip_start()
+ *
+ * inputs       - pointer to server
+ * output       - false if compression could not be set up, in which
+ *                case the link has to be dropped
+ * side effects - everything sent to client_p from now on is compressed
+ */
+bool
+server_zip_start(struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *zip = xcalloc(sizeof(*zip));
+
+  if (deflateInit(&zip->out, Z_DEFAULT_COMPRESSION) != Z_OK)
+  {
+    xfree(zip);
+    return false;
+  }
+
+  if (inflateInit(&zip->in) != Z_OK)
+  {
+    deflateEnd(&zip->out);
+    xfree(zip);
+    return false;
+  }
+
+  client_p->connection->zip = zip;
+
+  /* Whatever is still queued predates the switch and goes out uncompressed */
+  while (dbuf_length(&client_p->connection->buf_sendq))
+  {
+    struct dbuf_queue *const sendq = &client_p->connection->buf_sendq;
+    const struct dbuf_block *first = sendq->blocks.head->data;
+    const size_t length = first->size - sendq->pos;
+
+    dbuf_put(&zip->buf_zipq, first->data + sendq->pos, length);
+    dbuf_delete(sendq, length);
+
+    client_p->connection->send.bytes += length;
+    me.connection->send.bytes += length;
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+/* server_zip_recv_start()
+ *
+ * inputs       - pointer to server
+ * output       - false if what has been read so far is corrupt
+ * side effects - everything received from client_p after the current
+ *                line is decompressed
+ */
+bool
+server_zip_recv_start(struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *const zip = client_p->connection->zip;
+
+  if (zip == NULL || zip->inflating == true)
+    return true;
+
+  zip->inflating = true;
+
+  /*
+   * Anything that has been read past the line that got us here is part of
+   * our peer's compressed stream already. Run it through the decompressor.
+   */
+  if (dbuf_length(&client_p->connection->buf_recvq))
+  {
+    struct dbuf_queue queue = client_p->connection->buf_recvq;
+    dlink_node *node;
+    bool ok = true;
+
+    memset(&client_p->connection->buf_recvq, 0, sizeof(client_p->connection->buf_recvq));
+
+    DLINK_FOREACH(node, queue.blocks.head)
+    {
+      const struct dbuf_block *block = node->data;
+      const size_t pos = node == queue.blocks.head ? queue.pos : 0;
+
+      if (ok == true)
+        ok = zip_inflate(zip, block->data + pos, block->size - pos, &client_p->connection->buf_recvq);
+    }
+
+    dbuf_clear(&queue);
+    return ok;
+  }
+#endif
+  return true;
+}
+
+/* server_zip_free()
+ *
+ * inputs       - pointer to server
+ * output       - NONE
+ * side effects - releases the compression state of client_p, if any
+ */
+void
+server_zip_free(struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *zip = client_p->connection->zip;
+
+  if (zip == NULL)
+    return;
+
+  if (zip->pending == true)
+    dlinkDelete(&zip->node, &zip_pending_list);
+
+  deflateEnd(&zip->out);
+  inflateEnd(&zip->in);
+  dbuf_clear(&zip->buf_zipq);
+
+  xfree(zip);
+  client_p->connection->zip = NULL;
+#endif
+}
+
+/* server_zip_defer()
+ *
+ * inputs       - pointer to server
+ * output       - NONE
+ * side effects - the sendq of client_p is written by server_zip_flush()
+ *                at the end of the current event loop iteration
+ */
+void
+server_zip_defer(struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *zip = client_p->connection->zip;
+
+  if (zip->pending == false)
+  {
+    zip->pending = true;
+    dlinkAdd(client_p, &zip->node, &zip_pending_list);
+  }
+#endif
+}
+
+/* server_zip_flush()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - writes out what has been queued for compressed links
+ *                since the last call
+ */
+void
+server_zip_flush(void)
+{
+#ifdef HAVE_LIBZ
+  while (zip_pending_list.head)
+  {
+    struct Client *client_p = zip_pending_list.head->data;
+    struct ZipState *zip = client_p->connection->zip;
+
+    dlinkDelete(&zip->node, &zip_pending_list);
+    zip->pending = false;
+
+    send_queued_write(client_p);
+
+    /*
+     * Keep a burst going for as long as the socket takes it, just like
+     * sendq_unblocked() does; the next batch gets deferred again.
+     */
+    if (client_p->connection->burst_task && !HasFlag(client_p, FLAGS_BLOCKED))
+      server_burst_continue(client_p);
+  }
+#endif
+}
+
+/* server_zip_queue()
+ *
+ * inputs       - pointer to server
+ * output       - pointer to the queue of compressed data to be written,
+ *                or NULL if compression failed and the link has to be
+ *                dropped
+ * side effects - once the previous batch has been written, the next
+ *                ZIP_BATCH_SIZE bytes of the sendq are compressed
+ */
+struct dbuf_queue *
+server_zip_queue(struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *const zip = client_p->connection->zip;
+  struct dbuf_queue *const sendq = &client_p->connection->buf_sendq;
+  size_t batch = 0;
+
+  if (dbuf_length(&zip->buf_zipq) || dbuf_length(sendq) == 0)
+    return &zip->buf_zipq;
+
+  const uintmax_t started = zip_clock();
+
+  while (batch < ZIP_BATCH_SIZE && dbuf_length(sendq))
+  {
+    const struct dbuf_block *first = sendq->blocks.head->data;
+    const size_t length = first->size - sendq->pos;
+
+    batch += length;
+
+    zip->out.next_in = (Bytef *)(uintptr_t)(first->data + sendq->pos);
+    zip->out.avail_in = length;
+
+    /* End of the batch; make everything compressed so far available to the peer */
+    const int flush = (batch >= ZIP_BATCH_SIZE || length == dbuf_length(sendq)) ? Z_SYNC_FLUSH : Z_NO_FLUSH;
+
+    do
+    {
+      zip->out.next_out = (Bytef *)zip_buf;
+      zip->out.avail_out = sizeof(zip_buf);
+
+      /*
+       * Z_BUF_ERROR merely means there was nothing left to do when the
+       * previous call happened to fill the buffer exactly; with input left,
+       * the stream is broken just like with Z_STREAM_ERROR.
+       */
+      const int ret = deflate(&zip->out, flush);
+      if (ret == Z_STREAM_ERROR || (ret == Z_BUF_ERROR && zip->out.avail_in))
+      {
+        ilog(LOG_TYPE_IRCD, "Compressing data for %s failed: %s",
+             client_p->name, zip->out.msg ? zip->out.msg : "unknown error");
+        return NULL;
+      }
+
+      dbuf_put(&zip->buf_zipq, zip_buf, sizeof(zip_buf) - zip->out.avail_out);
+    } while (zip->out.avail_out == 0);
+
+    dbuf_delete(sendq, length);
+  }
+
+  zip->stats.out_raw += batch;
+  zip->stats.out_zip = zip->out.total_out;
+  zip->stats.usec += zip_clock() - started;
+
+  /* Bytes are accounted for uncompressed, like they are on the receiving side */
+  client_p->connection->send.bytes += batch;
+  me.connection->send.bytes += batch;
+
+  return &zip->buf_zipq;
+#else
+  return &client_p->connection->buf_sendq;
+#endif
+}
+
+/* server_zip_inflate()
+ *
+ * inputs       - pointer to server
+ *              - compressed data as read from the socket and its length
+ * output       - false if the stream is corrupt, otherwise true
+ * side effects - the decompressed data is appended to the recvq; data
+ *                preceding our peer's SVINFO is appended unchanged
+ */
+bool
+server_zip_inflate(struct Client *client_p, const char *data, size_t length)
+{
+#ifdef HAVE_LIBZ
+  struct ZipState *const zip = client_p->connection->zip;
+
+  if (zip->inflating == false)
+  {
+    dbuf_put(&client_p->connection->buf_recvq, data, length);
+    return true;
+  }
+
+  const uintmax_t started = zip_clock();
+  bool ret = zip_inflate(zip, data, length, &client_p->connection->buf_recvq);
+  zip->stats.usec += zip_clock() - started;
+
+  return ret;
+#else
+  return false;
+#endif
+}
+
+/* server_zip_stats()
+ *
+ * inputs       - pointer to server
+ * output       - pointer to the compression counters of client_p,
+ *                or NULL if the link isn't compressed
+ */
+const struct ZipStats *
+server_zip_stats(const struct Client *client_p)
+{
+#ifdef HAVE_LIBZ
+  if (client_p->connection->zip)
+    return &client_p->connection->zip->stats;
+#endif
+  return NULL;
+}
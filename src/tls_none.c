@@ -66,6 +66,12 @@ tls_isusing(tls_data_t *tls_data)
   return false;
 }
 
+bool
+tls_kernel_send(tls_data_t *tls_data)
+{
+  return false;
+}
+
 void
 tls_free(tls_data_t *tls_data)
 {
@@ -100,6 +106,33 @@ tls_handshake(tls_data_t *tls_data, tls_role_t role, const char **errstr)
   return 0;
 }
 
+void
+tls_session_resume(tls_data_t *tls_data, tls_session_t *session)
+{
+}
+
+void
+tls_session_detach(tls_data_t *tls_data)
+{
+}
+
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return false;
+}
+
+void
+tls_session_free(tls_session_t *session)
+{
+}
+
+void
+tls_session_cache_stats(unsigned int *entries, unsigned int *size)
+{
+  *entries = *size = 0;
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -27,8 +27,10 @@
  */
 
 #include "stdinc.h"
+#include <pthread.h>
 #include "tls.h"
 #include "conf.h"
+#include "event.h"
 #include "log.h"
 #include "misc.h"
 #include "memory.h"
@@ -38,8 +40,43 @@
 #error "OpenSSL 1.1.1 and above is required to build this module"
 #endif
 
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(LIBRESSL_VERSION_NUMBER)
+#include <openssl/core_names.h>
+#define TLS_TICKET_EVP_MAC
+#endif
+
+enum { TLS_TICKET_KEY_LIFETIME = 12 * 60 * 60 };  /**< Seconds a ticket key issues new tickets */
+
+/*! \brief Key used to encrypt and authenticate session tickets */
+struct tls_ticket_key
+{
+  unsigned char name[16];
+  unsigned char aes_key[32];
+  unsigned char hmac_key[32];
+  uintmax_t created;  /**< Real time */
+};
+
 static bool TLS_initialized;
 
+/*
+ * ticket_keys[0] issues new tickets; ticket_keys[1] is its predecessor,
+ * still accepted for another TLS_TICKET_KEY_LIFETIME, but tickets it
+ * decrypts get replaced. Both live for as long as the process does, so
+ * tickets survive a rehash; with serverinfo::tls_ticket_key_file, they
+ * survive a restart as well.
+ */
+static struct tls_ticket_key ticket_keys[2];
+
+/*
+ * Handshakes may run on TLS handshake threads (see tls_pool.c), so the
+ * ticket keys and the session slots of outgoing connections are only
+ * ever touched with these held. Ticket keys are only ever changed by
+ * the event loop; handshakes just read them.
+ */
+static pthread_mutex_t ticket_key_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t session_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /*
  * report_crypto_errors - Dump crypto error list to log
  */
@@ -58,6 +95,233 @@ always_accept_verify_cb(int preverify_ok, X509_STORE_CTX *x509_ctx)
   return 1;
 }
 
+/* tls_ticket_key_load()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - reads the ticket keys from serverinfo::tls_ticket_key_file
+ *                if they haven't been set up yet
+ */
+static void
+tls_ticket_key_load(void)
+{
+  struct tls_ticket_key keys[2];
+
+  if (ticket_keys[0].created || ConfigServerInfo.tls_ticket_key_file == NULL)
+    return;
+
+  FILE *file = fopen(ConfigServerInfo.tls_ticket_key_file, "r");
+  if (file == NULL)
+    return;  /* It gets created with the first key */
+
+  if (fread(keys, sizeof(keys), 1, file) == 1 && keys[0].created)
+  {
+    pthread_mutex_lock(&ticket_key_lock);
+    memcpy(ticket_keys, keys, sizeof(ticket_keys));
+    pthread_mutex_unlock(&ticket_key_lock);
+  }
+  else
+    ilog(LOG_TYPE_IRCD, "Ignoring serverinfo::tls_ticket_key_file -- invalid key file");
+
+  fclose(file);
+  memset(keys, 0, sizeof(keys));
+}
+
+/* tls_ticket_key_save()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - writes the ticket keys to serverinfo::tls_ticket_key_file
+ */
+static void
+tls_ticket_key_save(void)
+{
+  char path[HYB_PATH_MAX + 1];
+  const char *const ticket_key_file = ConfigServerInfo.tls_ticket_key_file;
+
+  if (ticket_key_file == NULL)
+    return;
+
+  snprintf(path, sizeof(path), "%s.tmp", ticket_key_file);
+
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd == -1)
+  {
+    ilog(LOG_TYPE_IRCD, "Could not write TLS ticket key file %s: %s", path, strerror(errno));
+    return;
+  }
+
+  if (write(fd, ticket_keys, sizeof(ticket_keys)) != sizeof(ticket_keys) ||
+      close(fd) == -1 ||
+      rename(path, ticket_key_file) == -1)
+  {
+    ilog(LOG_TYPE_IRCD, "Could not write TLS ticket key file %s: %s", path, strerror(errno));
+    unlink(path);
+  }
+}
+
+/* tls_ticket_key_rotate()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - a new key is generated once the current one has
+ *                been used for TLS_TICKET_KEY_LIFETIME seconds, or if
+ *                there is none yet
+ */
+static void
+tls_ticket_key_rotate(void *unused)
+{
+  const uintmax_t now = event_base->time.sec_real;
+
+  if (ticket_keys[0].created + TLS_TICKET_KEY_LIFETIME > now)
+    return;
+
+  struct tls_ticket_key key = { .created = now };
+  if (RAND_bytes(key.name, sizeof(key.name)) != 1 ||
+      RAND_bytes(key.aes_key, sizeof(key.aes_key)) != 1 ||
+      RAND_bytes(key.hmac_key, sizeof(key.hmac_key)) != 1)
+  {
+    report_crypto_errors();
+    return;  /* Try again next time */
+  }
+
+  pthread_mutex_lock(&ticket_key_lock);
+  ticket_keys[1] = ticket_keys[0];
+  ticket_keys[0] = key;
+  pthread_mutex_unlock(&ticket_key_lock);
+
+  memset(&key, 0, sizeof(key));
+
+  /* Nobody else writes the keys, so no need to hold the lock for reading them */
+  tls_ticket_key_save();
+}
+
+static struct event event_ticket_key_rotate =
+{
+  .name = "tls_ticket_key_rotate",
+  .handler = tls_ticket_key_rotate,
+  .when = 60
+};
+
+/* tls_ticket_key_setup()
+ *
+ * inputs       - key name, IV and contexts to set up
+ *              - 1 to issue a ticket, 0 to decrypt one
+ * output       - -1 on error, 0 if the ticket key is unknown, 1 if a
+ *                ticket has been set up, 2 if a ticket has been decrypted
+ *                and is to be replaced by a new one
+ * side effects - called by tls_ticket_key_cb() with ticket_key_lock held
+ */
+#ifdef TLS_TICKET_EVP_MAC
+static int
+tls_ticket_key_setup(unsigned char *name, unsigned char *iv,
+                     EVP_CIPHER_CTX *ctx, EVP_MAC_CTX *hctx, int enc)
+#else
+static int
+tls_ticket_key_setup(unsigned char *name, unsigned char *iv,
+                     EVP_CIPHER_CTX *ctx, HMAC_CTX *hctx, int enc)
+#endif
+{
+  struct tls_ticket_key *key = NULL;  /* Not const; OSSL_PARAM wants a writable pointer */
+  int ret = 1;  /* Ticket issued */
+
+  if (enc)
+  {
+    key = &ticket_keys[0];
+    if (key->created == 0)
+      return -1;
+
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+      return -1;
+
+    memcpy(name, key->name, sizeof(key->name));
+
+    if (EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, key->aes_key, iv) != 1)
+      return -1;
+  }
+  else
+  {
+    for (unsigned int i = 0; i < sizeof(ticket_keys) / sizeof(ticket_keys[0]); ++i)
+      if (ticket_keys[i].created && memcmp(name, ticket_keys[i].name, sizeof(ticket_keys[i].name)) == 0)
+        key = &ticket_keys[i];
+
+    if (key == NULL)
+      return 0;  /* Full handshake, and a ticket under the current key */
+
+    /*
+     * Always hand out a fresh ticket: TLSv1.3 clients, OpenSSL among them,
+     * use each ticket once only, and tickets under an old key have to be
+     * replaced anyway.
+     */
+    ret = 2;
+
+    if (EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, key->aes_key, iv) != 1)
+      return -1;
+  }
+
+#ifdef TLS_TICKET_EVP_MAC
+  static char digest[] = "sha256";
+  OSSL_PARAM params[] =
+  {
+    OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key->hmac_key, sizeof(key->hmac_key)),
+    OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+    OSSL_PARAM_construct_end()
+  };
+
+  if (EVP_MAC_CTX_set_params(hctx, params) != 1)
+    return -1;
+#else
+  if (HMAC_Init_ex(hctx, key->hmac_key, sizeof(key->hmac_key), EVP_sha256(), NULL) != 1)
+    return -1;
+#endif
+
+  return ret;
+}
+
+#ifdef TLS_TICKET_EVP_MAC
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char *name, unsigned char *iv,
+                  EVP_CIPHER_CTX *ctx, EVP_MAC_CTX *hctx, int enc)
+#else
+static int
+tls_ticket_key_cb(SSL *ssl, unsigned char *name, unsigned char *iv,
+                  EVP_CIPHER_CTX *ctx, HMAC_CTX *hctx, int enc)
+#endif
+{
+  pthread_mutex_lock(&ticket_key_lock);
+  int ret = tls_ticket_key_setup(name, iv, ctx, hctx, enc);
+  pthread_mutex_unlock(&ticket_key_lock);
+
+  return ret;
+}
+
+/* tls_session_new_cb()
+ *
+ * inputs       - outgoing TLS session, and a session it can be resumed with
+ * output       - 1 if we keep a reference to sess, 0 otherwise
+ * side effects - stores sess where tls_session_resume() asked for it
+ */
+static int
+tls_session_new_cb(SSL *ssl, SSL_SESSION *sess)
+{
+  pthread_mutex_lock(&session_lock);
+
+  /* Cleared by tls_session_detach() once the connection is gone */
+  tls_session_t *slot = SSL_get_app_data(ssl);
+  if (slot == NULL)
+  {
+    pthread_mutex_unlock(&session_lock);
+    return 0;
+  }
+
+  if (*slot)
+    SSL_SESSION_free(*slot);
+
+  *slot = sess;
+  pthread_mutex_unlock(&session_lock);
+  return 1;
+}
+
 bool
 tls_is_initialized(void)
 {
@@ -84,8 +348,16 @@ tls_init(void)
 
   SSL_CTX_set_min_proto_version(ConfigServerInfo.tls_ctx.server_ctx, TLS1_2_VERSION);
   SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_CIPHER_SERVER_PREFERENCE|SSL_OP_NO_TICKET);
+  SSL_CTX_set_session_id_context(ConfigServerInfo.tls_ctx.server_ctx, (const unsigned char *)"ircd-hybrid", 11);
+  SSL_CTX_set_num_tickets(ConfigServerInfo.tls_ctx.server_ctx, 1);
+#ifdef TLS_TICKET_EVP_MAC
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#else
+  SSL_CTX_set_tlsext_ticket_key_cb(ConfigServerInfo.tls_ctx.server_ctx, tls_ticket_key_cb);
+#endif
   SSL_CTX_set_verify(ConfigServerInfo.tls_ctx.server_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE, always_accept_verify_cb);
   SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_OFF);
+  SSL_CTX_set_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
   SSL_CTX_set_cipher_list(ConfigServerInfo.tls_ctx.server_ctx, "EECDH+HIGH:EDH+HIGH:HIGH:!aNULL");
 
   if ((ConfigServerInfo.tls_ctx.client_ctx = SSL_CTX_new(TLS_client_method())) == NULL)
@@ -98,9 +370,10 @@ tls_init(void)
   }
 
   SSL_CTX_set_min_proto_version(ConfigServerInfo.tls_ctx.client_ctx, TLS1_2_VERSION);
-  SSL_CTX_set_options(ConfigServerInfo.tls_ctx.client_ctx, SSL_OP_NO_TICKET);
   SSL_CTX_set_verify(ConfigServerInfo.tls_ctx.client_ctx, SSL_VERIFY_PEER|SSL_VERIFY_CLIENT_ONCE, always_accept_verify_cb);
-  SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.client_ctx, SSL_SESS_CACHE_OFF);
+  SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.client_ctx, SSL_SESS_CACHE_CLIENT|SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ConfigServerInfo.tls_ctx.client_ctx, tls_session_new_cb);
+  SSL_CTX_set_mode(ConfigServerInfo.tls_ctx.client_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
 }
 
 bool
@@ -176,6 +449,23 @@ tls_new_credentials(void)
     ilog(LOG_TYPE_IRCD, "Ignoring serverinfo::tls_cipher_list -- could not set supported cipher(s)");
   }
 
+  if (ConfigServerInfo.tls_session_cache_size)
+  {
+    tls_ticket_key_load();
+    tls_ticket_key_rotate(NULL);
+    event_add(&event_ticket_key_rotate, NULL);
+
+    SSL_CTX_clear_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_sess_set_cache_size(ConfigServerInfo.tls_ctx.server_ctx, ConfigServerInfo.tls_session_cache_size);
+  }
+  else
+  {
+    event_delete(&event_ticket_key_rotate);
+    SSL_CTX_set_options(ConfigServerInfo.tls_ctx.server_ctx, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(ConfigServerInfo.tls_ctx.server_ctx, SSL_SESS_CACHE_OFF);
+  }
+
 #ifndef LIBRESSL_VERSION_NUMBER
   if (ConfigServerInfo.tls_cipher_suites == NULL)
     SSL_CTX_set_ciphersuites(ConfigServerInfo.tls_ctx.server_ctx, "TLS_AES_256_GCM_SHA384:TLS_CHACHA20_POLY1305_SHA256:TLS_AES_128_GCM_SHA256");
@@ -217,6 +507,25 @@ tls_isusing(tls_data_t *tls_data)
   return ssl != NULL;
 }
 
+/* tls_kernel_send()
+ *
+ * inputs       - pointer to TLS session
+ * output       - true if the kernel encrypts what is written to the
+ *                socket, in which case it may be written with send()
+ *                directly
+ * side effects - NONE
+ */
+bool
+tls_kernel_send(tls_data_t *tls_data)
+{
+#if defined(SSL_OP_ENABLE_KTLS) && defined(BIO_get_ktls_send)
+  SSL *ssl = *tls_data;
+  return BIO_get_ktls_send(SSL_get_wbio(ssl));
+#else
+  return false;
+#endif
+}
+
 void
 tls_free(tls_data_t *tls_data)
 {
@@ -323,9 +632,91 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
 
   *tls_data = ssl;
   SSL_set_fd(ssl, fd);
+
+#ifdef SSL_OP_ENABLE_KTLS
+  /* Kernel TLS is set up by OpenSSL once the handshake is done, if it can */
+  if (ConfigServerInfo.tls_kernel_offload)
+    SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+#endif
   return true;
 }
 
+/* tls_session_resume()
+ *
+ * inputs       - pointer to outgoing TLS session that hasn't started its
+ *                handshake yet
+ *              - pointer to a session saved by an earlier connection
+ * output       - NONE
+ * side effects - the handshake tries to resume *session; any session
+ *                the peer hands out on this connection replaces it
+ */
+void
+tls_session_resume(tls_data_t *tls_data, tls_session_t *session)
+{
+  SSL *ssl = *tls_data;
+
+  pthread_mutex_lock(&session_lock);
+  if (*session)
+    SSL_set_session(ssl, *session);
+
+  SSL_set_app_data(ssl, session);
+  pthread_mutex_unlock(&session_lock);
+}
+
+/* tls_session_detach()
+ *
+ * inputs       - pointer to outgoing TLS session
+ * output       - NONE
+ * side effects - sessions the peer hands out from now on are no longer
+ *                stored where tls_session_resume() asked for; safe to
+ *                call while a handshake thread works on the session
+ */
+void
+tls_session_detach(tls_data_t *tls_data)
+{
+  SSL *ssl = *tls_data;
+
+  pthread_mutex_lock(&session_lock);
+  SSL_set_app_data(ssl, NULL);
+  pthread_mutex_unlock(&session_lock);
+}
+
+/* tls_session_reused()
+ *
+ * inputs       - pointer to TLS session that has completed its handshake
+ * output       - true if the handshake was abbreviated by resuming
+ *                an earlier session
+ */
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  SSL *ssl = *tls_data;
+  return SSL_session_reused(ssl);
+}
+
+void
+tls_session_free(tls_session_t *session)
+{
+  pthread_mutex_lock(&session_lock);
+  if (*session)
+    SSL_SESSION_free(*session);
+  *session = NULL;
+  pthread_mutex_unlock(&session_lock);
+}
+
+/* tls_session_cache_stats()
+ *
+ * inputs       - where to store the number of cached sessions and the
+ *                size of the session cache
+ * output       - NONE
+ */
+void
+tls_session_cache_stats(unsigned int *entries, unsigned int *size)
+{
+  *entries = SSL_CTX_sess_number(ConfigServerInfo.tls_ctx.server_ctx);
+  *size = SSL_CTX_sess_get_cache_size(ConfigServerInfo.tls_ctx.server_ctx);
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
@@ -357,7 +748,8 @@ tls_handshake(tls_data_t *tls_data, tls_role_t role, const char **errstr)
       return TLS_HANDSHAKE_WANT_READ;
     default:
     {
-      const char *error = ERR_error_string(ERR_get_error(), NULL);
+      /* May run on a TLS handshake thread; ERR_error_string() would use a static buffer */
+      const char *error = ERR_reason_error_string(ERR_get_error());
 
       if (errstr)
         *errstr = error;
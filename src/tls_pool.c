@@ -0,0 +1,354 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file tls_pool.c
+ * \brief TLS handshake worker threads.
+ * \version $Id$
+ *
+ * The public key operations of a full TLS handshake take far longer than
+ * anything else the event loop does for a connection, so a burst of new
+ * TLS connections stalls everyone else. With serverinfo::tls_handshake_threads
+ * set, each handshake step runs on one of a small set of worker threads
+ * instead. The event loop still waits for the socket to become ready; it
+ * then hands the TLS session over to a worker and doesn't touch it again
+ * until the worker has put the result on the completion queue and woken
+ * up the event loop through a pipe. Nothing but tls_handshake() ever
+ * runs on a worker thread.
+ */
+
+#include "stdinc.h"
+#include <pthread.h>
+#include <signal.h>
+#include "list.h"
+#include "fdlist.h"
+#include "tls_pool.h"
+#include "conf.h"
+#include "irc_string.h"
+#include "ircd.h"
+#include "log.h"
+#include "memory.h"
+#include "s_bsd.h"
+
+
+/*! \brief TlsPoolJob structure */
+struct TlsPoolJob
+{
+  struct TlsPoolJob *next;  /**< Link to pending or done queue; dlink nodes come from a mempool */
+  fde_t *F;  /**< NULL once the connection has been closed */
+  int fd;
+  tls_data_t tls;  /**< Owned by the worker until the job is done */
+  tls_role_t role;
+  tls_handshake_status_t status;
+  char error[256];
+  tls_pool_callback callback;
+  void *data;
+};
+
+/*! \brief TlsPoolQueue structure */
+struct TlsPoolQueue
+{
+  struct TlsPoolJob *head;
+  struct TlsPoolJob **tail;
+};
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_drain_cond = PTHREAD_COND_INITIALIZER;  /**< Signalled once all workers are idle */
+static struct TlsPoolQueue pool_pending = { NULL, &pool_pending.head };
+static struct TlsPoolQueue pool_done = { NULL, &pool_done.head };
+static unsigned int pool_threads;  /**< Number of running worker threads */
+static unsigned int pool_idle;  /**< Number of those waiting for a job */
+static unsigned int pool_limit;  /**< Copy of serverinfo::tls_handshake_threads */
+static unsigned int pool_queued;  /**< Jobs handed over and not yet completed */
+static int pool_pipe[2] = { -1, -1 };
+static fde_t *pool_pipe_F;
+
+
+static void
+pool_queue_push(struct TlsPoolQueue *queue, struct TlsPoolJob *job)
+{
+  job->next = NULL;
+  *queue->tail = job;
+  queue->tail = &job->next;
+}
+
+static struct TlsPoolJob *
+pool_queue_pop(struct TlsPoolQueue *queue)
+{
+  struct TlsPoolJob *job = queue->head;
+
+  if (job)
+  {
+    queue->head = job->next;
+    if (queue->head == NULL)
+      queue->tail = &queue->head;
+  }
+
+  return job;
+}
+
+/* pool_worker()
+ *
+ * inputs       - NONE
+ * output       - NONE
+ * side effects - runs handshake steps from the pending queue until there
+ *                are more threads than allowed
+ */
+static void *
+pool_worker(void *unused)
+{
+  pthread_mutex_lock(&pool_lock);
+
+  while (true)
+  {
+    struct TlsPoolJob *job;
+
+    while ((job = pool_queue_pop(&pool_pending)) == NULL)
+    {
+      if (pool_threads > pool_limit)
+      {
+        --pool_threads;
+        pthread_cond_signal(&pool_drain_cond);
+        pthread_mutex_unlock(&pool_lock);
+        return NULL;
+      }
+
+      if (++pool_idle == pool_threads)
+        pthread_cond_signal(&pool_drain_cond);
+      pthread_cond_wait(&pool_cond, &pool_lock);
+      --pool_idle;
+    }
+
+    pthread_mutex_unlock(&pool_lock);
+
+    const char *error = NULL;
+    job->status = tls_handshake(&job->tls, job->role, &error);
+    strlcpy(job->error, error ? error : "", sizeof(job->error));
+
+    pthread_mutex_lock(&pool_lock);
+    pool_queue_push(&pool_done, job);
+
+    /* Nothing to do about a full pipe; it's already got a byte to wake us up */
+    ssize_t unused_ret = write(pool_pipe[1], "", 1);
+    (void)unused_ret;
+  }
+}
+
+/* pool_complete()
+ *
+ * inputs       - wakeup pipe
+ *              - unused
+ * output       - NONE
+ * side effects - calls back for every job on the completion queue
+ */
+static void
+pool_complete(fde_t *F, void *unused)
+{
+  char buf[64];
+
+  while (read(F->fd, buf, sizeof(buf)) > 0)
+    ;
+
+  pthread_mutex_lock(&pool_lock);
+  struct TlsPoolJob *job = pool_done.head;
+  pool_done.head = NULL;
+  pool_done.tail = &pool_done.head;
+  pthread_mutex_unlock(&pool_lock);
+
+  comm_setselect(F, COMM_SELECT_READ, pool_complete, NULL, 0);
+
+  while (job)
+  {
+    struct TlsPoolJob *next = job->next;
+
+    --pool_queued;
+
+    if (job->F == NULL)
+    {
+      tls_free(&job->tls);
+      close(job->fd);
+    }
+    else
+    {
+      fde_t *const job_F = job->F;
+
+      job_F->tls = job->tls;
+      job_F->tls_job = NULL;
+      job->callback(job_F, job->status, job->status == TLS_HANDSHAKE_ERROR &&
+                    job->error[0] ? job->error : NULL, job->data);
+    }
+
+    xfree(job);
+    job = next;
+  }
+}
+
+/* pool_start()
+ *
+ * inputs       - NONE
+ * output       - true if a worker thread is available or could be started
+ * side effects - may start another worker thread; must hold pool_lock
+ */
+static bool
+pool_start(void)
+{
+  if (pool_idle > 0 || pool_threads >= pool_limit)
+    return pool_threads > 0;
+
+  pthread_attr_t attr;
+  pthread_t thread;
+  sigset_t all, old;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  /* Leave signals to the event loop */
+  sigfillset(&all);
+  pthread_sigmask(SIG_SETMASK, &all, &old);
+  int error = pthread_create(&thread, &attr, pool_worker, NULL);
+  pthread_sigmask(SIG_SETMASK, &old, NULL);
+  pthread_attr_destroy(&attr);
+
+  if (error)
+  {
+    ilog(LOG_TYPE_IRCD, "Failed to start TLS handshake thread: %s", strerror(error));
+    return pool_threads > 0;
+  }
+
+  ++pool_threads;
+  return true;
+}
+
+static bool
+pool_pipe_open(void)
+{
+  if (pool_pipe_F)
+    return true;
+
+  if (pipe(pool_pipe))
+  {
+    ilog(LOG_TYPE_IRCD, "Failed to create TLS handshake thread pipe: %s", strerror(errno));
+    return false;
+  }
+
+  for (unsigned int i = 0; i < 2; ++i)
+    fcntl(pool_pipe[i], F_SETFL, fcntl(pool_pipe[i], F_GETFL, 0) | O_NONBLOCK);
+
+  pool_pipe_F = fd_open(pool_pipe[0], false, "TLS handshake thread pipe");
+  comm_setselect(pool_pipe_F, COMM_SELECT_READ, pool_complete, NULL, 0);
+  return true;
+}
+
+/*! \brief Runs the next step of a TLS handshake, on a worker thread if
+ *         serverinfo::tls_handshake_threads allows
+ * \param F        Connection whose TLS session to advance
+ * \param role     TLS_ROLE_SERVER or TLS_ROLE_CLIENT
+ * \param callback Function to call from the event loop with the result
+ * \param data     Passed on to callback
+ *
+ * Until the callback has been called, F->tls is off limits and only
+ * fd_close() may be used on F.
+ */
+void
+tls_pool_handshake(fde_t *F, tls_role_t role, tls_pool_callback callback, void *data)
+{
+  assert(F->tls_job == NULL);
+
+  if (ConfigServerInfo.tls_handshake_threads && pool_pipe_open() == true)
+  {
+    pthread_mutex_lock(&pool_lock);
+    pool_limit = ConfigServerInfo.tls_handshake_threads;
+
+    if (pool_start() == true)
+    {
+      struct TlsPoolJob *job = xcalloc(sizeof(*job));
+      job->F = F;
+      job->fd = F->fd;
+      job->tls = F->tls;
+      job->role = role;
+      job->callback = callback;
+      job->data = data;
+
+      pool_queue_push(&pool_pending, job);
+      pthread_cond_signal(&pool_cond);
+      pthread_mutex_unlock(&pool_lock);
+
+      /* The callback checks the handshake time limit itself */
+      comm_settimeout(F, 0, NULL, NULL);
+      F->tls_job = job;
+      ++pool_queued;
+      return;
+    }
+
+    pthread_mutex_unlock(&pool_lock);
+  }
+
+  const char *error = NULL;
+  tls_handshake_status_t status = tls_handshake(&F->tls, role, &error);
+  callback(F, status, error, data);
+}
+
+/*! \brief Detaches a connection that is being closed from its pending
+ *         handshake job. The job frees the TLS session and closes the
+ *         file descriptor once the worker thread is done with it.
+ * \param F Connection being closed
+ */
+void
+tls_pool_orphan(fde_t *F)
+{
+  assert(F->tls_job);
+
+  /*
+   * The worker may still be storing a new session for an outgoing link
+   * into its connect{} block, which may be gone by the time it's done
+   */
+  tls_session_detach(&F->tls_job->tls);
+
+  /* Only ever read by the event loop, so no need to lock */
+  F->tls_job->F = NULL;
+  F->tls_job = NULL;
+}
+
+/*! \brief Blocks until no worker thread is in the middle of a handshake
+ *         step and none are left to be picked up, so that the TLS
+ *         contexts can be changed safely. Steps don't wait for the
+ *         network, so this never takes long.
+ */
+void
+tls_pool_drain(void)
+{
+  pthread_mutex_lock(&pool_lock);
+  while (pool_pending.head || pool_idle < pool_threads)
+    pthread_cond_wait(&pool_drain_cond, &pool_lock);
+  pthread_mutex_unlock(&pool_lock);
+}
+
+/*! \brief Reports the number of worker threads and pending handshake steps
+ */
+void
+tls_pool_stats(unsigned int *threads, unsigned int *queued)
+{
+  pthread_mutex_lock(&pool_lock);
+  *threads = pool_threads;
+  pthread_mutex_unlock(&pool_lock);
+
+  *queued = pool_queued;
+}
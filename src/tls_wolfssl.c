@@ -197,6 +197,12 @@ tls_isusing(tls_data_t *tls_data)
   return ssl != NULL;
 }
 
+bool
+tls_kernel_send(tls_data_t *tls_data)
+{
+  return false;
+}
+
 void
 tls_free(tls_data_t *tls_data)
 {
@@ -303,6 +309,33 @@ tls_new(tls_data_t *tls_data, int fd, tls_role_t role)
   return true;
 }
 
+void
+tls_session_resume(tls_data_t *tls_data, tls_session_t *session)
+{
+}
+
+void
+tls_session_detach(tls_data_t *tls_data)
+{
+}
+
+bool
+tls_session_reused(tls_data_t *tls_data)
+{
+  return false;
+}
+
+void
+tls_session_free(tls_session_t *session)
+{
+}
+
+void
+tls_session_cache_stats(unsigned int *entries, unsigned int *size)
+{
+  *entries = *size = 0;
+}
+
 bool
 tls_set_ciphers(tls_data_t *tls_data, const char *cipher_list)
 {
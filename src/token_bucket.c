@@ -0,0 +1,96 @@
+/*
+ *  ircd-hybrid: an advanced, lightweight Internet Relay Chat Daemon (ircd)
+ *
+ *  Copyright (c) 1997-2020 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file token_bucket.c
+ * \brief Token buckets used for flood control.
+ * \version $Id$
+ *
+ * Parse flood, message flood towards clients and channels, join flood
+ * and KNOCK/INVITE pacing are all limited by token buckets. A bucket is
+ * only looked at when the action it limits is attempted, so there's no
+ * work to do for idle clients and channels.
+ *
+ * A bucket with room for size tokens that gains one every interval
+ * milliseconds is empty as long as it won't be full for another
+ * size * interval milliseconds. Taking a token pushes the time it will
+ * be full again interval milliseconds further out.
+ */
+
+#include "stdinc.h"
+#include "event.h"
+#include "misc.h"
+#include "token_bucket.h"
+
+
+/*! \brief Takes a token from a bucket if it has one
+ * \param bucket   Pointer to bucket
+ * \param size     Most tokens the bucket holds
+ * \param interval Milliseconds it takes the bucket to gain a token
+ * \return true if a token has been taken, false if the bucket is empty
+ */
+bool
+token_bucket_take(struct TokenBucket *bucket, unsigned int size, uintmax_t interval)
+{
+  const uintmax_t now = event_base->time.msec_monotonic;
+  const uintmax_t full = IRCD_MAX(bucket->full, now) + interval;
+
+  if (full > now + size * interval)
+    return false;
+
+  bucket->full = full;
+  return true;
+}
+
+/*! \brief Checks whether a bucket has all of its tokens
+ * \param bucket Pointer to bucket
+ * \return true if no token has been taken that hasn't been made up for
+ */
+bool
+token_bucket_is_full(const struct TokenBucket *bucket)
+{
+  return bucket->full <= event_base->time.msec_monotonic;
+}
+
+/*! \brief Works out how long it takes a bucket to gain a token
+ * \param bucket   Pointer to bucket
+ * \param size     Most tokens the bucket holds
+ * \param interval Milliseconds it takes the bucket to gain a token
+ * \return Milliseconds until token_bucket_take() can succeed; 0 if it can now
+ */
+uintmax_t
+token_bucket_wait(const struct TokenBucket *bucket, unsigned int size, uintmax_t interval)
+{
+  const uintmax_t now = event_base->time.msec_monotonic;
+  const uintmax_t full = IRCD_MAX(bucket->full, now) + interval;
+
+  if (full > now + size * interval)
+    return full - now - size * interval;
+  return 0;
+}
+
+/*! \brief Gives a bucket all of its tokens back
+ * \param bucket Pointer to bucket
+ */
+void
+token_bucket_fill(struct TokenBucket *bucket)
+{
+  bucket->full = 0;
+}
@@ -30,11 +30,13 @@
 #include "channel.h"
 #include "channel_mode.h"
 #include "client.h"
+#include "client_index.h"
 #include "hash.h"
 #include "id.h"
 #include "irc_string.h"
 #include "ircd.h"
 #include "listener.h"
+#include "auth.h"
 #include "motd.h"
 #include "numeric.h"
 #include "conf.h"
@@ -54,6 +56,7 @@
 #include "server_capab.h" /* TBR: RHOST compatibility mode */
 
 static char umode_buffer[UMODE_MAX_STR];
+static uintmax_t global_client_serial;  /* Last Client::global_serial handed out */
 
 const struct user_modes *umode_map[256];
 const struct user_modes  umode_tab[] =
@@ -277,6 +280,21 @@ user_welcome(struct Client *client)
   motd_signon(client);
 }
 
+/* user_set_lengths()
+ *
+ * inputs       - client pointer to client being registered
+ * output       - NONE
+ * side effects - caches the lengths of name, username and host. From
+ *                here on, whatever changes one of them updates its length.
+ */
+static void
+user_set_lengths(struct Client *client)
+{
+  client->name_len = strlen(client->name);
+  client->username_len = strlen(client->username);
+  client->host_len = strlen(client->host);
+}
+
 /*! \brief This function is called when both NICK and USER messages
  *      have been accepted for the client, in whatever order. Only
  *      after this, is the UID message propagated.
@@ -397,7 +415,7 @@ register_local_user(struct Client *client)
 
   if (!HasFlag(client, FLAGS_EXEMPTXLINE))
   {
-    const struct GecosItem *gecos = gecos_find(client->info, match);
+    const struct GecosItem *gecos = gecos_match(client->info);
     if (gecos)
     {
       sendto_realops_flags(UMODE_REJ, L_ALL, SEND_NOTICE,
@@ -411,11 +429,7 @@ register_local_user(struct Client *client)
     }
   }
 
-  const char *id;
-  while (hash_find_id((id = uid_get())))
-    ;
-
-  strlcpy(client->id, id, sizeof(client->id));
+  strlcpy(client->id, uid_get(), sizeof(client->id));
   hash_add_id(client);
 
   sendto_realops_flags(UMODE_CCONN, L_ALL, SEND_NOTICE,
@@ -432,12 +446,15 @@ register_local_user(struct Client *client)
   }
 
   SetClient(client);
+  user_set_lengths(client);
 
   client->servptr = &me;
   client->connection->last_privmsg = event_base->time.sec_monotonic;
 
   dlinkAdd(client, &client->lnode, &client->servptr->serv->client_list);
   dlinkAdd(client, &client->node, &global_client_list);
+  client->global_serial = ++global_client_serial;
+  client_index_add(client);
 
   assert(dlinkFind(&unknown_list, client));
 
@@ -463,6 +480,7 @@ register_local_user(struct Client *client)
     Count.max_tot = dlink_list_length(&global_client_list);
   ++Count.totalrestartcount;
 
+  auth_registered(client);
   user_welcome(client);
 
   introduce_client(client);
@@ -491,8 +509,11 @@ register_remote_user(struct Client *client)
     AddFlag(client, FLAGS_SERVICE);
 
   SetClient(client);
+  user_set_lengths(client);
   dlinkAdd(client, &client->lnode, &client->servptr->serv->client_list);
   dlinkAdd(client, &client->node, &global_client_list);
+  client->global_serial = ++global_client_serial;
+  client_index_add(client);
 
   if (dlink_list_length(&global_client_list) > Count.max_tot)
     Count.max_tot = dlink_list_length(&global_client_list);
@@ -700,7 +721,12 @@ user_set_hostmask(struct Client *client, const char *hostname)
                                client->name, client->username,
                                client->host, client->username, hostname);
 
+  client_index_host_del(client);
   strlcpy(client->host, hostname, sizeof(client->host));
+  client->host_len = strlen(client->host);
+
+  if (IsClient(client))
+    client_index_host_add(client);
 
   if (MyConnect(client))
   {